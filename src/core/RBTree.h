@@ -1,6 +1,9 @@
 #ifndef RBTREE_H
 #define RBTREE_H
 
+#include <bit>
+#include <limits>
+#include <type_traits>
 #include "allocator.h"
 #include "comparator.h"
 #include "couple.h"
@@ -19,12 +22,53 @@
 
 namespace original {
 
+    /**
+     * @class noOrderStatistic
+     * @brief Default augmentation policy of RBTree
+     * @details Nodes keep no subtree size. Iterator jumps and distances walk the tree
+     * node by node, and rank/select are not available.
+     */
+    class noOrderStatistic {
+    public:
+        /**
+         * @brief Whether nodes maintain the size of their subtree
+         */
+        static constexpr bool SUBTREE_SIZE = false;
+    };
+
+    /**
+     * @class orderStatistic
+     * @brief Opt-in augmentation policy turning RBTree into an order statistic tree
+     * @details Every node counts the nodes of its subtree. The counts are refreshed by
+     * rotations and along the insertion or removal path, which adds O(log n) work to
+     * each update, and enable:
+     * - select(k) and rank(key) in O(log n)
+     * - Iterator jumps (+=, -=) and iterator distances in O(log n)
+     *
+     * With 32-bit sizes the counter occupies the padding after the node color, so nodes
+     * do not grow; with ORIGINAL_LARGE_SIZE it adds 8 bytes per node. Trees using
+     * noOrderStatistic store no counter at all.
+     *
+     * Select it through the AUGMENT template parameter of treeMap or treeSet:
+     * @code
+     * treeMap<int, int, increaseComparator<int>, allocator<couple<const int, int>>, orderStatistic> map;
+     * @endcode
+     */
+    class orderStatistic {
+    public:
+        /**
+         * @brief Whether nodes maintain the size of their subtree
+         */
+        static constexpr bool SUBTREE_SIZE = true;
+    };
+
     /**
      * @class RBTree
      * @tparam K_TYPE Key type (must be comparable)
      * @tparam V_TYPE Value type
      * @tparam ALLOC Allocator type (default: allocator<K_TYPE>)
      * @tparam Compare Comparison function type (default: increaseComparator<K_TYPE>)
+     * @tparam AUGMENT Node augmentation policy (default: noOrderStatistic)
      * @brief Red-Black Tree container implementation
      * @details This class provides a balanced binary search tree implementation
      * with the following properties:
@@ -36,10 +80,20 @@ namespace original {
     template<typename K_TYPE,
              typename V_TYPE,
              typename ALLOC = allocator<K_TYPE>,
-             typename Compare = increaseComparator<K_TYPE>>
+             typename Compare = increaseComparator<K_TYPE>,
+             typename AUGMENT = noOrderStatistic>
     class RBTree {
     protected:
 
+        /**
+         * @struct noSubtreeSize
+         * @brief Empty stand-in for the subtree size of nodes that do not maintain it
+         */
+        struct noSubtreeSize {};
+
+        /// Storage of the node subtree size, empty unless AUGMENT maintains it
+        using subtreeSizeType = std::conditional_t<AUGMENT::SUBTREE_SIZE, u_integer, noSubtreeSize>;
+
         /**
          * @class RBNode
          * @brief Internal node class for Red-Black Tree
@@ -57,6 +111,7 @@ namespace original {
         private:
             couple<const K_TYPE, V_TYPE> data_;  ///< Key-value pair storage
             color color_;                        ///< Node color
+            [[no_unique_address]] subtreeSizeType subtree_size_;  ///< Nodes in this subtree, stored only under orderStatistic
             RBNode* parent_;                     ///< Parent node pointer
             RBNode* left_;                       ///< Left child pointer
             RBNode* right_;                      ///< Right child pointer
@@ -137,6 +192,19 @@ namespace original {
              */
             color getColor() const;
 
+            /**
+             * @brief Gets the number of nodes in this subtree
+             * @return Subtree size, always 0 unless the tree uses orderStatistic
+             */
+            [[nodiscard]] u_integer getSubtreeSize() const;
+
+            /**
+             * @brief Sets the number of nodes in this subtree
+             * @param size New subtree size
+             * @note No-op unless the tree uses orderStatistic
+             */
+            void setSubtreeSize(u_integer size);
+
             /**
              * @brief Gets parent node
              * @return Pointer to parent node
@@ -210,6 +278,9 @@ namespace original {
         Compare compare_;                           ///< Comparison function
         mutable rebind_alloc_node rebind_alloc{};   ///< Node allocator
 
+        /// Whether nodes maintain subtree sizes (see orderStatistic)
+        static constexpr bool ORDER_STATISTIC = AUGMENT::SUBTREE_SIZE;
+
         /**
          * @class Iterator
          * @brief Bidirectional iterator for RBTree
@@ -260,15 +331,28 @@ namespace original {
             /**
              * @brief Advances iterator by steps
              * @param steps Number of positions to advance
+             * @details O(log n) under orderStatistic, O(steps) otherwise
              */
             void operator+=(integer steps) const;
 
             /**
              * @brief Moves iterator backward by steps
              * @param steps Number of positions to move back
+             * @details O(log n) under orderStatistic, O(steps) otherwise
              */
             void operator-=(integer steps) const;
 
+            /**
+             * @brief Calculates distance between two iterators
+             * @param other Iterator to compare with
+             * @return Number of steps from other to this, an invalid iterator counting
+             * as one past the last element
+             * @throw unSupportedMethodError if the tree does not use orderStatistic
+             * @details O(log n). Iterators of different trees return the maximum or
+             * minimum integer value.
+             */
+            integer operator-(const Iterator& other) const;
+
             /**
              * @brief Gets current element (non-const)
              * @return Reference to current key-value pair
@@ -324,6 +408,53 @@ namespace original {
          */
         RBNode* getMaxNode() const;
 
+        /**
+         * @brief Gets the size of a subtree
+         * @param node Subtree root, may be nullptr
+         * @return Number of nodes in the subtree, 0 for nullptr
+         * @note Only meaningful under orderStatistic
+         */
+        static u_integer subtreeSize(const RBNode* node);
+
+        /**
+         * @brief Recomputes a node's subtree size from its children
+         * @param node Node to update
+         * @details No-op unless the tree uses orderStatistic
+         */
+        static void updateSubtreeSize(RBNode* node);
+
+        /**
+         * @brief Adds a delta to the subtree sizes of a node and all its ancestors
+         * @param node First node to update, may be nullptr
+         * @param delta Value to add
+         * @details No-op unless the tree uses orderStatistic
+         */
+        static void adjustSubtreeSizes(RBNode* node, integer delta);
+
+        /**
+         * @brief Finds the node at an in-order position
+         * @param index Zero-based position
+         * @return Pointer to the node, or nullptr if index is not less than the size
+         * @note Requires orderStatistic, O(log n)
+         */
+        RBNode* selectNode(u_integer index) const;
+
+        /**
+         * @brief Counts the keys less than a key
+         * @param key Key to rank, need not be present
+         * @return Number of keys less than key
+         * @note Requires orderStatistic, O(log n)
+         */
+        u_integer rankOf(const K_TYPE& key) const;
+
+        /**
+         * @brief Gets the in-order position of a node
+         * @param node Node in this tree
+         * @return Zero-based position
+         * @note Requires orderStatistic, O(log n)
+         */
+        u_integer indexOf(const RBNode* node) const;
+
         /**
          * @brief Replaces one node with another while maintaining tree structure
          * @param src Source node to replace with
@@ -411,6 +542,34 @@ namespace original {
          */
         void adjustErase(RBNode* cur);
 
+        /**
+         * @brief Links sorted nodes into a balanced subtree
+         * @tparam SOURCE Callable returning the next RBNode*
+         * @param count Number of nodes in the subtree
+         * @param depth Depth of the subtree root
+         * @param red_depth Depth of the deepest level, whose nodes are colored red
+         * @param source Node source, called count times in key order
+         * @return Root of the new subtree, nullptr if count is 0
+         * @details Sets the color, subtree size and child links of every node, and the parent
+         * link of every node but the returned root. Source may reuse the left link of the
+         * nodes it already returned.
+         */
+        template<typename SOURCE>
+        RBNode* buildBalanced(u_integer count, u_integer depth, u_integer red_depth, SOURCE& source) const;
+
+        /**
+         * @brief Replaces the tree with a balanced tree built from sorted input
+         * @tparam SOURCE Callable returning the next couple<const K_TYPE, V_TYPE>
+         * @param count Number of elements source yields
+         * @param source Element source, called count times, yielding strictly increasing keys
+         * @details O(count) with no comparison and no rotation. Splitting every subtree at
+         * its middle element fills all levels but the deepest one, so coloring that level
+         * red and every other node black satisfies the red-black rules. The old tree is
+         * destroyed only after the new one is built, so source may read from it.
+         */
+        template<typename SOURCE>
+        void rebuildSorted(u_integer count, SOURCE&& source);
+
         /**
          * @brief Destroys entire tree and deallocates all nodes
          * @details Uses breadth-first traversal to destroy all nodes
@@ -431,6 +590,34 @@ namespace original {
          */
         RBNode* find(const K_TYPE& key) const;
 
+        /**
+         * @brief Finds the first node whose key is not less than a key
+         * @param key Key to search for
+         * @return Pointer to the node, or nullptr if every key is less than key
+         */
+        RBNode* ceilingNode(const K_TYPE& key) const;
+
+        /**
+         * @brief Finds the first node whose key is greater than a key
+         * @param key Key to search for
+         * @return Pointer to the node, or nullptr if no key is greater than key
+         */
+        RBNode* higherNode(const K_TYPE& key) const;
+
+        /**
+         * @brief Finds the last node whose key is not greater than a key
+         * @param key Key to search for
+         * @return Pointer to the node, or nullptr if every key is greater than key
+         */
+        RBNode* floorNode(const K_TYPE& key) const;
+
+        /**
+         * @brief Finds the last node whose key is less than a key
+         * @param key Key to search for
+         * @return Pointer to the node, or nullptr if no key is less than key
+         */
+        RBNode* lowerNode(const K_TYPE& key) const;
+
         /**
          * @brief Modifies value for existing key
          * @param key Key to modify
@@ -456,6 +643,26 @@ namespace original {
          */
         bool erase(const K_TYPE& key);
 
+        /**
+         * @brief Erases all nodes with keys in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return Number of erased nodes
+         * @details O(m log n) for m erased nodes
+         */
+        u_integer eraseRange(const K_TYPE& low, const K_TYPE& high);
+
+        /**
+         * @brief Inserts the nodes of another tree whose keys are absent
+         * @param other Tree to merge from, left unchanged
+         * @details Existing values win on equal keys. Threads the nodes of this tree into a
+         * sorted list, splices in copies of the absent nodes of other in one merged walk,
+         * then relinks the list into a balanced tree, O(n + m) and without reallocating
+         * the nodes already present. Both walks touch every node, so when other is the
+         * smaller tree its m nodes are inserted one by one instead, O(m log n).
+         */
+        void mergeFrom(const RBTree& other);
+
         /**
          * @brief Destructor
          * @details Cleans up all tree nodes and allocated memory
@@ -465,139 +672,158 @@ namespace original {
 
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::RBNode(const K_TYPE &key, const V_TYPE &value,
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::RBNode(const K_TYPE &key, const V_TYPE &value,
                                                                  const color color, RBNode *parent, RBNode *left, RBNode *right)
-                                                                 : data_({key, value}), color_(color), parent_(parent), left_(left), right_(right) {}
+                                                                 : data_({key, value}), color_(color), subtree_size_(), parent_(parent), left_(left), right_(right) {
+    this->setSubtreeSize(1);
+}
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::RBNode(const RBNode &other) : RBNode() {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::RBNode(const RBNode &other) : RBNode() {
     this->operator=(other);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode&
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::operator=(const RBNode &other) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode&
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::operator=(const RBNode &other) {
     if (this == &other)
         return *this;
 
     this->data_ = other.data_;
     this->color_ = other.color_;
+    this->subtree_size_ = other.subtree_size_;
     this->parent_ = other.parent_;
     this->left_ = other.left_;
     this->right_ = other.right_;
     return *this;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::RBNode(RBNode&& other) noexcept
-    : data_(std::move(other.data_)), color_(other.color_), parent_(nullptr), left_(nullptr), right_(nullptr) {}
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::RBNode(RBNode&& other) noexcept
+    : data_(std::move(other.data_)), color_(other.color_), subtree_size_(other.subtree_size_), parent_(nullptr), left_(nullptr), right_(nullptr) {}
 
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::swapData(RBNode &other) noexcept {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::swapData(RBNode &other) noexcept {
     std::swap(this->data_, other.data_);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::swapColor(RBNode &other) noexcept {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::swapColor(RBNode &other) noexcept {
     std::swap(this->color_, other.color_);
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
 original::couple<const K_TYPE, V_TYPE>&
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getVal()
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getVal()
 {
     return this->data_;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
 const original::couple<const K_TYPE, V_TYPE>&
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getVal() const
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getVal() const
 {
     return this->data_;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-const K_TYPE &original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getKey() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+const K_TYPE &original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getKey() const {
     return this->data_.first();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-const V_TYPE &original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getValue() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+const V_TYPE &original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getValue() const {
     return this->data_.second();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-V_TYPE &original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getValue() {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+V_TYPE &original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getValue() {
     return this->data_.second();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::setValue(const V_TYPE &value) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::setValue(const V_TYPE &value) {
     this->data_.template set<1>(value);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::color
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getColor() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::color
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getColor() const {
     return this->color_;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getPParent() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::u_integer original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getSubtreeSize() const {
+    if constexpr (AUGMENT::SUBTREE_SIZE) {
+        return this->subtree_size_;
+    } else {
+        return 0;
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::setSubtreeSize([[maybe_unused]] const u_integer size) {
+    if constexpr (AUGMENT::SUBTREE_SIZE) {
+        this->subtree_size_ = size;
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getPParent() const {
     return this->parent_;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getPLeft() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getPLeft() const {
     return this->left_;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getPRight() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getPRight() const {
     return this->right_;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*&
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getPLeftRef()
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*&
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getPLeftRef()
 {
     return this->left_;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*&
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::getPRightRef()
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*&
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::getPRightRef()
 {
     return this->right_;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::setColor(color new_color) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::setColor(color new_color) {
     this->color_ = new_color;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::setPParent(RBNode* new_parent) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::setPParent(RBNode* new_parent) {
     this->parent_ = new_parent;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::setPLeft(RBNode* new_left) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::setPLeft(RBNode* new_left) {
     this->left_ = new_left;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::setPRight(RBNode* new_right) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::setPRight(RBNode* new_right) {
     this->right_ = new_right;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::connect(RBNode* parent,
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode::connect(RBNode* parent,
                                                                        RBNode* child, bool is_left) {
     if (parent){
         is_left ? parent->left_ = child : parent->right_ = child;
@@ -607,18 +833,18 @@ void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode::connect(RBNode* p
     }
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::Iterator(RBTree* tree, RBNode* cur)
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::Iterator(RBTree* tree, RBNode* cur)
     : tree_(tree), cur_(cur) {}
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::Iterator(const Iterator& other) : Iterator() {
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::Iterator(const Iterator& other) : Iterator() {
     this->operator=(other);
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator&
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::operator=(const Iterator& other)
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator&
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::operator=(const Iterator& other)
 {
     if (this == &other)
         return *this;
@@ -628,34 +854,41 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::operator=(const Iter
     return *this;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::hasNext() const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::hasNext() const
 {
     return this->cur_ && this->tree_->getSuccessorNode(this->cur_);
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::hasPrev() const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::hasPrev() const
 {
     return this->cur_ && this->tree_->getPrecursorNode(this->cur_);
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::next() const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::next() const
 {
     this->cur_ = this->tree_->getSuccessorNode(this->cur_);
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::prev() const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::prev() const
 {
     this->cur_ = this->tree_->getPrecursorNode(this->cur_);
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::operator+=(const integer steps) const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::operator+=(const integer steps) const
 {
-    if (steps < 0){
+    if constexpr (ORDER_STATISTIC) {
+        if (!this->cur_) {
+            return;
+        }
+        const integer target = static_cast<integer>(this->tree_->indexOf(this->cur_)) + steps;
+        this->cur_ = target < 0 || target >= static_cast<integer>(this->tree_->size_) ?
+                     nullptr : this->tree_->selectNode(static_cast<u_integer>(target));
+    } else if (steps < 0){
         this->operator-=(-steps);
     } else {
         for (integer i = 0; i < steps; ++i) {
@@ -664,10 +897,12 @@ void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::operator+=(cons
     }
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::operator-=(integer steps) const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::operator-=(integer steps) const
 {
-    if (steps < 0){
+    if constexpr (ORDER_STATISTIC) {
+        this->operator+=(-steps);
+    } else if (steps < 0){
         this->operator+=(-steps);
     } else {
         for (integer i = 0; i < steps; ++i) {
@@ -676,8 +911,28 @@ void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::operator-=(inte
     }
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-original::couple<const K_TYPE, V_TYPE>& original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::get()
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::integer
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::operator-(const Iterator& other) const
+{
+    if constexpr (!ORDER_STATISTIC) {
+        throw unSupportedMethodError();
+    } else {
+        if (this->tree_ != other.tree_) {
+            return this->tree_ > other.tree_ ?
+                   std::numeric_limits<integer>::max() :
+                   std::numeric_limits<integer>::min();
+        }
+
+        const auto position = [this](const RBNode* node) {
+            return static_cast<integer>(node ? this->tree_->indexOf(node) : this->tree_->size_);
+        };
+        return position(this->cur_) - position(other.cur_);
+    }
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::couple<const K_TYPE, V_TYPE>& original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::get()
 {
     if (!this->isValid()) {
         throw outOfBoundError();
@@ -686,8 +941,8 @@ original::couple<const K_TYPE, V_TYPE>& original::RBTree<K_TYPE, V_TYPE, ALLOC,
     return this->cur_->getVal();
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-original::couple<const K_TYPE, V_TYPE> original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::get() const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::couple<const K_TYPE, V_TYPE> original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::get() const
 {
     if (!this->isValid()) {
         throw outOfBoundError();
@@ -696,22 +951,23 @@ original::couple<const K_TYPE, V_TYPE> original::RBTree<K_TYPE, V_TYPE, ALLOC, C
     return this->cur_->getVal();
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::isValid() const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::Iterator::isValid() const
 {
     return this->cur_;
 }
 
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::treeCopy() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::treeCopy() const {
     if (!this->root_) {
         return nullptr;
     }
 
     RBNode* copied_root =
     this->createNode(this->root_->getKey(), this->root_->getValue(), this->root_->getColor());
+    copied_root->setSubtreeSize(this->root_->getSubtreeSize());
     queue<RBNode*> src = {this->root_};
     queue<RBNode*> tar = {copied_root};
     while (!src.empty()){
@@ -722,6 +978,7 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::treeCopy() const {
         if (src_cur->getPLeft()){
             src_child = src_cur->getPLeft();
             tar_child = this->createNode(src_child->getKey(), src_child->getValue(), src_child->getColor());
+            tar_child->setSubtreeSize(src_child->getSubtreeSize());
             RBNode::connect(tar_cur, tar_child, true);
             src.push(src_child);
             tar.push(tar_child);
@@ -729,6 +986,7 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::treeCopy() const {
         if (src_cur->getPRight()){
             src_child = src_cur->getPRight();
             tar_child = this->createNode(src_child->getKey(), src_child->getValue(), src_child->getColor());
+            tar_child->setSubtreeSize(src_child->getSubtreeSize());
             RBNode::connect(tar_cur, tar_child, false);
             src.push(src_child);
             tar.push(tar_child);
@@ -739,9 +997,9 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::treeCopy() const {
     return copied_root;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::getPrecursorNode(RBNode *cur) const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::getPrecursorNode(RBNode *cur) const {
     if (!cur)
         return nullptr;
 
@@ -761,9 +1019,9 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::getPrecursorNode(RBNode *cur)
     return parent;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::getSuccessorNode(RBNode *cur) const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::getSuccessorNode(RBNode *cur) const {
     if (!cur)
         return nullptr;
 
@@ -783,9 +1041,9 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::getSuccessorNode(RBNode *cur)
     return parent;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::getMinNode() const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::getMinNode() const
 {
     if (!root_) return nullptr;
 
@@ -796,9 +1054,9 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::getMinNode() const
     return node;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::getMaxNode() const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::getMaxNode() const
 {
     if (!this->root_) {
         return nullptr;
@@ -811,12 +1069,87 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::getMaxNode() const
     return cur;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::replaceNode(RBNode* src, RBNode* tar)
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::u_integer
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::subtreeSize(const RBNode* node)
+{
+    return node ? node->getSubtreeSize() : 0;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::updateSubtreeSize(RBNode* node)
+{
+    if constexpr (ORDER_STATISTIC) {
+        node->setSubtreeSize(subtreeSize(node->getPLeft()) + subtreeSize(node->getPRight()) + 1);
+    }
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::adjustSubtreeSizes(RBNode* node, const integer delta)
+{
+    if constexpr (ORDER_STATISTIC) {
+        for (; node; node = node->getPParent()) {
+            node->setSubtreeSize(static_cast<u_integer>(static_cast<integer>(node->getSubtreeSize()) + delta));
+        }
+    }
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::selectNode(u_integer index) const
+{
+    auto cur = this->root_;
+    while (cur) {
+        const u_integer left_size = subtreeSize(cur->getPLeft());
+        if (index < left_size) {
+            cur = cur->getPLeft();
+        } else if (index == left_size) {
+            return cur;
+        } else {
+            index -= left_size + 1;
+            cur = cur->getPRight();
+        }
+    }
+    return nullptr;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::u_integer
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::rankOf(const K_TYPE& key) const
+{
+    u_integer rank = 0;
+    auto cur = this->root_;
+    while (cur) {
+        if (this->compare_(cur->getKey(), key)) {
+            rank += subtreeSize(cur->getPLeft()) + 1;
+            cur = cur->getPRight();
+        } else {
+            cur = cur->getPLeft();
+        }
+    }
+    return rank;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::u_integer
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::indexOf(const RBNode* node) const
+{
+    u_integer index = subtreeSize(node->getPLeft());
+    for (auto parent = node->getPParent(); parent; node = parent, parent = parent->getPParent()) {
+        if (parent->getPRight() == node) {
+            index += subtreeSize(parent->getPLeft()) + 1;
+        }
+    }
+    return index;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::replaceNode(RBNode* src, RBNode* tar)
 {
     auto moved_src = this->createNode(std::move(*src));
     moved_src->setColor(tar->getColor());
+    moved_src->setSubtreeSize(tar->getSubtreeSize());
     if (RBNode* tar_parent = tar->getPParent()) {
         RBNode::connect(tar_parent, moved_src, tar_parent->getPLeft() == tar);
     } else {
@@ -828,9 +1161,9 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::replaceNode(RBNode* src, RBNod
     return src;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::createNode(const K_TYPE &key, const V_TYPE &value,
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::createNode(const K_TYPE &key, const V_TYPE &value,
                                                              color color, RBNode* parent,
                                                              RBNode* left, RBNode* right) const {
     auto node = this->rebind_alloc.allocate(1);
@@ -838,40 +1171,40 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::createNode(const K_TYPE &key,
     return node;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::createNode(RBNode&& other_node) const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::createNode(RBNode&& other_node) const
 {
     auto node = this->rebind_alloc.allocate(1);
     this->rebind_alloc.construct(node, std::move(other_node));
     return node;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::destroyNode(RBNode* node) noexcept {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::destroyNode(RBNode* node) noexcept {
     this->rebind_alloc.destroy(node);
     this->rebind_alloc.deallocate(node, 1);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::highPriority(RBNode *cur, RBNode *other) const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::highPriority(RBNode *cur, RBNode *other) const {
     if (!cur){
         return false;
     }
     return this->highPriority(cur->getKey(), other);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::highPriority(const K_TYPE& key, RBNode* other) const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::highPriority(const K_TYPE& key, RBNode* other) const {
     if (!other){
         return true;
     }
     return this->compare_(key, other->getKey());
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::rotateLeft(RBNode *cur) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::rotateLeft(RBNode *cur) {
     RBNode* child_left = cur;
     RBNode* child_root = child_left->getPRight();
     RBNode* child_left_child = child_root->getPLeft();
@@ -880,12 +1213,14 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::rotateLeft(RBNode *cur) {
     RBNode::connect(child_root, child_left, true);
     RBNode::connect(child_left, child_left_child, false);
     RBNode::connect(child_root, child_right, false);
+    updateSubtreeSize(child_left);
+    updateSubtreeSize(child_root);
     return child_root;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::rotateRight(RBNode *cur) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::rotateRight(RBNode *cur) {
     RBNode* child_right = cur;
     RBNode* child_root = cur->getPLeft();
     RBNode* child_right_child = child_root->getPRight();
@@ -894,11 +1229,13 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::rotateRight(RBNode *cur) {
     RBNode::connect(child_root, child_left, true);
     RBNode::connect(child_right, child_right_child, true);
     RBNode::connect(child_root, child_right, false);
+    updateSubtreeSize(child_right);
+    updateSubtreeSize(child_root);
     return child_root;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::adjustInsert(RBNode *cur) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::adjustInsert(RBNode *cur) {
     while (cur != this->root_ && cur->getPParent()->getColor() == RED) {
         RBNode* parent = cur->getPParent();
         RBNode* grand_parent = parent->getPParent();
@@ -956,8 +1293,8 @@ void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::adjustInsert(RBNode *cur)
     this->root_->setColor(BLACK);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::adjustErase(RBNode *cur) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::adjustErase(RBNode *cur) {
     while (cur != this->root_ && cur->getColor() == BLACK) {
         RBNode* parent = cur->getPParent();
         RBNode* brother;
@@ -998,7 +1335,7 @@ void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::adjustErase(RBNode *cur)
                     nephew = brother->getPLeft();
                     nephew->setColor(parent->getColor());
                     parent->setColor(BLACK);
-                    RBNode::connect(parent, this->rotateRight(brother), true);
+                    RBNode::connect(parent, this->rotateRight(brother), false);
                     grand_parent = parent->getPParent();
                     if (grand_parent) {
                         bool is_left = grand_parent->getPLeft() == parent;
@@ -1092,8 +1429,41 @@ void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::adjustErase(RBNode *cur)
     cur->setColor(BLACK);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::destroyTree() noexcept {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+template<typename SOURCE>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::buildBalanced(const u_integer count, const u_integer depth,
+                                                              const u_integer red_depth, SOURCE& source) const {
+    if (count == 0) {
+        return nullptr;
+    }
+
+    const u_integer left_count = (count - 1) / 2;
+    RBNode* left = this->buildBalanced(left_count, depth + 1, red_depth, source);
+    RBNode* node = source();
+    node->setColor(depth == red_depth && depth > 0 ? RED : BLACK);
+    node->setSubtreeSize(count);
+    RBNode::connect(node, left, true);
+    RBNode::connect(node, this->buildBalanced(count - 1 - left_count, depth + 1, red_depth, source), false);
+    return node;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+template<typename SOURCE>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::rebuildSorted(const u_integer count, SOURCE&& source) {
+    const u_integer red_depth = count > 0 ? static_cast<u_integer>(std::bit_width(count)) - 1 : 0;
+    auto next_node = [this, &source] {
+        const auto elem = source();
+        return this->createNode(elem.first(), elem.second());
+    };
+    RBNode* root = this->buildBalanced(count, 0, red_depth, next_node);
+    this->destroyTree();
+    this->root_ = root;
+    this->size_ = count;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::destroyTree() noexcept {
     if (!this->root_) {
         return;
     }
@@ -1112,13 +1482,13 @@ void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::destroyTree() noexcept {
     this->root_ = nullptr;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBTree(Compare compare)
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBTree(Compare compare)
     : root_(nullptr), size_(0), compare_(std::move(compare)) {}
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::RBNode*
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::find(const K_TYPE &key) const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::find(const K_TYPE &key) const {
     auto cur = this->root_;
     while (cur){
         if (cur->getKey() == key){
@@ -1129,8 +1499,72 @@ original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::find(const K_TYPE &key) const
     return cur;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::modify(const K_TYPE &key, const V_TYPE &value) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::ceilingNode(const K_TYPE& key) const {
+    RBNode* found = nullptr;
+    auto cur = this->root_;
+    while (cur) {
+        if (this->compare_(cur->getKey(), key)) {
+            cur = cur->getPRight();
+        } else {
+            found = cur;
+            cur = cur->getPLeft();
+        }
+    }
+    return found;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::higherNode(const K_TYPE& key) const {
+    RBNode* found = nullptr;
+    auto cur = this->root_;
+    while (cur) {
+        if (this->compare_(key, cur->getKey())) {
+            found = cur;
+            cur = cur->getPLeft();
+        } else {
+            cur = cur->getPRight();
+        }
+    }
+    return found;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::floorNode(const K_TYPE& key) const {
+    RBNode* found = nullptr;
+    auto cur = this->root_;
+    while (cur) {
+        if (this->compare_(key, cur->getKey())) {
+            cur = cur->getPLeft();
+        } else {
+            found = cur;
+            cur = cur->getPRight();
+        }
+    }
+    return found;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+typename original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::RBNode*
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::lowerNode(const K_TYPE& key) const {
+    RBNode* found = nullptr;
+    auto cur = this->root_;
+    while (cur) {
+        if (this->compare_(cur->getKey(), key)) {
+            found = cur;
+            cur = cur->getPRight();
+        } else {
+            cur = cur->getPLeft();
+        }
+    }
+    return found;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::modify(const K_TYPE &key, const V_TYPE &value) {
     if (auto cur = this->find(key)){
         cur->setValue(value);
         return true;
@@ -1138,8 +1572,8 @@ bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::modify(const K_TYPE &key,
     return false;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::insert(const K_TYPE &key, const V_TYPE &value) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::insert(const K_TYPE &key, const V_TYPE &value) {
     auto** cur = &this->root_;
     RBNode* parent = nullptr;
     bool is_left = false;
@@ -1158,6 +1592,7 @@ bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::insert(const K_TYPE &key,
         this->root_ = child;
     } else {
         RBNode::connect(parent, child, is_left);
+        adjustSubtreeSizes(parent, 1);
     }
 
     this->size_ += 1;
@@ -1165,8 +1600,8 @@ bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::insert(const K_TYPE &key,
     return true;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::erase(const K_TYPE &key) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::erase(const K_TYPE &key) {
     if (!this->root_) {
         return false;
     }
@@ -1182,6 +1617,10 @@ bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::erase(const K_TYPE &key)
         cur = this->replaceNode(replace, cur);
     }
 
+    // The removed node stops counting before any fix-up rotation recomputes sizes
+    adjustSubtreeSizes(cur->getPParent(), -1);
+    cur->setSubtreeSize(0);
+
     RBNode* parent = cur->getPParent();
     if (cur->getPLeft() && !cur->getPRight()) {
         if (!parent) {
@@ -1210,8 +1649,6 @@ bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::erase(const K_TYPE &key)
             this->root_ = nullptr;
         } else if (cur->getColor() == BLACK) {
             this->adjustErase(cur);
-        } else {
-            RBNode::connect(nullptr, cur, true);
         }
     }
 
@@ -1223,8 +1660,77 @@ bool original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::erase(const K_TYPE &key)
     return true;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
-original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare>::~RBTree() {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::u_integer
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::eraseRange(const K_TYPE& low, const K_TYPE& high) {
+    u_integer erased = 0;
+    for (auto cur = this->ceilingNode(low); cur && this->compare_(cur->getKey(), high); cur = this->ceilingNode(low)) {
+        const K_TYPE key = cur->getKey();
+        this->erase(key);
+        erased += 1;
+    }
+    return erased;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+void original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::mergeFrom(const RBTree& other) {
+    if (this == &other || other.size_ == 0) {
+        return;
+    }
+
+    if (other.size_ < this->size_) {
+        for (auto node = other.getMinNode(); node; node = other.getSuccessorNode(node)) {
+            this->insert(node->getKey(), node->getValue());
+        }
+        return;
+    }
+
+    // A successor walk never reads the left link of a visited node, so the nodes
+    // of this tree are threaded through it while copies of the absent nodes of
+    // other are spliced in, in the same merged walk
+    RBNode* list = nullptr;
+    RBNode* tail = nullptr;
+    u_integer count = 0;
+    auto append = [&list, &tail, &count](RBNode* node) {
+        if (tail) {
+            tail->setPLeft(node);
+        } else {
+            list = node;
+        }
+        tail = node;
+        count += 1;
+    };
+
+    RBNode* cur = this->getMinNode();
+    for (auto node = other.getMinNode(); node; node = other.getSuccessorNode(node)) {
+        while (cur && this->compare_(cur->getKey(), node->getKey())) {
+            RBNode* next = this->getSuccessorNode(cur);
+            append(cur);
+            cur = next;
+        }
+        if (!cur || this->compare_(node->getKey(), cur->getKey())) {
+            append(this->createNode(node->getKey(), node->getValue()));
+        }
+    }
+    while (cur) {
+        RBNode* next = this->getSuccessorNode(cur);
+        append(cur);
+        cur = next;
+    }
+
+    const u_integer red_depth = static_cast<u_integer>(std::bit_width(count)) - 1;
+    auto next_node = [&list] {
+        RBNode* node = list;
+        list = list->getPLeft();
+        return node;
+    };
+    this->root_ = this->buildBalanced(count, 0, red_depth, next_node);
+    this->root_->setPParent(nullptr);
+    this->size_ = count;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare, typename AUGMENT>
+original::RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>::~RBTree() {
     this->destroyTree();
 }
 
@@ -3,6 +3,9 @@
 
 #include <functional>
 #include <cmath>
+#include <new>
+#include <utility>
+#include "allocator.h"
 #include "vector.h"
 #include "filter.h"
 #include "iterator.h"
@@ -479,6 +482,76 @@ namespace original
         requires Compare<Callback, TYPE>
         static void insertionSort(const iterator<TYPE> &begin, const iterator<TYPE> &end,
                                   const Callback& compares);
+
+        // ---- Contiguous container overloads ----
+
+        /**
+         * @brief Sorts a whole contiguous container
+         * @tparam CONTAINER Contiguous container type (`vector`, `array`)
+         * @tparam Callback Comparison callback type
+         * @param container Container to sort
+         * @param compares Comparison callback to define the order
+         * @param is_stable If true, uses @ref stableSort(), otherwise @ref introSort()
+         * @details Dispatched at compile time to raw-pointer kernels: no iterator is
+         *          cloned and no virtual call is made per element.
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires Compare<Callback, contiguousElemType<CONTAINER>>
+        static void sort(CONTAINER& container, const Callback& compares, bool is_stable = false);
+
+        /**
+         * @brief Sorts a whole contiguous container using introspective sort
+         * @see introSort(const iterator<TYPE>&, const iterator<TYPE>&, const Callback&)
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires Compare<Callback, contiguousElemType<CONTAINER>>
+        static void introSort(CONTAINER& container, const Callback& compares);
+
+        /**
+         * @brief Stably sorts a whole contiguous container
+         * @details Allocates one merge buffer of half the container size.
+         * @see stableSort(const iterator<TYPE>&, const iterator<TYPE>&, const Callback&)
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires Compare<Callback, contiguousElemType<CONTAINER>>
+        static void stableSort(CONTAINER& container, const Callback& compares);
+
+        /**
+         * @brief Sorts a whole contiguous container using heap sort
+         * @see heapSort(const iterator<TYPE>&, const iterator<TYPE>&, const Callback&)
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires Compare<Callback, contiguousElemType<CONTAINER>>
+        static void heapSort(CONTAINER& container, const Callback& compares);
+
+        /**
+         * @brief Sorts a whole contiguous container using insertion sort
+         * @see insertionSort(const iterator<TYPE>&, const iterator<TYPE>&, const Callback&)
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires Compare<Callback, contiguousElemType<CONTAINER>>
+        static void insertionSort(CONTAINER& container, const Callback& compares);
+
+        // ---- Raw contiguous range overloads ----
+
+        /**
+         * @brief Sorts the elements in [first, last) using introspective sort
+         * @details For callers that already hold pointers into contiguous storage,
+         *          such as the chunks of parallel::sort.
+         * @see introSort(const iterator<TYPE>&, const iterator<TYPE>&, const Callback&)
+         */
+        template<typename TYPE, typename Callback>
+        requires Compare<Callback, TYPE>
+        static void introSort(TYPE* first, TYPE* last, const Callback& compares);
+
+        /**
+         * @brief Stably sorts the elements in [first, last)
+         * @details Allocates one merge buffer of half the range size.
+         * @see stableSort(const iterator<TYPE>&, const iterator<TYPE>&, const Callback&)
+         */
+        template<typename TYPE, typename Callback>
+        requires Compare<Callback, TYPE>
+        static void stableSort(TYPE* first, TYPE* last, const Callback& compares);
     protected:
         /**
         * @brief Get parent node's priority child in heap structure
@@ -583,6 +656,80 @@ namespace original
         static void _stableSort(const iterator<TYPE>& begin, const iterator<TYPE>& end,
                                 const Callback& compares);
 
+        // ---- Raw-pointer kernels over half-open ranges [first, last) ----
+
+        /**
+         * @brief Resolves an inclusive iterator range to contiguous memory
+         * @tparam TYPE Element type
+         * @param begin Start iterator of the range
+         * @param end End iterator of the range (inclusive)
+         * @param first Set to the address of the first element
+         * @param last Set to one past the address of the last element
+         * @return True if both iterators walk the same contiguous block with end not before begin
+         * @note Used by the iterator entry points to select the kernels below at runtime
+         */
+        template<typename TYPE>
+        static bool _contiguousRange(const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                     TYPE*& first, TYPE*& last);
+
+        /**
+         * @brief Insertion sort kernel, shifting elements instead of swapping
+         */
+        template<typename TYPE, typename Callback>
+        requires Compare<Callback, TYPE>
+        static void _insertionSortKernel(TYPE* first, TYPE* last, const Callback& compares);
+
+        /**
+         * @brief Moves the element at hole down a heap of len elements rooted at first
+         */
+        template<typename TYPE, typename Callback>
+        requires Compare<Callback, TYPE>
+        static void _heapSiftDownKernel(TYPE* first, integer hole, integer len, const Callback& compares);
+
+        /**
+         * @brief Heap sort kernel
+         */
+        template<typename TYPE, typename Callback>
+        requires Compare<Callback, TYPE>
+        static void _heapSortKernel(TYPE* first, TYPE* last, const Callback& compares);
+
+        /**
+         * @brief Partitions around the median of three, moved to *first as pivot
+         * @return Start of the right part; every element before it orders no later
+         *         than the pivot and every element from it on no earlier
+         * @details The median-of-three placement guarantees sentinels on both sides,
+         *          so the scanning loops need no bound checks.
+         */
+        template<typename TYPE, typename Callback>
+        requires Compare<Callback, TYPE>
+        static TYPE* _introSortPartitionKernel(TYPE* first, TYPE* last, const Callback& compares);
+
+        /**
+         * @brief Introspective sort kernel
+         * @details Loops on the left part and recurses on the right one; falls back to
+         *          heap sort when depth_limit is exhausted and to insertion sort for
+         *          ranges of at most 16 elements.
+         */
+        template<typename TYPE, typename Callback>
+        requires Compare<Callback, TYPE>
+        static void _introSortKernel(TYPE* first, TYPE* last, const Callback& compares, u_integer depth_limit);
+
+        /**
+         * @brief Stable sort kernel, allocating one buffer for the whole sort
+         */
+        template<typename TYPE, typename Callback>
+        requires Compare<Callback, TYPE>
+        static void _stableSortKernel(TYPE* first, TYPE* last, const Callback& compares);
+
+        /**
+         * @brief Recursive stable merge sort using raw storage of (last - first) / 2 elements
+         * @details Only the left half is moved into buffer before merging back in
+         *          place; ties are taken from the left half to keep the order stable.
+         */
+        template<typename TYPE, typename Callback>
+        requires Compare<Callback, TYPE>
+        static void _stableSortKernel(TYPE* first, TYPE* last, TYPE* buffer, const Callback& compares);
+
     // ---- Implementation of pointer overload version ----
 
     public:
@@ -960,6 +1107,14 @@ namespace original
         const TYPE& target) -> u_integer
     {
         u_integer cnt = 0;
+        if (TYPE *first, *last; _contiguousRange(begin, end, first, last)) {
+            for (; first != last; ++first) {
+                if (*first == target) {
+                    cnt += 1;
+                }
+            }
+            return cnt;
+        }
         auto it = strongPtr(begin.clone());
         while (it->isValid() && distance(end, *it) != -1) {
             if (it->get() == target) {
@@ -976,6 +1131,14 @@ namespace original
                                      const Callback& condition) -> u_integer
     {
         u_integer cnt = 0;
+        if (TYPE *first, *last; _contiguousRange(begin, end, first, last)) {
+            for (; first != last; ++first) {
+                if (condition(*first)) {
+                    cnt += 1;
+                }
+            }
+            return cnt;
+        }
         auto it = strongPtr(begin.clone());
         while (it->isValid() && distance(end, *it) != -1) {
             if (condition(it->get())) {
@@ -1006,6 +1169,12 @@ namespace original
     auto original::algorithms::forEach(const iterator<TYPE>& begin, const iterator<TYPE>& end,
                                        Callback operation) -> void
     {
+        if (TYPE *first, *last; _contiguousRange(begin, end, first, last)) {
+            for (; first != last; ++first) {
+                operation(*first);
+            }
+            return;
+        }
         auto it = strongPtr(begin.clone());
         for (; !it->equal(end); it->next()) {
             operation(it->get());
@@ -1056,6 +1225,14 @@ namespace original
     auto original::algorithms::fill(const iterator<TYPE>& begin,
                                     const iterator<TYPE>& end, const TYPE& value) -> void
     {
+        if constexpr (std::is_copy_assignable_v<TYPE>) {
+            if (TYPE *first, *last; _contiguousRange(begin, end, first, last)) {
+                for (; first != last; ++first) {
+                    *first = value;
+                }
+                return;
+            }
+        }
         auto it = strongPtr(begin.clone());
         while (!it->equal(end)){
             it->set(value);
@@ -1205,6 +1382,14 @@ namespace original
     requires original::Compare<Callback, TYPE>
     void original::algorithms::introSort(const iterator<TYPE> &begin, const iterator<TYPE> &end,
                                          const Callback &compares) {
+        if constexpr (std::is_move_constructible_v<TYPE> && std::is_move_assignable_v<TYPE>) {
+            if (TYPE *first, *last; _contiguousRange(begin, end, first, last)) {
+                if (last - first > 1)
+                    _introSortKernel(first, last, compares, static_cast<u_integer>(2 * std::log2(last - first)));
+                return;
+            }
+        }
+
         if (const integer dis = distance(end, begin); dis <= 0)
             return;
 
@@ -1216,6 +1401,12 @@ namespace original
     requires original::Compare<Callback, TYPE>
     void original::algorithms::stableSort(const iterator<TYPE> &begin, const iterator<TYPE> &end,
                                           const Callback &compares) {
+        if constexpr (std::is_move_constructible_v<TYPE> && std::is_move_assignable_v<TYPE>) {
+            if (TYPE *first, *last; _contiguousRange(begin, end, first, last)) {
+                _stableSortKernel(first, last, compares);
+                return;
+            }
+        }
         _stableSort(begin, end, compares);
     }
 
@@ -1223,6 +1414,13 @@ namespace original
     requires original::Compare<Callback, TYPE>
     void original::algorithms::heapSort(const iterator<TYPE> &begin, const iterator<TYPE> &end,
                                         const Callback& compares) {
+        if constexpr (std::is_move_constructible_v<TYPE> && std::is_move_assignable_v<TYPE>) {
+            if (TYPE *first, *last; _contiguousRange(begin, end, first, last)) {
+                _heapSortKernel(first, last, compares);
+                return;
+            }
+        }
+
         if (distance(end, begin) <= 0)
             return;
 
@@ -1326,6 +1524,13 @@ namespace original
     requires original::Compare<Callback, TYPE>
     void original::algorithms::insertionSort(const iterator<TYPE> &begin, const iterator<TYPE> &end,
                                              const Callback &compares) {
+        if constexpr (std::is_move_constructible_v<TYPE> && std::is_move_assignable_v<TYPE>) {
+            if (TYPE *first, *last; _contiguousRange(begin, end, first, last)) {
+                _insertionSortKernel(first, last, compares);
+                return;
+            }
+        }
+
         if (distance(end, begin) <= 0)
             return;
 
@@ -1351,7 +1556,7 @@ namespace original
         auto right = strongPtr(mid.clone());
 
         while (distance(mid, *left) > 0 && distance(end, *right) > 0){
-            if (compare(left, right, compares)){
+            if (!compare(right, left, compares)){
                 tmp.pushEnd(left->get());
                 left->next();
             } else{
@@ -1393,4 +1598,237 @@ namespace original
         _stableSortMerge(begin, *mid, end, compares);
     }
 
+    template<original::ContiguousContainer CONTAINER, typename Callback>
+    requires original::Compare<Callback, original::contiguousElemType<CONTAINER>>
+    void original::algorithms::sort(CONTAINER& container, const Callback& compares, const bool is_stable) {
+        is_stable ? stableSort(container, compares) : introSort(container, compares);
+    }
+
+    template<original::ContiguousContainer CONTAINER, typename Callback>
+    requires original::Compare<Callback, original::contiguousElemType<CONTAINER>>
+    void original::algorithms::introSort(CONTAINER& container, const Callback& compares) {
+        if (container.size() <= 1)
+            return;
+        auto* first = &container.data();
+        _introSortKernel(first, first + container.size(), compares,
+                         static_cast<u_integer>(2 * std::log2(container.size())));
+    }
+
+    template<original::ContiguousContainer CONTAINER, typename Callback>
+    requires original::Compare<Callback, original::contiguousElemType<CONTAINER>>
+    void original::algorithms::stableSort(CONTAINER& container, const Callback& compares) {
+        if (container.size() <= 1)
+            return;
+        auto* first = &container.data();
+        _stableSortKernel(first, first + container.size(), compares);
+    }
+
+    template<original::ContiguousContainer CONTAINER, typename Callback>
+    requires original::Compare<Callback, original::contiguousElemType<CONTAINER>>
+    void original::algorithms::heapSort(CONTAINER& container, const Callback& compares) {
+        if (container.size() <= 1)
+            return;
+        auto* first = &container.data();
+        _heapSortKernel(first, first + container.size(), compares);
+    }
+
+    template<original::ContiguousContainer CONTAINER, typename Callback>
+    requires original::Compare<Callback, original::contiguousElemType<CONTAINER>>
+    void original::algorithms::insertionSort(CONTAINER& container, const Callback& compares) {
+        if (container.size() <= 1)
+            return;
+        auto* first = &container.data();
+        _insertionSortKernel(first, first + container.size(), compares);
+    }
+
+    template<typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    void original::algorithms::introSort(TYPE* first, TYPE* last, const Callback& compares) {
+        if (last - first <= 1)
+            return;
+        _introSortKernel(first, last, compares, static_cast<u_integer>(2 * std::log2(last - first)));
+    }
+
+    template<typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    void original::algorithms::stableSort(TYPE* first, TYPE* last, const Callback& compares) {
+        if (last - first <= 1)
+            return;
+        _stableSortKernel(first, last, compares);
+    }
+
+    template<typename TYPE>
+    bool original::algorithms::_contiguousRange(const iterator<TYPE>& begin, const iterator<TYPE>& end,
+                                                TYPE*& first, TYPE*& last) {
+        first = begin.contiguousPtr();
+        TYPE* back = end.contiguousPtr();
+        // Pointers of unrelated blocks never match the iterator distance
+        if (first == nullptr || back == nullptr || back < first || back - first != end - begin)
+            return false;
+        last = back + 1;
+        return true;
+    }
+
+    template<typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    void original::algorithms::_insertionSortKernel(TYPE* first, TYPE* last, const Callback& compares) {
+        if (last - first <= 1)
+            return;
+
+        for (TYPE* cur = first + 1; cur != last; ++cur) {
+            if (!compares(*cur, *(cur - 1)))
+                continue;
+            TYPE tmp = std::move(*cur);
+            TYPE* hole = cur;
+            do {
+                *hole = std::move(*(hole - 1));
+                --hole;
+            } while (hole != first && compares(tmp, *(hole - 1)));
+            *hole = std::move(tmp);
+        }
+    }
+
+    template<typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    void original::algorithms::_heapSiftDownKernel(TYPE* first, integer hole, const integer len,
+                                                   const Callback& compares) {
+        TYPE value = std::move(first[hole]);
+        for (integer child = 2 * hole + 1; child < len; child = 2 * hole + 1) {
+            if (child + 1 < len && compares(first[child], first[child + 1]))
+                child += 1;
+            if (!compares(value, first[child]))
+                break;
+            first[hole] = std::move(first[child]);
+            hole = child;
+        }
+        first[hole] = std::move(value);
+    }
+
+    template<typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    void original::algorithms::_heapSortKernel(TYPE* first, TYPE* last, const Callback& compares) {
+        const integer len = last - first;
+        if (len <= 1)
+            return;
+
+        for (integer i = len / 2; i > 0; --i) {
+            _heapSiftDownKernel(first, i - 1, len, compares);
+        }
+        for (integer end = len - 1; end > 0; --end) {
+            std::swap(first[0], first[end]);
+            _heapSiftDownKernel(first, 0, end, compares);
+        }
+    }
+
+    template<typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    TYPE* original::algorithms::_introSortPartitionKernel(TYPE* first, TYPE* last, const Callback& compares) {
+        TYPE* a = first + 1;
+        TYPE* b = first + (last - first) / 2;
+        TYPE* c = last - 1;
+        TYPE* median;
+        if (compares(*a, *b)) {
+            median = compares(*b, *c) ? b : compares(*a, *c) ? c : a;
+        } else {
+            median = compares(*a, *c) ? a : compares(*b, *c) ? c : b;
+        }
+        std::swap(*first, *median);
+
+        TYPE* left = first + 1;
+        TYPE* right = last;
+        for (;;) {
+            while (compares(*left, *first))
+                ++left;
+            --right;
+            while (compares(*first, *right))
+                --right;
+            if (!(left < right))
+                return left;
+            std::swap(*left, *right);
+            ++left;
+        }
+    }
+
+    template<typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    void original::algorithms::_introSortKernel(TYPE* first, TYPE* last, const Callback& compares,
+                                                u_integer depth_limit) {
+        while (last - first > 16) {
+            if (depth_limit == 0) {
+                _heapSortKernel(first, last, compares);
+                return;
+            }
+            depth_limit -= 1;
+            TYPE* cut = _introSortPartitionKernel(first, last, compares);
+            _introSortKernel(cut, last, compares, depth_limit);
+            last = cut;
+        }
+        _insertionSortKernel(first, last, compares);
+    }
+
+    template<typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    void original::algorithms::_stableSortKernel(TYPE* first, TYPE* last, const Callback& compares) {
+        const u_integer len = last - first;
+        if (len <= 1)
+            return;
+
+        TYPE* buffer = allocators::malloc<TYPE>(len / 2);
+        try {
+            _stableSortKernel(first, last, buffer, compares);
+        } catch (...) {
+            allocators::free(buffer);
+            throw;
+        }
+        allocators::free(buffer);
+    }
+
+    template<typename TYPE, typename Callback>
+    requires original::Compare<Callback, TYPE>
+    void original::algorithms::_stableSortKernel(TYPE* first, TYPE* last, TYPE* buffer, const Callback& compares) {
+        if (last - first <= 16) {
+            _insertionSortKernel(first, last, compares);
+            return;
+        }
+
+        TYPE* mid = first + (last - first) / 2;
+        _stableSortKernel(first, mid, buffer, compares);
+        _stableSortKernel(mid, last, buffer, compares);
+        if (!compares(*mid, *(mid - 1)))
+            return;
+
+        TYPE* buffer_end = buffer;
+        for (TYPE* p = first; p != mid; ++p, ++buffer_end) {
+            new (buffer_end) TYPE(std::move(*p));
+        }
+
+        TYPE* left = buffer;
+        TYPE* right = mid;
+        TYPE* out = first;
+        try {
+            while (left != buffer_end && right != last) {
+                if (compares(*right, *left)) {
+                    *out++ = std::move(*right++);
+                } else {
+                    *out++ = std::move(*left++);
+                }
+            }
+        } catch (...) {
+            // The free slots [out, right) exactly fit the unmerged part of the buffer
+            for (; left != buffer_end; ++left, ++out) {
+                *out = std::move(*left);
+            }
+            for (TYPE* p = buffer; p != buffer_end; ++p) {
+                p->~TYPE();
+            }
+            throw;
+        }
+        for (; left != buffer_end; ++left, ++out) {
+            *out = std::move(*left);
+        }
+        for (TYPE* p = buffer; p != buffer_end; ++p) {
+            p->~TYPE();
+        }
+    }
+
 #endif // ALGORITHMS_H
@@ -1,6 +1,7 @@
 #ifndef ALLOCATOR_H
 #define ALLOCATOR_H
 
+#include <limits>
 #include "config.h"
 #include "error.h"
 #include "maths.h"
@@ -46,7 +47,7 @@ namespace original {
         * @tparam TYPE Type of objects to allocate
         * @param size Number of elements to allocate
         * @return Pointer to allocated memory
-        * @throw allocateError When memory allocation fails
+        * @throw allocateError When memory allocation fails or size * sizeof(TYPE) overflows
         * @note Returns nullptr if size is 0
         * @see free
         */
@@ -365,6 +366,10 @@ TYPE* original::allocators::malloc(const u_integer size) {
         return nullptr;
     }
 
+    if (size > std::numeric_limits<std::size_t>::max() / sizeof(TYPE)) {
+        throw allocateError();
+    }
+
     try {
         return static_cast<TYPE*>(operator new(size * sizeof(TYPE)));
     } catch (const std::bad_alloc&) {
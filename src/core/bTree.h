@@ -0,0 +1,1299 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include <new>
+#include "allocator.h"
+#include "comparator.h"
+#include "couple.h"
+
+/**
+ * @file bTree.h
+ * @brief B+ tree implementation header
+ * @details Provides a template-based B+ tree implementation with:
+ * - Balanced tree operations with a high fanout
+ * - Keys of a node stored contiguously, node size tuned to cache lines
+ * - Linked leaves for sequential scans
+ * - Iterator support
+ * - Memory management via allocators
+ * - Custom comparison support
+ */
+
+
+namespace original {
+
+    /**
+     * @class bTree
+     * @tparam K_TYPE Key type (must be comparable)
+     * @tparam V_TYPE Value type
+     * @tparam ALLOC Allocator type (default: allocator<K_TYPE>)
+     * @tparam Compare Comparison function type (default: increaseComparator<K_TYPE>)
+     * @brief B+ tree container implementation
+     * @details This class provides a balanced search tree with the following properties:
+     * - O(log n) search/insert/delete operations with a base of up to MAX_KEYS
+     * - All key-value pairs in the leaves, inner nodes only hold separator keys
+     * - Leaves doubly linked in key order, so a scan never climbs the tree
+     * - Custom comparator support
+     * - STL-style allocator support
+     *
+     * Each node keeps its keys in one contiguous array sized to a few cache lines, so a
+     * lookup touches O(log n / log MAX_KEYS) nodes instead of O(log n) scattered nodes.
+     * Leaves additionally hold the key-value pairs handed out by iterators, keys are
+     * mirrored there so that searching a leaf only reads the key array.
+     *
+     * Insertion splits full nodes and deletion refills minimal nodes on the way down,
+     * so both finish in a single root-to-leaf pass.
+     */
+    template<typename K_TYPE,
+             typename V_TYPE,
+             typename ALLOC = allocator<K_TYPE>,
+             typename Compare = increaseComparator<K_TYPE>>
+    class bTree {
+    protected:
+        /**
+         * @brief Cache line size the node layout is tuned for
+         */
+        static constexpr u_integer CACHE_LINE = 64;
+
+        /**
+         * @brief Computes the key capacity of a node
+         * @return Number of keys filling four cache lines, clamped to [4, 64] and even
+         */
+        static constexpr u_integer keysPerNode();
+
+        static constexpr u_integer MAX_KEYS = keysPerNode();        ///< Maximum number of keys in a node
+        static constexpr u_integer MIN_KEYS = (MAX_KEYS - 1) / 2;   ///< Minimum number of keys in a non-root node
+
+        /**
+         * @class bNode
+         * @brief Common part of leaf and inner nodes
+         * @details Holds the node kind, the key count and the contiguous key array.
+         * Keys in [0, count) are constructed, the remaining slots are raw storage.
+         */
+        class bNode {
+        protected:
+            bool leaf_;                                             ///< Whether this is a leaf
+            u_integer count_;                                       ///< Number of keys
+            alignas(K_TYPE) byte keys_[MAX_KEYS * sizeof(K_TYPE)];  ///< Key storage
+
+        public:
+            friend class bTree;
+
+            /**
+             * @brief Constructs an empty node
+             * @param leaf Whether the node is a leaf
+             */
+            explicit bNode(bool leaf);
+
+            bNode(const bNode&) = delete;
+            bNode& operator=(const bNode&) = delete;
+
+            /**
+             * @brief Gets the key array
+             * @return Pointer to the first key slot
+             */
+            K_TYPE* keys();
+
+            /**
+             * @brief Gets the key array (const)
+             * @return Pointer to the first key slot
+             */
+            const K_TYPE* keys() const;
+
+            /**
+             * @brief Checks the node kind
+             * @return true if this is a leaf
+             */
+            [[nodiscard]] bool isLeaf() const;
+
+            /**
+             * @brief Gets the number of keys
+             * @return Key count
+             */
+            [[nodiscard]] u_integer count() const;
+        };
+
+        /**
+         * @class leafNode
+         * @brief Leaf node holding key-value pairs
+         * @details Pairs in [0, count) are constructed and mirror the key array.
+         */
+        class leafNode final : public bNode {
+            using entryType = couple<const K_TYPE, V_TYPE>;
+
+            leafNode* prev_;                                                    ///< Previous leaf in key order
+            leafNode* next_;                                                    ///< Next leaf in key order
+            alignas(entryType) byte entries_[MAX_KEYS * sizeof(entryType)];     ///< Key-value pair storage
+
+        public:
+            friend class bTree;
+
+            /**
+             * @brief Constructs an empty, unlinked leaf
+             */
+            leafNode();
+
+            /**
+             * @brief Gets the pair array
+             * @return Pointer to the first pair slot
+             */
+            entryType* entries();
+
+            /**
+             * @brief Gets a key-value pair
+             * @param index Slot index
+             * @return Reference to the pair
+             */
+            entryType& getVal(u_integer index);
+        };
+
+        /**
+         * @class innerNode
+         * @brief Inner node routing searches
+         * @details Child i holds the keys k with keys[i - 1] <= k < keys[i].
+         */
+        class innerNode final : public bNode {
+            bNode* children_[MAX_KEYS + 1];    ///< Child pointers
+
+        public:
+            friend class bTree;
+
+            /**
+             * @brief Constructs an inner node without keys
+             */
+            innerNode();
+        };
+
+        using rebind_alloc_leaf = typename ALLOC::template rebind_alloc<leafNode>;    ///< Rebound allocator for leaves
+        using rebind_alloc_inner = typename ALLOC::template rebind_alloc<innerNode>;  ///< Rebound allocator for inner nodes
+
+        bNode* root_;                                     ///< Root node pointer, nullptr if empty
+        u_integer size_;                                  ///< Number of elements
+        Compare compare_;                                 ///< Comparison function
+        mutable rebind_alloc_leaf rebind_alloc{};         ///< Leaf allocator
+        mutable rebind_alloc_inner rebind_alloc_inner_{}; ///< Inner node allocator
+
+        /**
+         * @class Iterator
+         * @brief Bidirectional iterator for bTree
+         * @details Provides iteration over tree elements in sorted order by walking
+         * the linked leaves
+         */
+        class Iterator
+        {
+        protected:
+            mutable bTree* tree_;       ///< Owning tree
+            mutable leafNode* leaf_;    ///< Current leaf, nullptr at the end
+            mutable u_integer index_;   ///< Slot in the current leaf
+
+            /**
+             * @brief Constructs iterator
+             * @param tree Owning tree
+             * @param leaf Current leaf
+             * @param index Slot in the leaf
+             */
+            explicit Iterator(bTree* tree = nullptr, leafNode* leaf = nullptr, u_integer index = 0);
+
+            /// Copy constructor
+            Iterator(const Iterator& other);
+
+            /// Copy assignment operator
+            Iterator& operator=(const Iterator& other);
+
+        public:
+            /**
+             * @brief Checks if more elements exist forward
+             * @return true if more elements available
+             */
+            [[nodiscard]] bool hasNext() const;
+
+            /**
+             * @brief Checks if more elements exist backward
+             * @return true if more elements available
+             */
+            [[nodiscard]] bool hasPrev() const;
+
+            /**
+             * @brief Moves to next element
+             */
+            void next() const;
+
+            /**
+             * @brief Moves to previous element
+             */
+            void prev() const;
+
+            /**
+             * @brief Advances iterator by steps
+             * @param steps Number of positions to advance
+             */
+            void operator+=(integer steps) const;
+
+            /**
+             * @brief Moves iterator backward by steps
+             * @param steps Number of positions to move back
+             */
+            void operator-=(integer steps) const;
+
+            /**
+             * @brief Gets current element (non-const)
+             * @return Reference to current key-value pair
+             */
+            couple<const K_TYPE, V_TYPE>& get();
+
+            /**
+             * @brief Gets current element (const)
+             * @return Copy of current key-value pair
+             */
+            couple<const K_TYPE, V_TYPE> get() const;
+
+            /**
+             * @brief Checks if iterator is valid
+             * @return true if iterator points to valid element
+             */
+            [[nodiscard]] bool isValid() const;
+        };
+
+        friend Iterator;
+
+        /**
+         * @brief Moves an object to an uninitialized slot and destroys the source
+         * @param dst Uninitialized destination slot
+         * @param src Constructed source slot
+         */
+        template<typename T>
+        static void relocate(T* dst, T* src);
+
+        /**
+         * @brief Opens an uninitialized slot by moving [pos, count) one slot right
+         * @param arr Array with count constructed slots
+         * @param pos Slot to open
+         * @param count Number of constructed slots
+         */
+        template<typename T>
+        static void shiftRight(T* arr, u_integer pos, u_integer count);
+
+        /**
+         * @brief Closes an uninitialized slot by moving (pos, count) one slot left
+         * @param arr Array whose slot pos is uninitialized
+         * @param pos Slot to close
+         * @param count Number of slots including the uninitialized one
+         */
+        template<typename T>
+        static void shiftLeft(T* arr, u_integer pos, u_integer count);
+
+        /**
+         * @brief Finds the first key not less than a key
+         * @param node Node to search
+         * @param key Key to search for
+         * @return Index in [0, count]
+         */
+        u_integer lowerIndex(const bNode* node, const K_TYPE& key) const;
+
+        /**
+         * @brief Finds the first key greater than a key
+         * @param node Node to search
+         * @param key Key to search for
+         * @return Index in [0, count], also the child to descend into
+         */
+        u_integer upperIndex(const bNode* node, const K_TYPE& key) const;
+
+        /**
+         * @brief Creates an empty leaf
+         * @return Pointer to newly created leaf
+         */
+        leafNode* createLeaf() const;
+
+        /**
+         * @brief Creates an empty inner node
+         * @return Pointer to newly created inner node
+         */
+        innerNode* createInner() const;
+
+        /**
+         * @brief Destroys a node, its keys and pairs, not its children
+         * @param node Node to destroy
+         */
+        void destroyNode(bNode* node) noexcept;
+
+        /**
+         * @brief Destroys a subtree
+         * @param node Root of the subtree
+         */
+        void destroySubtree(bNode* node) noexcept;
+
+        /**
+         * @brief Destroys entire tree and deallocates all nodes
+         */
+        void destroyTree() noexcept;
+
+        /**
+         * @brief Copies a subtree
+         * @param node Root of the subtree to copy
+         * @param last_leaf Last copied leaf, the copied leaves are linked after it
+         * @return Root of the copy
+         */
+        bNode* subtreeCopy(const bNode* node, leafNode*& last_leaf) const;
+
+        /**
+          * @brief Creates a deep copy of the tree
+          * @return Pointer to root of copied tree
+          */
+        bNode* treeCopy() const;
+
+        /**
+         * @brief Gets the leftmost leaf
+         * @return Leaf holding the minimum key, nullptr if empty
+         */
+        leafNode* getMinLeaf() const;
+
+        /**
+         * @brief Gets the rightmost leaf
+         * @return Leaf holding the maximum key, nullptr if empty
+         */
+        leafNode* getMaxLeaf() const;
+
+        /**
+         * @brief Splits the full child i of an inner node that has room for one more key
+         * @param parent Parent node
+         * @param i Index of the full child
+         */
+        void splitChild(innerNode* parent, u_integer i);
+
+        /**
+         * @brief Gives child i of an inner node more than MIN_KEYS keys
+         * @param parent Parent node
+         * @param i Index of the minimal child
+         * @return Index of the child now covering the former range of child i
+         * @details Borrows from a sibling with spare keys, otherwise merges with a sibling
+         */
+        u_integer fillChild(innerNode* parent, u_integer i);
+
+        /**
+         * @brief Moves the last key of child i - 1 into child i through the parent
+         */
+        void borrowFromLeft(innerNode* parent, u_integer i);
+
+        /**
+         * @brief Moves the first key of child i + 1 into child i through the parent
+         */
+        void borrowFromRight(innerNode* parent, u_integer i);
+
+        /**
+         * @brief Merges child i + 1 into child i and removes their separator
+         */
+        void mergeChildren(innerNode* parent, u_integer i);
+
+        /**
+         * @brief Constructs bTree with given comparison function
+         * @param compare Comparison function to use
+         */
+        explicit bTree(Compare compare = Compare{});
+
+        /**
+         * @brief Descends to the leaf whose range covers a key
+         * @param key Key to search for
+         * @return The leaf, or nullptr if the tree is empty
+         */
+        leafNode* findLeaf(const K_TYPE& key) const;
+
+        /**
+         * @brief Normalizes a slot that may lie one past the end of its leaf
+         * @param leaf Leaf of the slot
+         * @param index Slot index, updated if the slot moves to the next leaf
+         * @return Leaf holding the slot, or nullptr if past the last element
+         */
+        static leafNode* slotForward(leafNode* leaf, u_integer& index);
+
+        /**
+         * @brief Moves a slot one position back, possibly into the previous leaf
+         * @param leaf Leaf of the slot
+         * @param index Slot index, updated to the previous slot
+         * @return Leaf holding the previous slot, or nullptr if before the first element
+         */
+        static leafNode* slotBackward(leafNode* leaf, u_integer& index);
+
+        /**
+         * @brief Finds the first slot whose key is not less than a key
+         * @param key Key to search for
+         * @param index Output slot index
+         * @return Leaf holding the slot, or nullptr if every key is less than key
+         */
+        leafNode* ceilingSlot(const K_TYPE& key, u_integer& index) const;
+
+        /**
+         * @brief Finds the first slot whose key is greater than a key
+         * @param key Key to search for
+         * @param index Output slot index
+         * @return Leaf holding the slot, or nullptr if no key is greater than key
+         */
+        leafNode* higherSlot(const K_TYPE& key, u_integer& index) const;
+
+        /**
+         * @brief Finds the last slot whose key is not greater than a key
+         * @param key Key to search for
+         * @param index Output slot index
+         * @return Leaf holding the slot, or nullptr if every key is greater than key
+         */
+        leafNode* floorSlot(const K_TYPE& key, u_integer& index) const;
+
+        /**
+         * @brief Finds the last slot whose key is less than a key
+         * @param key Key to search for
+         * @param index Output slot index
+         * @return Leaf holding the slot, or nullptr if no key is less than key
+         */
+        leafNode* lowerSlot(const K_TYPE& key, u_integer& index) const;
+
+        /**
+         * @brief Locates the leaf slot holding a key
+         * @param key Key to search for
+         * @param index Output slot index, set only if found
+         * @return Leaf holding the key, or nullptr if not found
+         */
+        leafNode* locate(const K_TYPE& key, u_integer& index) const;
+
+        /**
+         * @brief Finds the pair with given key
+         * @param key Key to search for
+         * @return Pointer to found pair, or nullptr if not found
+         */
+        couple<const K_TYPE, V_TYPE>* find(const K_TYPE& key) const;
+
+        /**
+         * @brief Modifies value for existing key
+         * @param key Key to modify
+         * @param value New value to set
+         * @return true if key was found and modified
+         */
+        bool modify(const K_TYPE& key, const V_TYPE& value);
+
+        /**
+         * @brief Inserts new key-value pair
+         * @param key Key to insert
+         * @param value Value to insert
+         * @return true if inserted, false if key already existed
+         */
+        bool insert(const K_TYPE& key, const V_TYPE& value);
+
+        /**
+         * @brief Erases pair with given key
+         * @param key Key to erase
+         * @return true if key was found and erased
+         */
+        bool erase(const K_TYPE& key);
+
+        /**
+         * @brief Erases all pairs with keys in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return Number of erased pairs
+         * @details O(m log n) for m erased pairs
+         */
+        u_integer eraseRange(const K_TYPE& low, const K_TYPE& high);
+
+        /**
+         * @brief Destructor
+         * @details Cleans up all tree nodes and allocated memory
+         */
+        ~bTree();
+    };
+
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+constexpr original::u_integer original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::keysPerNode()
+{
+    u_integer keys = 4 * CACHE_LINE / sizeof(K_TYPE);
+    if (keys < 4) {
+        keys = 4;
+    }
+    if (keys > 64) {
+        keys = 64;
+    }
+    return keys - keys % 2;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::bNode::bNode(const bool leaf)
+    : leaf_(leaf), count_(0) {}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+K_TYPE* original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::bNode::keys()
+{
+    return std::launder(reinterpret_cast<K_TYPE*>(this->keys_));
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+const K_TYPE* original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::bNode::keys() const
+{
+    return std::launder(reinterpret_cast<const K_TYPE*>(this->keys_));
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::bNode::isLeaf() const
+{
+    return this->leaf_;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::u_integer original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::bNode::count() const
+{
+    return this->count_;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode::leafNode()
+    : bNode(true), prev_(nullptr), next_(nullptr) {}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::couple<const K_TYPE, V_TYPE>*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode::entries()
+{
+    return std::launder(reinterpret_cast<entryType*>(this->entries_));
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::couple<const K_TYPE, V_TYPE>&
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode::getVal(const u_integer index)
+{
+    return this->entries()[index];
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::innerNode::innerNode()
+    : bNode(false), children_{} {}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::Iterator(bTree* tree, leafNode* leaf, const u_integer index)
+    : tree_(tree), leaf_(leaf), index_(index) {}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::Iterator(const Iterator& other) : Iterator() {
+    this->operator=(other);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator&
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::operator=(const Iterator& other)
+{
+    if (this == &other)
+        return *this;
+
+    this->tree_ = other.tree_;
+    this->leaf_ = other.leaf_;
+    this->index_ = other.index_;
+    return *this;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::hasNext() const
+{
+    return this->leaf_ && (this->index_ + 1 < this->leaf_->count_ || this->leaf_->next_);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::hasPrev() const
+{
+    return this->leaf_ && (this->index_ > 0 || this->leaf_->prev_);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::next() const
+{
+    if (!this->leaf_)
+        return;
+
+    if (this->index_ + 1 < this->leaf_->count_) {
+        this->index_ += 1;
+    } else {
+        this->leaf_ = this->leaf_->next_;
+        this->index_ = 0;
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::prev() const
+{
+    if (!this->leaf_)
+        return;
+
+    if (this->index_ > 0) {
+        this->index_ -= 1;
+    } else {
+        this->leaf_ = this->leaf_->prev_;
+        this->index_ = this->leaf_ ? this->leaf_->count_ - 1 : 0;
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::operator+=(const integer steps) const
+{
+    if (steps < 0){
+        this->operator-=(-steps);
+        return;
+    }
+
+    integer remaining = steps;
+    while (remaining > 0 && this->leaf_) {
+        const integer in_leaf = static_cast<integer>(this->leaf_->count_ - this->index_ - 1);
+        if (remaining <= in_leaf) {
+            this->index_ += static_cast<u_integer>(remaining);
+            return;
+        }
+        remaining -= in_leaf + 1;
+        this->leaf_ = this->leaf_->next_;
+        this->index_ = 0;
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::operator-=(const integer steps) const
+{
+    if (steps < 0){
+        this->operator+=(-steps);
+        return;
+    }
+
+    integer remaining = steps;
+    while (remaining > 0 && this->leaf_) {
+        if (remaining <= static_cast<integer>(this->index_)) {
+            this->index_ -= static_cast<u_integer>(remaining);
+            return;
+        }
+        remaining -= static_cast<integer>(this->index_) + 1;
+        this->leaf_ = this->leaf_->prev_;
+        this->index_ = this->leaf_ ? this->leaf_->count_ - 1 : 0;
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::couple<const K_TYPE, V_TYPE>& original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::get()
+{
+    if (!this->isValid()) {
+        throw outOfBoundError();
+    }
+
+    return this->leaf_->getVal(this->index_);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::couple<const K_TYPE, V_TYPE> original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::get() const
+{
+    if (!this->isValid()) {
+        throw outOfBoundError();
+    }
+
+    return this->leaf_->getVal(this->index_);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::isValid() const
+{
+    return this->leaf_;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+template<typename T>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::relocate(T* dst, T* src)
+{
+    new (dst) T(std::move(*src));
+    src->~T();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+template<typename T>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::shiftRight(T* arr, const u_integer pos, const u_integer count)
+{
+    for (u_integer i = count; i > pos; --i) {
+        relocate(&arr[i], &arr[i - 1]);
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+template<typename T>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::shiftLeft(T* arr, const u_integer pos, const u_integer count)
+{
+    for (u_integer i = pos; i + 1 < count; ++i) {
+        relocate(&arr[i], &arr[i + 1]);
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::u_integer
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::lowerIndex(const bNode* node, const K_TYPE& key) const
+{
+    const K_TYPE* keys = node->keys();
+    u_integer len = node->count_;
+    if (len == 0) {
+        return 0;
+    }
+
+    // Branch-free halving, the step is computed rather than branched on
+    const K_TYPE* base = keys;
+    while (len > 1) {
+        const u_integer half = len / 2;
+        base += half * static_cast<u_integer>(this->compare_(base[half - 1], key));
+        len -= half;
+    }
+    return static_cast<u_integer>(base - keys) + (this->compare_(*base, key) ? 1 : 0);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::u_integer
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::upperIndex(const bNode* node, const K_TYPE& key) const
+{
+    const K_TYPE* keys = node->keys();
+    u_integer len = node->count_;
+    if (len == 0) {
+        return 0;
+    }
+
+    const K_TYPE* base = keys;
+    while (len > 1) {
+        const u_integer half = len / 2;
+        base += half * static_cast<u_integer>(!this->compare_(key, base[half - 1]));
+        len -= half;
+    }
+    return static_cast<u_integer>(base - keys) + (this->compare_(key, *base) ? 0 : 1);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::createLeaf() const
+{
+    auto node = this->rebind_alloc.allocate(1);
+    this->rebind_alloc.construct(node);
+    return node;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::innerNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::createInner() const
+{
+    auto node = this->rebind_alloc_inner_.allocate(1);
+    this->rebind_alloc_inner_.construct(node);
+    return node;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::destroyNode(bNode* node) noexcept
+{
+    for (u_integer i = 0; i < node->count_; ++i) {
+        node->keys()[i].~K_TYPE();
+    }
+    if (node->leaf_) {
+        auto leaf = static_cast<leafNode*>(node);
+        for (u_integer i = 0; i < leaf->count_; ++i) {
+            this->rebind_alloc.destroy(&leaf->entries()[i]);
+        }
+        this->rebind_alloc.destroy(leaf);
+        this->rebind_alloc.deallocate(leaf, 1);
+    } else {
+        auto inner = static_cast<innerNode*>(node);
+        this->rebind_alloc_inner_.destroy(inner);
+        this->rebind_alloc_inner_.deallocate(inner, 1);
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::destroySubtree(bNode* node) noexcept
+{
+    if (!node->leaf_) {
+        auto inner = static_cast<innerNode*>(node);
+        for (u_integer i = 0; i <= inner->count_; ++i) {
+            this->destroySubtree(inner->children_[i]);
+        }
+    }
+    this->destroyNode(node);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::destroyTree() noexcept
+{
+    if (this->root_) {
+        this->destroySubtree(this->root_);
+        this->root_ = nullptr;
+    }
+    this->size_ = 0;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::bNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::subtreeCopy(const bNode* node, leafNode*& last_leaf) const
+{
+    if (node->leaf_) {
+        auto src = static_cast<leafNode*>(const_cast<bNode*>(node));
+        auto copied = this->createLeaf();
+        for (u_integer i = 0; i < src->count_; ++i) {
+            new (&copied->keys()[i]) K_TYPE(src->keys()[i]);
+            new (&copied->entries()[i]) couple<const K_TYPE, V_TYPE>(src->entries()[i]);
+            copied->count_ += 1;
+        }
+        copied->prev_ = last_leaf;
+        if (last_leaf) {
+            last_leaf->next_ = copied;
+        }
+        last_leaf = copied;
+        return copied;
+    }
+
+    auto src = static_cast<const innerNode*>(node);
+    auto copied = this->createInner();
+    for (u_integer i = 0; i < src->count_; ++i) {
+        new (&copied->keys()[i]) K_TYPE(src->keys()[i]);
+        copied->count_ += 1;
+    }
+    for (u_integer i = 0; i <= src->count_; ++i) {
+        copied->children_[i] = this->subtreeCopy(src->children_[i], last_leaf);
+    }
+    return copied;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::bNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::treeCopy() const
+{
+    if (!this->root_) {
+        return nullptr;
+    }
+
+    leafNode* last_leaf = nullptr;
+    return this->subtreeCopy(this->root_, last_leaf);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::getMinLeaf() const
+{
+    if (!this->root_) return nullptr;
+
+    bNode* node = this->root_;
+    while (!node->leaf_) {
+        node = static_cast<innerNode*>(node)->children_[0];
+    }
+    return static_cast<leafNode*>(node);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::getMaxLeaf() const
+{
+    if (!this->root_) return nullptr;
+
+    bNode* node = this->root_;
+    while (!node->leaf_) {
+        auto inner = static_cast<innerNode*>(node);
+        node = inner->children_[inner->count_];
+    }
+    return static_cast<leafNode*>(node);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::splitChild(innerNode* parent, const u_integer i)
+{
+    bNode* child = parent->children_[i];
+    bNode* right;
+    const u_integer half = MAX_KEYS / 2;
+
+    shiftRight(parent->keys(), i, parent->count_);
+    if (child->leaf_) {
+        auto left_leaf = static_cast<leafNode*>(child);
+        auto right_leaf = this->createLeaf();
+        for (u_integer j = half; j < MAX_KEYS; ++j) {
+            relocate(&right_leaf->keys()[j - half], &left_leaf->keys()[j]);
+            relocate(&right_leaf->entries()[j - half], &left_leaf->entries()[j]);
+        }
+        right_leaf->count_ = MAX_KEYS - half;
+        left_leaf->count_ = half;
+
+        right_leaf->next_ = left_leaf->next_;
+        if (right_leaf->next_) {
+            right_leaf->next_->prev_ = right_leaf;
+        }
+        right_leaf->prev_ = left_leaf;
+        left_leaf->next_ = right_leaf;
+
+        new (&parent->keys()[i]) K_TYPE(right_leaf->keys()[0]);
+        right = right_leaf;
+    } else {
+        auto left_inner = static_cast<innerNode*>(child);
+        auto right_inner = this->createInner();
+        for (u_integer j = half + 1; j < MAX_KEYS; ++j) {
+            relocate(&right_inner->keys()[j - half - 1], &left_inner->keys()[j]);
+        }
+        for (u_integer j = half + 1; j <= MAX_KEYS; ++j) {
+            right_inner->children_[j - half - 1] = left_inner->children_[j];
+        }
+        right_inner->count_ = MAX_KEYS - half - 1;
+        left_inner->count_ = half;
+
+        relocate(&parent->keys()[i], &left_inner->keys()[half]);
+        right = right_inner;
+    }
+
+    for (u_integer j = parent->count_ + 1; j > i + 1; --j) {
+        parent->children_[j] = parent->children_[j - 1];
+    }
+    parent->children_[i + 1] = right;
+    parent->count_ += 1;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::u_integer original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::fillChild(innerNode* parent, const u_integer i)
+{
+    if (i > 0 && parent->children_[i - 1]->count_ > MIN_KEYS) {
+        this->borrowFromLeft(parent, i);
+        return i;
+    }
+    if (i < parent->count_ && parent->children_[i + 1]->count_ > MIN_KEYS) {
+        this->borrowFromRight(parent, i);
+        return i;
+    }
+    if (i < parent->count_) {
+        this->mergeChildren(parent, i);
+        return i;
+    }
+    this->mergeChildren(parent, i - 1);
+    return i - 1;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::borrowFromLeft(innerNode* parent, const u_integer i)
+{
+    bNode* child = parent->children_[i];
+    bNode* left = parent->children_[i - 1];
+
+    shiftRight(child->keys(), 0, child->count_);
+    if (child->leaf_) {
+        auto child_leaf = static_cast<leafNode*>(child);
+        auto left_leaf = static_cast<leafNode*>(left);
+        shiftRight(child_leaf->entries(), 0, child_leaf->count_);
+        relocate(&child_leaf->keys()[0], &left_leaf->keys()[left_leaf->count_ - 1]);
+        relocate(&child_leaf->entries()[0], &left_leaf->entries()[left_leaf->count_ - 1]);
+        parent->keys()[i - 1].~K_TYPE();
+        new (&parent->keys()[i - 1]) K_TYPE(child_leaf->keys()[0]);
+    } else {
+        auto child_inner = static_cast<innerNode*>(child);
+        auto left_inner = static_cast<innerNode*>(left);
+        for (u_integer j = child_inner->count_ + 1; j > 0; --j) {
+            child_inner->children_[j] = child_inner->children_[j - 1];
+        }
+        child_inner->children_[0] = left_inner->children_[left_inner->count_];
+        relocate(&child_inner->keys()[0], &parent->keys()[i - 1]);
+        relocate(&parent->keys()[i - 1], &left_inner->keys()[left_inner->count_ - 1]);
+    }
+    left->count_ -= 1;
+    child->count_ += 1;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::borrowFromRight(innerNode* parent, const u_integer i)
+{
+    bNode* child = parent->children_[i];
+    bNode* right = parent->children_[i + 1];
+
+    if (child->leaf_) {
+        auto child_leaf = static_cast<leafNode*>(child);
+        auto right_leaf = static_cast<leafNode*>(right);
+        relocate(&child_leaf->keys()[child_leaf->count_], &right_leaf->keys()[0]);
+        relocate(&child_leaf->entries()[child_leaf->count_], &right_leaf->entries()[0]);
+        shiftLeft(right_leaf->keys(), 0, right_leaf->count_);
+        shiftLeft(right_leaf->entries(), 0, right_leaf->count_);
+        parent->keys()[i].~K_TYPE();
+        new (&parent->keys()[i]) K_TYPE(right_leaf->keys()[0]);
+    } else {
+        auto child_inner = static_cast<innerNode*>(child);
+        auto right_inner = static_cast<innerNode*>(right);
+        relocate(&child_inner->keys()[child_inner->count_], &parent->keys()[i]);
+        child_inner->children_[child_inner->count_ + 1] = right_inner->children_[0];
+        relocate(&parent->keys()[i], &right_inner->keys()[0]);
+        shiftLeft(right_inner->keys(), 0, right_inner->count_);
+        for (u_integer j = 0; j < right_inner->count_; ++j) {
+            right_inner->children_[j] = right_inner->children_[j + 1];
+        }
+    }
+    right->count_ -= 1;
+    child->count_ += 1;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::mergeChildren(innerNode* parent, const u_integer i)
+{
+    bNode* left = parent->children_[i];
+    bNode* right = parent->children_[i + 1];
+
+    if (left->leaf_) {
+        auto left_leaf = static_cast<leafNode*>(left);
+        auto right_leaf = static_cast<leafNode*>(right);
+        for (u_integer j = 0; j < right_leaf->count_; ++j) {
+            relocate(&left_leaf->keys()[left_leaf->count_ + j], &right_leaf->keys()[j]);
+            relocate(&left_leaf->entries()[left_leaf->count_ + j], &right_leaf->entries()[j]);
+        }
+        left_leaf->count_ += right_leaf->count_;
+        right_leaf->count_ = 0;
+
+        left_leaf->next_ = right_leaf->next_;
+        if (left_leaf->next_) {
+            left_leaf->next_->prev_ = left_leaf;
+        }
+        parent->keys()[i].~K_TYPE();
+    } else {
+        auto left_inner = static_cast<innerNode*>(left);
+        auto right_inner = static_cast<innerNode*>(right);
+        relocate(&left_inner->keys()[left_inner->count_], &parent->keys()[i]);
+        for (u_integer j = 0; j < right_inner->count_; ++j) {
+            relocate(&left_inner->keys()[left_inner->count_ + 1 + j], &right_inner->keys()[j]);
+        }
+        for (u_integer j = 0; j <= right_inner->count_; ++j) {
+            left_inner->children_[left_inner->count_ + 1 + j] = right_inner->children_[j];
+        }
+        left_inner->count_ += right_inner->count_ + 1;
+        right_inner->count_ = 0;
+    }
+    this->destroyNode(right);
+
+    shiftLeft(parent->keys(), i, parent->count_);
+    for (u_integer j = i + 1; j < parent->count_; ++j) {
+        parent->children_[j] = parent->children_[j + 1];
+    }
+    parent->count_ -= 1;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::bTree(Compare compare)
+    : root_(nullptr), size_(0), compare_(std::move(compare)) {}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::findLeaf(const K_TYPE& key) const
+{
+    if (!this->root_) {
+        return nullptr;
+    }
+
+    bNode* node = this->root_;
+    while (!node->leaf_) {
+        node = static_cast<innerNode*>(node)->children_[this->upperIndex(node, key)];
+    }
+    return static_cast<leafNode*>(node);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::slotForward(leafNode* leaf, u_integer& index)
+{
+    if (leaf && index == leaf->count_) {
+        leaf = leaf->next_;
+        index = 0;
+    }
+    return leaf;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::slotBackward(leafNode* leaf, u_integer& index)
+{
+    if (!leaf) {
+        return nullptr;
+    }
+
+    if (index > 0) {
+        index -= 1;
+        return leaf;
+    }
+    leaf = leaf->prev_;
+    index = leaf ? leaf->count_ - 1 : 0;
+    return leaf;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::ceilingSlot(const K_TYPE& key, u_integer& index) const
+{
+    leafNode* leaf = this->findLeaf(key);
+    index = leaf ? this->lowerIndex(leaf, key) : 0;
+    return slotForward(leaf, index);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::higherSlot(const K_TYPE& key, u_integer& index) const
+{
+    leafNode* leaf = this->findLeaf(key);
+    index = leaf ? this->upperIndex(leaf, key) : 0;
+    return slotForward(leaf, index);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::floorSlot(const K_TYPE& key, u_integer& index) const
+{
+    leafNode* leaf = this->findLeaf(key);
+    index = leaf ? this->upperIndex(leaf, key) : 0;
+    return slotBackward(leaf, index);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::lowerSlot(const K_TYPE& key, u_integer& index) const
+{
+    leafNode* leaf = this->findLeaf(key);
+    index = leaf ? this->lowerIndex(leaf, key) : 0;
+    return slotBackward(leaf, index);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::leafNode*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::locate(const K_TYPE& key, u_integer& index) const
+{
+    leafNode* leaf = this->findLeaf(key);
+    if (!leaf) {
+        return nullptr;
+    }
+
+    const u_integer i = this->lowerIndex(leaf, key);
+    if (i < leaf->count_ && !this->compare_(key, leaf->keys()[i])) {
+        index = i;
+        return leaf;
+    }
+    return nullptr;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::couple<const K_TYPE, V_TYPE>*
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::find(const K_TYPE& key) const
+{
+    u_integer index = 0;
+    leafNode* leaf = this->locate(key, index);
+    return leaf ? &leaf->getVal(index) : nullptr;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::modify(const K_TYPE& key, const V_TYPE& value)
+{
+    auto entry = this->find(key);
+    if (!entry) {
+        return false;
+    }
+
+    entry->template set<1>(value);
+    return true;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::insert(const K_TYPE& key, const V_TYPE& value)
+{
+    if (!this->root_) {
+        this->root_ = this->createLeaf();
+    }
+    if (this->root_->count_ == MAX_KEYS) {
+        auto new_root = this->createInner();
+        new_root->children_[0] = this->root_;
+        this->root_ = new_root;
+        this->splitChild(new_root, 0);
+    }
+
+    bNode* node = this->root_;
+    while (!node->leaf_) {
+        auto inner = static_cast<innerNode*>(node);
+        u_integer i = this->upperIndex(inner, key);
+        if (inner->children_[i]->count_ == MAX_KEYS) {
+            this->splitChild(inner, i);
+            if (!this->compare_(key, inner->keys()[i])) {
+                i += 1;
+            }
+        }
+        node = inner->children_[i];
+    }
+
+    auto leaf = static_cast<leafNode*>(node);
+    const u_integer i = this->lowerIndex(leaf, key);
+    if (i < leaf->count_ && !this->compare_(key, leaf->keys()[i])) {
+        return false;
+    }
+
+    shiftRight(leaf->keys(), i, leaf->count_);
+    shiftRight(leaf->entries(), i, leaf->count_);
+    try {
+        new (&leaf->keys()[i]) K_TYPE(key);
+        try {
+            this->rebind_alloc.construct(&leaf->entries()[i], key, value);
+        } catch (...) {
+            leaf->keys()[i].~K_TYPE();
+            throw;
+        }
+    } catch (...) {
+        shiftLeft(leaf->keys(), i, leaf->count_ + 1);
+        shiftLeft(leaf->entries(), i, leaf->count_ + 1);
+        throw;
+    }
+    leaf->count_ += 1;
+    this->size_ += 1;
+    return true;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::erase(const K_TYPE& key)
+{
+    if (!this->root_) {
+        return false;
+    }
+
+    bNode* node = this->root_;
+    while (!node->leaf_) {
+        auto inner = static_cast<innerNode*>(node);
+        u_integer i = this->upperIndex(inner, key);
+        if (inner->children_[i]->count_ <= MIN_KEYS) {
+            i = this->fillChild(inner, i);
+            if (inner == this->root_ && inner->count_ == 0) {
+                // The root lost its last separator, its only child becomes the root
+                this->root_ = inner->children_[0];
+                this->destroyNode(inner);
+                node = this->root_;
+                continue;
+            }
+        }
+        node = inner->children_[i];
+    }
+
+    auto leaf = static_cast<leafNode*>(node);
+    const u_integer i = this->lowerIndex(leaf, key);
+    if (i >= leaf->count_ || this->compare_(key, leaf->keys()[i])) {
+        return false;
+    }
+
+    leaf->keys()[i].~K_TYPE();
+    this->rebind_alloc.destroy(&leaf->entries()[i]);
+    shiftLeft(leaf->keys(), i, leaf->count_);
+    shiftLeft(leaf->entries(), i, leaf->count_);
+    leaf->count_ -= 1;
+    this->size_ -= 1;
+
+    if (leaf == this->root_ && leaf->count_ == 0) {
+        this->destroyNode(leaf);
+        this->root_ = nullptr;
+    }
+    return true;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::u_integer original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::eraseRange(const K_TYPE& low, const K_TYPE& high)
+{
+    u_integer erased = 0;
+    u_integer index = 0;
+    for (auto leaf = this->ceilingSlot(low, index);
+         leaf && this->compare_(leaf->keys()[index], high);
+         leaf = this->ceilingSlot(low, index)) {
+        const K_TYPE key = leaf->keys()[index];
+        this->erase(key);
+        erased += 1;
+    }
+    return erased;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::bTree<K_TYPE, V_TYPE, ALLOC, Compare>::~bTree() {
+    this->destroyTree();
+}
+
+#endif //BTREE_H
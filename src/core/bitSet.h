@@ -1,17 +1,34 @@
 #ifndef BITSET_H
 #define BITSET_H
 
+#include <bit>
 #include "array.h"
 #include "couple.h"
 #include "iterationStream.h"
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define ORIGINAL_BITSET_SSE2 1
+#if ORIGINAL_COMPILER_GCC || ORIGINAL_COMPILER_CLANG
+#define ORIGINAL_BITSET_AVX2 1
+#endif
+#endif
+
 
 namespace original {
+    template<typename TYPE>
+    class filterStream;
+
     /**
      * @file bitSet.h
      * @brief BitSet class declaration.
      * @details This file contains the declaration of the bitSet class, which implements a
      *          space-efficient data structure for storing a set of bits.
+     *
+     *          Whole-set operations work on 64-bit blocks: count() uses popcount, the boolean
+     *          operators combine blocks in place with SSE2 on x86-64, switching to AVX2 at
+     *          runtime when the CPU supports it (GCC and Clang), and findFirst()/findNext()
+     *          skip empty blocks and locate set bits with countr_zero.
      */
 
     /**
@@ -28,19 +45,29 @@ namespace original {
     template<typename ALLOC = allocator<bool>>
     class bitSet final : public baseArray<bool, ALLOC>, public iterationStream<bool, bitSet<ALLOC>>{
             /**
-             * @brief Underlying storage type for bit blocks (unsigned integer)
+             * @brief Underlying storage type for bit blocks (64-bit unsigned integer)
              */
-            using underlying_type = u_integer;
+            using underlying_type = ul_integer;
 
             /**
              * @brief Rebound allocator type for underlying storage
-             * @details This is the allocator type rebound to manage underlying_type (u_integer)
+             * @details This is the allocator type rebound to manage underlying_type (ul_integer)
              *          instead of bool, since we store bits in blocks of unsigned integers.
              */
             using rebind_alloc_underlying = ALLOC::template rebind_alloc<underlying_type>;
 
             static constexpr integer BLOCK_MAX_SIZE = sizeof(underlying_type) * 8; ///< Maximum number of bits in a block.
 
+            /**
+             * @enum blockOperation
+             * @brief Boolean operation combining two blocks
+             */
+            enum class blockOperation {
+                AND,    ///< Keeps the bits set in both blocks
+                OR,     ///< Keeps the bits set in either block
+                XOR,    ///< Keeps the bits set in exactly one block
+            };
+
             /**
              * @brief Array to store the blocks of bits.
              * @details Uses a rebound allocator to manage memory for the underlying storage blocks.
@@ -139,6 +166,78 @@ namespace original {
              */
             static integer toOuterIdx(u_integer cur_block, integer cur_bit);
 
+            /**
+             * @brief Combines blocks in place: dst[i] = dst[i] OP src[i]
+             * @tparam OP Operation to apply
+             * @param dst Blocks to update
+             * @param src Blocks to combine with
+             * @param n Number of blocks
+             * @details Dispatches to the AVX2 kernel when the CPU supports it, otherwise
+             *          runs the SSE2 kernel, or a scalar loop off x86-64.
+             */
+            template<blockOperation OP>
+            static void applyBlocks(underlying_type* dst, const underlying_type* src, u_integer n);
+
+            /**
+             * @brief Portable kernel of applyBlocks, two 64-bit blocks per SSE2 step on x86-64
+             * @tparam OP Operation to apply
+             * @param dst Blocks to update
+             * @param src Blocks to combine with
+             * @param n Number of blocks
+             */
+            template<blockOperation OP>
+            static void applyBlocksBase(underlying_type* dst, const underlying_type* src, u_integer n);
+
+#if ORIGINAL_BITSET_AVX2
+            /**
+             * @brief AVX2 kernel of applyBlocks, four 64-bit blocks per step
+             * @tparam OP Operation to apply
+             * @param dst Blocks to update
+             * @param src Blocks to combine with
+             * @param n Number of blocks
+             */
+            template<blockOperation OP>
+            [[gnu::target("avx2")]]
+            static void applyBlocksAvx2(underlying_type* dst, const underlying_type* src, u_integer n);
+
+            /**
+             * @brief Popcount kernel compiled with the POPCNT instruction
+             * @param blocks Blocks to count
+             * @param n Number of blocks
+             * @return Number of set bits
+             */
+            [[gnu::target("popcnt")]]
+            static u_integer countBlocksPopcnt(const underlying_type* blocks, u_integer n);
+
+            /**
+             * @brief Checks once whether the CPU supports AVX2 and POPCNT
+             * @return true if both are available
+             */
+            static bool hasAvx2();
+#endif
+
+            /**
+             * @brief Counts the set bits of blocks with popcount
+             * @param blocks Blocks to count
+             * @param n Number of blocks
+             * @return Number of set bits
+             */
+            static u_integer countBlocks(const underlying_type* blocks, u_integer n);
+
+            /**
+             * @brief Gets a pointer to the first block
+             * @return Pointer to the blocks, or nullptr for a bitSet without blocks
+             * @details Unlike array::data(), safe to call on an empty bitSet.
+             */
+            [[nodiscard]] underlying_type* blocksData() const;
+
+            /**
+             * @brief Finds the first set bit at or after a global index
+             * @param from Global index to start from
+             * @return Index of the set bit, or size() if there is none
+             */
+            [[nodiscard]] u_integer scanFrom(u_integer from) const;
+
         public:
 
         /**
@@ -339,9 +438,27 @@ namespace original {
             /**
              * @brief Counts the number of bits set to true.
              * @return The count of true bits.
+             * @details One popcount per 64-bit block.
              */
             [[nodiscard]] u_integer count() const;
 
+            /**
+             * @brief Finds the first bit set to true.
+             * @return Index of the first set bit, or size() if no bit is set.
+             * @details Skips empty blocks and locates the bit with countr_zero.
+             */
+            [[nodiscard]] u_integer findFirst() const;
+
+            /**
+             * @brief Finds the next bit set to true after an index.
+             * @param index Index to search after.
+             * @return Index of the first set bit greater than index, or size() if there is none.
+             * @details Visiting every set bit with
+             *          for (auto i = bs.findFirst(); i < bs.size(); i = bs.findNext(i))
+             *          costs one countr_zero per set bit and one load per block.
+             */
+            [[nodiscard]] u_integer findNext(u_integer index) const;
+
             /**
              * @brief Resizes the bitSet to the given size.
              * @param new_size The new size for the bitSet.
@@ -401,6 +518,8 @@ namespace original {
              * @brief Performs a bitwise AND operation between two bitSets.
              * @param other The bitSet to AND with.
              * @return The result of the AND operation.
+             * @details Works in place on whole blocks. The size of this bitSet is kept: bits
+             *          of other beyond it are ignored and missing bits of other count as false.
              */
             bitSet& operator&=(const bitSet& other);
 
@@ -408,6 +527,7 @@ namespace original {
              * @brief Performs a bitwise OR operation between two bitSets.
              * @param other The bitSet to OR with.
              * @return The result of the OR operation.
+             * @details Works in place on whole blocks, sizes handled as in operator&=.
              */
             bitSet& operator|=(const bitSet& other);
 
@@ -415,6 +535,7 @@ namespace original {
              * @brief Performs a bitwise XOR operation between two bitSets.
              * @param other The bitSet to XOR with.
              * @return The result of the XOR operation.
+             * @details Works in place on whole blocks, sizes handled as in operator&=.
              */
             bitSet& operator^=(const bitSet& other);
 
@@ -466,6 +587,12 @@ namespace original {
              */
             template<typename ALLOC_>
             friend bitSet<ALLOC_> operator~(const bitSet<ALLOC_>& bs);
+
+            /**
+             * @brief Lets filterStream write batch evaluation results block by block.
+             */
+            template<typename TYPE>
+            friend class filterStream;
     };
 
     /**
@@ -522,7 +649,8 @@ namespace std {
     template<typename ALLOC>
     auto original::bitSet<ALLOC>::bitsetInit(const u_integer size) -> void
     {
-        this->map = array<underlying_type, rebind_alloc_underlying>((size + BLOCK_MAX_SIZE - 1) / BLOCK_MAX_SIZE, rebind_alloc_underlying{});
+        const u_integer blocks = size / BLOCK_MAX_SIZE + (size % BLOCK_MAX_SIZE != 0);
+        this->map = array<underlying_type, rebind_alloc_underlying>(blocks, rebind_alloc_underlying{});
         this->size_ = size;
     }
 
@@ -544,12 +672,16 @@ namespace std {
     template<typename ALLOC>
     auto original::bitSet<ALLOC>::clearHigherBitsFromBlock(const underlying_type block_value, const integer bit) -> underlying_type
     {
+        if (bit + 1 == BLOCK_MAX_SIZE)
+            return block_value;
         return block_value & (underlying_type{1} << (bit + 1)) - underlying_type{1};
     }
 
     template<typename ALLOC>
     auto original::bitSet<ALLOC>::clearRedundantBits() -> void
     {
+        if (this->size() == 0)
+            return;
         this->map.set(-1, clearHigherBitsFromBlock(this->map.get(-1), toInnerIdx(this->size() - 1).second()));
     }
 
@@ -584,6 +716,135 @@ namespace std {
         return cur_block *  BLOCK_MAX_SIZE + cur_bit;
     }
 
+    template<typename ALLOC>
+    template<typename original::bitSet<ALLOC>::blockOperation OP>
+    auto original::bitSet<ALLOC>::applyBlocks(underlying_type* dst, const underlying_type* src, const u_integer n) -> void
+    {
+#if ORIGINAL_BITSET_AVX2
+        if (hasAvx2()) {
+            applyBlocksAvx2<OP>(dst, src, n);
+            return;
+        }
+#endif
+        applyBlocksBase<OP>(dst, src, n);
+    }
+
+    template<typename ALLOC>
+    template<typename original::bitSet<ALLOC>::blockOperation OP>
+    auto original::bitSet<ALLOC>::applyBlocksBase(underlying_type* dst, const underlying_type* src, const u_integer n) -> void
+    {
+        u_integer i = 0;
+#if ORIGINAL_BITSET_SSE2
+        for (; i + 2 <= n; i += 2) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i r;
+            if constexpr (OP == blockOperation::AND) {
+                r = _mm_and_si128(a, b);
+            } else if constexpr (OP == blockOperation::OR) {
+                r = _mm_or_si128(a, b);
+            } else {
+                r = _mm_xor_si128(a, b);
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), r);
+        }
+#endif
+        for (; i < n; i++) {
+            if constexpr (OP == blockOperation::AND) {
+                dst[i] &= src[i];
+            } else if constexpr (OP == blockOperation::OR) {
+                dst[i] |= src[i];
+            } else {
+                dst[i] ^= src[i];
+            }
+        }
+    }
+
+#if ORIGINAL_BITSET_AVX2
+    template<typename ALLOC>
+    template<typename original::bitSet<ALLOC>::blockOperation OP>
+    [[gnu::target("avx2")]]
+    auto original::bitSet<ALLOC>::applyBlocksAvx2(underlying_type* dst, const underlying_type* src, const u_integer n) -> void
+    {
+        u_integer i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            __m256i r;
+            if constexpr (OP == blockOperation::AND) {
+                r = _mm256_and_si256(a, b);
+            } else if constexpr (OP == blockOperation::OR) {
+                r = _mm256_or_si256(a, b);
+            } else {
+                r = _mm256_xor_si256(a, b);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+        }
+        applyBlocksBase<OP>(dst + i, src + i, n - i);
+    }
+
+    template<typename ALLOC>
+    [[gnu::target("popcnt")]]
+    auto original::bitSet<ALLOC>::countBlocksPopcnt(const underlying_type* blocks, const u_integer n) -> u_integer
+    {
+        u_integer count = 0;
+        for (u_integer i = 0; i < n; i++) {
+            count += static_cast<u_integer>(std::popcount(blocks[i]));
+        }
+        return count;
+    }
+
+    template<typename ALLOC>
+    auto original::bitSet<ALLOC>::hasAvx2() -> bool
+    {
+        static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+        return supported;
+    }
+#endif
+
+    template<typename ALLOC>
+    auto original::bitSet<ALLOC>::blocksData() const -> underlying_type*
+    {
+        if (this->map.size() == 0)
+            return nullptr;
+        return &this->map.data();
+    }
+
+    template<typename ALLOC>
+    auto original::bitSet<ALLOC>::countBlocks(const underlying_type* blocks, const u_integer n) -> u_integer
+    {
+#if ORIGINAL_BITSET_AVX2
+        if (hasAvx2()) {
+            return countBlocksPopcnt(blocks, n);
+        }
+#endif
+        u_integer count = 0;
+        for (u_integer i = 0; i < n; i++) {
+            count += static_cast<u_integer>(std::popcount(blocks[i]));
+        }
+        return count;
+    }
+
+    template<typename ALLOC>
+    auto original::bitSet<ALLOC>::scanFrom(const u_integer from) const -> u_integer
+    {
+        if (from >= this->size())
+            return this->size();
+
+        const underlying_type* blocks = this->blocksData();
+        const u_integer total = this->map.size();
+        auto idx = toInnerIdx(from);
+        u_integer block = idx.first();
+        underlying_type cur = blocks[block] & ~underlying_type{0} << idx.second();
+        while (cur == 0) {
+            block += 1;
+            if (block == total)
+                return this->size();
+            cur = blocks[block];
+        }
+        return static_cast<u_integer>(toOuterIdx(block, std::countr_zero(cur)));
+    }
+
     template<typename ALLOC>
     original::bitSet<ALLOC>::Iterator::Iterator(const integer bit, const integer block, underlying_type* block_p, const bitSet* container)
         : cur_bit(bit), cur_block(block), block_(block_p), container_(container) {}
@@ -603,7 +864,7 @@ namespace std {
 
     template<typename ALLOC>
     auto original::bitSet<ALLOC>::Iterator::hasNext() const -> bool {
-        return toOuterIdx(this->cur_block, this->cur_bit) < this->container_->size() - 1;
+        return toOuterIdx(this->cur_block, this->cur_bit) < static_cast<integer>(this->container_->size()) - 1;
     }
 
     template<typename ALLOC>
@@ -657,6 +918,7 @@ namespace std {
     auto original::bitSet<ALLOC>::Iterator::operator+=(const integer steps) const -> void
     {
         auto new_idx = toInnerIdx(toOuterIdx(this->cur_block, this->cur_bit) + steps);
+        this->block_ += static_cast<integer>(new_idx.first()) - this->cur_block;
         this->cur_block = new_idx.first();
         this->cur_bit = new_idx.second();
     }
@@ -665,6 +927,7 @@ namespace std {
     auto original::bitSet<ALLOC>::Iterator::operator-=(const integer steps) const -> void
     {
         auto new_idx = toInnerIdx(toOuterIdx(this->cur_block, this->cur_bit) - steps);
+        this->block_ += static_cast<integer>(new_idx.first()) - this->cur_block;
         this->cur_block = new_idx.first();
         this->cur_bit = new_idx.second();
     }
@@ -711,7 +974,7 @@ namespace std {
     template<typename ALLOC>
     auto original::bitSet<ALLOC>::Iterator::isValid() const -> bool {
         const auto outer = toOuterIdx(this->cur_block, this->cur_bit);
-        return outer >= 0 && outer < this->container_->size();
+        return outer >= 0 && outer < static_cast<integer>(this->container_->size());
     }
 
     template<typename ALLOC>
@@ -782,15 +1045,17 @@ namespace std {
 
     template<typename ALLOC>
     auto original::bitSet<ALLOC>::count() const -> u_integer {
-        u_integer count = 0;
-        for (const auto& e : this->map) {
-            auto n = e;
-            while (n) {
-                n &= n - 1;
-                count += 1;
-            }
-        }
-        return count;
+        return countBlocks(this->blocksData(), this->map.size());
+    }
+
+    template<typename ALLOC>
+    auto original::bitSet<ALLOC>::findFirst() const -> u_integer {
+        return this->scanFrom(0);
+    }
+
+    template<typename ALLOC>
+    auto original::bitSet<ALLOC>::findNext(const u_integer index) const -> u_integer {
+        return this->scanFrom(index + 1);
     }
 
     template<typename ALLOC>
@@ -849,10 +1114,13 @@ namespace std {
 
     template<typename ALLOC>
     auto original::bitSet<ALLOC>::indexOf(const bool &e) const -> u_integer {
-        for (u_integer i = 0; i < this->size(); i++) {
-            if (auto idx = toInnerIdx(i);
-                e == this->getBit(idx.second(), idx.first())) {
-                return i;
+        if (e)
+            return this->findFirst();
+
+        const underlying_type* blocks = this->blocksData();
+        for (u_integer i = 0; i < this->map.size(); i++) {
+            if (blocks[i] != ~underlying_type{0}) {
+                return min(static_cast<u_integer>(toOuterIdx(i, std::countr_one(blocks[i]))), this->size());
             }
         }
         return this->size();
@@ -860,45 +1128,31 @@ namespace std {
 
     template<typename ALLOC>
     auto original::bitSet<ALLOC>::operator&=(const bitSet &other) -> bitSet& {
-        if (this->size() != other.size()) {
-            const auto resized = other.resize(this->size());
-            for (u_integer i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) & resized.map.get(i));
-            }
-        }else {
-            for (u_integer i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) & other.map.get(i));
-            }
+        const u_integer blocks = min(this->map.size(), other.map.size());
+        applyBlocks<blockOperation::AND>(this->blocksData(), other.blocksData(), blocks);
+        auto* tail = this->blocksData();
+        for (u_integer i = blocks; i < this->map.size(); i++) {
+            tail[i] = 0;
         }
         return *this;
     }
 
     template<typename ALLOC>
     auto original::bitSet<ALLOC>::operator|=(const bitSet &other) -> bitSet& {
-        if (this->size() != other.size()) {
-            const auto resized = other.resize(this->size());
-            for (u_integer i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) | resized.map.get(i));
-            }
-        }else {
-            for (u_integer i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) | other.map.get(i));
-            }
+        const u_integer blocks = min(this->map.size(), other.map.size());
+        applyBlocks<blockOperation::OR>(this->blocksData(), other.blocksData(), blocks);
+        if (other.size() > this->size()) {
+            this->clearRedundantBits();
         }
         return *this;
     }
 
     template<typename ALLOC>
     auto original::bitSet<ALLOC>::operator^=(const bitSet &other) -> bitSet& {
-        if (this->size() != other.size()) {
-            const auto resized = other.resize(this->size());
-            for (u_integer i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) ^ resized.map.get(i));
-            }
-        }else {
-            for (u_integer i = 0; i < this->map.size(); i++) {
-                this->map.set(i, this->map.get(i) ^ other.map.get(i));
-            }
+        const u_integer blocks = min(this->map.size(), other.map.size());
+        applyBlocks<blockOperation::XOR>(this->blocksData(), other.blocksData(), blocks);
+        if (other.size() > this->size()) {
+            this->clearRedundantBits();
         }
         return *this;
     }
@@ -932,8 +1186,9 @@ namespace std {
     template<typename ALLOC_>
     auto original::operator~(const bitSet<ALLOC_> &bs) -> bitSet<ALLOC_> {
         bitSet nbs(bs);
+        auto* blocks = nbs.blocksData();
         for (u_integer i = 0; i < nbs.map.size(); i++) {
-            nbs.map.set(i, ~nbs.map.get(i));
+            blocks[i] = ~blocks[i];
         }
         nbs.clearRedundantBits();
         return nbs;
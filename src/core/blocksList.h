@@ -796,7 +796,7 @@ namespace std {
     auto original::blocksList<TYPE, ALLOC>::Iterator::isValid() const -> bool
     {
         return this->container_->innerIdxToOuterIdx(this->cur_block, this->cur_pos) >= 0 &&
-               this->container_->innerIdxToOuterIdx(this->cur_block, this->cur_pos) < this->container_->size();
+               this->container_->innerIdxToOuterIdx(this->cur_block, this->cur_pos) < static_cast<integer>(this->container_->size());
     }
 
     template <typename TYPE, typename ALLOC>
@@ -865,7 +865,7 @@ namespace std {
         this->blocksListDestroy();
         this->map = vector<TYPE*>{};
 
-        for (integer i = 0; i < other.map.size(); ++i) {
+        for (u_integer i = 0; i < other.map.size(); ++i) {
             auto* block = this->blockArrayInit();
             for (u_integer j = 0; j < BLOCK_MAX_SIZE; ++j) {
                 block[j] = other.getElem(i, j);
@@ -981,7 +981,7 @@ namespace std {
     template <typename TYPE, typename ALLOC>
     auto original::blocksList<TYPE, ALLOC>::push(integer index, const TYPE& e) -> void
     {
-        if (this->parseNegIndex(index) == this->size())
+        if (this->parseNegIndex(index) == static_cast<integer>(this->size()))
         {
             this->pushEnd(e);
         } else if (this->parseNegIndex(index) == 0)
@@ -992,7 +992,7 @@ namespace std {
                 throw outOfBoundError();
 
             index = this->parseNegIndex(index);
-            const bool is_first = index <= (this->size() - 1) / 2;
+            const bool is_first = index <= static_cast<integer>(this->size() - 1) / 2;
             this->adjust(1, is_first);
             if (is_first){
                 this->moveElements(this->first_block, this->first_, index + 1, -1);
@@ -1017,7 +1017,7 @@ namespace std {
     {
         if (this->parseNegIndex(index) == 0)
             return this->popBegin();
-        if (this->parseNegIndex(index) == this->size() - 1)
+        if (this->parseNegIndex(index) == static_cast<integer>(this->size()) - 1)
             return this->popEnd();
         if (this->indexOutOfBound(index))
             throw outOfBoundError();
@@ -1025,7 +1025,7 @@ namespace std {
         index = this->parseNegIndex(index);
         auto idx = outerIdxToInnerIdx(index);
         TYPE res = this->getElem(idx.first(), idx.second());
-        if (index <= (this->size() - 1) / 2){
+        if (index <= static_cast<integer>(this->size() - 1) / 2){
             moveElements(this->first_block, this->first_, index, 1);
             auto new_idx = innerIdxOffset(this->first_block, this->first_, 1);
             this->first_block = new_idx.first();
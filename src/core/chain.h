@@ -28,9 +28,16 @@ namespace original {
      * @details Implements a classic doubly linked list with:
      * - Sentinel nodes for boundary management
      * - Bidirectional traversal capabilities
-     * - Index-based element access (O(n) complexity)
+     * - Index-based element access (O(n) complexity, O(1) for sequential or nearby indices)
      * - Deep copy semantics
      * - Custom memory allocation through allocator
+     *
+     * Indexed access keeps a finger, the last node reached by index together with its
+     * position. Each lookup walks from whichever of the head, the tail or the finger is
+     * closest. Only non-const indexed operations (operator[], set, push and pop at an
+     * index) move the finger, so loops over operator[] and accesses near the previous
+     * one take O(1) steps, while const get() only starts from it and stays safe to
+     * call from several threads at once.
      */
     template <typename TYPE, typename ALLOC = allocator<TYPE>>
     class chain final : public baseList<TYPE, ALLOC>, public iterationStream<TYPE, chain<TYPE, ALLOC>>{
@@ -134,15 +141,26 @@ namespace original {
         chainNode* begin_;      ///< Pointer to first element node
         chainNode* end_;        ///< Pointer to end sentinel node
         rebind_alloc_node rebind_alloc{};
+        chainNode* finger_ = nullptr; ///< Last node reached by a non-const indexed operation, nullptr if unset
+        u_integer finger_index_ = 0;  ///< Index of the finger node
 
 
         /**
          * @brief Finds the node at the given index.
          * @param index The index of the node to find.
          * @return The node at the given index.
+         * @details Walks from the nearest of the head, the tail and the finger.
+         *          Does not move the finger.
          */
         chainNode* findNode(integer index) const;
 
+        /**
+         * @brief Finds the node at the given index and moves the finger to it.
+         * @param index The index of the node to find.
+         * @return The node at the given index.
+         */
+        chainNode* fingerNode(integer index);
+
         /**
          * @brief Creates a new node using the rebound allocator
          * @param value The value to store in the new node
@@ -481,24 +499,41 @@ namespace std {
 
     template <typename TYPE, typename ALLOC>
     auto original::chain<TYPE, ALLOC>::findNode(integer index) const -> chainNode* {
-        const bool reverse_visit = index <= this->size() / 2 ? 0 : 1;
-        chainNode* cur;
-        if (!reverse_visit){
-            cur = this->begin_;
-            for(u_integer i = 0; i < index; i++)
-            {
-                cur = cur->getPNext();
-            }
-        } else{
+        const auto target = static_cast<u_integer>(index);
+        chainNode* cur = this->begin_;
+        u_integer pos = 0;
+        u_integer distance = target;
+        if (this->size() - 1 - target < distance){
             cur = this->end_;
-            for(u_integer i = this->size() - 1; i > index; i -= 1)
-            {
-                cur = cur->getPPrev();
+            pos = this->size() - 1;
+            distance = pos - target;
+        }
+        if (this->finger_ != nullptr){
+            const u_integer finger_distance = this->finger_index_ > target ?
+                this->finger_index_ - target : target - this->finger_index_;
+            if (finger_distance < distance){
+                cur = this->finger_;
+                pos = this->finger_index_;
             }
         }
+        for (; pos < target; pos += 1)
+        {
+            cur = cur->getPNext();
+        }
+        for (; pos > target; pos -= 1)
+        {
+            cur = cur->getPPrev();
+        }
         return cur;
     }
 
+    template <typename TYPE, typename ALLOC>
+    auto original::chain<TYPE, ALLOC>::fingerNode(integer index) -> chainNode* {
+        this->finger_ = this->findNode(index);
+        this->finger_index_ = static_cast<u_integer>(index);
+        return this->finger_;
+    }
+
     template<typename TYPE, typename ALLOC>
     auto original::chain<TYPE, ALLOC>::createNode(const TYPE &value, chainNode* prev, chainNode* next) -> chainNode* {
         auto node = this->rebind_alloc.allocate(1);
@@ -519,6 +554,7 @@ namespace std {
         this->size_ = 0;
         this->begin_ = pivot->getPNext();
         this->end_ = pivot;
+        this->finger_ = nullptr;
     }
 
     template <typename TYPE, typename ALLOC>
@@ -549,6 +585,7 @@ namespace std {
             this->destroyNode(current);
             current = prev;
         }
+        this->finger_ = nullptr;
     }
 
     template <typename TYPE, typename ALLOC>
@@ -679,6 +716,8 @@ namespace std {
         this->begin_ = other.begin_;
         this->end_ = other.end_;
         this->size_ = other.size_;
+        this->finger_ = other.finger_;
+        this->finger_index_ = other.finger_index_;
         if constexpr (ALLOC::propagate_on_container_move_assignment::value){
             this->allocator = std::move(other.allocator);
             this->rebind_alloc = std::move(other.rebind_alloc);
@@ -696,6 +735,8 @@ namespace std {
         std::swap(this->size_, other.size_);
         std::swap(this->begin_, other.begin_);
         std::swap(this->end_, other.end_);
+        std::swap(this->finger_, other.finger_);
+        std::swap(this->finger_index_, other.finger_index_);
         if constexpr (ALLOC::propagate_on_container_swap::value) {
             std::swap(this->allocator, other.allocator);
             std::swap(this->rebind_alloc, other.rebind_alloc);
@@ -749,7 +790,7 @@ namespace std {
             throw outOfBoundError("chain::operator[]: Index " + printable::formatString(index) +
                                  " out of bounds for chain of size " + printable::formatString(this->size()));
         }
-        chainNode* cur = this->findNode(this->parseNegIndex(index));
+        chainNode* cur = this->fingerNode(this->parseNegIndex(index));
         return cur->getVal();
     }
 
@@ -760,7 +801,7 @@ namespace std {
             throw outOfBoundError("chain::set: Index " + printable::formatString(index) +
                                  " out of bounds for chain of size " + printable::formatString(this->size()));
         }
-        auto cur = this->findNode(this->parseNegIndex(index));
+        auto cur = this->fingerNode(this->parseNegIndex(index));
         cur->setVal(e);
     }
 
@@ -788,6 +829,7 @@ namespace std {
             chainNode::connect(pivot, new_node);
             this->begin_ = new_node;
             this->size_ += 1;
+            this->finger_index_ += 1;
         }
     }
 
@@ -797,7 +839,7 @@ namespace std {
         index = this->parseNegIndex(index);
         if (index == 0){
             this->pushBegin(e);
-        } else if (index == this->size()){
+        } else if (index == static_cast<integer>(this->size())){
             this->pushEnd(e);
         } else{
             if (this->indexOutOfBound(index)){
@@ -810,6 +852,8 @@ namespace std {
             chainNode::connect(prev, new_node);
             chainNode::connect(new_node, cur);
             this->size_ += 1;
+            this->finger_ = new_node;
+            this->finger_index_ = index;
         }
     }
 
@@ -841,10 +885,14 @@ namespace std {
             res = this->begin_->getVal();
             auto new_begin = this->begin_->getPNext();
             auto pivot = this->begin_->getPPrev();
+            if (this->finger_ == this->begin_){
+                this->finger_ = nullptr;
+            }
             this->destroyNode(this->begin_);
             this->begin_ = new_begin;
             chainNode::connect(pivot, this->begin_);
             this->size_ -= 1;
+            this->finger_index_ -= 1;
         }
         return res;
     }
@@ -856,7 +904,7 @@ namespace std {
         if (index == 0){
             return this->popBegin();
         }
-        if (index == this->size() - 1){
+        if (index == static_cast<integer>(this->size()) - 1){
             return this->popEnd();
         }
         if (this->indexOutOfBound(index)){
@@ -871,6 +919,8 @@ namespace std {
         chainNode::connect(prev, next);
         this->destroyNode(cur);
         this->size_ -= 1;
+        this->finger_ = next;
+        this->finger_index_ = index;
         return res;
     }
 
@@ -888,6 +938,9 @@ namespace std {
         } else{
             res = this->end_->getVal();
             auto new_end = this->end_->getPPrev();
+            if (this->finger_ == this->end_){
+                this->finger_ = nullptr;
+            }
             this->destroyNode(this->end_);
             this->end_ = new_end;
             chainNode::connect(this->end_, nullptr);
@@ -56,6 +56,25 @@
 #endif
 /** @} */ // end of CompilerDetection group
 
+/**
+ * @defgroup BuildOptions Build Options
+ * @brief Macros configuring the library at build time
+ * @{
+ */
+
+/**
+ * @def ORIGINAL_LARGE_SIZE
+ * @brief Selects 64-bit sizes and indexes
+ * @details When defined to 1, u_integer is 64 bits wide, so containers, bitSets and
+ * allocators can hold more than 4,294,967,295 elements. Defaults to 0 (32-bit sizes).
+ * Set it through the ORIGINAL_LARGE_SIZE CMake option, which defines it for the
+ * library and every target linking it, as all translation units must agree on it.
+ */
+#ifndef ORIGINAL_LARGE_SIZE
+#define ORIGINAL_LARGE_SIZE 0
+#endif
+/** @} */ // end of BuildOptions group
+
 /**
  * @namespace original
  * @brief Main namespace for the project Original
@@ -253,14 +272,25 @@ namespace original {
      */
     using integer = std::int64_t;
 
+#if ORIGINAL_LARGE_SIZE
+    /**
+     * @brief 64-bit unsigned integer type for sizes and indexes
+     * @details Used for array indexing, sizes, and counts where negative values are not needed.
+     * Selected by ORIGINAL_LARGE_SIZE for containers beyond 4G elements.
+     * @note Range: 0 to 18,446,744,073,709,551,615
+     * @note Equivalent to std::uint64_t
+     */
+    using u_integer = std::uint64_t;
+#else
     /**
      * @brief 32-bit unsigned integer type for sizes and indexes
      * @details Used for array indexing, sizes, and counts where negative values are not needed.
      * @note Range: 0 to 4,294,967,295
-     * @warning Not suitable for very large containers (>4GB)
+     * @warning Not suitable for very large containers (>4G elements), see ORIGINAL_LARGE_SIZE
      * @note Equivalent to std::uint32_t
      */
     using u_integer = std::uint32_t;
+#endif
 
     /**
      * @brief 64-bit unsigned integer type
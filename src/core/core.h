@@ -11,8 +11,8 @@
  *
  * @subsection Containers
  * - Fixed-size containers: array, bitSet
- * - Variable-size containers: vector, forwardChain, chain, blocksList
- * - Associative containers: hashMap, treeMap, hashSet, treeSet, JSet, JMap
+ * - Variable-size containers: vector, forwardChain, chain, blocksList, ringBuffer
+ * - Associative containers: hashMap, treeMap, hashSet, treeSet, JSet, JMap, roaringBitmap
  * - Container adapters: stack, queue, deque, prique
  *
  * @subsection Memory_Management
@@ -61,6 +61,7 @@
 #include "baseArray.h"
 #include "baseList.h"
 #include "bitSet.h"
+#include "bTree.h"
 #include "blocksList.h"
 #include "chain.h"
 #include "cloneable.h"
@@ -90,13 +91,17 @@
 #include "prique.h"
 #include "queue.h"
 #include "randomAccessIterator.h"
+#include "rangeView.h"
 #include "RBTree.h"
 #include "refCntPtr.h"
+#include "ringBuffer.h"
+#include "roaringBitmap.h"
 #include "serial.h"
 #include "set.h"
 #include "singleDirectionIterator.h"
 #include "singleton.h"
 #include "skipList.h"
+#include "sortedMerge.h"
 #include "stack.h"
 #include "stepIterator.h"
 #include "transform.h"
@@ -80,8 +80,10 @@ namespace original
          * @brief Constructs from rvalue references
          * @param first First element to move
          * @param second Second element to move
+         * @note Takes non-const rvalues, so a couple with a const element type
+         *       (e.g. couple<const K, V>) can still move that element in
          */
-        couple(F_TYPE&& first, S_TYPE&& second);
+        couple(std::remove_const_t<F_TYPE>&& first, std::remove_const_t<S_TYPE>&& second);
 
         /**
          * @brief Copy constructor
@@ -281,7 +283,7 @@ namespace std {
         : first_(first), second_(second) {}
 
     template <typename F_TYPE, typename S_TYPE>
-    original::couple<F_TYPE, S_TYPE>::couple(F_TYPE&& first, S_TYPE&& second)
+    original::couple<F_TYPE, S_TYPE>::couple(std::remove_const_t<F_TYPE>&& first, std::remove_const_t<S_TYPE>&& second)
         : first_(std::move(first)), second_(std::move(second)) {}
 
     template <typename F_TYPE, typename S_TYPE>
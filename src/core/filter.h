@@ -1,6 +1,7 @@
 #ifndef FILTER_H
 #define FILTER_H
 #include "cloneable.h"
+#include "config.h"
 
 /**
  * @file filter.h
@@ -15,6 +16,10 @@
  *          - `notLessFilter`: checks if an element is greater than or equal to a target value.
  *          - `notGreaterFilter`: checks if an element is less than or equal to a target value.
  *          - `rangeFilter`: checks if an element lies within a given range.
+ *
+ *          Besides single elements, every filter can be applied to a contiguous block of elements,
+ *          producing one bit per element. The comparison filters implement the block form as a
+ *          tight loop without virtual calls, which the compiler can vectorize.
  */
 
 namespace original {
@@ -37,6 +42,27 @@ namespace original {
          */
         virtual bool match(const TYPE& t) const;
 
+        /**
+         * @brief Determines which elements of a block match the filter condition.
+         * @param data The first element of the block.
+         * @param n The number of elements in the block.
+         * @param words Output bits, bit `i % 64` of `words[i / 64]` is set if `data[i]` matches.
+         * @details The default implementation calls `match` for every element. Bits past `n`
+         *          in the last word are cleared.
+         */
+        virtual void matchBlock(const TYPE* data, u_integer n, ul_integer* words) const;
+
+        /**
+         * @brief Packs the results of a predicate over a block into bits.
+         * @tparam PRED Predicate type, inlined into the loop.
+         * @param data The first element of the block.
+         * @param n The number of elements in the block.
+         * @param words Output bits, bits past `n` in the last word are cleared.
+         * @param pred The predicate applied to every element.
+         */
+        template<typename PRED>
+        static void matchWords(const TYPE* data, u_integer n, ul_integer* words, PRED pred);
+
     public:
         /**
          * @brief Virtual destructor for the filter class.
@@ -55,6 +81,15 @@ namespace original {
          * @return `true` if the element matches the filter, `false` otherwise.
          */
         bool operator()(const TYPE& t) const;
+
+        /**
+         * @brief Applies the filter to a block of elements.
+         * @param data The first element of the block.
+         * @param n The number of elements in the block.
+         * @param words Output bits, bit `i % 64` of `words[i / 64]` is set if `data[i]` matches.
+         *              Must hold at least `(n + 63) / 64` words.
+         */
+        void operator()(const TYPE* data, u_integer n, ul_integer* words) const;
     };
 
     /**
@@ -75,6 +110,14 @@ namespace original {
          */
         bool match(const TYPE& t) const override;
 
+        /**
+         * @brief Determines which elements of a block match, without a virtual call per element.
+         * @param data The first element of the block.
+         * @param n The number of elements in the block.
+         * @param words Output bits, one per element.
+         */
+        void matchBlock(const TYPE* data, u_integer n, ul_integer* words) const override;
+
     public:
         /**
          * @brief Constructs an equalFilter with the target value.
@@ -107,6 +150,14 @@ namespace original {
          */
         bool match(const TYPE& t) const override;
 
+        /**
+         * @brief Determines which elements of a block match, without a virtual call per element.
+         * @param data The first element of the block.
+         * @param n The number of elements in the block.
+         * @param words Output bits, one per element.
+         */
+        void matchBlock(const TYPE* data, u_integer n, ul_integer* words) const override;
+
     public:
         /**
          * @brief Constructs a notEqualFilter with the target value.
@@ -139,6 +190,14 @@ namespace original {
          */
         bool match(const TYPE& t) const override;
 
+        /**
+         * @brief Determines which elements of a block match, without a virtual call per element.
+         * @param data The first element of the block.
+         * @param n The number of elements in the block.
+         * @param words Output bits, one per element.
+         */
+        void matchBlock(const TYPE* data, u_integer n, ul_integer* words) const override;
+
     public:
         /**
          * @brief Constructs a lessFilter with the target value.
@@ -171,6 +230,14 @@ namespace original {
          */
         bool match(const TYPE& t) const override;
 
+        /**
+         * @brief Determines which elements of a block match, without a virtual call per element.
+         * @param data The first element of the block.
+         * @param n The number of elements in the block.
+         * @param words Output bits, one per element.
+         */
+        void matchBlock(const TYPE* data, u_integer n, ul_integer* words) const override;
+
     public:
         /**
          * @brief Constructs a greaterFilter with the target value.
@@ -203,6 +270,14 @@ namespace original {
          */
         bool match(const TYPE& t) const override;
 
+        /**
+         * @brief Determines which elements of a block match, without a virtual call per element.
+         * @param data The first element of the block.
+         * @param n The number of elements in the block.
+         * @param words Output bits, one per element.
+         */
+        void matchBlock(const TYPE* data, u_integer n, ul_integer* words) const override;
+
     public:
         /**
          * @brief Constructs a notLessFilter with the target value.
@@ -235,6 +310,14 @@ namespace original {
          */
         bool match(const TYPE& t) const override;
 
+        /**
+         * @brief Determines which elements of a block match, without a virtual call per element.
+         * @param data The first element of the block.
+         * @param n The number of elements in the block.
+         * @param words Output bits, one per element.
+         */
+        void matchBlock(const TYPE* data, u_integer n, ul_integer* words) const override;
+
     public:
         /**
          * @brief Constructs a notGreaterFilter with the target value.
@@ -268,6 +351,14 @@ namespace original {
          */
         bool match(const TYPE& t) const override;
 
+        /**
+         * @brief Determines which elements of a block match, without a virtual call per element.
+         * @param data The first element of the block.
+         * @param n The number of elements in the block.
+         * @param words Output bits, one per element.
+         */
+        void matchBlock(const TYPE* data, u_integer n, ul_integer* words) const override;
+
     public:
         /**
          * @brief Constructs a rangeFilter with the specified range.
@@ -290,6 +381,31 @@ namespace original {
         return true;
     }
 
+    template<typename TYPE>
+    void original::filter<TYPE>::matchBlock(const TYPE* data, const u_integer n, ul_integer* words) const {
+        matchWords(data, n, words, [this](const TYPE& t) { return this->match(t); });
+    }
+
+    template<typename TYPE>
+    template<typename PRED>
+    void original::filter<TYPE>::matchWords(const TYPE* data, const u_integer n, ul_integer* words, PRED pred) {
+        u_integer i = 0;
+        for (; i + 64 <= n; i += 64) {
+            ul_integer word = 0;
+            for (u_integer j = 0; j < 64; ++j) {
+                word |= static_cast<ul_integer>(pred(data[i + j])) << j;
+            }
+            words[i / 64] = word;
+        }
+        if (i < n) {
+            ul_integer word = 0;
+            for (u_integer j = 0; i + j < n; ++j) {
+                word |= static_cast<ul_integer>(pred(data[i + j])) << j;
+            }
+            words[i / 64] = word;
+        }
+    }
+
     template <typename TYPE>
     auto original::filter<TYPE>::clone() const -> filter*
     {
@@ -301,11 +417,21 @@ namespace original {
         return this->match(t);
     }
 
+    template<typename TYPE>
+    void original::filter<TYPE>::operator()(const TYPE* data, const u_integer n, ul_integer* words) const {
+        this->matchBlock(data, n, words);
+    }
+
     template<typename TYPE>
     bool original::equalFilter<TYPE>::match(const TYPE& t) const {
         return t == target;
     }
 
+    template<typename TYPE>
+    void original::equalFilter<TYPE>::matchBlock(const TYPE* data, const u_integer n, ul_integer* words) const {
+        filter<TYPE>::matchWords(data, n, words, [target = this->target](const TYPE& t) { return t == target; });
+    }
+
     template<typename TYPE>
     original::equalFilter<TYPE>::equalFilter(const TYPE& target)
             : target(target) {}
@@ -321,6 +447,11 @@ namespace original {
         return t != target;
     }
 
+    template<typename TYPE>
+    void original::notEqualFilter<TYPE>::matchBlock(const TYPE* data, const u_integer n, ul_integer* words) const {
+        filter<TYPE>::matchWords(data, n, words, [target = this->target](const TYPE& t) { return t != target; });
+    }
+
     template<typename TYPE>
     original::notEqualFilter<TYPE>::notEqualFilter(const TYPE& target)
             : target(target) {}
@@ -336,6 +467,11 @@ namespace original {
         return t < low;
     }
 
+    template<typename TYPE>
+    void original::lessFilter<TYPE>::matchBlock(const TYPE* data, const u_integer n, ul_integer* words) const {
+        filter<TYPE>::matchWords(data, n, words, [low = this->low](const TYPE& t) { return t < low; });
+    }
+
     template<typename TYPE>
     original::lessFilter<TYPE>::lessFilter(const TYPE& low)
             : low(low) {}
@@ -351,6 +487,11 @@ namespace original {
         return t > high;
     }
 
+    template<typename TYPE>
+    void original::greaterFilter<TYPE>::matchBlock(const TYPE* data, const u_integer n, ul_integer* words) const {
+        filter<TYPE>::matchWords(data, n, words, [high = this->high](const TYPE& t) { return t > high; });
+    }
+
     template<typename TYPE>
     original::greaterFilter<TYPE>::greaterFilter(const TYPE& high)
             : high(high) {}
@@ -366,6 +507,11 @@ namespace original {
         return t >= high;
     }
 
+    template<typename TYPE>
+    void original::notLessFilter<TYPE>::matchBlock(const TYPE* data, const u_integer n, ul_integer* words) const {
+        filter<TYPE>::matchWords(data, n, words, [high = this->high](const TYPE& t) { return t >= high; });
+    }
+
     template<typename TYPE>
     original::notLessFilter<TYPE>::notLessFilter(const TYPE& high)
             : high(high) {}
@@ -381,6 +527,11 @@ namespace original {
         return t <= low;
     }
 
+    template<typename TYPE>
+    void original::notGreaterFilter<TYPE>::matchBlock(const TYPE* data, const u_integer n, ul_integer* words) const {
+        filter<TYPE>::matchWords(data, n, words, [low = this->low](const TYPE& t) { return t <= low; });
+    }
+
     template<typename TYPE>
     original::notGreaterFilter<TYPE>::notGreaterFilter(const TYPE& low)
             : low(low) {}
@@ -396,6 +547,11 @@ namespace original {
         return t >= low && t <= high;
     }
 
+    template<typename TYPE>
+    void original::rangeFilter<TYPE>::matchBlock(const TYPE* data, const u_integer n, ul_integer* words) const {
+        filter<TYPE>::matchWords(data, n, words, [low = this->low, high = this->high](const TYPE& t) { return t >= low && t <= high; });
+    }
+
     template<typename TYPE>
     original::rangeFilter<TYPE>::rangeFilter(const TYPE& low, const TYPE& high)
             : low(low), high(high) {}
@@ -2,8 +2,10 @@
 #define FILTERSTREAM_H
 
 #include "filter.h"
+#include "bitSet.h"
 #include "chain.h"
 #include "refCntPtr.h"
+#include "vector.h"
 
 
 /**
@@ -12,6 +14,13 @@
 * @details Implements a stream-like structure for combining multiple filters through logical operators.
 * Supports AND/OR/NOT operations and explicit grouping via group() function.
 * Uses postfix notation for internal evaluation and avoids direct parenthesis usage.
+*
+* On first evaluation the stream is compiled into a flat program held in a vector: a leaf test
+* per filter, with short-circuit jumps after the left operand of every AND/OR. Elements are
+* evaluated by running the program with a single accumulator, so each element costs one virtual
+* call per filter actually tested and no list traversal. evaluate() runs the same program over
+* blocks of elements, applying every filter to a whole block at once and combining the resulting
+* bit masks word by word.
 */
 
 namespace original{
@@ -32,9 +41,41 @@ namespace original{
         /// @internal Operator types for postfix conversion
         enum class opts{AND = 1, OR = 0, NOT = 2, LEFT_BRACKET = 3, RIGHT_BRACKET = 4};
 
+        /// @internal Operation codes of the compiled program
+        enum class code{
+            TEST,           ///< Evaluates leaf filter arg
+            NOT,            ///< Negates the current value
+            AND,            ///< Combines the two topmost block masks (no-op per element)
+            OR,             ///< Combines the two topmost block masks (no-op per element)
+            JUMP_IF_FALSE,  ///< Jumps to arg if the current value is false
+            JUMP_IF_TRUE,   ///< Jumps to arg if the current value is true
+        };
+
+        /// @internal Instruction of the compiled program
+        struct instruction{
+            code op;        ///< Operation code
+            u_integer arg;  ///< Leaf index for TEST, target for jumps
+        };
+
+        /// @internal Node of the expression tree built while compiling
+        struct exprNode{
+            opts op;            ///< Operator, LEFT_BRACKET marks a leaf
+            u_integer left;     ///< Left operand node, or leaf index for leaves
+            u_integer right;    ///< Right operand node
+        };
+
+        /// Number of elements evaluated together by evaluate(), a multiple of 64
+        static constexpr u_integer BLOCK_SIZE = 1024;
+
+        /// Number of 64-bit words in the mask of one block
+        static constexpr u_integer BLOCK_WORDS = BLOCK_SIZE / 64;
+
         mutable chain<strongPtr<filter<TYPE>>> stream; ///< Filter operand chain
         mutable chain<opts> ops; ///< Operator sequence storage
-        mutable bool flag; ///< Postfix conversion status flag
+        mutable bool flag; ///< Compilation status flag, cleared by every modification
+        mutable vector<instruction> program; ///< Compiled evaluation program
+        mutable vector<const filter<TYPE>*> leaves; ///< Leaf filters in program order, owned by stream
+        mutable u_integer depth; ///< Maximum number of block masks alive during evaluate()
 
     protected:
         /**
@@ -80,10 +121,20 @@ namespace original{
         void pushAll(const filterStream& fs);
 
         /**
-        * @brief Convert infix notation to postfix
-        * @details Internal implementation of Shunting Yard algorithm
+        * @brief Compile the stream into the evaluation program
+        * @details Parses the infix stream with the Shunting Yard algorithm into an expression
+        *          tree and emits it as a flat program with short-circuit jumps. The stream
+        *          itself is left unchanged, so it can still be extended afterward.
+        */
+        void compile() const;
+
+        /**
+        * @brief Emit the program of an expression subtree
+        * @param nodes Expression tree nodes
+        * @param index Root of the subtree
+        * @param height Number of block masks alive before the subtree is evaluated
         */
-        void toPostFix() const;
+        void emit(const vector<exprNode>& nodes, u_integer index, u_integer height) const;
 
     public:
         ~filterStream() = default;
@@ -130,6 +181,19 @@ namespace original{
         */
         bool operator()(const TYPE& t) const;
 
+        /**
+        * @brief Batch filter evaluation
+        * @tparam ALLOC Allocator type of the result bitSet
+        * @param data First element to test
+        * @param n Number of elements to test
+        * @param out Result, resized to n bits; bit i is set if data[i] passes the filter chain
+        * @details Evaluates blocks of BLOCK_SIZE elements: every filter is applied to the whole
+        *          block at once, and the operands of AND/OR are skipped for a block whose left
+        *          operand already decides every element.
+        */
+        template<typename ALLOC>
+        void evaluate(const TYPE* data, u_integer n, bitSet<ALLOC>& out) const;
+
         // Friend operator implementations
         template<typename T>
         friend filterStream<T> operator&&(const filter<T>& f1, const filter<T>& f2);
@@ -258,11 +322,12 @@ namespace original{
 } // namespace original
 
     template <typename TYPE>
-    original::filterStream<TYPE>::filterStream() : stream(), ops(), flag(false) {}
+    original::filterStream<TYPE>::filterStream() : stream(), ops(), flag(false), program(), leaves(), depth(0) {}
 
     template <typename TYPE>
     auto original::filterStream<TYPE>::addBrackets() -> void
     {
+        this->flag = false;
         this->stream.pushBegin(nullFilter);
         this->stream.pushEnd(nullFilter);
         this->ops.pushBegin(opts::LEFT_BRACKET);
@@ -272,6 +337,7 @@ namespace original{
     template <typename TYPE>
     auto original::filterStream<TYPE>::addAndOpt() -> void
     {
+        this->flag = false;
         this->stream.pushEnd(nullFilter);
         this->ops.pushEnd(opts::AND);
     }
@@ -279,6 +345,7 @@ namespace original{
     template <typename TYPE>
     auto original::filterStream<TYPE>::addOrOpt() -> void
     {
+        this->flag = false;
         this->stream.pushEnd(nullFilter);
         this->ops.pushEnd(opts::OR);
     }
@@ -286,6 +353,7 @@ namespace original{
     template <typename TYPE>
     auto original::filterStream<TYPE>::addNotOpt() -> void
     {
+        this->flag = false;
         this->stream.pushBegin(nullFilter);
         this->ops.pushBegin(opts::NOT);
     }
@@ -293,12 +361,14 @@ namespace original{
     template <typename TYPE>
     auto original::filterStream<TYPE>::pushEnd(const filter<TYPE>& f) -> void
     {
+        this->flag = false;
         this->stream.pushEnd(strongPtr<filter<TYPE>>(f.clone()));
     }
 
     template <typename TYPE>
     auto original::filterStream<TYPE>::pushAll(const filterStream& fs) -> void
     {
+        this->flag = false;
         for (auto& filter: fs.stream)
         {
             this->stream.pushEnd(filter);
@@ -310,19 +380,27 @@ namespace original{
     }
 
     template <typename TYPE>
-    auto original::filterStream<TYPE>::toPostFix() const -> void{
-        this->flag = true;
-
-        chain<strongPtr<filter<TYPE>>> stream_post;
-        chain<opts> ops_post;
+    auto original::filterStream<TYPE>::compile() const -> void{
+        vector<exprNode> nodes;
+        vector<u_integer> operands;
         chain<opts> ops_tmp;
+        this->leaves = vector<const filter<TYPE>*>();
+
+        auto reduce = [&](const opts op){
+            const u_integer right = operands.popEnd();
+            const u_integer left = op == opts::NOT ? right : operands.popEnd();
+            nodes.pushEnd(exprNode{op, left, right});
+            operands.pushEnd(nodes.size() - 1);
+        };
 
         auto it_stream = this->stream.begins();
         auto it_ops = this->ops.begins();
 
         while (it_stream->isValid()){
             if (it_stream->get() != nullFilter){
-                stream_post.pushEnd(it_stream->get());
+                nodes.pushEnd(exprNode{opts::LEFT_BRACKET, this->leaves.size(), 0});
+                operands.pushEnd(nodes.size() - 1);
+                this->leaves.pushEnd(it_stream->get().get());
             } else if (it_ops->isValid()){
                 switch (it_ops->get()) {
                     case opts::LEFT_BRACKET:
@@ -330,8 +408,7 @@ namespace original{
                         break;
                     case opts::RIGHT_BRACKET:
                         while (!ops_tmp.empty() && ops_tmp[-1] != opts::LEFT_BRACKET){
-                            stream_post.pushEnd(nullFilter);
-                            ops_post.pushEnd(ops_tmp.popEnd());
+                            reduce(ops_tmp.popEnd());
                         }
                         ops_tmp.popEnd();
                         break;
@@ -342,8 +419,7 @@ namespace original{
                         while (!ops_tmp.empty()
                                && ops_tmp[-1] >= it_ops->get()
                                && ops_tmp[-1] != opts::LEFT_BRACKET){
-                            stream_post.pushEnd(nullFilter);
-                            ops_post.pushEnd(ops_tmp.popEnd());
+                            reduce(ops_tmp.popEnd());
                         }
                         ops_tmp.pushEnd(it_ops->get());
                         break;
@@ -352,15 +428,53 @@ namespace original{
             }
             it_stream->next();
         }
+        delete it_ops;
+        delete it_stream;
 
         while (!ops_tmp.empty()){
-            stream_post.pushEnd(nullFilter);
-            ops_post.pushEnd(ops_tmp.popEnd());
+            reduce(ops_tmp.popEnd());
+        }
+
+        this->program = vector<instruction>();
+        this->depth = 0;
+        this->emit(nodes, operands[-1], 0);
+
+        // Thread jumps landing on a jump of the same kind: the value it tests is unchanged
+        for (u_integer i = 0; i < this->program.size(); ++i) {
+            instruction& ins = this->program[i];
+            if (ins.op != code::JUMP_IF_FALSE && ins.op != code::JUMP_IF_TRUE)
+                continue;
+            while (ins.arg < this->program.size() && this->program[ins.arg].op == ins.op){
+                ins.arg = this->program[ins.arg].arg;
+            }
+        }
+        this->flag = true;
+    }
+
+    template <typename TYPE>
+    auto original::filterStream<TYPE>::emit(const vector<exprNode>& nodes, const u_integer index,
+                                            const u_integer height) const -> void{
+        const exprNode& node = nodes[index];
+        switch (node.op) {
+            case opts::LEFT_BRACKET:
+                this->program.pushEnd(instruction{code::TEST, node.left});
+                this->depth = max(this->depth, height + 1);
+                break;
+            case opts::NOT:
+                this->emit(nodes, node.left, height);
+                this->program.pushEnd(instruction{code::NOT, 0});
+                break;
+            default: {
+                const bool is_and = node.op == opts::AND;
+                this->emit(nodes, node.left, height);
+                const u_integer jump = this->program.size();
+                this->program.pushEnd(instruction{is_and ? code::JUMP_IF_FALSE : code::JUMP_IF_TRUE, 0});
+                this->emit(nodes, node.right, height + 1);
+                this->program.pushEnd(instruction{is_and ? code::AND : code::OR, 0});
+                this->program[jump].arg = this->program.size();
+                break;
+            }
         }
-        this->stream = stream_post;
-        this->ops = ops_post;
-        delete it_ops;
-        delete it_stream;
     }
 
     template <typename TYPE>
@@ -482,34 +596,112 @@ namespace original{
 
     template <typename TYPE>
     auto original::filterStream<TYPE>::operator()(const TYPE &t) const -> bool {
-        if (!this->flag) this->toPostFix();
-
-        chain<bool> value_stack;
-        auto it_stream = this->stream.begins();
-        auto it_ops = this->ops.begins();
+        if (!this->flag) this->compile();
+
+        const instruction* code_ptr = &this->program.data();
+        const u_integer size = this->program.size();
+        bool value = false;
+        u_integer pc = 0;
+        while (pc < size){
+            const instruction& ins = code_ptr[pc];
+            switch (ins.op) {
+                case code::TEST:
+                    value = this->leaves[ins.arg]->operator()(t);
+                    break;
+                case code::NOT:
+                    value = !value;
+                    break;
+                case code::JUMP_IF_FALSE:
+                    if (!value){
+                        pc = ins.arg;
+                        continue;
+                    }
+                    break;
+                case code::JUMP_IF_TRUE:
+                    if (value){
+                        pc = ins.arg;
+                        continue;
+                    }
+                    break;
+                default:
+                    // The right operand decides once the left one did not jump
+                    break;
+            }
+            pc += 1;
+        }
+        return value;
+    }
 
-        while (it_stream->isValid()){
-            if (it_stream->get() != nullFilter){
-                value_stack.pushEnd(it_stream->get()->operator()(t));
-            } else if (it_ops->isValid()){
-                switch (it_ops->get()) {
-                    case opts::NOT:
-                        value_stack[-1] = !value_stack[-1];
+    template <typename TYPE>
+    template <typename ALLOC>
+    auto original::filterStream<TYPE>::evaluate(const TYPE* data, const u_integer n, bitSet<ALLOC>& out) const -> void {
+        if (!this->flag) this->compile();
+        if (out.size() != n) out = bitSet<ALLOC>(n);
+        if (n == 0) return;
+
+        const instruction* code_ptr = &this->program.data();
+        const u_integer size = this->program.size();
+        vector<ul_integer> masks(this->depth * BLOCK_WORDS, allocator<ul_integer>{}, ul_integer{0});
+        ul_integer* stack = &masks.data();
+        ul_integer* result = &out.map.data();
+
+        for (u_integer base = 0; base < n; base += BLOCK_SIZE){
+            const u_integer count = min(BLOCK_SIZE, n - base);
+            const u_integer words = (count + 63) / 64;
+            const ul_integer last_word = count % 64 == 0 ? ~ul_integer{0} : (ul_integer{1} << count % 64) - 1;
+            u_integer top = 0;
+            u_integer pc = 0;
+            while (pc < size){
+                const instruction& ins = code_ptr[pc];
+                ul_integer* value = stack + (top > 0 ? top - 1 : 0) * BLOCK_WORDS;  // Topmost mask
+                switch (ins.op) {
+                    case code::TEST:
+                        this->leaves[ins.arg]->operator()(data + base, count, stack + top * BLOCK_WORDS);
+                        top += 1;
                         break;
-                    default:
-                        const bool right = value_stack.popEnd();
-                        const bool left = value_stack.popEnd();
-                        value_stack.pushEnd(it_ops->get() == opts::AND ?
-                                                left && right : left || right);
+                    case code::NOT:
+                        for (u_integer w = 0; w < words; ++w){
+                            value[w] = ~value[w];
+                        }
+                        value[words - 1] &= last_word;
                         break;
+                    case code::AND: {
+                        ul_integer* left = value - BLOCK_WORDS;
+                        for (u_integer w = 0; w < words; ++w){
+                            left[w] &= value[w];
+                        }
+                        top -= 1;
+                        break;
+                    }
+                    case code::OR: {
+                        ul_integer* left = value - BLOCK_WORDS;
+                        for (u_integer w = 0; w < words; ++w){
+                            left[w] |= value[w];
+                        }
+                        top -= 1;
+                        break;
+                    }
+                    case code::JUMP_IF_FALSE:
+                    case code::JUMP_IF_TRUE: {
+                        // Jump if every element of the block is already decided
+                        const ul_integer full = ins.op == code::JUMP_IF_TRUE ? ~ul_integer{0} : 0;
+                        bool decided = (value[words - 1] | ~last_word) == (full | ~last_word);
+                        for (u_integer w = 0; decided && w + 1 < words; ++w){
+                            decided = value[w] == full;
+                        }
+                        if (decided){
+                            pc = ins.arg;
+                            continue;
+                        }
+                        break;
+                    }
                 }
-                it_ops->next();
+                pc += 1;
+            }
+            for (u_integer w = 0; w < words; ++w){
+                result[base / 64 + w] = masks[w];
             }
-            it_stream->next();
         }
-        delete it_ops;
-        delete it_stream;
-        return value_stack[-1];
     }
 
 #endif //FILTERSTREAM_H
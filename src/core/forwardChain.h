@@ -462,7 +462,7 @@ namespace original {
     auto original::forwardChain<TYPE, ALLOC>::findNode(const integer index) const -> forwardChainNode* {
         if (this->size() == 0) return this->begin_;
         auto cur = this->beginNode();
-        for(u_integer i = 0; i < index; i++)
+        for(u_integer i = 0; static_cast<integer>(i) < index; i++)
         {
             cur = cur->getPNext();
         }
@@ -709,7 +709,7 @@ namespace original {
         index = this->parseNegIndex(index);
         if (index == 0){
             this->pushBegin(e);
-        } else if (index == this->size()){
+        } else if (index == static_cast<integer>(this->size())){
             this->pushEnd(e);
         } else{
             if (this->indexOutOfBound(index)){
@@ -762,7 +762,7 @@ namespace original {
         if (index == 0){
             return this->popBegin();
         }
-        if (index == this->size() - 1){
+        if (index == static_cast<integer>(this->size()) - 1){
             return this->popEnd();
         }
         if (this->indexOutOfBound(index)){
@@ -1,6 +1,7 @@
 #ifndef HASHTABLE_H
 #define HASHTABLE_H
 
+#include <cstdint>
 #include "allocator.h"
 #include "couple.h"
 #include "hash.h"
@@ -22,18 +23,225 @@
  * - Base class for hash-based containers
  * - Printable interface support
  * - Dynamic resizing based on load factor
- * - Predefined bucket sizes for optimal performance
+ * - Pluggable bucket sizing: prime bucket counts by default,
+ *   power-of-two bucket counts with hash mixing as an opt-in policy
+ * - Pluggable rehashing: all at once by default, or migrated a few buckets
+ *   per insertion to bound the latency of a single insertion
  * - Exception-safe implementation
  */
 
 namespace original {
 
+    /**
+     * @class primeBucketSizing
+     * @brief Default bucket sizing policy of hashTable
+     * @details Grows and shrinks along a table of primes and maps a hash code to
+     * a bucket with a modulo. Prime counts spread even weak hash functions (such as
+     * the identity hash used for integers) over all buckets, at the price of an
+     * integer division on every lookup.
+     */
+    class primeBucketSizing {
+    public:
+        /**
+         * @brief Size of BUCKETS_SIZES
+         * @ref BUCKETS_SIZES
+         */
+        static constexpr u_integer BUCKETS_SIZES_COUNT = ORIGINAL_LARGE_SIZE ? 38 : 30;
+
+        /**
+         * @brief Predefined bucket sizes for hash table resizing
+         * @details An array of prime numbers carefully selected for hash table bucket sizes.
+         * These primes are used during table resizing to maintain optimal performance characteristics.
+         *
+         * Key Properties:
+         * - All values are prime numbers to reduce hash collisions
+         * - Each size is approximately double the previous (with some variance)
+         * - Covers a wide range from small to very large tables
+         * - Specifically chosen to avoid common modulo patterns
+         *
+         * Selection Criteria:
+         * 1. Primes spaced roughly exponentially (growth factor ~1.8-2.2)
+         * 2. Avoid primes close to powers of 2 to prevent clustering
+         * 3. Sufficient gaps between sizes to justify resize operations
+         * 4. Includes sizes suitable for both small and large datasets
+         *
+         * Performance Impact:
+         * - Larger sizes reduce collisions but increase memory usage
+         * - Smaller sizes conserve memory but may increase collisions
+         * - The growth factor balances between resize frequency and memory overhead
+         *
+         * The sequence continues until reaching sizes suitable for maximum practical
+         * in-memory hash tables (over 100 million buckets). With ORIGINAL_LARGE_SIZE it
+         * goes on past 2^32 with the largest prime below each power of two up to 2^40.
+         *
+         * @note The actual resize operation only occurs when the load factor
+         * exceeds thresholds, not necessarily at every size transition.
+         *
+         * @see hashTable::LOAD_FACTOR_MIN
+         * @see hashTable::LOAD_FACTOR_MAX
+         */
+        static constexpr u_integer BUCKETS_SIZES[] = {
+                17,          29,          53,          97,          193,
+                389,         769,         1543,        3079,        6151,
+                12289,       24593,       49157,       98317,       196613,
+
+                393241,      786433,      1572869,     3145739,     6291469,
+                12582917,    25165843,    50331653,    100663319,   201326611,
+
+                402653189,   805306457,   1610612741,  3221225473,  4294967291,
+#if ORIGINAL_LARGE_SIZE
+                8589934583,  17179869143, 34359738337, 68719476731, 137438953447,
+                274877906899, 549755813881, 1099511627689,
+#endif
+        };
+
+        /**
+         * @brief Gets the bucket count of a new table
+         * @return Smallest predefined prime
+         */
+        static u_integer initialSize() noexcept;
+
+        /**
+         * @brief Gets the bucket count after expansion
+         * @param current Current bucket count
+         * @return Next larger predefined prime
+         * @throw outOfBoundError if already at maximum size
+         */
+        static u_integer nextSize(u_integer current);
+
+        /**
+         * @brief Gets the bucket count after shrinking
+         * @param current Current bucket count
+         * @return Next smaller predefined prime, or the smallest one
+         */
+        static u_integer prevSize(u_integer current) noexcept;
+
+        /**
+         * @brief Maps a hash code to a bucket
+         * @param code Hash code of the key
+         * @param bucket_count Current bucket count
+         * @return code modulo bucket_count
+         */
+        static u_integer bucketOf(u_integer code, u_integer bucket_count) noexcept;
+    };
+
+    /**
+     * @class powerOfTwoBucketSizing
+     * @brief Opt-in bucket sizing policy with power-of-two bucket counts
+     * @details Replaces the modulo by a bit mask. Since a mask only keeps the low
+     * bits of the hash code, the code is first passed through a 64-bit avalanche
+     * finalizer (the MurmurHash3 fmix64 step), so sequential or identity-hashed
+     * keys still land in different buckets.
+     *
+     * Select it through the hashTable template parameter, or through the
+     * powerOfTwoHashTable alias for hashMap and hashSet:
+     * @code
+     * hashMap<int, int, hash<int>, allocator<couple<const int, int>>, powerOfTwoHashTable> map;
+     * @endcode
+     */
+    class powerOfTwoBucketSizing {
+    public:
+        /**
+         * @brief Bucket count of a new table, also the smallest count after shrinking
+         */
+        static constexpr u_integer MIN_SIZE = 16;
+
+        /**
+         * @brief Largest power of two representable by u_integer
+         */
+        static constexpr u_integer MAX_SIZE = static_cast<u_integer>(1) << (sizeof(u_integer) * 8 - 1);
+
+        /**
+         * @brief Scrambles a hash code so every input bit affects every output bit
+         * @param code Hash code to mix
+         * @return Mixed hash code
+         */
+        static u_integer mix(u_integer code) noexcept;
+
+        /**
+         * @brief Gets the bucket count of a new table
+         * @return MIN_SIZE
+         */
+        static u_integer initialSize() noexcept;
+
+        /**
+         * @brief Gets the bucket count after expansion
+         * @param current Current bucket count
+         * @return Twice the current count
+         * @throw outOfBoundError if already at MAX_SIZE
+         */
+        static u_integer nextSize(u_integer current);
+
+        /**
+         * @brief Gets the bucket count after shrinking
+         * @param current Current bucket count
+         * @return Half the current count, but at least MIN_SIZE
+         */
+        static u_integer prevSize(u_integer current) noexcept;
+
+        /**
+         * @brief Maps a hash code to a bucket
+         * @param code Hash code of the key
+         * @param bucket_count Current bucket count (power of two)
+         * @return Low bits of the mixed code
+         */
+        static u_integer bucketOf(u_integer code, u_integer bucket_count) noexcept;
+    };
+
+    /**
+     * @class eagerRehash
+     * @brief Default rehash policy of hashTable
+     * @details A resize relinks every node into the new bucket array inside the
+     * insertion or removal that crossed the load factor threshold. Cheapest in total,
+     * but that single operation costs O(n).
+     */
+    class eagerRehash {
+    public:
+        /**
+         * @brief Buckets migrated per mutating operation, 0 means all at once
+         */
+        static constexpr u_integer STEP_BUCKETS = 0;
+    };
+
+    /**
+     * @class incrementalRehash
+     * @tparam STEPS Old buckets migrated per insertion (must be positive)
+     * @brief Opt-in rehash policy spreading a resize over many insertions
+     * @details A resize only allocates the new bucket array. The old array stays
+     * alive, and every following insertion moves the next STEPS old buckets into
+     * the new one until the old array is empty (Redis dict style). Lookups and
+     * removals consult both arrays while the migration is in progress.
+     *
+     * Removals never move nodes, so they keep iterators valid as with eagerRehash;
+     * a shrink that a removal would have triggered starts at the next insertion.
+     * Growing needs about 1.4 migrated buckets per insertion and shrinking about 2
+     * to finish before the next threshold is reached, so the default of 16 leaves
+     * a wide margin. No new resize starts before a migration finishes.
+     *
+     * Select it through the hashTable template parameter, or through the
+     * incrementalHashTable alias for hashMap and hashSet:
+     * @code
+     * hashMap<int, int, hash<int>, allocator<couple<const int, int>>, incrementalHashTable> map;
+     * @endcode
+     */
+    template<u_integer STEPS = 16>
+    class incrementalRehash {
+        static_assert(STEPS > 0, "incrementalRehash needs at least one bucket per step");
+    public:
+        /**
+         * @brief Buckets migrated per mutating operation
+         */
+        static constexpr u_integer STEP_BUCKETS = STEPS;
+    };
+
     /**
      * @class hashTable
      * @tparam K_TYPE Key type (must be hashable)
      * @tparam V_TYPE Value type
      * @tparam ALLOC Allocator type (default: allocator<K_TYPE>)
      * @tparam HASH Hash function type (default: hash<K_TYPE>)
+     * @tparam SIZING Bucket sizing policy (default: primeBucketSizing)
+     * @tparam REHASH Rehash policy (default: eagerRehash)
      * @brief Hash table implementation with separate chaining
      * @details This class provides a generic hash table implementation that serves as the
      * base for hash-based containers. It implements:
@@ -51,7 +259,8 @@ namespace original {
      * - Automatic resizing when load factor thresholds are crossed
      * - Exception safety (basic guarantee)
      */
-    template<typename K_TYPE, typename V_TYPE, typename ALLOC = allocator<K_TYPE>, typename HASH = hash<K_TYPE>>
+    template<typename K_TYPE, typename V_TYPE, typename ALLOC = allocator<K_TYPE>, typename HASH = hash<K_TYPE>,
+             typename SIZING = primeBucketSizing, typename REHASH = eagerRehash>
     class hashTable{
     protected:
 
@@ -179,6 +388,12 @@ namespace original {
          */
         using buckets_type = vector<hashNode*, rebind_alloc_pointer>;
 
+        /**
+         * @typedef rebind_alloc_buckets
+         * @brief Rebound allocator type for the old bucket array of a migration
+         */
+        using rebind_alloc_buckets = typename ALLOC::template rebind_alloc<buckets_type>;
+
         /**
          * @brief Minimum load factor before shrinking
          */
@@ -190,57 +405,17 @@ namespace original {
         static constexpr floating LOAD_FACTOR_MAX = 0.75;
 
         /**
-         * @brief Size of BUCKETS_SIZES
-         * @ref BUCKETS_SIZES
+         * @brief Whether REHASH migrates buckets over several operations
          */
-        static constexpr u_integer BUCKETS_SIZES_COUNT = 30;
-
-        /**
-         * @brief Predefined bucket sizes for hash table resizing
-         * @details An array of prime numbers carefully selected for hash table bucket sizes.
-         * These primes are used during table resizing to maintain optimal performance characteristics.
-         *
-         * Key Properties:
-         * - All values are prime numbers to reduce hash collisions
-         * - Each size is approximately double the previous (with some variance)
-         * - Covers a wide range from small to very large tables
-         * - Specifically chosen to avoid common modulo patterns
-         *
-         * Selection Criteria:
-         * 1. Primes spaced roughly exponentially (growth factor ~1.8-2.2)
-         * 2. Avoid primes close to powers of 2 to prevent clustering
-         * 3. Sufficient gaps between sizes to justify resize operations
-         * 4. Includes sizes suitable for both small and large datasets
-         *
-         * Performance Impact:
-         * - Larger sizes reduce collisions but increase memory usage
-         * - Smaller sizes conserve memory but may increase collisions
-         * - The growth factor balances between resize frequency and memory overhead
-         *
-         * The sequence continues until reaching sizes suitable for maximum practical
-         * in-memory hash tables (over 100 million buckets).
-         *
-         * @note The actual resize operation only occurs when the load factor
-         * exceeds thresholds, not necessarily at every size transition.
-         *
-         * @see LOAD_FACTOR_MIN
-         * @see LOAD_FACTOR_MAX
-         */
-        static constexpr u_integer BUCKETS_SIZES[] = {
-                17,          29,          53,          97,          193,
-                389,         769,         1543,        3079,        6151,
-                12289,       24593,       49157,       98317,       196613,
-
-                393241,      786433,      1572869,     3145739,     6291469,
-                12582917,    25165843,    50331653,    100663319,   201326611,
-
-                402653189,   805306457,   1610612741,  3221225473,  4294967291
-        };
+        static constexpr bool INCREMENTAL = REHASH::STEP_BUCKETS != 0;
 
         u_integer size_;
         buckets_type buckets;
+        buckets_type* old_buckets;
+        u_integer migrate_pos;
         HASH hash_;
         mutable rebind_alloc_node rebind_alloc{};
+        mutable rebind_alloc_buckets buckets_alloc{};
 
         /**
          * @class Iterator
@@ -256,42 +431,46 @@ namespace original {
          * - Lightweight copy semantics
          * - STL-style iteration interface
          *
-         * @note Iterators remain valid unless the table is rehashed
+         * Buckets are numbered across both arrays: the current array first, then the
+         * old array of an incremental rehash in progress.
+         *
+         * @note Iterators remain valid unless the table is rehashed. While an
+         * incremental rehash is in progress, every insertion migrates buckets and
+         * therefore invalidates iterators as well; removals do not.
          */
         class Iterator {
+            friend class hashTable;
         protected:
-            mutable vector<hashNode*, rebind_alloc_pointer>* p_buckets;
+            mutable const hashTable* p_table;
             mutable u_integer cur_bucket;
             mutable hashNode* p_node;
 
             /**
              * @brief Finds the next non-empty bucket
-             * @param buckets Reference to buckets vector
+             * @param table Table to search
              * @param bucket Starting bucket index
-             * @return Index of next non-empty bucket or buckets.size() if none
+             * @return Index of next non-empty bucket or table->totalBuckets() if none
              * @internal
              */
-            static u_integer findNextValidBucket(vector<hashNode *, rebind_alloc_pointer> *buckets,
-                                              u_integer bucket);
+            static u_integer findNextValidBucket(const hashTable* table, u_integer bucket);
 
             /**
              * @brief Finds the previous non-empty bucket
-             * @param buckets Reference to buckets vector
+             * @param table Table to search
              * @param bucket Starting bucket index
-             * @return Index of previous non-empty bucket or buckets.size() if none
+             * @return Index of previous non-empty bucket or table->totalBuckets() if none
              * @internal
              */
-            static u_integer findPrevValidBucket(vector<hashNode *, rebind_alloc_pointer> *buckets,
-                                             u_integer bucket);
+            static u_integer findPrevValidBucket(const hashTable* table, u_integer bucket);
 
             /**
              * @brief Constructs an iterator pointing to specific position
-             * @param buckets Pointer to buckets vector
+             * @param table Table to iterate
              * @param bucket Current bucket index
              * @param node Current node pointer
              * @note Protected constructor for use by hashTable only
              */
-            explicit Iterator(vector<hashNode*, rebind_alloc_pointer>* buckets = nullptr,
+            explicit Iterator(const hashTable* table = nullptr,
                               u_integer bucket = 0, hashNode* node = nullptr);
 
             /**
@@ -306,6 +485,13 @@ namespace original {
              * @return Reference to this iterator
              */
             Iterator& operator=(const Iterator& other);
+
+            /**
+             * @brief Checks if two iterators point to the same position
+             * @param other Iterator to compare with
+             * @return true if both refer to the same node of the same table
+             */
+            [[nodiscard]] bool equalTo(const Iterator& other) const;
         public:
             /**
               * @brief Checks if more elements are available
@@ -412,6 +598,43 @@ namespace original {
          */
         hashNode* getBucket(const K_TYPE& key) const;
 
+        /**
+         * @brief Checks whether an incremental rehash is in progress
+         * @return true if old buckets still hold nodes to migrate
+         */
+        bool migrating() const noexcept;
+
+        /**
+         * @brief Gets the number of buckets across both arrays
+         * @return Current bucket count plus the old bucket count while migrating
+         */
+        u_integer totalBuckets() const noexcept;
+
+        /**
+         * @brief Gets a bucket head by its index across both arrays
+         * @param index Bucket index, see totalBuckets()
+         * @return Pointer to first node in bucket's chain
+         */
+        hashNode* bucketAt(u_integer index) const;
+
+        /**
+         * @brief Searches a single bucket array for a key
+         * @param target Bucket array to search
+         * @param code Hash code of the key
+         * @param key Key to search for
+         * @return Pointer to node if found, nullptr otherwise
+         */
+        hashNode* findIn(const buckets_type& target, u_integer code, const K_TYPE& key) const;
+
+        /**
+         * @brief Removes a key from a single bucket array
+         * @param target Bucket array to remove from
+         * @param code Hash code of the key
+         * @param key Key to remove
+         * @return true if key existed in target and was removed
+         */
+        bool eraseFrom(buckets_type& target, u_integer code, const K_TYPE& key);
+
         /**
          * @brief Calculates current load factor
          * @return Current elements/buckets ratio
@@ -420,14 +643,14 @@ namespace original {
 
         /**
          * @brief Gets next appropriate bucket size for expansion
-         * @return Next larger bucket size from predefined primes
+         * @return Next larger bucket size given by SIZING
          * @throw outOfBoundError if already at maximum size
          */
         u_integer getNextSize() const;
 
         /**
          * @brief Gets previous appropriate bucket size for shrinking
-         * @return Next smaller bucket size from predefined primes
+         * @return Next smaller bucket size given by SIZING
          */
         u_integer getPrevSize() const;
 
@@ -442,20 +665,81 @@ namespace original {
          */
         void rehash(u_integer new_bucket_count);
 
+        /**
+         * @brief Moves the next REHASH::STEP_BUCKETS old buckets into the current array
+         * @details Releases the old array once every bucket has been migrated.
+         */
+        void migrateStep();
+
+        /**
+         * @brief Starts a migration with the given array as the old buckets
+         * @param from Bucket array to migrate from
+         */
+        void createOldBuckets(buckets_type&& from);
+
+        /**
+         * @brief Releases the old bucket array and ends the migration
+         * @note The old buckets must already be empty
+         */
+        void destroyOldBuckets() noexcept;
+
         /**
          * @brief Adjusts table size based on load factor
          * @details Checks current load factor and resizes if:
          * - loadFactor() >= LOAD_FACTOR_MAX: expands table
          * - loadFactor() <= LOAD_FACTOR_MIN: shrinks table
+         *
+         * With incrementalRehash a resize only starts a migration, and while it is
+         * in progress each call migrates one more step instead of checking the load factor.
+         * Only insertions call it then, so that removals never move nodes.
          */
         void adjust();
 
+        /**
+         * @brief Destroys all nodes, leaving every bucket empty
+         * @details Also drops the old bucket array of an unfinished migration.
+         */
+        void destroyNodes() noexcept;
+
         /**
          * @brief Constructs empty hashTable
          * @param hash Hash function to use
          */
         explicit hashTable(HASH hash = HASH{});
 
+        /**
+         * @brief Creates an iterator at the first element
+         * @return Iterator to the first element, or an invalid iterator if empty
+         */
+        Iterator firstIterator() const;
+
+        /**
+         * @brief Creates an iterator at the last element
+         * @return Iterator to the last element, or an invalid iterator if empty
+         */
+        Iterator lastIterator() const;
+
+        /**
+         * @brief Replaces the contents with a deep copy of another table
+         * @param other Table to copy
+         * @note Allocators are copied if propagate_on_container_copy_assignment is true
+         */
+        void tableCopy(const hashTable& other);
+
+        /**
+         * @brief Takes over the contents of another table
+         * @param other Table to move from, left empty
+         * @note Allocators are moved if propagate_on_container_move_assignment is true
+         */
+        void tableMove(hashTable&& other) noexcept;
+
+        /**
+         * @brief Exchanges contents with another table
+         * @param other Table to swap with
+         * @note Allocators are swapped if propagate_on_container_swap is true
+         */
+        void tableSwap(hashTable& other) noexcept;
+
         /**
          * @brief Finds node for given key
          * @param key Key to search for
@@ -484,7 +768,8 @@ namespace original {
          * @brief Removes key-value pair
          * @param key Key to remove
          * @return true if key existed and was removed
-         * @note Automatically adjusts table size if needed
+         * @note Automatically adjusts table size if needed, except with
+         * incrementalRehash, where resizing is left to insertions
          */
         bool erase(const K_TYPE& key);
 
@@ -494,20 +779,99 @@ namespace original {
          */
         ~hashTable();
     };
+
+    /**
+     * @brief hashTable with power-of-two buckets, usable as the TABLE engine of hashMap and hashSet
+     * @tparam K_TYPE Key type (must be hashable)
+     * @tparam V_TYPE Value type
+     * @tparam ALLOC Allocator type (default: allocator<K_TYPE>)
+     * @tparam HASH Hash function type (default: hash<K_TYPE>)
+     * @see powerOfTwoBucketSizing
+     */
+    template<typename K_TYPE, typename V_TYPE, typename ALLOC = allocator<K_TYPE>, typename HASH = hash<K_TYPE>>
+    using powerOfTwoHashTable = hashTable<K_TYPE, V_TYPE, ALLOC, HASH, powerOfTwoBucketSizing>;
+
+    /**
+     * @brief hashTable with incremental rehashing, usable as the TABLE engine of hashMap and hashSet
+     * @tparam K_TYPE Key type (must be hashable)
+     * @tparam V_TYPE Value type
+     * @tparam ALLOC Allocator type (default: allocator<K_TYPE>)
+     * @tparam HASH Hash function type (default: hash<K_TYPE>)
+     * @see incrementalRehash
+     */
+    template<typename K_TYPE, typename V_TYPE, typename ALLOC = allocator<K_TYPE>, typename HASH = hash<K_TYPE>>
+    using incrementalHashTable = hashTable<K_TYPE, V_TYPE, ALLOC, HASH, primeBucketSizing, incrementalRehash<>>;
+}
+
+inline original::u_integer original::primeBucketSizing::initialSize() noexcept {
+    return BUCKETS_SIZES[0];
+}
+
+inline original::u_integer original::primeBucketSizing::nextSize(const u_integer current) {
+    for (u_integer i : BUCKETS_SIZES){
+        if (current < i){
+            return i;
+        }
+    }
+    throw outOfBoundError();
+}
+
+inline original::u_integer original::primeBucketSizing::prevSize(const u_integer current) noexcept {
+    for (u_integer i = BUCKETS_SIZES_COUNT - 1; i > 0; --i){
+        if (BUCKETS_SIZES[i] < current){
+            return BUCKETS_SIZES[i];
+        }
+    }
+    return BUCKETS_SIZES[0];
+}
+
+inline original::u_integer
+original::primeBucketSizing::bucketOf(const u_integer code, const u_integer bucket_count) noexcept {
+    return code % bucket_count;
+}
+
+inline original::u_integer original::powerOfTwoBucketSizing::mix(const u_integer code) noexcept {
+    auto h = static_cast<std::uint64_t>(code);
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return static_cast<u_integer>(h);
+}
+
+inline original::u_integer original::powerOfTwoBucketSizing::initialSize() noexcept {
+    return MIN_SIZE;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::hashNode(const K_TYPE& key, const V_TYPE& value, hashNode* next)
+inline original::u_integer original::powerOfTwoBucketSizing::nextSize(const u_integer current) {
+    if (current >= MAX_SIZE) {
+        throw outOfBoundError();
+    }
+    return current * 2;
+}
+
+inline original::u_integer original::powerOfTwoBucketSizing::prevSize(const u_integer current) noexcept {
+    return current / 2 > MIN_SIZE ? current / 2 : MIN_SIZE;
+}
+
+inline original::u_integer
+original::powerOfTwoBucketSizing::bucketOf(const u_integer code, const u_integer bucket_count) noexcept {
+    return mix(code) & (bucket_count - 1);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::hashNode(const K_TYPE& key, const V_TYPE& value, hashNode* next)
     : data_({key, value}), next_(next) {}
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::hashNode(const hashNode& other) : hashNode() {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::hashNode(const hashNode& other) : hashNode() {
     this->operator=(other);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode&
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::operator=(const hashNode& other) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode&
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::operator=(const hashNode& other) {
     if (this == &other)
         return *this;
     this->data_ = other.data_;
@@ -515,123 +879,130 @@ original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::operator=(const hash
     return *this;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
 original::couple<const K_TYPE, V_TYPE>&
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getVal() {
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::getVal() {
     return this->data_;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
 const original::couple<const K_TYPE, V_TYPE>&
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getVal() const {
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::getVal() const {
     return this->data_;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-const K_TYPE& original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getKey() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+const K_TYPE& original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::getKey() const {
     return this->getVal().first();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-const V_TYPE& original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getValue() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+const V_TYPE& original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::getValue() const {
     return this->getVal().second();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-V_TYPE& original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getValue() {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+V_TYPE& original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::getValue() {
     return this->getVal().second();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::setVal(couple<const K_TYPE, V_TYPE>) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::setVal(couple<const K_TYPE, V_TYPE>) {
     throw unSupportedMethodError();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::setValue(const V_TYPE &value) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::setValue(const V_TYPE &value) {
     this->data_.template set<1>(value);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode*
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getPPrev() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode*
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::getPPrev() const {
     throw unSupportedMethodError();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode*
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getPNext() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode*
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::getPNext() const {
     return this->next_;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::setPNext(hashNode *new_next) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::setPNext(hashNode *new_next) {
     this->next_ = new_next;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::connect(hashNode *prev, hashNode *next) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode::connect(hashNode *prev, hashNode *next) {
     if (prev != nullptr) prev->setPNext(next);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
 original::u_integer
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::findNextValidBucket(
-    vector<hashNode *, rebind_alloc_pointer> *buckets, const u_integer bucket) {
-    for (u_integer i = bucket + 1; i < buckets->size(); i++) {
-        if ((*buckets)[i])
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::findNextValidBucket(const hashTable* table, const u_integer bucket) {
+    const u_integer total = table->totalBuckets();
+    for (u_integer i = bucket + 1; i < total; i++) {
+        if (table->bucketAt(i))
             return i;
     }
-    return buckets->size();
+    return total;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
 original::u_integer
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::findPrevValidBucket(
-    vector<hashNode*, rebind_alloc_pointer> *buckets, const u_integer bucket) {
-    if (bucket == 0) return buckets->size();
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::findPrevValidBucket(const hashTable* table, const u_integer bucket) {
+    const u_integer total = table->totalBuckets();
+    if (bucket == 0) return total;
     for (u_integer i = bucket - 1; i > 0; i--) {
-        if ((*buckets)[i])
+        if (table->bucketAt(i))
             return i;
     }
-    if ((*buckets)[0]) {
+    if (table->bucketAt(0)) {
         return 0;
     }
-    return buckets->size();
+    return total;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::Iterator(
-    vector<hashNode *, rebind_alloc_pointer> *buckets, const u_integer bucket, hashNode *node)
-    : p_buckets(buckets), cur_bucket(bucket), p_node(node) {}
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::Iterator(const hashTable* table, const u_integer bucket, hashNode *node)
+    : p_table(table), cur_bucket(bucket), p_node(node) {}
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::Iterator(const Iterator &other) : Iterator() {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::Iterator(const Iterator &other) : Iterator() {
     this->operator=(other);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator&
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::operator=(const Iterator &other) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator&
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::operator=(const Iterator &other) {
     if (this == &other)
         return *this;
 
-    this->p_buckets = other.p_buckets;
+    this->p_table = other.p_table;
+    this->cur_bucket = other.cur_bucket;
     this->p_node = other.p_node;
     return *this;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::hasNext() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::equalTo(const Iterator& other) const {
+    return this->p_table == other.p_table &&
+           this->cur_bucket == other.cur_bucket &&
+           this->p_node == other.p_node;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::hasNext() const {
     if (this->p_node && this->p_node->getPNext()) {
         return true;
     }
 
-    return Iterator::findNextValidBucket(this->p_buckets, this->cur_bucket) != this->p_buckets->size();
+    return Iterator::findNextValidBucket(this->p_table, this->cur_bucket) != this->p_table->totalBuckets();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::next() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::next() const {
     if (!this->isValid()) {
         throw outOfBoundError();
     }
@@ -641,19 +1012,19 @@ void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::next() const {
         return;
     }
 
-    if (auto next_bucket = Iterator::findNextValidBucket(this->p_buckets, this->cur_bucket);
-        next_bucket != this->p_buckets->size()) {
+    if (auto next_bucket = Iterator::findNextValidBucket(this->p_table, this->cur_bucket);
+        next_bucket != this->p_table->totalBuckets()) {
         this->cur_bucket = next_bucket;
-        this->p_node = this->p_buckets->get(next_bucket);
+        this->p_node = this->p_table->bucketAt(next_bucket);
         return;
     }
 
-    this->cur_bucket = this->p_buckets->size();
+    this->cur_bucket = this->p_table->totalBuckets();
     this->p_node = nullptr;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::operator+=(const integer steps) const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::operator+=(const integer steps) const {
     if (steps < 0) {
         throw unSupportedMethodError();
     }
@@ -663,9 +1034,9 @@ void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::operator+=(cons
     }
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
 original::couple<const K_TYPE, V_TYPE>&
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::get() {
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::get() {
     if (!this->isValid()) {
         throw outOfBoundError();
     }
@@ -673,9 +1044,9 @@ original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::get() {
     return this->p_node->getVal();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
 original::couple<const K_TYPE, V_TYPE>
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::get() const {
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::get() const {
     if (!this->isValid()) {
         throw outOfBoundError();
     }
@@ -683,14 +1054,14 @@ original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::get() const {
     return this->p_node->getVal();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::isValid() const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator::isValid() const {
     return this->p_node;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::buckets_type
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::bucketsCopy(const buckets_type& old_buckets) const
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::buckets_type
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::bucketsCopy(const buckets_type& old_buckets) const
 {
     buckets_type new_buckets = buckets_type(old_buckets.size(), rebind_alloc_pointer{}, nullptr);
     for (u_integer i = 0; i < old_buckets.size(); ++i) {
@@ -713,68 +1084,109 @@ original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::bucketsCopy(const buckets_type
     return new_buckets;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode*
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::createNode(const K_TYPE& key, const V_TYPE& value, hashNode* next) const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode*
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::createNode(const K_TYPE& key, const V_TYPE& value, hashNode* next) const {
     auto node = this->rebind_alloc.allocate(1);
     this->rebind_alloc.construct(node, key, value, next);
     return node;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::destroyNode(hashNode* node) noexcept {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::destroyNode(hashNode* node) noexcept {
     this->rebind_alloc.destroy(node);
     this->rebind_alloc.deallocate(node, 1);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
 original::u_integer
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::getHashCode(const K_TYPE &key) const {
-    return this->hash_(key) % this->getBucketCount();
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::getHashCode(const K_TYPE &key) const {
+    return SIZING::bucketOf(this->hash_(key), this->getBucketCount());
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
 original::u_integer
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::getBucketCount() const {
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::getBucketCount() const {
     return this->buckets.size();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode*
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::getBucket(const K_TYPE &key) const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode*
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::getBucket(const K_TYPE &key) const {
     u_integer code = this->getHashCode(key);
     return this->buckets[code];
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-original::floating
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::loadFactor() const {
-    return static_cast<floating>(this->size_) / this->getBucketCount();
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::migrating() const noexcept {
+    return this->old_buckets != nullptr;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-original::u_integer original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::getNextSize() const {
-    for (u_integer i : BUCKETS_SIZES){
-        if (this->getBucketCount() < i){
-            return i;
-        }
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+original::u_integer
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::totalBuckets() const noexcept {
+    return this->migrating() ? this->buckets.size() + this->old_buckets->size() : this->buckets.size();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode*
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::bucketAt(const u_integer index) const {
+    if (index < this->buckets.size())
+        return this->buckets[index];
+    return (*this->old_buckets)[index - this->buckets.size()];
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode*
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::findIn(const buckets_type& target, const u_integer code, const K_TYPE& key) const {
+    for (auto cur = target[SIZING::bucketOf(code, target.size())]; cur; cur = cur->getPNext()){
+        if (cur->getKey() == key)
+            return cur;
     }
-    throw outOfBoundError();
+    return nullptr;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-original::u_integer original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::getPrevSize() const {
-    const u_integer current = this->getBucketCount();
-    for (u_integer i = BUCKETS_SIZES_COUNT - 1; i > 0; --i){
-        if (BUCKETS_SIZES[i] < current){
-            return BUCKETS_SIZES[i];
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::eraseFrom(buckets_type& target, const u_integer code, const K_TYPE& key) {
+    const u_integer index = SIZING::bucketOf(code, target.size());
+    hashNode* cur = target[index];
+    hashNode* prev = nullptr;
+
+    while (cur){
+        if (cur->getKey() == key) {
+            if (prev) {
+                hashNode::connect(prev, cur->getPNext());
+            } else {
+                target[index] = cur->getPNext();
+            }
+            this->destroyNode(cur);
+            this->size_ -= 1;
+            return true;
         }
+        prev = cur;
+        cur = cur->getPNext();
     }
-    return BUCKETS_SIZES[0];
+    return false;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::rehash(u_integer new_bucket_count) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+original::floating
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::loadFactor() const {
+    return static_cast<floating>(this->size_) / this->getBucketCount();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+original::u_integer original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::getNextSize() const {
+    return SIZING::nextSize(this->getBucketCount());
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+original::u_integer original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::getPrevSize() const {
+    return SIZING::prevSize(this->getBucketCount());
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::rehash(u_integer new_bucket_count) {
     if (new_bucket_count == this->getBucketCount())
         return;
 
@@ -786,7 +1198,7 @@ void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::rehash(u_integer new_buck
             old_head = old_head->getPNext();
 
             cur->setPNext(nullptr);
-            auto code = this->hash_(cur->getKey()) % new_bucket_count;
+            auto code = SIZING::bucketOf(this->hash_(cur->getKey()), new_bucket_count);
 
             cur->setPNext(new_buckets[code]);
             new_buckets[code] = cur;
@@ -796,36 +1208,200 @@ void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::rehash(u_integer new_buck
     this->buckets = std::move(new_buckets);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::adjust() {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::migrateStep() {
+    buckets_type& from = *this->old_buckets;
+    const u_integer end = from.size() - this->migrate_pos > REHASH::STEP_BUCKETS ?
+                          this->migrate_pos + REHASH::STEP_BUCKETS : from.size();
+
+    for (; this->migrate_pos < end; ++this->migrate_pos) {
+        hashNode*& old_head = from[this->migrate_pos];
+        while (old_head) {
+            hashNode* cur = old_head;
+            old_head = old_head->getPNext();
+
+            auto code = SIZING::bucketOf(this->hash_(cur->getKey()), this->buckets.size());
+            cur->setPNext(this->buckets[code]);
+            this->buckets[code] = cur;
+        }
+    }
+
+    if (this->migrate_pos == from.size()) {
+        this->destroyOldBuckets();
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::createOldBuckets(buckets_type&& from) {
+    auto old = this->buckets_alloc.allocate(1);
+    this->buckets_alloc.construct(old, std::move(from));
+    this->old_buckets = old;
+    this->migrate_pos = 0;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::destroyOldBuckets() noexcept {
+    this->buckets_alloc.destroy(this->old_buckets);
+    this->buckets_alloc.deallocate(this->old_buckets, 1);
+    this->old_buckets = nullptr;
+    this->migrate_pos = 0;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::adjust() {
+    if constexpr (INCREMENTAL) {
+        if (this->migrating()) {
+            this->migrateStep();
+            return;
+        }
+    }
+
+    u_integer new_bucket_count = this->getBucketCount();
     if (this->loadFactor() <= LOAD_FACTOR_MIN){
-        this->rehash(this->getPrevSize());
+        new_bucket_count = this->getPrevSize();
     } else if (this->loadFactor() >= LOAD_FACTOR_MAX){
-        this->rehash(this->getNextSize());
+        new_bucket_count = this->getNextSize();
+    }
+
+    if constexpr (INCREMENTAL) {
+        if (new_bucket_count == this->getBucketCount())
+            return;
+
+        auto new_buckets = buckets_type(new_bucket_count, rebind_alloc_pointer{}, nullptr);
+        this->createOldBuckets(std::move(this->buckets));
+        this->buckets = std::move(new_buckets);
+        this->migrateStep();
+    } else {
+        this->rehash(new_bucket_count);
     }
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashTable(HASH hash)
-    : size_(0), hash_(std::move(hash)) {
-    this->buckets = vector<hashNode*, rebind_alloc_pointer>(BUCKETS_SIZES[0], rebind_alloc_pointer{}, nullptr);
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::destroyNodes() noexcept {
+    for (hashNode*& bucket: this->buckets) {
+        while (bucket){
+            auto next = bucket->getPNext();
+            this->destroyNode(bucket);
+            bucket = next;
+        }
+    }
+    if (this->migrating()) {
+        for (hashNode*& bucket: *this->old_buckets) {
+            while (bucket){
+                auto next = bucket->getPNext();
+                this->destroyNode(bucket);
+                bucket = next;
+            }
+        }
+        this->destroyOldBuckets();
+    }
+    this->size_ = 0;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashTable(HASH hash)
+    : size_(0), old_buckets(nullptr), migrate_pos(0), hash_(std::move(hash)) {
+    this->buckets = vector<hashNode*, rebind_alloc_pointer>(SIZING::initialSize(), rebind_alloc_pointer{}, nullptr);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode*
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::find(const K_TYPE& key) const {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::firstIterator() const {
+    if (this->buckets[0]) {
+        return Iterator(this, 0, this->buckets[0]);
+    }
+    auto bucket = Iterator::findNextValidBucket(this, 0);
+    return Iterator(this, bucket, bucket != this->totalBuckets() ? this->bucketAt(bucket) : nullptr);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::Iterator
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::lastIterator() const {
+    auto bucket = Iterator::findPrevValidBucket(this, this->totalBuckets());
+    if (bucket == this->totalBuckets()) {
+        return Iterator(this, bucket, nullptr);
+    }
+    auto node = this->bucketAt(bucket);
+    while (node->getPNext()) {
+        node = node->getPNext();
+    }
+    return Iterator(this, bucket, node);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::tableCopy(const hashTable& other) {
+    if (this == &other)
+        return;
+
+    this->destroyNodes();
+    if constexpr (ALLOC::propagate_on_container_copy_assignment::value) {
+        this->rebind_alloc = other.rebind_alloc;
+        this->buckets_alloc = other.buckets_alloc;
+    }
+    this->buckets = this->bucketsCopy(other.buckets);
+    if (other.migrating()) {
+        this->createOldBuckets(this->bucketsCopy(*other.old_buckets));
+        this->migrate_pos = other.migrate_pos;
+    }
+    this->size_ = other.size_;
+    this->hash_ = other.hash_;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::tableMove(hashTable&& other) noexcept {
+    if (this == &other)
+        return;
+
+    this->destroyNodes();
+    if constexpr (ALLOC::propagate_on_container_move_assignment::value) {
+        this->rebind_alloc = std::move(other.rebind_alloc);
+        this->buckets_alloc = std::move(other.buckets_alloc);
+    }
+    this->buckets = std::move(other.buckets);
+    other.buckets = buckets_type(SIZING::initialSize(), rebind_alloc_pointer{}, nullptr);
+    this->old_buckets = other.old_buckets;
+    other.old_buckets = nullptr;
+    this->migrate_pos = other.migrate_pos;
+    other.migrate_pos = 0;
+    this->size_ = other.size_;
+    other.size_ = 0;
+    this->hash_ = std::move(other.hash_);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+void original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::tableSwap(hashTable& other) noexcept {
+    if (this == &other)
+        return;
+
+    std::swap(this->size_, other.size_);
+    std::swap(this->buckets, other.buckets);
+    std::swap(this->old_buckets, other.old_buckets);
+    std::swap(this->migrate_pos, other.migrate_pos);
+    std::swap(this->hash_, other.hash_);
+    if constexpr (ALLOC::propagate_on_container_swap::value) {
+        std::swap(this->rebind_alloc, other.rebind_alloc);
+        std::swap(this->buckets_alloc, other.buckets_alloc);
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+typename original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::hashNode*
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::find(const K_TYPE& key) const {
     if (this->size_ == 0)
         return nullptr;
 
-    for (auto cur = this->getBucket(key); cur; cur = cur->getPNext()){
-        if (cur->getKey() == key)
-            return cur;
+    const u_integer code = this->hash_(key);
+    if (auto cur = this->findIn(this->buckets, code, key))
+        return cur;
+    if constexpr (INCREMENTAL) {
+        if (this->migrating())
+            return this->findIn(*this->old_buckets, code, key);
     }
     return nullptr;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::modify(const K_TYPE &key, const V_TYPE &value) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::modify(const K_TYPE &key, const V_TYPE &value) {
     if (auto cur = this->find(key)){
         cur->setValue(value);
         return true;
@@ -833,10 +1409,15 @@ bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::modify(const K_TYPE &key,
     return false;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::insert(const K_TYPE &key, const V_TYPE &value) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::insert(const K_TYPE &key, const V_TYPE &value) {
     this->adjust();
 
+    if constexpr (INCREMENTAL) {
+        if (this->migrating() && this->findIn(*this->old_buckets, this->hash_(key), key))
+            return false;
+    }
+
     auto cur = this->getBucket(key);
     if (!cur){
         this->buckets[this->getHashCode(key)] = this->createNode(key, value);
@@ -845,7 +1426,7 @@ bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::insert(const K_TYPE &key,
             return false;
 
         for (; cur->getPNext(); cur = cur->getPNext()){
-            if (cur->getKey() == key)
+            if (cur->getPNext()->getKey() == key)
                 return false;
         }
         hashNode::connect(cur, this->createNode(key, value));
@@ -855,44 +1436,28 @@ bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::insert(const K_TYPE &key,
     return true;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::erase(const K_TYPE &key) {
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+bool original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::erase(const K_TYPE &key) {
     if (this->size_ == 0)
         return false;
 
-    this->adjust();
-
-    u_integer code = this->getHashCode(key);
-    hashNode* cur = this->buckets[code];
-    hashNode* prev = nullptr;
-
-    while (cur){
-        if (cur->getKey() == key) {
-            if (prev) {
-                hashNode::connect(prev, cur->getPNext());
-            } else {
-                this->buckets[code] = cur->getPNext();
-            }
-            this->destroyNode(cur);
-            this->size_ -= 1;
-            return true;
-        }
-        prev = cur;
-        cur = cur->getPNext();
+    if constexpr (!INCREMENTAL) {
+        this->adjust();
     }
 
+    const u_integer code = this->hash_(key);
+    if (this->eraseFrom(this->buckets, code, key))
+        return true;
+    if constexpr (INCREMENTAL) {
+        if (this->migrating())
+            return this->eraseFrom(*this->old_buckets, code, key);
+    }
     return false;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
-original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::~hashTable() {
-    for (hashNode*& bucket: this->buckets) {
-        while (bucket){
-            auto next = bucket->getPNext();
-            this->destroyNode(bucket);
-            bucket = next;
-        }
-    }
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH, typename SIZING, typename REHASH>
+original::hashTable<K_TYPE, V_TYPE, ALLOC, HASH, SIZING, REHASH>::~hashTable() {
+    this->destroyNodes();
 }
 
 #endif //HASHTABLE_H
@@ -247,6 +247,13 @@ namespace original {
              */
             [[nodiscard]] bool isValid() const override;
 
+            /**
+             * @brief Gets the address of the current element in contiguous storage.
+             * @return Pointer to the current element, or nullptr if not contiguous.
+             * @details Delegates to the underlying iterator's contiguousPtr() method.
+             */
+            TYPE* contiguousPtr() const override;
+
             /**
              * @brief Returns the class name.
              * @return The string "iterAdaptor".
@@ -603,6 +610,11 @@ namespace original {
         return this->it_->isValid();
     }
 
+    template<typename TYPE>
+    auto original::iterable<TYPE>::iterAdaptor::contiguousPtr() const -> TYPE* {
+        return this->it_->contiguousPtr();
+    }
+
     template<typename TYPE>
     auto original::iterable<TYPE>::iterAdaptor::className() const -> std::string {
         return "iterAdaptor";
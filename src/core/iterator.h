@@ -251,6 +251,15 @@ public:
      */
     [[nodiscard]] virtual bool isValid() const = 0;
 
+    /**
+     * @brief Gets the address of the current element in contiguous storage.
+     * @return Pointer to the current element if the iterator walks a single
+     *         contiguous block (the next element lives at pointer + 1), otherwise nullptr.
+     * @details Allows algorithms to switch to raw-pointer kernels without
+     *          knowing the container. The default implementation returns nullptr.
+     */
+    virtual TYPE* contiguousPtr() const;
+
     /**
      * @brief Returns the class name of the iterator.
      * @return A string representing the class name.
@@ -418,6 +427,12 @@ bool operator!=(const iterator<T>& l_it, const iterator<T>& r_it);
         return this->get();
     }
 
+    template <typename TYPE>
+    auto original::iterator<TYPE>::contiguousPtr() const -> TYPE*
+    {
+        return nullptr;
+    }
+
     template<typename TYPE>
     auto original::iterator<TYPE>::equal(const iterator *other) const -> bool {
         return this->equalPtr(other);
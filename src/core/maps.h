@@ -5,21 +5,26 @@
 #include "couple.h"
 #include "hash.h"
 #include "hashTable.h"
+#include "openHashTable.h"
 #include "map.h"
 #include "ownerPtr.h"
 #include "comparator.h"
 #include "RBTree.h"
+#include "bTree.h"
 #include "skipList.h"
+#include "rangeView.h"
+#include "sortedMerge.h"
 
 
 /**
  * @file maps.h
  * @brief Implementation of map containers with different underlying data structures
- * @details Provides three map implementations with different performance characteristics
+ * @details Provides four map implementations with different performance characteristics
  * and iteration capabilities:
  * 1. hashMap - Hash table based implementation (unordered, fastest average case)
  * 2. treeMap - Red-Black Tree based implementation (ordered, consistent performance)
- * 3. JMap - Skip List based implementation (ordered, probabilistic balance)
+ * 3. bTreeMap - B+ tree based implementation (ordered, cache-friendly)
+ * 4. JMap - Skip List based implementation (ordered, probabilistic balance)
  *
  * Common Features:
  * - Key-value pair storage with unique keys
@@ -34,11 +39,17 @@
  * - Value updating with insert() or operator[]
  * - Integration with printable for string representation
  *
+ * Ordered containers (all except hashMap) also provide lowerBound(), upperBound(),
+ * floor() and ceiling() in O(log n), a lazy range(low, high) view and eraseRange(low, high).
+ * treeMap and JMap can be built from sorted pairs in O(n) with fromSorted() and
+ * merge() another map of their type in O(n + m).
+ *
  * Performance Characteristics:
  * | Container | Insertion    | Lookup   | Deletion | Ordered | Memory Usage | Iterator Type |
  * |-----------|--------------|----------|----------|---------|--------------|---------------|
  * | hashMap   | O(1) avg     | O(1)     | O(1)     | No      | Medium-High  | Forward-only  |
  * | treeMap   | O(log n)     | O(log n) | O(log n) | Yes     | Low          | Bidirectional |
+ * | bTreeMap  | O(log n)     | O(log n) | O(log n) | Yes     | Medium       | Bidirectional |
  * | JMap      | O(log n) avg | O(log n) | O(log n) | Yes     | Medium       | Forward-only  |
  *
  * Memory Characteristics:
@@ -46,21 +57,29 @@
  * |-----------|----------------|----------|-----------|-------------------|
  * | hashMap   | Key-Value + Next | 1 pointer | Yes       | No                |
  * | treeMap   | Key-Value + Parent/Child/Color | 3 pointers + color | No | Yes (Red-Black) |
+ * | bTreeMap  | Key array + Key-Value array per node | 1 mirrored key + free slots | No | Yes (split/merge) |
  * | JMap      | Key-Value + Multi-level links | ~2 pointers avg | No | Probabilistic |
  *
  * Usage Guidelines:
  * - Use hashMap for maximum performance when key order doesn't matter and keys are hashable
  * - Use treeMap for ordered traversal, range queries, and consistent worst-case performance
+ * - Use bTreeMap instead of treeMap for large maps with small keys, where lookups and scans are cache-bound
  * - Use JMap for concurrent scenarios (external synchronization) or when probabilistic balance is preferred
  *
  * Iterator Invalidation:
  * - hashMap: Iterators invalidate on rehash (insertion that causes capacity change)
+ *   With the incrementalHashTable engine a rehash is spread over the following
+ *   insertions, and each of them invalidates iterators until it completes; removals
+ *   never invalidate iterators to other elements.
+ *   With the openHashTable engine every insertion or removal invalidates iterators.
+ *   Lookups and value updates never invalidate iterators.
  * - treeMap: Iterators invalidate on element removal that affects the current position
+ * - bTreeMap: Iterators invalidate on any insertion or removal in the same or a neighbouring leaf
  * - JMap: Iterators invalidate on any structural modification
  *
  * Key Requirements:
  * - hashMap: Keys must be hashable (provide std::hash specialization or custom HASH)
- * - treeMap/JMap: Keys must be comparable (provide operator< or custom Compare)
+ * - treeMap/bTreeMap/JMap: Keys must be comparable (provide operator< or custom Compare)
  * - All keys must be copyable and movable
  * - Values must be default constructible for operator[] usage
  *
@@ -72,6 +91,7 @@
  * @see map.h For the base interface definition
  * @see hashTable.h For hashMap implementation details
  * @see RBTree.h For treeMap implementation details
+ * @see bTree.h For bTreeMap implementation details
  * @see skipList.h For JMap implementation details
  * @see printable.h For string formatting support
  * @see couple.h For key-value pair implementation
@@ -85,13 +105,21 @@ namespace original {
      * @tparam V_TYPE Value type
      * @tparam HASH Hash function type (default: hash<K_TYPE>)
      * @tparam ALLOC Allocator type (default: allocator)
+     * @tparam TABLE Hash table engine (default: hashTable)
      * @brief Hash table based implementation of the map interface
      * @details This class provides a concrete implementation of the map interface
-     * using a hash table with separate chaining. It combines the functionality of:
+     * using a hash table engine. It combines the functionality of:
      * - map (interface)
-     * - hashTable (storage)
+     * - TABLE (storage)
      * - iterable (iteration support)
      *
+     * Available engines:
+     * - hashTable: separate chaining, element addresses stay stable until removal
+     * - openHashTable: Robin Hood open addressing with inline slots, faster lookups
+     *   but every insertion or removal invalidates iterators and references
+     * - incrementalHashTable: separate chaining that migrates a resize a few buckets
+     *   per insertion or removal instead of all at once, bounding the worst-case latency
+     *
      * Performance Characteristics:
      * - Insertion: Average O(1), Worst O(n)
      * - Lookup: Average O(1), Worst O(n)
@@ -106,24 +134,19 @@ namespace original {
     template <typename K_TYPE,
               typename V_TYPE,
               typename HASH = hash<K_TYPE>,
-              typename ALLOC = allocator<couple<const K_TYPE, V_TYPE>>>
+              typename ALLOC = allocator<couple<const K_TYPE, V_TYPE>>,
+              template <typename, typename, typename, typename> typename TABLE = hashTable>
     class hashMap final
-                : public hashTable<K_TYPE, V_TYPE, ALLOC, HASH>,
+                : public TABLE<K_TYPE, V_TYPE, ALLOC, HASH>,
                   public map<K_TYPE, V_TYPE, ALLOC>,
                   public iterable<couple<const K_TYPE, V_TYPE>>,
                   public printable{
 
         /**
-         * @typedef hashNode
-         * @brief Internal node type used for hash table storage
-         */
-        using hashNode = hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode;
-
-        /**
-         * @typedef rebind_alloc_pointer
-         * @brief Rebound allocator type for pointer storage
+         * @typedef table_type
+         * @brief Hash table engine used for storage
          */
-        using rebind_alloc_pointer = hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::rebind_alloc_pointer;
+        using table_type = TABLE<K_TYPE, V_TYPE, ALLOC, HASH>;
     public:
 
             /**
@@ -139,18 +162,15 @@ namespace original {
              * - Invalidates on rehash
              * - Lightweight copy semantics
              */
-            class Iterator final : public hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator,
+            class Iterator final : public table_type::Iterator,
                                    public baseIterator<couple<const K_TYPE, V_TYPE>> {
 
                 /**
-                 * @brief Constructs iterator pointing to specific bucket/node
-                 * @param buckets Pointer to buckets vector
-                 * @param bucket Current bucket index
-                 * @param node Current node pointer
+                 * @brief Constructs iterator from a position of the table engine
+                 * @param it Engine iterator to wrap
                  * @note Internal constructor, not meant for direct use
                  */
-                explicit Iterator(vector<hashNode*, rebind_alloc_pointer>* buckets = nullptr,
-                                  u_integer bucket = 0, hashNode* node = nullptr);
+                explicit Iterator(const typename table_type::Iterator& it);
 
                 /**
                  * @brief Compares iterator pointers for equality
@@ -445,6 +465,8 @@ namespace original {
      * @tparam V_TYPE Value type
      * @tparam Compare Comparison function type (default: increaseComparator<K_TYPE>)
      * @tparam ALLOC Allocator type (default: allocator)
+     * @tparam AUGMENT Node augmentation policy (default: noOrderStatistic); orderStatistic
+     * enables select(), rank() and O(log n) iterator jumps and distances
      * @brief Red-Black Tree based implementation of the map interface
      * @details This class provides a concrete implementation of the map interface
      * using a Red-Black Tree. It combines the functionality of:
@@ -468,8 +490,9 @@ namespace original {
     template <typename K_TYPE,
               typename V_TYPE,
               typename Compare = increaseComparator<K_TYPE>,
-              typename ALLOC = allocator<couple<const K_TYPE, V_TYPE>>>
-    class treeMap final : public RBTree<K_TYPE, V_TYPE, ALLOC, Compare>,
+              typename ALLOC = allocator<couple<const K_TYPE, V_TYPE>>,
+              typename AUGMENT = noOrderStatistic>
+    class treeMap final : public RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>,
                           public map<K_TYPE, V_TYPE, ALLOC>,
                           public iterable<couple<const K_TYPE, V_TYPE>>,
                           public printable {
@@ -478,7 +501,7 @@ namespace original {
          * @typedef RBTreeType
          * @brief Alias for the underlying red-black tree implementation.
          */
-        using RBTreeType = RBTree<K_TYPE, V_TYPE, ALLOC, Compare>;
+        using RBTreeType = RBTree<K_TYPE, V_TYPE, ALLOC, Compare, AUGMENT>;
 
         /**
          * @typedef RBNode
@@ -558,7 +581,10 @@ namespace original {
         void operator-=(integer steps) const override;
 
         /**
-         * @brief Not supported (throws unSupportedMethodError)
+         * @brief Distance between iterators
+         * @param other Iterator to compare with
+         * @return Number of steps from other to this, in O(log n)
+         * @throw unSupportedMethodError unless AUGMENT is orderStatistic
          */
         integer operator-(const iterator<couple<const K_TYPE, V_TYPE>> &other) const override;
 
@@ -769,6 +795,102 @@ namespace original {
          */
         V_TYPE & operator[](const K_TYPE &k) override;
 
+        /**
+         * @typedef rangeType
+         * @brief Lazy view type returned by range()
+         */
+        using rangeType = rangeView<couple<const K_TYPE, V_TYPE>, K_TYPE, Iterator, Compare>;
+
+        /**
+         * @brief Finds the first element whose key is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator lowerBound(const K_TYPE& k) const;
+
+        /**
+         * @brief Finds the first element whose key is greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator upperBound(const K_TYPE& k) const;
+
+        /**
+         * @brief Finds the last element whose key is not greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator floor(const K_TYPE& k) const;
+
+        /**
+         * @brief Finds the first element whose key is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note Same position as lowerBound, O(log n)
+         */
+        Iterator ceiling(const K_TYPE& k) const;
+
+        /**
+         * @brief Gets a lazy view of the elements with keys in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return View iterating the range in order
+         * @details Creating the view costs two O(log n) searches, and iterating it
+         * visits only the elements in range. The view is empty if high is not
+         * greater than low.
+         */
+        rangeType range(const K_TYPE& low, const K_TYPE& high) const;
+
+        /**
+         * @brief Removes all elements with keys in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return Number of removed elements
+         */
+        u_integer eraseRange(const K_TYPE& low, const K_TYPE& high);
+
+        /**
+         * @brief Builds a treeMap from sorted key-value pairs in O(n)
+         * @tparam ELEM Element type of the input iterators
+         * @param begin Iterator at the first pair
+         * @param end Iterator at the last pair (inclusive, as in algorithms)
+         * @param comp Comparison function, under which the keys must be strictly increasing
+         * @param alloc Allocator to use
+         * @return treeMap holding the pairs in a perfectly balanced red-black tree
+         * @throw valueError if the keys are not strictly increasing
+         * @details Reads the input twice, once to count and check it and once to build,
+         * without any search, rotation or per-element rebalancing.
+         */
+        template<typename ELEM>
+        static treeMap fromSorted(const iterator<ELEM>& begin, const iterator<ELEM>& end,
+                                  Compare comp = Compare{}, ALLOC alloc = ALLOC{});
+
+        /**
+         * @brief Adds the pairs of another map whose keys are absent
+         * @param other treeMap to merge from, left unchanged
+         * @details Existing values win on equal keys. O(n + m), see RBTree::mergeFrom.
+         */
+        void merge(const treeMap& other);
+
+        /**
+         * @brief Finds the element at an in-order position
+         * @param index Zero-based position, 0 being the smallest key
+         * @return Iterator at the element, invalid if index is not less than size()
+         * @note Requires orderStatistic, O(log n)
+         */
+        Iterator select(u_integer index) const requires AUGMENT::SUBTREE_SIZE;
+
+        /**
+         * @brief Counts the elements less than a key
+         * @param k Key to rank, need not be present
+         * @return Number of elements less than k, which is the position of k if present
+         * @note Requires orderStatistic, O(log n)
+         */
+        u_integer rank(const K_TYPE& k) const requires AUGMENT::SUBTREE_SIZE;
+
         /**
          * @brief Gets begin iterator
          * @return New iterator at first element (minimum key)
@@ -802,22 +924,28 @@ namespace original {
     };
 
     /**
-     * @class JMap
+     * @class bTreeMap
      * @tparam K_TYPE Key type (must be comparable)
      * @tparam V_TYPE Value type
      * @tparam Compare Comparison function type (default: increaseComparator<K_TYPE>)
-     * @tparam ALLOC Allocator type (default: allocator<couple<const K_TYPE, V_TYPE>>)
-     * @brief Skip List based implementation of the map interface
+     * @tparam ALLOC Allocator type (default: allocator)
+     * @brief B+ tree based implementation of the map interface
      * @details This class provides a concrete implementation of the map interface
-     * using a probabilistic skip list. It combines the functionality of:
+     * using a B+ tree with cache-line sized nodes. It combines the functionality of:
      * - map (interface)
-     * - skipList (storage)
+     * - bTree (storage)
      * - iterable (iteration support)
      *
      * Performance Characteristics:
-     * - Insertion: Average O(log n), Worst O(n)
-     * - Lookup: Average O(log n), Worst O(n)
-     * - Deletion: Average O(log n), Worst O(n)
+     * - Insertion: O(log n)
+     * - Lookup: O(log n)
+     * - Deletion: O(log n)
+     * - Traversal: O(n), walking linked leaves
+     *
+     * Compared to treeMap it has the same interface and iterator capabilities, but
+     * keeps many keys per node in contiguous arrays, so lookups and scans touch far
+     * fewer cache lines. Insertion and removal move elements within a node, so
+     * they invalidate iterators into the affected leaves.
      *
      * The implementation guarantees:
      * - Elements sorted by key according to comparator
@@ -827,210 +955,628 @@ namespace original {
      * - Iterator validity unless modified
      */
     template <typename K_TYPE,
-            typename V_TYPE,
-            typename Compare = increaseComparator<K_TYPE>,
-            typename ALLOC = allocator<couple<const K_TYPE, V_TYPE>>>
-    class JMap final : public skipList<const K_TYPE, V_TYPE, ALLOC, Compare>,
-                       public map<K_TYPE, V_TYPE, ALLOC>,
-                       public iterable<couple<const K_TYPE, V_TYPE>>,
-                       public printable {
-
-        using skipListType = skipList<const K_TYPE, V_TYPE, ALLOC, Compare>;
+              typename V_TYPE,
+              typename Compare = increaseComparator<K_TYPE>,
+              typename ALLOC = allocator<couple<const K_TYPE, V_TYPE>>>
+    class bTreeMap final : public bTree<K_TYPE, V_TYPE, ALLOC, Compare>,
+                           public map<K_TYPE, V_TYPE, ALLOC>,
+                           public iterable<couple<const K_TYPE, V_TYPE>>,
+                           public printable {
 
         /**
-         * @typedef skipListNode
-         * @brief Internal node type used for Skip List storage
+         * @typedef bTreeType
+         * @brief Alias for the underlying B+ tree implementation.
          */
-        using skipListNode = skipListType::skipListNode;
+        using bTreeType = bTree<K_TYPE, V_TYPE, ALLOC, Compare>;
 
+        /**
+         * @typedef leafNode
+         * @brief Leaf node type used for B+ tree storage
+         */
+        using leafNode = bTreeType::leafNode;
     public:
+
         /**
          * @class Iterator
-         * @brief Forward iterator for JMap
-         * @details Provides iteration over JMap elements while maintaining:
+         * @brief Bidirectional iterator for bTreeMap
+         * @details Provides iteration over bTreeMap elements while maintaining:
          * - Sorted traversal order (according to comparator)
          * - Safe invalidation detection
          * - Const-correct access
          *
          * Iterator Characteristics:
-         * - Forward iteration only (throws on reverse operations)
-         * - Invalidates on container modification
+         * - Both forward and backward iteration
+         * - Invalidates on tree modification
          * - Lightweight copy semantics
          */
-        class Iterator final : public skipListType::Iterator,
+        class Iterator final : public bTreeType::Iterator,
                                public baseIterator<couple<const K_TYPE, V_TYPE>> {
-
-            /**
-             * @brief Compares iterator pointers for equality
-             * @param other Iterator to compare with
-             * @return true if iterators point to same element
-             * @internal
-             */
-            bool equalPtr(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
-
-        public:
-            friend class JMap;
-
-            /**
-             * @brief Constructs iterator pointing to specific skip list node
-             * @param cur Current node pointer
-             * @note Internal constructor, not meant for direct use
-             */
-            explicit Iterator(skipListNode* cur);
-
-            /**
-             * @brief Copy constructor
-             * @param other Iterator to copy
-             */
-            Iterator(const Iterator& other);
-
-            /**
-             * @brief Copy assignment operator
-             * @param other Iterator to copy
-             * @return Reference to this iterator
-             */
-            Iterator& operator=(const Iterator& other);
-
-            /**
-             * @brief Creates a copy of this iterator
-             * @return New iterator instance
-             */
-            Iterator* clone() const override;
-
-            /**
-             * @brief Gets iterator class name
-             * @return "JMap::Iterator"
-             */
-            [[nodiscard]] std::string className() const override;
-
-            /**
-             * @brief Advances iterator by steps
-             * @param steps Number of positions to advance
-             */
-            void operator+=(integer steps) const override;
-
-            /**
-             * @brief Not supported (throws unSupportedMethodError)
-             */
-            void operator-=(integer steps) const override;
-
-            /**
-             * @brief Calculates distance between iterators
-             * @param other Iterator to calculate distance to
-             * @return Distance between iterators
-             * @note Returns max/min integer values if iterators are not compatible
-             */
-            integer operator-(const iterator<couple<const K_TYPE, V_TYPE>> &other) const override;
-
-            /**
-             * @brief Checks if more elements exist in forward direction
-             * @return true if more elements available
-             */
-            [[nodiscard]] bool hasNext() const override;
-
-            /**
-             * @brief Not supported (throws unSupportedMethodError)
-             */
-            [[nodiscard]] bool hasPrev() const override;
-
-            /**
-             * @brief Checks if other is previous to this
-             * @param other Iterator to check
-             * @return true if other is previous
-             */
-            bool atPrev(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
-
-            /**
-             * @brief Checks if other is next to this
-             * @param other Iterator to check
-             * @return true if other is next
-             */
-            bool atNext(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
-
-            /**
-             * @brief Moves to next element
-             */
-            void next() const override;
-
-            /**
-             * @brief Not supported (throws unSupportedMethodError)
-             */
-            void prev() const override;
-
-            /**
-             * @brief Not supported (throws unSupportedMethodError)
-             */
-            Iterator* getPrev() const override;
-
-            /**
-             * @brief Gets current element (non-const)
-             * @return Reference to current key-value pair
-             */
-            couple<const K_TYPE, V_TYPE>& get() override;
-
-            /**
-             * @brief Gets current element (const)
-             * @return Copy of current key-value pair
-             */
-            couple<const K_TYPE, V_TYPE> get() const override;
-
-            /**
-             * @brief Not supported (throws unSupportedMethodError)
-             */
-            void set(const couple<const K_TYPE, V_TYPE> &data) override;
-
-            /**
-             * @brief Checks if iterator is valid
-             * @return true if iterator points to valid element
-             */
-            [[nodiscard]] bool isValid() const override;
-
-            ~Iterator() override = default;
-        };
-
-        friend class Iterator;
+       /**
+         * @brief Constructs iterator pointing to specific leaf slot
+         * @param tree Pointer to owning tree
+         * @param leaf Current leaf pointer
+         * @param index Slot in the leaf
+         * @note Internal constructor, not meant for direct use
+         */
+        explicit Iterator(bTreeType* tree, leafNode* leaf, u_integer index);
 
         /**
-         * @brief Constructs empty JMap
-         * @param comp Comparison function to use
-         * @param alloc Allocator to use
+         * @brief Compares iterator pointers for equality
+         * @param other Iterator to compare with
+         * @return true if iterators point to same element
+         * @internal
          */
-        explicit JMap(Compare comp = Compare{}, ALLOC alloc = ALLOC{});
+        bool equalPtr(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
+    public:
+        friend class bTreeMap;
 
         /**
          * @brief Copy constructor
-         * @param other JMap to copy
-         * @details Performs deep copy of all elements and skip list structure
-         * @note Allocator is copied if propagate_on_container_copy_assignment is true
+         * @param other Iterator to copy
          */
-        JMap(const JMap& other);
+        Iterator(const Iterator& other);
 
         /**
          * @brief Copy assignment operator
-         * @param other JMap to copy
-         * @return Reference to this JMap
-         * @details Performs deep copy of all elements and skip list structure
-         * @note Allocator is copied if propagate_on_container_copy_assignment is true
+         * @param other Iterator to copy
+         * @return Reference to this iterator
          */
-        JMap& operator=(const JMap& other);
+        Iterator& operator=(const Iterator& other);
 
         /**
-         * @brief Move constructor
-         * @param other JMap to move from
-         * @details Transfers ownership of resources from other
-         * @note Leaves other in valid but unspecified state
+         * @brief Creates a copy of this iterator
+         * @return New iterator instance
          */
-        JMap(JMap&& other) noexcept;
+        Iterator* clone() const override;
 
         /**
-         * @brief Move assignment operator
-         * @param other JMap to move from
-         * @return Reference to this JMap
-         * @details Transfers ownership of resources from other
-         * @note Leaves other in valid but unspecified state
-         * @note Allocator is moved if propagate_on_container_move_assignment is true
+         * @brief Gets iterator class name
+         * @return "bTreeMap::Iterator"
          */
-        JMap& operator=(JMap&& other) noexcept;
+        [[nodiscard]] std::string className() const override;
+
+        /**
+         * @brief Advances iterator by steps
+         * @param steps Number of positions to advance
+         */
+        void operator+=(integer steps) const override;
+
+        /**
+         * @brief Rewinds iterator by steps
+         * @param steps Number of positions to rewind
+         */
+        void operator-=(integer steps) const override;
+
+        /**
+         * @brief Not supported (throws unSupportedMethodError)
+         */
+        integer operator-(const iterator<couple<const K_TYPE, V_TYPE>> &other) const override;
+
+        /**
+         * @brief Checks if more elements exist in forward direction
+         * @return true if more elements available
+         */
+        [[nodiscard]] bool hasNext() const override;
+
+        /**
+         * @brief Checks if more elements exist in backward direction
+         * @return true if more elements available
+         */
+        [[nodiscard]] bool hasPrev() const override;
+
+        /**
+         * @brief Checks if other is previous to this
+         * @param other Iterator to check
+         * @return true if other is previous
+         */
+        bool atPrev(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
+
+        /**
+         * @brief Checks if other is next to this
+         * @param other Iterator to check
+         * @return true if other is next
+         */
+        bool atNext(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
+
+        /**
+         * @brief Moves to next element
+         */
+        void next() const override;
+
+        /**
+         * @brief Moves to previous element
+         */
+        void prev() const override;
+
+        /**
+         * @brief Gets previous iterator
+         * @return New iterator at previous position
+         */
+        Iterator* getPrev() const override;
+
+        /**
+         * @brief Gets current element (non-const)
+         * @return Reference to current key-value pair
+         */
+        couple<const K_TYPE, V_TYPE>& get() override;
+
+        /**
+         * @brief Gets current element (const)
+         * @return Copy of current key-value pair
+         */
+        couple<const K_TYPE, V_TYPE> get() const override;
+
+        /**
+         * @brief Not supported
+         * @throw unSupportedMethodError
+         */
+        void set(const couple<const K_TYPE, V_TYPE> &data) override;
+
+        /**
+         * @brief Checks if iterator is valid
+         * @return true if iterator points to valid element
+         */
+        [[nodiscard]] bool isValid() const override;
+
+        ~Iterator() override = default;
+    };
+
+        friend class Iterator;
+
+       /**
+         * @brief Constructs empty bTreeMap
+         * @param comp Comparison function to use
+         * @param alloc Allocator to use
+         */
+        explicit bTreeMap(Compare comp = Compare{}, ALLOC alloc = ALLOC{});
+
+        /**
+         * @brief Copy constructor
+         * @param other bTreeMap to copy
+         * @details Performs deep copy of all elements and tree structure
+         * @note Allocator is copied if propagate_on_container_copy_assignment is true
+         */
+        bTreeMap(const bTreeMap& other);
+
+        /**
+         * @brief Copy assignment operator
+         * @param other bTreeMap to copy
+         * @return Reference to this bTreeMap
+         * @details Performs deep copy of all elements and tree structure
+         * @note Allocator is copied if propagate_on_container_copy_assignment is true
+         */
+        bTreeMap& operator=(const bTreeMap& other);
+
+        /**
+         * @brief Move constructor
+         * @param other bTreeMap to move from
+         * @details Transfers ownership of resources from other
+         * @note Leaves other in valid but unspecified state
+         */
+        bTreeMap(bTreeMap&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator
+         * @param other bTreeMap to move from
+         * @return Reference to this bTreeMap
+         * @details Transfers ownership of resources from other
+         * @note Leaves other in valid but unspecified state
+         * @note Allocator is moved if propagate_on_container_move_assignment is true
+         */
+        bTreeMap& operator=(bTreeMap&& other) noexcept;
+
+        /**
+         * @brief Swaps contents with another bTreeMap
+         * @param other bTreeMap to swap with
+         * @note No-throw guarantee if element swap and allocator swap are noexcept
+         * @details Efficiently exchanges all internal resources between two bTreeMaps:
+         * - Root nodes of the B+ trees (entire tree structures)
+         * - Size counters
+         * - Comparison function instances
+         * - Allocators (if ALLOC::propagate_on_container_swap::value is true)
+         *
+         * Performance: O(1) - pointer and integer swaps only, no tree rebalancing
+         * Memory: No additional memory allocation during swap
+         * Iterator Invalidation: All iterators from both maps are invalidated
+         *
+         * Allocator Handling:
+         * - If ALLOC::propagate_on_container_swap::value is true, allocators are swapped
+         * - Otherwise, each tree retains its original allocator
+         * - Consistent with C++ standard associative container behavior
+         *
+         * @warning All existing iterators, pointers, and references to elements
+         *          in both containers are invalidated by this operation
+         * @see std::swap For the standard swap algorithm
+         * @see bTreeMap::operator= For copy and move assignment alternatives
+         */
+        void swap(bTreeMap& other) noexcept;
+
+        /**
+         * @brief Gets number of elements
+         * @return Current size
+         */
+        [[nodiscard]] u_integer size() const override;
+
+        /**
+         * @brief Checks if key-value pair exists
+         * @param e Pair to check
+         * @return true if both key exists and value matches
+         */
+        bool contains(const couple<const K_TYPE, V_TYPE> &e) const override;
+
+        /**
+         * @brief Adds new key-value pair
+         * @param k Key to add
+         * @param v Value to associate
+         * @return true if added, false if key existed
+         */
+        bool add(const K_TYPE &k, const V_TYPE &v) override;
+
+        /**
+         * @brief Removes key-value pair
+         * @param k Key to remove
+         * @return true if removed, false if key didn't exist
+         */
+        bool remove(const K_TYPE &k) override;
+
+        /**
+         * @brief Checks if key exists
+         * @param k Key to check
+         * @return true if key exists
+         */
+        [[nodiscard]] bool containsKey(const K_TYPE &k) const override;
+
+        /**
+         * @brief Gets value for key
+         * @param k Key to lookup
+         * @return Associated value
+         * @throw noElementError if key doesn't exist
+         */
+        V_TYPE get(const K_TYPE &k) const override;
+
+        /**
+         * @brief Updates value for existing key
+         * @param key Key to update
+         * @param value New value
+         * @return true if updated, false if key didn't exist
+         */
+        bool update(const K_TYPE &key, const V_TYPE &value) override;
+
+        /**
+         * @brief Const element access
+         * @param k Key to access
+         * @return const reference to value
+         * @throw noElementError if key doesn't exist
+         */
+        const V_TYPE & operator[](const K_TYPE &k) const override;
+
+        /**
+         * @brief Non-const element access
+         * @param k Key to access
+         * @return reference to value
+         * @note Inserts default-constructed value if key doesn't exist
+         */
+        V_TYPE & operator[](const K_TYPE &k) override;
+
+        /**
+         * @typedef rangeType
+         * @brief Lazy view type returned by range()
+         */
+        using rangeType = rangeView<couple<const K_TYPE, V_TYPE>, K_TYPE, Iterator, Compare>;
+
+        /**
+         * @brief Finds the first element whose key is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator lowerBound(const K_TYPE& k) const;
+
+        /**
+         * @brief Finds the first element whose key is greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator upperBound(const K_TYPE& k) const;
+
+        /**
+         * @brief Finds the last element whose key is not greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator floor(const K_TYPE& k) const;
+
+        /**
+         * @brief Finds the first element whose key is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note Same position as lowerBound, O(log n)
+         */
+        Iterator ceiling(const K_TYPE& k) const;
+
+        /**
+         * @brief Gets a lazy view of the elements with keys in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return View iterating the range in order
+         * @details Creating the view costs two O(log n) searches, and iterating it
+         * visits only the elements in range. The view is empty if high is not
+         * greater than low.
+         */
+        rangeType range(const K_TYPE& low, const K_TYPE& high) const;
+
+        /**
+         * @brief Removes all elements with keys in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return Number of removed elements
+         */
+        u_integer eraseRange(const K_TYPE& low, const K_TYPE& high);
+
+        /**
+         * @brief Gets begin iterator
+         * @return New iterator at first element (minimum key)
+         */
+        Iterator* begins() const override;
+
+        /**
+         * @brief Gets end iterator
+         * @return New iterator at last element (maximum key)
+         */
+        Iterator* ends() const override;
+
+        /**
+         * @brief Gets class name
+         * @return "bTreeMap"
+         */
+        [[nodiscard]] std::string className() const override;
+
+        /**
+         * @brief Converts to string representation
+         * @param enter Add newline if true
+         * @return String representation of key-value pairs
+         */
+        [[nodiscard]] std::string toString(bool enter) const override;
+
+        /**
+         * @brief Destructor
+         * @details Cleans up all tree nodes and allocated memory
+         */
+        ~bTreeMap() override;
+    };
+
+    /**
+     * @class JMap
+     * @tparam K_TYPE Key type (must be comparable)
+     * @tparam V_TYPE Value type
+     * @tparam Compare Comparison function type (default: increaseComparator<K_TYPE>)
+     * @tparam ALLOC Allocator type (default: allocator<couple<const K_TYPE, V_TYPE>>)
+     * @brief Skip List based implementation of the map interface
+     * @details This class provides a concrete implementation of the map interface
+     * using a probabilistic skip list. It combines the functionality of:
+     * - map (interface)
+     * - skipList (storage)
+     * - iterable (iteration support)
+     *
+     * Performance Characteristics:
+     * - Insertion: Average O(log n), Worst O(n)
+     * - Lookup: Average O(log n), Worst O(n)
+     * - Deletion: Average O(log n), Worst O(n)
+     *
+     * The implementation guarantees:
+     * - Elements sorted by key according to comparator
+     * - Unique keys (no duplicates)
+     * - Type safety
+     * - Exception safety (basic guarantee)
+     * - Iterator validity unless modified
+     */
+    template <typename K_TYPE,
+            typename V_TYPE,
+            typename Compare = increaseComparator<K_TYPE>,
+            typename ALLOC = allocator<couple<const K_TYPE, V_TYPE>>>
+    class JMap final : public skipList<const K_TYPE, V_TYPE, ALLOC, Compare>,
+                       public map<K_TYPE, V_TYPE, ALLOC>,
+                       public iterable<couple<const K_TYPE, V_TYPE>>,
+                       public printable {
+
+        using skipListType = skipList<const K_TYPE, V_TYPE, ALLOC, Compare>;
+
+        /**
+         * @typedef skipListNode
+         * @brief Internal node type used for Skip List storage
+         */
+        using skipListNode = skipListType::skipListNode;
+
+    public:
+        /**
+         * @class Iterator
+         * @brief Forward iterator for JMap
+         * @details Provides iteration over JMap elements while maintaining:
+         * - Sorted traversal order (according to comparator)
+         * - Safe invalidation detection
+         * - Const-correct access
+         *
+         * Iterator Characteristics:
+         * - Forward iteration only (throws on reverse operations)
+         * - Invalidates on container modification
+         * - Lightweight copy semantics
+         */
+        class Iterator final : public skipListType::Iterator,
+                               public baseIterator<couple<const K_TYPE, V_TYPE>> {
+
+            /**
+             * @brief Compares iterator pointers for equality
+             * @param other Iterator to compare with
+             * @return true if iterators point to same element
+             * @internal
+             */
+            bool equalPtr(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
+
+        public:
+            friend class JMap;
+
+            /**
+             * @brief Constructs iterator pointing to specific skip list node
+             * @param cur Current node pointer
+             * @note Internal constructor, not meant for direct use
+             */
+            explicit Iterator(skipListNode* cur);
+
+            /**
+             * @brief Copy constructor
+             * @param other Iterator to copy
+             */
+            Iterator(const Iterator& other);
+
+            /**
+             * @brief Copy assignment operator
+             * @param other Iterator to copy
+             * @return Reference to this iterator
+             */
+            Iterator& operator=(const Iterator& other);
+
+            /**
+             * @brief Creates a copy of this iterator
+             * @return New iterator instance
+             */
+            Iterator* clone() const override;
+
+            /**
+             * @brief Gets iterator class name
+             * @return "JMap::Iterator"
+             */
+            [[nodiscard]] std::string className() const override;
+
+            /**
+             * @brief Advances iterator by steps
+             * @param steps Number of positions to advance
+             */
+            void operator+=(integer steps) const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            void operator-=(integer steps) const override;
+
+            /**
+             * @brief Calculates distance between iterators
+             * @param other Iterator to calculate distance to
+             * @return Distance between iterators
+             * @note Returns max/min integer values if iterators are not compatible
+             */
+            integer operator-(const iterator<couple<const K_TYPE, V_TYPE>> &other) const override;
+
+            /**
+             * @brief Checks if more elements exist in forward direction
+             * @return true if more elements available
+             */
+            [[nodiscard]] bool hasNext() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            [[nodiscard]] bool hasPrev() const override;
+
+            /**
+             * @brief Checks if other is previous to this
+             * @param other Iterator to check
+             * @return true if other is previous
+             */
+            bool atPrev(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
+
+            /**
+             * @brief Checks if other is next to this
+             * @param other Iterator to check
+             * @return true if other is next
+             */
+            bool atNext(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
+
+            /**
+             * @brief Moves to next element
+             */
+            void next() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            void prev() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            Iterator* getPrev() const override;
+
+            /**
+             * @brief Gets current element (non-const)
+             * @return Reference to current key-value pair
+             */
+            couple<const K_TYPE, V_TYPE>& get() override;
+
+            /**
+             * @brief Gets current element (const)
+             * @return Copy of current key-value pair
+             */
+            couple<const K_TYPE, V_TYPE> get() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            void set(const couple<const K_TYPE, V_TYPE> &data) override;
+
+            /**
+             * @brief Checks if iterator is valid
+             * @return true if iterator points to valid element
+             */
+            [[nodiscard]] bool isValid() const override;
+
+            ~Iterator() override = default;
+        };
+
+        friend class Iterator;
+
+        /**
+         * @brief Constructs empty JMap
+         * @param comp Comparison function to use
+         * @param alloc Allocator to use
+         */
+        explicit JMap(Compare comp = Compare{}, ALLOC alloc = ALLOC{});
+
+        /**
+         * @brief Copy constructor
+         * @param other JMap to copy
+         * @details Performs deep copy of all elements and skip list structure
+         * @note Allocator is copied if propagate_on_container_copy_assignment is true
+         */
+        JMap(const JMap& other);
+
+        /**
+         * @brief Copy assignment operator
+         * @param other JMap to copy
+         * @return Reference to this JMap
+         * @details Performs deep copy of all elements and skip list structure
+         * @note Allocator is copied if propagate_on_container_copy_assignment is true
+         */
+        JMap& operator=(const JMap& other);
+
+        /**
+         * @brief Move constructor
+         * @param other JMap to move from
+         * @details Transfers ownership of resources from other
+         * @note Leaves other in valid but unspecified state
+         */
+        JMap(JMap&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator
+         * @param other JMap to move from
+         * @return Reference to this JMap
+         * @details Transfers ownership of resources from other
+         * @note Leaves other in valid but unspecified state
+         * @note Allocator is moved if propagate_on_container_move_assignment is true
+         */
+        JMap& operator=(JMap&& other) noexcept;
 
         /**
          * @brief Swaps contents with another JMap
@@ -1126,6 +1672,87 @@ namespace original {
          */
         V_TYPE & operator[](const K_TYPE &k) override;
 
+        /**
+         * @typedef rangeType
+         * @brief Lazy view type returned by range()
+         */
+        using rangeType = rangeView<couple<const K_TYPE, V_TYPE>, K_TYPE, Iterator, Compare>;
+
+        /**
+         * @brief Finds the first element whose key is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator lowerBound(const K_TYPE& k) const;
+
+        /**
+         * @brief Finds the first element whose key is greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator upperBound(const K_TYPE& k) const;
+
+        /**
+         * @brief Finds the last element whose key is not greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator floor(const K_TYPE& k) const;
+
+        /**
+         * @brief Finds the first element whose key is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note Same position as lowerBound, O(log n)
+         */
+        Iterator ceiling(const K_TYPE& k) const;
+
+        /**
+         * @brief Gets a lazy view of the elements with keys in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return View iterating the range in order
+         * @details Creating the view costs two O(log n) searches, and iterating it
+         * visits only the elements in range. The view is empty if high is not
+         * greater than low.
+         * @note JMap iterators are forward only, so the view is traversed forward only
+         */
+        rangeType range(const K_TYPE& low, const K_TYPE& high) const;
+
+        /**
+         * @brief Removes all elements with keys in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return Number of removed elements
+         */
+        u_integer eraseRange(const K_TYPE& low, const K_TYPE& high);
+
+        /**
+         * @brief Builds a JMap from sorted key-value pairs in O(n)
+         * @tparam ELEM Element type of the input iterators
+         * @param begin Iterator at the first pair
+         * @param end Iterator at the last pair (inclusive, as in algorithms)
+         * @param comp Comparison function, under which the keys must be strictly increasing
+         * @param alloc Allocator to use
+         * @return JMap holding the pairs in a deterministic skip list
+         * @throw valueError if the keys are not strictly increasing
+         * @details Reads the input twice, once to count and check it and once to build,
+         * without any search, random draw or per-element rebalancing.
+         */
+        template<typename ELEM>
+        static JMap fromSorted(const iterator<ELEM>& begin, const iterator<ELEM>& end,
+                               Compare comp = Compare{}, ALLOC alloc = ALLOC{});
+
+        /**
+         * @brief Adds the pairs of another map whose keys are absent
+         * @param other JMap to merge from, left unchanged
+         * @details Existing values win on equal keys. O(n + m), see skipList::mergeFrom.
+         */
+        void merge(const JMap& other);
+
         /**
          * @brief Gets begin iterator
          * @return New iterator at first element (minimum key)
@@ -1166,6 +1793,7 @@ namespace std {
      * @tparam V_TYPE Value type (must be copyable and movable)
      * @tparam HASH Hash function type (default: hash<K_TYPE>)
      * @tparam ALLOC Allocator type for memory management
+     * @tparam TABLE Hash table engine
      * @param lhs First hashMap to swap
      * @param rhs Second hashMap to swap
      * @note No-throw guarantee if hashMap::swap is noexcept
@@ -1188,9 +1816,10 @@ namespace std {
      * @see std::swap For the general swap algorithm
      * @see <algorithm> For standard algorithms that use swap
      */
-    template <typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-    void swap(original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>& lhs, // NOLINT
-              original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>& rhs) noexcept;
+    template <typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+              template <typename, typename, typename, typename> typename TABLE>
+    void swap(original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>& lhs, // NOLINT
+              original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>& rhs) noexcept;
 
     /**
      * @brief std::swap specialization for treeMap
@@ -1219,113 +1848,470 @@ namespace std {
      * @see std::map For the standard ordered map comparison
      * @see std::swap For the general swap algorithm
      */
+    template <typename K_TYPE, typename V_TYPE, typename COMPARE, typename ALLOC, typename AUGMENT>
+    void swap(original::treeMap<K_TYPE, V_TYPE, COMPARE, ALLOC, AUGMENT>& lhs, // NOLINT
+              original::treeMap<K_TYPE, V_TYPE, COMPARE, ALLOC, AUGMENT>& rhs) noexcept;
+
+    /**
+     * @brief std::swap specialization for bTreeMap
+     * @tparam K_TYPE Key type (must be comparable and copyable)
+     * @tparam V_TYPE Value type (must be copyable and movable)
+     * @tparam COMPARE Comparison function type (default: increaseComparator<K_TYPE>)
+     * @tparam ALLOC Allocator type for memory management
+     * @param lhs First bTreeMap to swap
+     * @param rhs Second bTreeMap to swap
+     * @note No-throw guarantee if bTreeMap::swap is noexcept
+     * @details Delegates to bTreeMap::swap(), which exchanges the root nodes, the size
+     * counters, the comparison functions and, according to ALLOC traits, the allocators.
+     *
+     * Iterator Invalidation: All iterators from both maps are invalidated
+     *
+     * @see bTreeMap::swap For the underlying swap implementation
+     * @see std::swap For the general swap algorithm
+     */
+    template <typename K_TYPE, typename V_TYPE, typename COMPARE, typename ALLOC>
+    void swap(original::bTreeMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& lhs, // NOLINT
+              original::bTreeMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& rhs) noexcept;
+
+    /**
+     * @brief std::swap specialization for JMap
+     * @tparam K_TYPE Key type (must be comparable and copyable)
+     * @tparam V_TYPE Value type (must be copyable and movable)
+     * @tparam COMPARE Comparison function type (default: increaseComparator<K_TYPE>)
+     * @tparam ALLOC Allocator type for memory management
+     * @param lhs First JMap to swap
+     * @param rhs Second JMap to swap
+     * @note No-throw guarantee if JMap::swap is noexcept
+     * @details Provides standard library integration for JMap by specializing
+     * std::swap. This enables probabilistic skip list containers to work seamlessly
+     * with standard C++ algorithms and generic programming patterns.
+     *
+     * The implementation delegates to JMap::swap() to ensure proper handling of:
+     * - Skip list head node exchange (entire multi-level structure)
+     * - Size counter swapping
+     * - Comparison function transfer
+     * - Allocator propagation according to ALLOC traits
+     *
+     * Iterator Invalidation: All iterators from both maps are invalidated
+     * Exception Safety: No-throw if JMap::swap is noexcept
+     * Probabilistic Structure: Both skip lists maintain their level distributions
+     *
+     * @see JMap::swap For the underlying swap implementation
+     * @see skipList For the underlying probabilistic data structure
+     * @see std::swap For the general swap algorithm
+     */
     template <typename K_TYPE, typename V_TYPE, typename COMPARE, typename ALLOC>
-    void swap(original::treeMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& lhs, // NOLINT
-              original::treeMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& rhs) noexcept;
+    void swap(original::JMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& lhs, // NOLINT
+              original::JMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& rhs) noexcept;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::Iterator(
+    const typename table_type::Iterator& it) : table_type::Iterator(it) {}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::equalPtr(
+        const iterator<couple<const K_TYPE, V_TYPE>>* other) const {
+    auto other_it = dynamic_cast<const Iterator*>(other);
+    return other_it && this->equalTo(*other_it);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::Iterator(const Iterator &other)
+    : table_type::Iterator(other) {}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator&
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::operator=(const Iterator &other) {
+    if (this == &other)
+        return *this;
+
+    table_type::Iterator::operator=(other);
+    return *this;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator*
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::clone() const {
+    return new Iterator(*this);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+std::string original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::className() const {
+    return "hashMap::Iterator";
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::operator+=(integer steps) const {
+    table_type::Iterator::operator+=(steps);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::operator-=(integer) const {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::integer original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::operator-(
+        const iterator<couple<const K_TYPE, V_TYPE>>&) const {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::hasNext() const {
+    return table_type::Iterator::hasNext();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::hasPrev() const {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::atPrev(
+        const iterator<couple<const K_TYPE, V_TYPE>> *other) const {
+    auto other_it = dynamic_cast<const Iterator*>(other);
+    if (!other_it) {
+        return false;
+    }
+    auto next = ownerPtr(this->clone());
+    if (!next->isValid()){
+        return false;
+    }
+
+    next->next();
+    return next->equalPtr(other_it);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::atNext(
+        const iterator<couple<const K_TYPE, V_TYPE>> *other) const {
+    return other->atPrev(*this);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::next() const {
+    table_type::Iterator::next();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::prev() const {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator*
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::getPrev() const {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::couple<const K_TYPE, V_TYPE>&
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::get() {
+    return table_type::Iterator::get();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::couple<const K_TYPE, V_TYPE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::get() const {
+    return table_type::Iterator::get();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::set(const couple<const K_TYPE, V_TYPE>&) {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator::isValid() const {
+    return table_type::Iterator::isValid();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::hashMap(HASH hash, ALLOC alloc)
+    : table_type(std::move(hash)),
+      map<K_TYPE, V_TYPE, ALLOC>(std::move(alloc)) {}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::hashMap(const hashMap &other) : hashMap() {
+    this->operator=(other);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>&
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::operator=(const hashMap &other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    this->tableCopy(other);
+    if constexpr(ALLOC::propagate_on_container_copy_assignment::value) {
+        this->allocator = other.allocator;
+    }
+    return *this;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::hashMap(hashMap &&other) noexcept : hashMap() {
+    this->operator=(std::move(other));
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>&
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::operator=(hashMap &&other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+
+    this->tableMove(std::move(other));
+    if constexpr(ALLOC::propagate_on_container_move_assignment::value) {
+        this->allocator = std::move(other.allocator);
+    }
+    return *this;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+          template <typename, typename, typename, typename> typename TABLE>
+void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::swap(hashMap& other) noexcept
+{
+    if (this == &other)
+        return;
+
+    this->tableSwap(other);
+    if constexpr (ALLOC::propagate_on_container_swap::value) {
+        std::swap(this->allocator, other.allocator);
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::u_integer
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::size() const {
+    return this->size_;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::contains(const couple<const K_TYPE, V_TYPE> &e) const {
+    return this->containsKey(e.first()) && this->get(e.first()) == e.second();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::add(const K_TYPE &k, const V_TYPE &v) {
+    return this->insert(k, v);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::remove(const K_TYPE &k) {
+    return this->erase(k);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::containsKey(const K_TYPE &k) const {
+    return this->find(k);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+V_TYPE original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::get(const K_TYPE &k) const {
+    auto node = this->find(k);
+    if (!node)
+        throw noElementError();
+    return node->getValue();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::update(const K_TYPE &key, const V_TYPE &value) {
+    return this->modify(key, value);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+const V_TYPE& original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::operator[](const K_TYPE &k) const {
+    auto node = this->find(k);
+    if (!node)
+        throw noElementError();
+    return node->getValue();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+V_TYPE& original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::operator[](const K_TYPE &k) {
+    auto node = this->find(k);
+    if (!node) {
+        this->insert(k, V_TYPE{});
+        node = this->find(k);
+    }
+    return node->getValue();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator*
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::begins() const {
+    return new Iterator(this->firstIterator());
+}
+
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::Iterator*
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::ends() const {
+    return new Iterator(this->lastIterator());
+}
 
-    /**
-     * @brief std::swap specialization for JMap
-     * @tparam K_TYPE Key type (must be comparable and copyable)
-     * @tparam V_TYPE Value type (must be copyable and movable)
-     * @tparam COMPARE Comparison function type (default: increaseComparator<K_TYPE>)
-     * @tparam ALLOC Allocator type for memory management
-     * @param lhs First JMap to swap
-     * @param rhs Second JMap to swap
-     * @note No-throw guarantee if JMap::swap is noexcept
-     * @details Provides standard library integration for JMap by specializing
-     * std::swap. This enables probabilistic skip list containers to work seamlessly
-     * with standard C++ algorithms and generic programming patterns.
-     *
-     * The implementation delegates to JMap::swap() to ensure proper handling of:
-     * - Skip list head node exchange (entire multi-level structure)
-     * - Size counter swapping
-     * - Comparison function transfer
-     * - Allocator propagation according to ALLOC traits
-     *
-     * Iterator Invalidation: All iterators from both maps are invalidated
-     * Exception Safety: No-throw if JMap::swap is noexcept
-     * Probabilistic Structure: Both skip lists maintain their level distributions
-     *
-     * @see JMap::swap For the underlying swap implementation
-     * @see skipList For the underlying probabilistic data structure
-     * @see std::swap For the general swap algorithm
-     */
-    template <typename K_TYPE, typename V_TYPE, typename COMPARE, typename ALLOC>
-    void swap(original::JMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& lhs, // NOLINT
-              original::JMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& rhs) noexcept;
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+std::string original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::className() const {
+    return "hashMap";
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::Iterator(
-    vector<hashNode *, rebind_alloc_pointer> *buckets, u_integer bucket, hashNode *node)
-    : hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator(
-        const_cast<vector<hashNode*, rebind_alloc_pointer>*>(buckets), bucket, node) {}
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+std::string original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::toString(const bool enter) const {
+    std::stringstream ss;
+    ss << this->className();
+    ss << "(";
+    bool first = true;
+    for (auto it = this->begin(); it != this->end(); it.next()){
+        if (!first){
+            ss << ", ";
+        }
+        ss << "{" << printable::formatString(it.get().template get<0>()) << ": "
+           << printable::formatString(it.get().template get<1>()) << "}";
+        first = false;
+    }
+    ss << ")";
+    if (enter)
+        ss << "\n";
+    return ss.str();
+}
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::equalPtr(
-        const iterator<couple<const K_TYPE, V_TYPE>>* other) const {
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>::~hashMap() = default;
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::Iterator(RBTreeType* tree, RBNode* cur)
+    : RBTreeType::Iterator(tree, cur)  {}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::equalPtr(
+    const iterator<couple<const K_TYPE, V_TYPE>>* other) const
+{
     auto other_it = dynamic_cast<const Iterator*>(other);
     return other_it &&
-           this->p_buckets == other_it->p_buckets &&
-           this->cur_bucket == other_it->cur_bucket &&
-           this->p_node == other_it->p_node;
+           this->tree_ == other_it->tree_ &&
+           this->cur_ == other_it->cur_;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::Iterator(const Iterator &other) : Iterator() {
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::Iterator(const Iterator& other) : Iterator(nullptr, nullptr)
+{
     this->operator=(other);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator&
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::operator=(const Iterator &other) {
-    if (this == &other)
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator&
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::operator=(const Iterator& other)
+{
+    if (this == &other) {
         return *this;
+    }
 
-    hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::operator=(other);
+    this->tree_ = other.tree_;
+    this->cur_ = other.cur_;
     return *this;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator*
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::clone() const {
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator*
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::clone() const
+{
     return new Iterator(*this);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-std::string original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::className() const {
-    return "hashMap::Iterator";
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+std::string original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::className() const
+{
+    return "treeMap::Iterator";
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::operator+=(integer steps) const {
-    hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::operator+=(steps);
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::operator+=(integer steps) const
+{
+    RBTreeType::Iterator::operator+=(steps);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::operator-=(integer) const {
-    throw unSupportedMethodError();
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::operator-=(integer steps) const
+{
+    RBTreeType::Iterator::operator-=(steps);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::integer original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::operator-(
-        const iterator<couple<const K_TYPE, V_TYPE>>&) const {
-    throw unSupportedMethodError();
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::integer
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::operator-(
+    const iterator<couple<const K_TYPE, V_TYPE>>& other) const
+{
+    if constexpr (!AUGMENT::SUBTREE_SIZE) {
+        throw unSupportedMethodError();
+    } else {
+        auto other_it = dynamic_cast<const Iterator*>(&other);
+        if (other_it == nullptr)
+            return this > &other ?
+                   std::numeric_limits<integer>::max() :
+                   std::numeric_limits<integer>::min();
+        return RBTreeType::Iterator::operator-(*other_it);
+    }
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::hasNext() const {
-    return hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::hasNext();
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::hasNext() const
+{
+    return RBTreeType::Iterator::hasNext();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::hasPrev() const {
-    throw unSupportedMethodError();
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::hasPrev() const
+{
+    return RBTreeType::Iterator::hasPrev();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::atPrev(
-        const iterator<couple<const K_TYPE, V_TYPE>> *other) const {
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::atPrev(
+    const iterator<couple<const K_TYPE, V_TYPE>>* other) const
+{
     auto other_it = dynamic_cast<const Iterator*>(other);
     if (!other_it) {
         return false;
@@ -1339,70 +2325,79 @@ bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::atPrev(
     return next->equalPtr(other_it);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::atNext(
-        const iterator<couple<const K_TYPE, V_TYPE>> *other) const {
-    return other->atPrev(*this);
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::atNext(
+    const iterator<couple<const K_TYPE, V_TYPE>>* other) const
+{
+    return other->atNext(*this);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::next() const {
-    hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::next();
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::next() const
+{
+    RBTreeType::Iterator::next();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::prev() const {
-    throw unSupportedMethodError();
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::prev() const
+{
+    RBTreeType::Iterator::prev();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator*
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::getPrev() const {
-    throw unSupportedMethodError();
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator*
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::getPrev() const
+{
+    auto it = this->clone();
+    it->prev();
+    return it;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::couple<const K_TYPE, V_TYPE>&
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::get() {
-    return hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::get();
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::couple<const K_TYPE, V_TYPE>& original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::get()
+{
+    return RBTreeType::Iterator::get();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::couple<const K_TYPE, V_TYPE>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::get() const {
-    return hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::get();
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::couple<const K_TYPE, V_TYPE> original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::get() const
+{
+    return RBTreeType::Iterator::get();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::set(const couple<const K_TYPE, V_TYPE>&) {
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::set(const couple<const K_TYPE, V_TYPE>&)
+{
     throw unSupportedMethodError();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator::isValid() const {
-    return hashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::isValid();
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator::isValid() const
+{
+    return RBTreeType::Iterator::isValid();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::hashMap(HASH hash, ALLOC alloc)
-    : hashTable<K_TYPE, V_TYPE, ALLOC, HASH>(std::move(hash)),
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::treeMap(Compare comp, ALLOC alloc)
+    : RBTreeType(std::move(comp)),
       map<K_TYPE, V_TYPE, ALLOC>(std::move(alloc)) {}
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::hashMap(const hashMap &other) : hashMap() {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::treeMap(const treeMap& other) : treeMap() {
     this->operator=(other);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>&
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::operator=(const hashMap &other) {
-    if (this == &other) {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>&
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::operator=(const treeMap& other) {
+    if (this == &other){
         return *this;
     }
 
-    this->buckets = this->bucketsCopy(other.buckets);
+    this->destroyTree();
+    this->root_ = other.treeCopy();
     this->size_ = other.size_;
-    this->hash_ = other.hash_;
+    this->compare_ = other.compare_;
     if constexpr(ALLOC::propagate_on_container_copy_assignment::value) {
         this->allocator = other.allocator;
         this->rebind_alloc = other.rebind_alloc;
@@ -1410,22 +2405,24 @@ original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::operator=(const hashMap &other)
     return *this;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::hashMap(hashMap &&other) noexcept : hashMap() {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::treeMap(treeMap&& other) noexcept : treeMap() {
     this->operator=(std::move(other));
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>&
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::operator=(hashMap &&other) noexcept {
-    if (this == &other) {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>&
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::operator=(treeMap&& other) noexcept {
+    if (this == &other){
         return *this;
     }
 
-    this->buckets = std::move(other.buckets);
+    this->destroyTree();
+    this->root_ = other.root_;
+    other.root_ = nullptr;
     this->size_ = other.size_;
     other.size_ = 0;
-    this->hash_ = std::move(other.hash_);
+    this->compare_ = std::move(other.compare_);
     if constexpr(ALLOC::propagate_on_container_move_assignment::value) {
         this->allocator = std::move(other.allocator);
         this->rebind_alloc = std::move(other.rebind_alloc);
@@ -1433,71 +2430,70 @@ original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::operator=(hashMap &&other) noexc
     return *this;
 }
 
-template <typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-void original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::swap(hashMap& other) noexcept
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::swap(treeMap& other) noexcept
 {
     if (this == &other)
         return;
 
+    std::swap(this->root_, other.root_);
     std::swap(this->size_, other.size_);
-    std::swap(this->buckets, other.buckets);
-    std::swap(this->hash_, other.hash_);
+    std::swap(this->compare_, other.compare_);
     if constexpr (ALLOC::propagate_on_container_swap::value) {
         std::swap(this->allocator, other.allocator);
         std::swap(this->rebind_alloc, other.rebind_alloc);
     }
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::u_integer
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::size() const {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::u_integer original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::size() const {
     return this->size_;
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
 bool
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::contains(const couple<const K_TYPE, V_TYPE> &e) const {
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::contains(const couple<const K_TYPE, V_TYPE> &e) const {
     return this->containsKey(e.first()) && this->get(e.first()) == e.second();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::add(const K_TYPE &k, const V_TYPE &v) {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::add(const K_TYPE &k, const V_TYPE &v) {
     return this->insert(k, v);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::remove(const K_TYPE &k) {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::remove(const K_TYPE &k) {
     return this->erase(k);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::containsKey(const K_TYPE &k) const {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::containsKey(const K_TYPE &k) const {
     return this->find(k);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-V_TYPE original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::get(const K_TYPE &k) const {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+V_TYPE original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::get(const K_TYPE &k) const {
     auto node = this->find(k);
     if (!node)
         throw noElementError();
     return node->getValue();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-bool original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::update(const K_TYPE &key, const V_TYPE &value) {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::update(const K_TYPE &key, const V_TYPE &value) {
     return this->modify(key, value);
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-const V_TYPE& original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::operator[](const K_TYPE &k) const {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+const V_TYPE &original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::operator[](const K_TYPE &k) const {
     auto node = this->find(k);
     if (!node)
         throw noElementError();
     return node->getValue();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-V_TYPE& original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::operator[](const K_TYPE &k) {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+V_TYPE &original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::operator[](const K_TYPE &k) {
     auto node = this->find(k);
     if (!node) {
         this->insert(k, V_TYPE{});
@@ -1506,36 +2502,105 @@ V_TYPE& original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::operator[](const K_TYPE
     return node->getValue();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator*
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::begins() const {
-    auto p_buckets = const_cast<vector<hashNode*, rebind_alloc_pointer>*>(&this->buckets);
-    if (this->buckets[0]) {
-        return new Iterator(p_buckets, 0, this->buckets[0]);
-    }
-    auto bucket = Iterator::findNextValidBucket(p_buckets, 0);
-    return new Iterator(p_buckets, bucket, p_buckets->get(bucket));
-}
-
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::Iterator*
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::ends() const {
-    auto p_buckets = const_cast<vector<hashNode*, rebind_alloc_pointer>*>(&this->buckets);
-    auto bucket = Iterator::findPrevValidBucket(p_buckets, this->buckets.size());
-    auto node = this->buckets[bucket];
-    while (node && node->getPNext()) {
-        node = node->getPNext();
-    }
-    return new Iterator(p_buckets, bucket, node);
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::lowerBound(const K_TYPE& k) const
+{
+    return Iterator(const_cast<treeMap*>(this), this->ceilingNode(k));
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-std::string original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::className() const {
-    return "hashMap";
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::upperBound(const K_TYPE& k) const
+{
+    return Iterator(const_cast<treeMap*>(this), this->higherNode(k));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::floor(const K_TYPE& k) const
+{
+    return Iterator(const_cast<treeMap*>(this), this->floorNode(k));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::ceiling(const K_TYPE& k) const
+{
+    return Iterator(const_cast<treeMap*>(this), this->ceilingNode(k));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::rangeType
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::range(const K_TYPE& low, const K_TYPE& high) const
+{
+    return rangeType(this->lowerBound(low), Iterator(const_cast<treeMap*>(this), this->lowerNode(high)), low, high, this->compare_);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::u_integer
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::eraseRange(const K_TYPE& low, const K_TYPE& high)
+{
+    return RBTreeType::eraseRange(low, high);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+template <typename ELEM>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::fromSorted(const iterator<ELEM>& begin, const iterator<ELEM>& end,
+    Compare comp, ALLOC alloc)
+{
+    treeMap result(std::move(comp), std::move(alloc));
+    sortedRange<ELEM, K_TYPE, Compare> cursor(begin, end, result.compare_);
+    result.rebuildSorted(cursor.remaining(), [&cursor] {
+        auto elem = cursor.get();
+        cursor.next();
+        return elem;
+    });
+    return result;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::merge(const treeMap& other)
+{
+    RBTreeType::mergeFrom(other);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::select(const u_integer index) const requires AUGMENT::SUBTREE_SIZE
+{
+    return Iterator(const_cast<treeMap*>(this), this->selectNode(index));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::u_integer
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::rank(const K_TYPE& k) const requires AUGMENT::SUBTREE_SIZE
+{
+    return this->rankOf(k);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator*
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::begins() const
+{
+    return new Iterator(const_cast<treeMap*>(this), this->getMinNode());
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::Iterator*
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::ends() const
+{
+    return new Iterator(const_cast<treeMap*>(this), this->getMaxNode());
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+std::string original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::className() const {
+    return "treeMap";
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-std::string original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::toString(const bool enter) const {
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+std::string original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::toString(const bool enter) const {
     std::stringstream ss;
     ss << this->className();
     ss << "(";
@@ -1554,90 +2619,93 @@ std::string original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::toString(const bool
     return ss.str();
 }
 
-template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>::~hashMap() = default;
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC, AUGMENT>::~treeMap() = default;
+
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::Iterator(RBTreeType* tree, RBNode* cur)
-    : RBTreeType::Iterator(tree, cur)  {}
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::Iterator(bTreeType* tree, leafNode* leaf, const u_integer index)
+    : bTreeType::Iterator(tree, leaf, index)  {}
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
 bool
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::equalPtr(
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::equalPtr(
     const iterator<couple<const K_TYPE, V_TYPE>>* other) const
 {
     auto other_it = dynamic_cast<const Iterator*>(other);
     return other_it &&
            this->tree_ == other_it->tree_ &&
-           this->cur_ == other_it->cur_;
+           this->leaf_ == other_it->leaf_ &&
+           this->index_ == other_it->index_;
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::Iterator(const Iterator& other) : Iterator(nullptr, nullptr)
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::Iterator(const Iterator& other) : Iterator(nullptr, nullptr, 0)
 {
     this->operator=(other);
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator&
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator=(const Iterator& other)
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator&
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator=(const Iterator& other)
 {
     if (this == &other) {
         return *this;
     }
 
     this->tree_ = other.tree_;
-    this->cur_ = other.cur_;
+    this->leaf_ = other.leaf_;
+    this->index_ = other.index_;
     return *this;
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::clone() const
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::clone() const
 {
     return new Iterator(*this);
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-std::string original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::className() const
+std::string original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::className() const
 {
-    return "treeMap::Iterator";
+    return "bTreeMap::Iterator";
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator+=(integer steps) const
+void original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator+=(integer steps) const
 {
-    RBTreeType::Iterator::operator+=(steps);
+    bTreeType::Iterator::operator+=(steps);
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator-=(integer steps) const
+void original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator-=(integer steps) const
 {
-    RBTreeType::Iterator::operator-=(steps);
+    bTreeType::Iterator::operator-=(steps);
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
 original::integer
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator-(
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator-(
     const iterator<couple<const K_TYPE, V_TYPE>>&) const
 {
     throw unSupportedMethodError();
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::hasNext() const
+bool original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::hasNext() const
 {
-    return RBTreeType::Iterator::hasNext();
+    return bTreeType::Iterator::hasNext();
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::hasPrev() const
+bool original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::hasPrev() const
 {
-    return RBTreeType::Iterator::hasPrev();
+    return bTreeType::Iterator::hasPrev();
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::atPrev(
+bool original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::atPrev(
     const iterator<couple<const K_TYPE, V_TYPE>>* other) const
 {
     auto other_it = dynamic_cast<const Iterator*>(other);
@@ -1654,27 +2722,27 @@ bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::atPrev(
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::atNext(
+bool original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::atNext(
     const iterator<couple<const K_TYPE, V_TYPE>>* other) const
 {
     return other->atNext(*this);
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::next() const
+void original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::next() const
 {
-    RBTreeType::Iterator::next();
+    bTreeType::Iterator::next();
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::prev() const
+void original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::prev() const
 {
-    RBTreeType::Iterator::prev();
+    bTreeType::Iterator::prev();
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::getPrev() const
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::getPrev() const
 {
     auto it = this->clone();
     it->prev();
@@ -1682,42 +2750,42 @@ original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::getPrev() const
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::couple<const K_TYPE, V_TYPE>& original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::get()
+original::couple<const K_TYPE, V_TYPE>& original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::get()
 {
-    return RBTreeType::Iterator::get();
+    return bTreeType::Iterator::get();
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::couple<const K_TYPE, V_TYPE> original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::get() const
+original::couple<const K_TYPE, V_TYPE> original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::get() const
 {
-    return RBTreeType::Iterator::get();
+    return bTreeType::Iterator::get();
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::set(const couple<const K_TYPE, V_TYPE>&)
+void original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::set(const couple<const K_TYPE, V_TYPE>&)
 {
     throw unSupportedMethodError();
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::isValid() const
+bool original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::isValid() const
 {
-    return RBTreeType::Iterator::isValid();
+    return bTreeType::Iterator::isValid();
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::treeMap(Compare comp, ALLOC alloc)
-    : RBTreeType(std::move(comp)),
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::bTreeMap(Compare comp, ALLOC alloc)
+    : bTreeType(std::move(comp)),
       map<K_TYPE, V_TYPE, ALLOC>(std::move(alloc)) {}
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::treeMap(const treeMap& other) : treeMap() {
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::bTreeMap(const bTreeMap& other) : bTreeMap() {
     this->operator=(other);
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>&
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator=(const treeMap& other) {
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>&
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator=(const bTreeMap& other) {
     if (this == &other){
         return *this;
     }
@@ -1729,18 +2797,19 @@ original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator=(const treeMap& othe
     if constexpr(ALLOC::propagate_on_container_copy_assignment::value) {
         this->allocator = other.allocator;
         this->rebind_alloc = other.rebind_alloc;
+        this->rebind_alloc_inner_ = other.rebind_alloc_inner_;
     }
     return *this;
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::treeMap(treeMap&& other) noexcept : treeMap() {
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::bTreeMap(bTreeMap&& other) noexcept : bTreeMap() {
     this->operator=(std::move(other));
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>&
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator=(treeMap&& other) noexcept {
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>&
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator=(bTreeMap&& other) noexcept {
     if (this == &other){
         return *this;
     }
@@ -1754,12 +2823,13 @@ original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator=(treeMap&& other) no
     if constexpr(ALLOC::propagate_on_container_move_assignment::value) {
         this->allocator = std::move(other.allocator);
         this->rebind_alloc = std::move(other.rebind_alloc);
+        this->rebind_alloc_inner_ = std::move(other.rebind_alloc_inner_);
     }
     return *this;
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::swap(treeMap& other) noexcept
+void original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::swap(bTreeMap& other) noexcept
 {
     if (this == &other)
         return;
@@ -1770,87 +2840,142 @@ void original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::swap(treeMap& other) noe
     if constexpr (ALLOC::propagate_on_container_swap::value) {
         std::swap(this->allocator, other.allocator);
         std::swap(this->rebind_alloc, other.rebind_alloc);
+        std::swap(this->rebind_alloc_inner_, other.rebind_alloc_inner_);
     }
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::u_integer original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::size() const {
+original::u_integer original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::size() const {
     return this->size_;
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
 bool
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::contains(const couple<const K_TYPE, V_TYPE> &e) const {
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::contains(const couple<const K_TYPE, V_TYPE> &e) const {
     return this->containsKey(e.first()) && this->get(e.first()) == e.second();
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::add(const K_TYPE &k, const V_TYPE &v) {
+bool original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::add(const K_TYPE &k, const V_TYPE &v) {
     return this->insert(k, v);
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::remove(const K_TYPE &k) {
+bool original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::remove(const K_TYPE &k) {
     return this->erase(k);
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::containsKey(const K_TYPE &k) const {
+bool original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::containsKey(const K_TYPE &k) const {
     return this->find(k);
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-V_TYPE original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::get(const K_TYPE &k) const {
-    auto node = this->find(k);
-    if (!node)
+V_TYPE original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::get(const K_TYPE &k) const {
+    auto entry = this->find(k);
+    if (!entry)
         throw noElementError();
-    return node->getValue();
+    return entry->template get<1>();
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-bool original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::update(const K_TYPE &key, const V_TYPE &value) {
+bool original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::update(const K_TYPE &key, const V_TYPE &value) {
     return this->modify(key, value);
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-const V_TYPE &original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator[](const K_TYPE &k) const {
-    auto node = this->find(k);
-    if (!node)
+const V_TYPE &original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator[](const K_TYPE &k) const {
+    auto entry = this->find(k);
+    if (!entry)
         throw noElementError();
-    return node->getValue();
+    return entry->template get<1>();
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-V_TYPE &original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator[](const K_TYPE &k) {
-    auto node = this->find(k);
-    if (!node) {
+V_TYPE &original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator[](const K_TYPE &k) {
+    auto entry = this->find(k);
+    if (!entry) {
         this->insert(k, V_TYPE{});
-        node = this->find(k);
+        entry = this->find(k);
     }
-    return node->getValue();
+    return entry->template get<1>();
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::begins() const
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::lowerBound(const K_TYPE& k) const
 {
-    return new Iterator(const_cast<treeMap*>(this), this->getMinNode());
+    u_integer index = 0;
+    auto leaf = this->ceilingSlot(k, index);
+    return Iterator(const_cast<bTreeMap*>(this), leaf, index);
 }
 
 template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::ends() const
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::upperBound(const K_TYPE& k) const
 {
-    return new Iterator(const_cast<treeMap*>(this), this->getMaxNode());
+    u_integer index = 0;
+    auto leaf = this->higherSlot(k, index);
+    return Iterator(const_cast<bTreeMap*>(this), leaf, index);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::floor(const K_TYPE& k) const
+{
+    u_integer index = 0;
+    auto leaf = this->floorSlot(k, index);
+    return Iterator(const_cast<bTreeMap*>(this), leaf, index);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::ceiling(const K_TYPE& k) const
+{
+    u_integer index = 0;
+    auto leaf = this->ceilingSlot(k, index);
+    return Iterator(const_cast<bTreeMap*>(this), leaf, index);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::rangeType
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::range(const K_TYPE& low, const K_TYPE& high) const
+{
+    u_integer index = 0;
+    auto leaf = this->lowerSlot(high, index);
+    return rangeType(this->lowerBound(low), Iterator(const_cast<bTreeMap*>(this), leaf, index),
+                     low, high, this->compare_);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::u_integer
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::eraseRange(const K_TYPE& low, const K_TYPE& high)
+{
+    return bTreeType::eraseRange(low, high);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::begins() const
+{
+    return new Iterator(const_cast<bTreeMap*>(this), this->getMinLeaf(), 0);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::ends() const
+{
+    auto leaf = this->getMaxLeaf();
+    return new Iterator(const_cast<bTreeMap*>(this), leaf, leaf ? leaf->count() - 1 : 0);
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-std::string original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::className() const {
-    return "treeMap";
+std::string original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::className() const {
+    return "bTreeMap";
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-std::string original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::toString(const bool enter) const {
+std::string original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::toString(const bool enter) const {
     std::stringstream ss;
     ss << this->className();
     ss << "(";
@@ -1870,7 +2995,7 @@ std::string original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::toString(const bo
 }
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
-original::treeMap<K_TYPE, V_TYPE, Compare, ALLOC>::~treeMap() = default;
+original::bTreeMap<K_TYPE, V_TYPE, Compare, ALLOC>::~bTreeMap() = default;
 
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
 bool original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::equalPtr(
@@ -2033,7 +3158,7 @@ original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator=(JMap&& other) noexcept
 
     this->listDestroy();
     this->head_ = other.head_;
-    other.head_ = other.createNode();
+    other.head_ = other.createHead();
     this->size_ = other.size_;
     other.size_ = 0;
     this->compare_ = std::move(other.compare_);
@@ -2115,6 +3240,70 @@ V_TYPE &original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator[](const K_TYPE
     return node->getValue();
 }
 
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::lowerBound(const K_TYPE& k) const
+{
+    return Iterator(this->ceilingNode(k));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::upperBound(const K_TYPE& k) const
+{
+    return Iterator(this->higherNode(k));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::floor(const K_TYPE& k) const
+{
+    return Iterator(this->floorNode(k));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::ceiling(const K_TYPE& k) const
+{
+    return Iterator(this->ceilingNode(k));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::rangeType
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::range(const K_TYPE& low, const K_TYPE& high) const
+{
+    return rangeType(this->lowerBound(low), Iterator(this->lowerNode(high)), low, high, this->compare_);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::u_integer
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::eraseRange(const K_TYPE& low, const K_TYPE& high)
+{
+    return skipListType::eraseRange(low, high);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+template <typename ELEM>
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>
+original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::fromSorted(const iterator<ELEM>& begin, const iterator<ELEM>& end,
+    Compare comp, ALLOC alloc)
+{
+    JMap result(std::move(comp), std::move(alloc));
+    sortedRange<ELEM, K_TYPE, Compare> cursor(begin, end, result.compare_);
+    result.rebuildSorted(cursor.remaining(), [&cursor] {
+        auto elem = cursor.get();
+        cursor.next();
+        return elem;
+    });
+    return result;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+void original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::merge(const JMap& other)
+{
+    skipListType::mergeFrom(other);
+}
+
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
 original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
 original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::begins() const {
@@ -2155,16 +3344,24 @@ std::string original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::toString(bool enter)
 template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
 original::JMap<K_TYPE, V_TYPE, Compare, ALLOC>::~JMap() = default;
 
-template <typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC>
-void std::swap(original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>& lhs, // NOLINT
-    original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC>& rhs) noexcept
+template<typename K_TYPE, typename V_TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void std::swap(original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>& lhs, // NOLINT
+    original::hashMap<K_TYPE, V_TYPE, HASH, ALLOC, TABLE>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename COMPARE, typename ALLOC, typename AUGMENT>
+void std::swap(original::treeMap<K_TYPE, V_TYPE, COMPARE, ALLOC, AUGMENT>& lhs, // NOLINT
+    original::treeMap<K_TYPE, V_TYPE, COMPARE, ALLOC, AUGMENT>& rhs) noexcept
 {
     lhs.swap(rhs);
 }
 
 template <typename K_TYPE, typename V_TYPE, typename COMPARE, typename ALLOC>
-void std::swap(original::treeMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& lhs, // NOLINT
-    original::treeMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& rhs) noexcept
+void std::swap(original::bTreeMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& lhs, // NOLINT
+    original::bTreeMap<K_TYPE, V_TYPE, COMPARE, ALLOC>& rhs) noexcept
 {
     lhs.swap(rhs);
 }
@@ -0,0 +1,772 @@
+#ifndef OPENHASHTABLE_H
+#define OPENHASHTABLE_H
+
+#include <cstdint>
+#include <new>
+#include "allocator.h"
+#include "couple.h"
+#include "error.h"
+#include "hash.h"
+
+
+/**
+ * @file openHashTable.h
+ * @brief Open-addressing hash table engine
+ * @details Provides an alternative storage backend for hashMap and hashSet with:
+ * - Robin Hood linear probing with backward-shift deletion
+ * - Key-value pairs stored inline in one flat slot array (no per-element allocation)
+ * - Power-of-two capacity with Fibonacci hashing of the user hash value
+ * - Probe distance stored in front of each slot, so a probe touches one cache line per slot
+ *
+ * The class exposes the same protected interface as hashTable, so it can be
+ * selected through the TABLE template parameter of hashMap and hashSet:
+ * @code
+ * hashMap<int, int, hash<int>, allocator<couple<const int, int>>, openHashTable> map;
+ * @endcode
+ */
+
+namespace original {
+
+    /**
+     * @class openHashTable
+     * @tparam K_TYPE Key type (must be hashable)
+     * @tparam V_TYPE Value type
+     * @tparam ALLOC Allocator type (default: allocator<K_TYPE>)
+     * @tparam HASH Hash function type (default: hash<K_TYPE>)
+     * @brief Open-addressing hash table using Robin Hood probing
+     * @details Elements live directly in a slot array of power-of-two capacity. Each slot
+     * starts with a probe distance (0 = empty, d = element sits d - 1 slots after its home slot).
+     * Insertion keeps every probe run ordered by home slot by shifting the tail of the
+     * run one slot forward, and deletion shifts the tail one slot back, so no tombstones
+     * are ever left behind.
+     *
+     * Performance Characteristics:
+     * - Insertion: Average O(1), Worst O(n)
+     * - Lookup: Average O(1), Worst O(n)
+     * - Deletion: Average O(1), Worst O(n)
+     *
+     * Compared with hashTable:
+     * - No node allocation per element and no pointer chasing while probing
+     * - Lookups stop as soon as the probe distance of a slot is shorter than the
+     *   distance searched so far
+     * - Elements are relocated by insertions, deletions and rehashes, so every
+     *   modification invalidates all iterators and element references
+     *
+     * @note Relocating an element moves its key and value, so keys whose move
+     * constructor does not allocate (e.g. std::string) are never deep-copied
+     */
+    template<typename K_TYPE, typename V_TYPE, typename ALLOC = allocator<K_TYPE>, typename HASH = hash<K_TYPE>>
+    class openHashTable {
+    protected:
+
+        /**
+         * @class hashNode
+         * @brief Inline slot payload of the open-addressing table
+         * @details Holds only the key-value pair, without chain links or virtual wrapper
+         * interface. Provides the same accessors as hashTable::hashNode so the containers
+         * built on top can use either engine.
+         */
+        class hashNode final {
+            couple<const K_TYPE, V_TYPE> data_;
+
+        public:
+            /**
+             * @brief Constructs a node holding key and value
+             * @param key Key to store
+             * @param value Value to associate
+             */
+            hashNode(const K_TYPE& key, const V_TYPE& value);
+
+            /**
+             * @brief Move constructor used when relocating slots
+             * @param other Node to move from, must be destroyed right afterwards
+             * @details Moves the key as well as the value. The key is const only to
+             * keep it read-only for users; other is a slot being vacated, so its key
+             * is never read again, the same contract as std::node_handle::key().
+             */
+            hashNode(hashNode&& other);
+
+            /**
+             * @brief Gets key-value pair (non-const)
+             * @return Reference to the contained pair
+             */
+            couple<const K_TYPE, V_TYPE>& getVal();
+
+            /**
+             * @brief Gets key-value pair (const)
+             * @return Const reference to the contained pair
+             */
+            const couple<const K_TYPE, V_TYPE>& getVal() const;
+
+            /**
+             * @brief Gets the key (const)
+             * @return Const reference to the key
+             */
+            const K_TYPE& getKey() const;
+
+            /**
+             * @brief Gets the value (const)
+             * @return Const reference to the value
+             */
+            const V_TYPE& getValue() const;
+
+            /**
+             * @brief Gets the value (non-const)
+             * @return Reference to the value
+             */
+            V_TYPE& getValue();
+
+            /**
+             * @brief Sets a new value
+             * @param value New value to set
+             */
+            void setValue(const V_TYPE& value);
+        };
+
+        /**
+         * @struct slot
+         * @brief One entry of the slot array
+         * @details A probe distance followed by raw storage for a hashNode. The node
+         * is constructed only while distance is non-zero.
+         */
+        struct slot {
+            u_integer distance;
+            alignas(hashNode) byte storage[sizeof(hashNode)];
+
+            /**
+             * @brief Gets the node stored in this slot
+             * @return Pointer to the node, only meaningful while distance is non-zero
+             */
+            hashNode* node() noexcept;
+        };
+
+        /**
+         * @typedef rebind_alloc_slot
+         * @brief Rebound allocator type for slot storage
+         */
+        using rebind_alloc_slot = typename ALLOC::template rebind_alloc<slot>;
+
+        /**
+         * @brief Minimum load factor before shrinking
+         */
+        static constexpr floating LOAD_FACTOR_MIN = 0.25;
+
+        /**
+         * @brief Maximum load factor before expanding
+         * @details Robin Hood probing keeps probe lengths short even at high load,
+         * so the table is allowed to be fuller than a chaining table.
+         */
+        static constexpr floating LOAD_FACTOR_MAX = 0.875;
+
+        /**
+         * @brief Capacity allocated by the first insertion, never shrunk below
+         */
+        static constexpr u_integer MIN_CAPACITY = 16;
+
+        u_integer size_;
+        u_integer capacity_;
+        u_integer shift_;
+        slot* slots_;
+        HASH hash_;
+        mutable rebind_alloc_slot rebind_alloc{};
+
+        /**
+         * @class Iterator
+         * @brief Forward iterator for openHashTable
+         * @details Walks the slot array in index order, skipping empty slots.
+         *
+         * Iterator Characteristics:
+         * - Forward iteration only (throws on reverse operations)
+         * - Invalidates on any insertion or deletion, as elements may be relocated
+         * - Lightweight copy semantics (table pointer and slot index)
+         */
+        class Iterator {
+            friend class openHashTable;
+        protected:
+            mutable openHashTable* p_table;
+            mutable u_integer cur_slot;
+
+            /**
+             * @brief Constructs an iterator pointing to a slot
+             * @param table Table being iterated
+             * @param index Current slot index, capacity of the table for the end position
+             * @note Protected constructor for use by openHashTable only
+             */
+            explicit Iterator(openHashTable* table = nullptr, u_integer index = 0);
+
+            /**
+             * @brief Copy constructor
+             * @param other Iterator to copy
+             */
+            Iterator(const Iterator& other);
+
+            /**
+             * @brief Copy assignment operator
+             * @param other Iterator to copy from
+             * @return Reference to this iterator
+             */
+            Iterator& operator=(const Iterator& other);
+
+            /**
+             * @brief Checks if two iterators point to the same position
+             * @param other Iterator to compare with
+             * @return true if both refer to the same slot of the same table
+             */
+            [[nodiscard]] bool equalTo(const Iterator& other) const;
+        public:
+            /**
+              * @brief Checks if more elements are available
+              * @return true if more elements can be traversed
+              */
+            [[nodiscard]] bool hasNext() const;
+
+            /**
+             * @brief Advances to the next element
+             * @throw outOfBoundError if already at end
+             */
+            void next() const;
+
+            /**
+             * @brief Advances iterator by steps positions
+             * @param steps Number of positions to advance (must be >= 0)
+             * @throw unSupportedMethodError if steps is negative
+             */
+            void operator+=(integer steps) const;
+
+            /**
+             * @brief Gets current key-value pair (non-const)
+             * @return Reference to current pair
+             * @throw outOfBoundError if iterator is invalid
+             */
+            couple<const K_TYPE, V_TYPE>& get();
+
+            /**
+             * @brief Gets current key-value pair (const)
+             * @return Copy of current pair
+             * @throw outOfBoundError if iterator is invalid
+             */
+            couple<const K_TYPE, V_TYPE> get() const;
+
+            /**
+             * @brief Checks if iterator points to valid element
+             * @return true if iterator is valid
+             */
+            [[nodiscard]] bool isValid() const;
+        };
+
+        /**
+         * @brief Finds the first occupied slot at or after index
+         * @param index Slot index to start from
+         * @return Index of the occupied slot, or capacity if none
+         */
+        u_integer nextOccupied(u_integer index) const;
+
+        /**
+         * @brief Computes the home slot of a key
+         * @param key Key to hash
+         * @return Slot index in [0, capacity)
+         * @details Multiplies the hash value by 2^64 / phi and keeps the top bits, so
+         * weak hash functions (e.g. identity on integers) still spread over the table.
+         */
+        u_integer homeOf(const K_TYPE& key) const;
+
+        /**
+         * @brief Locates a key or the slot where it belongs
+         * @param key Key to look for
+         * @param index Receives the slot of the key, or the insertion slot if absent
+         * @param distance Receives the probe distance matching index
+         * @return true if the key is present
+         */
+        bool locate(const K_TYPE& key, u_integer& index, u_integer& distance) const;
+
+        /**
+         * @brief Moves a node into an empty slot and destroys the source
+         * @param dst Uninitialized destination slot
+         * @param src Constructed source node
+         * @note A half-finished Robin Hood shift cannot be rolled back, so a key or
+         * value whose move constructor throws terminates here
+         */
+        static void relocate(hashNode* dst, hashNode* src) noexcept;
+
+        /**
+         * @brief Places a node at its Robin Hood position
+         * @param index Insertion slot found by locate()
+         * @param distance Probe distance at index
+         * @param node Node to move into the table
+         * @details Shifts the rest of the probe run one slot forward up to the next
+         * empty slot, then moves node into the freed slot. The table must have
+         * at least one empty slot.
+         */
+        void place(u_integer index, u_integer distance, hashNode& node) noexcept;
+
+        /**
+         * @brief Rebuilds the table with a new capacity
+         * @param new_capacity New slot count (power of two, larger than size)
+         * @note Invalidates all iterators
+         */
+        void rehash(u_integer new_capacity);
+
+        /**
+         * @brief Destroys all elements and releases the slot arrays
+         */
+        void release() noexcept;
+
+        /**
+         * @brief Constructs empty openHashTable
+         * @param hash Hash function to use
+         * @note No memory is allocated until the first insertion
+         */
+        explicit openHashTable(HASH hash = HASH{});
+
+        /**
+         * @brief Creates an iterator at the first element
+         * @return Iterator to the first element, or an invalid iterator if empty
+         */
+        Iterator firstIterator() const;
+
+        /**
+         * @brief Creates an iterator at the last element
+         * @return Iterator to the last element, or an invalid iterator if empty
+         */
+        Iterator lastIterator() const;
+
+        /**
+         * @brief Replaces the contents with a deep copy of another table
+         * @param other Table to copy
+         * @note Allocators are copied if propagate_on_container_copy_assignment is true
+         */
+        void tableCopy(const openHashTable& other);
+
+        /**
+         * @brief Takes over the contents of another table
+         * @param other Table to move from, left empty
+         * @note Allocators are moved if propagate_on_container_move_assignment is true
+         */
+        void tableMove(openHashTable&& other) noexcept;
+
+        /**
+         * @brief Exchanges contents with another table
+         * @param other Table to swap with
+         * @note Allocators are swapped if propagate_on_container_swap is true
+         */
+        void tableSwap(openHashTable& other) noexcept;
+
+        /**
+         * @brief Finds node for given key
+         * @param key Key to search for
+         * @return Pointer to node if found, nullptr otherwise
+         */
+        hashNode* find(const K_TYPE& key) const;
+
+        /**
+         * @brief Modifies value for existing key
+         * @param key Key to modify
+         * @param value New value
+         * @return true if key existed and was modified
+         */
+        bool modify(const K_TYPE& key, const V_TYPE& value);
+
+        /**
+         * @brief Inserts new key-value pair
+         * @param key Key to insert
+         * @param value Value to associate
+         * @return true if inserted, false if key already existed
+         * @note Grows the table when the load factor would exceed LOAD_FACTOR_MAX
+         */
+        bool insert(const K_TYPE& key, const V_TYPE& value);
+
+        /**
+         * @brief Removes key-value pair
+         * @param key Key to remove
+         * @return true if key existed and was removed
+         * @note Shrinks the table when the load factor drops below LOAD_FACTOR_MIN
+         */
+        bool erase(const K_TYPE& key);
+
+        /**
+         * @brief Destroys openHashTable
+         * @details Destroys all elements and releases the slot arrays
+         */
+        ~openHashTable();
+    };
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::hashNode(const K_TYPE& key, const V_TYPE& value)
+    : data_(key, value) {}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::hashNode(hashNode&& other)
+    : data_(std::move(const_cast<K_TYPE&>(other.data_.first())), std::move(other.data_.second())) {}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::couple<const K_TYPE, V_TYPE>&
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getVal() {
+    return this->data_;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+const original::couple<const K_TYPE, V_TYPE>&
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getVal() const {
+    return this->data_;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+const K_TYPE& original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getKey() const {
+    return this->data_.first();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+const V_TYPE& original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getValue() const {
+    return this->data_.second();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+V_TYPE& original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::getValue() {
+    return this->data_.second();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+void original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode::setValue(const V_TYPE& value) {
+    this->data_.template set<1>(value);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+typename original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode*
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::slot::node() noexcept {
+    return std::launder(reinterpret_cast<hashNode*>(this->storage));
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::Iterator(openHashTable* table, const u_integer index)
+    : p_table(table), cur_slot(index) {}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::Iterator(const Iterator& other)
+    : p_table(other.p_table), cur_slot(other.cur_slot) {}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+typename original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator&
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::operator=(const Iterator& other) {
+    if (this == &other)
+        return *this;
+
+    this->p_table = other.p_table;
+    this->cur_slot = other.cur_slot;
+    return *this;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+bool original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::equalTo(const Iterator& other) const {
+    return this->p_table == other.p_table && this->cur_slot == other.cur_slot;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+bool original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::hasNext() const {
+    if (!this->p_table || this->cur_slot >= this->p_table->capacity_)
+        return false;
+    return this->p_table->nextOccupied(this->cur_slot + 1) != this->p_table->capacity_;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+void original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::next() const {
+    if (!this->isValid()) {
+        throw outOfBoundError();
+    }
+
+    this->cur_slot = this->p_table->nextOccupied(this->cur_slot + 1);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+void original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::operator+=(const integer steps) const {
+    if (steps < 0) {
+        throw unSupportedMethodError();
+    }
+
+    for (integer i = 0; i < steps; ++i) {
+        this->next();
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::couple<const K_TYPE, V_TYPE>&
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::get() {
+    if (!this->isValid()) {
+        throw outOfBoundError();
+    }
+
+    return this->p_table->slots_[this->cur_slot].node()->getVal();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::couple<const K_TYPE, V_TYPE>
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::get() const {
+    if (!this->isValid()) {
+        throw outOfBoundError();
+    }
+
+    return this->p_table->slots_[this->cur_slot].node()->getVal();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+bool original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator::isValid() const {
+    return this->p_table && this->cur_slot < this->p_table->capacity_ &&
+           this->p_table->slots_[this->cur_slot].distance != 0;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::u_integer
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::nextOccupied(u_integer index) const {
+    while (index < this->capacity_ && this->slots_[index].distance == 0) {
+        index += 1;
+    }
+    return index;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::u_integer
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::homeOf(const K_TYPE& key) const {
+    const auto code = static_cast<std::uint64_t>(this->hash_(key));
+    return static_cast<u_integer>(code * 0x9E3779B97F4A7C15ULL >> this->shift_);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+bool original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::locate(const K_TYPE& key,
+                                                                 u_integer& index, u_integer& distance) const {
+    const u_integer mask = this->capacity_ - 1;
+    index = this->homeOf(key);
+    distance = 1;
+    // A slot closer to its home than the current probe ends the run of candidates
+    while (this->slots_[index].distance >= distance) {
+        if (this->slots_[index].distance == distance && this->slots_[index].node()->getKey() == key)
+            return true;
+        index = (index + 1) & mask;
+        distance += 1;
+    }
+    return false;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+void original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::relocate(hashNode* dst, hashNode* src) noexcept {
+    ::new (static_cast<void*>(dst)) hashNode(std::move(*src));
+    src->~hashNode();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+void original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::place(u_integer index, u_integer distance,
+                                                                 hashNode& node) noexcept {
+    const u_integer mask = this->capacity_ - 1;
+    u_integer empty = index;
+    while (this->slots_[empty].distance != 0) {
+        empty = (empty + 1) & mask;
+    }
+    while (empty != index) {
+        const u_integer prev = (empty - 1) & mask;
+        relocate(this->slots_[empty].node(), this->slots_[prev].node());
+        this->slots_[empty].distance = this->slots_[prev].distance + 1;
+        empty = prev;
+    }
+    ::new (static_cast<void*>(this->slots_[index].node())) hashNode(std::move(node));
+    this->slots_[index].distance = distance;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+void original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::rehash(const u_integer new_capacity) {
+    slot* new_slots = this->rebind_alloc.allocate(new_capacity);
+    for (u_integer i = 0; i < new_capacity; ++i) {
+        new_slots[i].distance = 0;
+    }
+
+    slot* old_slots = this->slots_;
+    const u_integer old_capacity = this->capacity_;
+
+    this->slots_ = new_slots;
+    this->capacity_ = new_capacity;
+    this->shift_ = 64;
+    for (u_integer c = new_capacity; c > 1; c >>= 1) {
+        this->shift_ -= 1;
+    }
+
+    for (u_integer i = 0; i < old_capacity; ++i) {
+        if (old_slots[i].distance == 0)
+            continue;
+        u_integer index, distance;
+        this->locate(old_slots[i].node()->getKey(), index, distance);
+        this->place(index, distance, *old_slots[i].node());
+        old_slots[i].node()->~hashNode();
+    }
+
+    if (old_capacity != 0) {
+        this->rebind_alloc.deallocate(old_slots, old_capacity);
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+void original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::release() noexcept {
+    if (this->capacity_ == 0)
+        return;
+
+    for (u_integer i = 0; i < this->capacity_; ++i) {
+        if (this->slots_[i].distance != 0)
+            this->slots_[i].node()->~hashNode();
+    }
+    this->rebind_alloc.deallocate(this->slots_, this->capacity_);
+    this->slots_ = nullptr;
+    this->size_ = 0;
+    this->capacity_ = 0;
+    this->shift_ = 64;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::openHashTable(HASH hash)
+    : size_(0), capacity_(0), shift_(64), slots_(nullptr), hash_(std::move(hash)) {}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+typename original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::firstIterator() const {
+    return Iterator(const_cast<openHashTable*>(this), this->nextOccupied(0));
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+typename original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::Iterator
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::lastIterator() const {
+    for (u_integer i = this->capacity_; i > 0; --i) {
+        if (this->slots_[i - 1].distance != 0)
+            return Iterator(const_cast<openHashTable*>(this), i - 1);
+    }
+    return Iterator(const_cast<openHashTable*>(this), this->capacity_);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+void original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::tableCopy(const openHashTable& other) {
+    if (this == &other)
+        return;
+
+    this->release();
+    if constexpr (ALLOC::propagate_on_container_copy_assignment::value) {
+        this->rebind_alloc = other.rebind_alloc;
+    }
+    this->hash_ = other.hash_;
+    if (other.size_ == 0)
+        return;
+
+    // Same capacity and same hash function keep every probe distance valid, so slots copy one to one
+    this->rehash(other.capacity_);
+    for (u_integer i = 0; i < other.capacity_; ++i) {
+        if (other.slots_[i].distance == 0)
+            continue;
+        const hashNode* node = other.slots_[i].node();
+        ::new (static_cast<void*>(this->slots_[i].node())) hashNode(node->getKey(), node->getValue());
+        this->slots_[i].distance = other.slots_[i].distance;
+        this->size_ += 1;
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+void original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::tableMove(openHashTable&& other) noexcept {
+    if (this == &other)
+        return;
+
+    this->release();
+    if constexpr (ALLOC::propagate_on_container_move_assignment::value) {
+        this->rebind_alloc = std::move(other.rebind_alloc);
+    }
+    this->size_ = other.size_;
+    this->capacity_ = other.capacity_;
+    this->shift_ = other.shift_;
+    this->slots_ = other.slots_;
+    this->hash_ = std::move(other.hash_);
+
+    other.size_ = 0;
+    other.capacity_ = 0;
+    other.shift_ = 64;
+    other.slots_ = nullptr;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+void original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::tableSwap(openHashTable& other) noexcept {
+    if (this == &other)
+        return;
+
+    std::swap(this->size_, other.size_);
+    std::swap(this->capacity_, other.capacity_);
+    std::swap(this->shift_, other.shift_);
+    std::swap(this->slots_, other.slots_);
+    std::swap(this->hash_, other.hash_);
+    if constexpr (ALLOC::propagate_on_container_swap::value) {
+        std::swap(this->rebind_alloc, other.rebind_alloc);
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+typename original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::hashNode*
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::find(const K_TYPE& key) const {
+    if (this->size_ == 0)
+        return nullptr;
+
+    u_integer index, distance;
+    if (this->locate(key, index, distance))
+        return this->slots_[index].node();
+    return nullptr;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+bool original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::modify(const K_TYPE& key, const V_TYPE& value) {
+    if (auto cur = this->find(key)) {
+        cur->setValue(value);
+        return true;
+    }
+    return false;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+bool original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::insert(const K_TYPE& key, const V_TYPE& value) {
+    u_integer index, distance;
+    if (this->capacity_ != 0 && this->locate(key, index, distance))
+        return false;
+
+    if (static_cast<floating>(this->size_ + 1) > LOAD_FACTOR_MAX * this->capacity_) {
+        this->rehash(this->capacity_ == 0 ? MIN_CAPACITY : this->capacity_ * 2);
+        this->locate(key, index, distance);
+    }
+
+    // Built before any slot is touched, so a throwing copy leaves the table unchanged
+    hashNode node(key, value);
+    this->place(index, distance, node);
+    this->size_ += 1;
+    return true;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+bool original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::erase(const K_TYPE& key) {
+    if (this->size_ == 0)
+        return false;
+
+    u_integer index, distance;
+    if (!this->locate(key, index, distance))
+        return false;
+
+    const u_integer mask = this->capacity_ - 1;
+    this->slots_[index].node()->~hashNode();
+    // Backward shift: pull the rest of the run one slot closer to home
+    for (u_integer next = (index + 1) & mask; this->slots_[next].distance > 1; next = (next + 1) & mask) {
+        relocate(this->slots_[index].node(), this->slots_[next].node());
+        this->slots_[index].distance = this->slots_[next].distance - 1;
+        index = next;
+    }
+    this->slots_[index].distance = 0;
+    this->size_ -= 1;
+
+    if (this->capacity_ > MIN_CAPACITY &&
+        static_cast<floating>(this->size_) < LOAD_FACTOR_MIN * this->capacity_) {
+        this->rehash(this->capacity_ / 2);
+    }
+    return true;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+original::openHashTable<K_TYPE, V_TYPE, ALLOC, HASH>::~openHashTable() {
+    this->release();
+}
+
+#endif //OPENHASHTABLE_H
@@ -169,6 +169,12 @@ namespace original {
          */
         [[nodiscard]] bool isValid() const override;
 
+        /**
+         * @brief Gets the raw pointer to the current element
+         * @return Pointer to the current element, or nullptr if the iterator is invalid
+         */
+        TYPE* contiguousPtr() const override;
+
         /**
          * @brief Gets the class name of the iterator
          * @return The class name as a string
@@ -212,7 +218,7 @@ namespace original {
 
     template<typename TYPE, typename ALLOC>
     auto original::randomAccessIterator<TYPE, ALLOC>::hasNext() const -> bool {
-        return this->isValid() && this->_pos <= this->_container->size() - 1;
+        return this->isValid() && this->_pos <= static_cast<integer>(this->_container->size()) - 1;
     }
 
     template<typename TYPE, typename ALLOC>
@@ -319,7 +325,12 @@ namespace original {
 
     template<typename TYPE, typename ALLOC>
     auto original::randomAccessIterator<TYPE, ALLOC>::isValid() const -> bool {
-        return this->_pos >= 0 && this->_pos < this->_container->size();
+        return this->_pos >= 0 && this->_pos < static_cast<integer>(this->_container->size());
+    }
+
+    template<typename TYPE, typename ALLOC>
+    auto original::randomAccessIterator<TYPE, ALLOC>::contiguousPtr() const -> TYPE* {
+        return this->isValid() ? this->_ptr : nullptr;
     }
 
     template<typename TYPE, typename ALLOC>
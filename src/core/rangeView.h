@@ -0,0 +1,489 @@
+#ifndef RANGEVIEW_H
+#define RANGEVIEW_H
+
+#include <type_traits>
+#include "error.h"
+#include "iterable.h"
+#include "ownerPtr.h"
+#include "printable.h"
+
+/**
+ * @file rangeView.h
+ * @brief Lazy view over a key range of an ordered container
+ * @details Provides rangeView, the result of range(low, high) on the ordered maps
+ * and sets. The view stores two container iterators and the bounds, so creating
+ * it costs two O(log n) searches and iterating it visits only the elements in range.
+ */
+
+
+namespace original {
+
+    /**
+     * @class rangeView
+     * @tparam TYPE Element type of the container
+     * @tparam K_TYPE Key type of the container
+     * @tparam ITER Iterator type of the container
+     * @tparam Compare Comparison function type of the container
+     * @brief Iterable view of the elements with keys in [low, high)
+     * @details The view does not copy elements. Its iterators wrap container
+     * iterators and become invalid once they leave the range, so the usual
+     * begin()/end() loop stops at the upper bound. Iterators of the view are
+     * invalidated by the same modifications that invalidate container iterators,
+     * and must not outlive the view or the container.
+     *
+     * Bidirectional traversal is available when the container iterator supports it.
+     */
+    template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+    class rangeView final : public iterable<TYPE>, public printable {
+        ITER first_;        ///< First element not less than low
+        ITER last_;         ///< Last element less than high
+        K_TYPE low_;        ///< Inclusive lower bound
+        K_TYPE high_;       ///< Exclusive upper bound
+        Compare compare_;   ///< Comparison function
+
+        /**
+         * @brief Extracts the key of an element
+         * @param elem Element of the container
+         * @return The element itself for sets, its first component for maps
+         */
+        static const K_TYPE& keyOf(const std::remove_const_t<TYPE>& elem);
+
+        /**
+         * @brief Checks whether a key lies in [low, high)
+         * @param key Key to check
+         * @return true if the key is in range
+         */
+        bool inRange(const K_TYPE& key) const;
+
+    public:
+        /**
+         * @class Iterator
+         * @brief Iterator over the elements of a rangeView
+         * @details Wraps a container iterator and reports itself invalid once the
+         * wrapped iterator leaves the range or the container.
+         */
+        class Iterator final : public baseIterator<TYPE> {
+            mutable ITER it_;           ///< Wrapped container iterator
+            const rangeView* view_;     ///< Owning view
+
+            /**
+             * @brief Constructs an iterator wrapping a container iterator
+             * @param it Container iterator
+             * @param view Owning view
+             */
+            Iterator(const ITER& it, const rangeView* view);
+
+            /**
+             * @brief Compares iterator positions
+             * @param other Iterator to compare with
+             * @return true if both point to the same element or both are out of range
+             */
+            bool equalPtr(const iterator<TYPE>* other) const override;
+
+        public:
+            friend class rangeView;
+
+            /**
+             * @brief Copy constructor
+             * @param other Iterator to copy
+             */
+            Iterator(const Iterator& other);
+
+            /**
+             * @brief Copy assignment operator
+             * @param other Iterator to copy
+             * @return Reference to this iterator
+             */
+            Iterator& operator=(const Iterator& other);
+
+            /**
+             * @brief Creates a copy of this iterator
+             * @return New iterator instance
+             */
+            Iterator* clone() const override;
+
+            /**
+             * @brief Gets iterator class name
+             * @return "rangeView::Iterator"
+             */
+            [[nodiscard]] std::string className() const override;
+
+            /**
+             * @brief Advances iterator by steps
+             * @param steps Number of positions to advance
+             */
+            void operator+=(integer steps) const override;
+
+            /**
+             * @brief Rewinds iterator by steps
+             * @param steps Number of positions to rewind
+             */
+            void operator-=(integer steps) const override;
+
+            /**
+             * @brief Distance between iterators, if the container iterator supports it
+             * @param other Iterator to compare with
+             * @return Distance between iterators
+             * @throw unSupportedMethodError if other is not a rangeView iterator
+             */
+            integer operator-(const iterator<TYPE>& other) const override;
+
+            /**
+             * @brief Checks if more elements in range exist forward
+             * @return true if more elements available
+             */
+            [[nodiscard]] bool hasNext() const override;
+
+            /**
+             * @brief Checks if more elements in range exist backward
+             * @return true if more elements available
+             */
+            [[nodiscard]] bool hasPrev() const override;
+
+            /**
+             * @brief Checks if other is previous to this
+             * @param other Iterator to check
+             * @return true if other is previous
+             */
+            bool atPrev(const iterator<TYPE>* other) const override;
+
+            /**
+             * @brief Checks if other is next to this
+             * @param other Iterator to check
+             * @return true if other is next
+             */
+            bool atNext(const iterator<TYPE>* other) const override;
+
+            /**
+             * @brief Moves to next element
+             */
+            void next() const override;
+
+            /**
+             * @brief Moves to previous element
+             */
+            void prev() const override;
+
+            /**
+             * @brief Gets previous iterator
+             * @return New iterator at previous position
+             */
+            Iterator* getPrev() const override;
+
+            /**
+             * @brief Gets current element (non-const)
+             * @return Reference to current element
+             * @throw outOfBoundError if the iterator is out of range
+             */
+            TYPE& get() override;
+
+            /**
+             * @brief Gets current element (const)
+             * @return Copy of current element
+             * @throw outOfBoundError if the iterator is out of range
+             */
+            TYPE get() const override;
+
+            /**
+             * @brief Sets current element through the container iterator
+             * @param data New element
+             */
+            void set(const TYPE& data) override;
+
+            /**
+             * @brief Checks if iterator points to an element in range
+             * @return true if valid
+             */
+            [[nodiscard]] bool isValid() const override;
+
+            ~Iterator() override = default;
+        };
+
+        friend class Iterator;
+
+        /**
+         * @brief Constructs a view, normally called by the container's range()
+         * @param first Container iterator at the first element not less than low
+         * @param last Container iterator at the last element less than high
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound, clamped to low if less than it
+         * @param compare Comparison function of the container
+         */
+        rangeView(const ITER& first, const ITER& last,
+                  const K_TYPE& low, const K_TYPE& high, Compare compare);
+
+        /**
+         * @brief Checks whether the range holds no element
+         * @return true if empty
+         */
+        [[nodiscard]] bool empty() const;
+
+        /**
+         * @brief Gets begin iterator
+         * @return New iterator at the first element in range
+         */
+        Iterator* begins() const override;
+
+        /**
+         * @brief Gets end iterator
+         * @return New iterator at the last element in range
+         */
+        Iterator* ends() const override;
+
+        /**
+         * @brief Gets class name
+         * @return "rangeView"
+         */
+        [[nodiscard]] std::string className() const override;
+
+        /**
+         * @brief Converts to string representation
+         * @param enter Add newline if true
+         * @return String representation of the elements in range
+         */
+        [[nodiscard]] std::string toString(bool enter) const override;
+
+        ~rangeView() override = default;
+    };
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+const K_TYPE& original::rangeView<TYPE, K_TYPE, ITER, Compare>::keyOf(const std::remove_const_t<TYPE>& elem)
+{
+    if constexpr (std::is_same_v<std::remove_const_t<TYPE>, std::remove_const_t<K_TYPE>>) {
+        return elem;
+    } else {
+        return elem.template get<0>();
+    }
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+bool original::rangeView<TYPE, K_TYPE, ITER, Compare>::inRange(const K_TYPE& key) const
+{
+    return !this->compare_(key, this->low_) && this->compare_(key, this->high_);
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::Iterator(const ITER& it, const rangeView* view)
+    : it_(it), view_(view) {}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+bool original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::equalPtr(const iterator<TYPE>* other) const
+{
+    auto other_it = dynamic_cast<const Iterator*>(other);
+    if (!other_it) {
+        return false;
+    }
+
+    const bool valid = this->isValid();
+    if (!valid || !other_it->isValid()) {
+        return valid == other_it->isValid();
+    }
+    return this->it_.equal(other_it->it_);
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::Iterator(const Iterator& other)
+    : it_(other.it_), view_(other.view_) {}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+typename original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator&
+original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::operator=(const Iterator& other)
+{
+    if (this == &other) {
+        return *this;
+    }
+
+    this->it_ = other.it_;
+    this->view_ = other.view_;
+    return *this;
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+typename original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator*
+original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::clone() const
+{
+    return new Iterator(*this);
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+std::string original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::className() const
+{
+    return "rangeView::Iterator";
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+void original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::operator+=(const integer steps) const
+{
+    this->it_ += steps;
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+void original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::operator-=(const integer steps) const
+{
+    this->it_ -= steps;
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+original::integer
+original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::operator-(const iterator<TYPE>& other) const
+{
+    auto other_it = dynamic_cast<const Iterator*>(&other);
+    if (!other_it) {
+        throw unSupportedMethodError();
+    }
+    return this->it_ - other_it->it_;
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+bool original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::hasNext() const
+{
+    if (!this->isValid()) {
+        return false;
+    }
+
+    auto next = ownerPtr(this->clone());
+    next->next();
+    return next->isValid();
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+bool original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::hasPrev() const
+{
+    if (!this->isValid()) {
+        return false;
+    }
+
+    auto prev = ownerPtr(this->clone());
+    prev->prev();
+    return prev->isValid();
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+bool original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::atPrev(const iterator<TYPE>* other) const
+{
+    auto other_it = dynamic_cast<const Iterator*>(other);
+    if (!other_it || !this->isValid()) {
+        return false;
+    }
+
+    auto next = ownerPtr(this->clone());
+    next->next();
+    return next->equalPtr(other_it);
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+bool original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::atNext(const iterator<TYPE>* other) const
+{
+    return other->atPrev(*this);
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+void original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::next() const
+{
+    if (this->it_.isValid()) {
+        this->it_.next();
+    }
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+void original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::prev() const
+{
+    if (this->it_.isValid()) {
+        this->it_.prev();
+    }
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+typename original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator*
+original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::getPrev() const
+{
+    auto it = this->clone();
+    it->prev();
+    return it;
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+TYPE& original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::get()
+{
+    if (!this->isValid()) {
+        throw outOfBoundError();
+    }
+    return this->it_.get();
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+TYPE original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::get() const
+{
+    if (!this->isValid()) {
+        throw outOfBoundError();
+    }
+    return this->it_.get();
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+void original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::set(const TYPE& data)
+{
+    this->it_.set(data);
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+bool original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator::isValid() const
+{
+    return this->it_.isValid() && this->view_->inRange(keyOf(this->it_.get()));
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+original::rangeView<TYPE, K_TYPE, ITER, Compare>::rangeView(const ITER& first, const ITER& last,
+                                                            const K_TYPE& low, const K_TYPE& high,
+                                                            Compare compare)
+    : first_(first), last_(last), low_(low),
+      high_(compare(high, low) ? low : high), compare_(std::move(compare)) {}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+bool original::rangeView<TYPE, K_TYPE, ITER, Compare>::empty() const
+{
+    return !Iterator(this->first_, this).isValid();
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+typename original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator*
+original::rangeView<TYPE, K_TYPE, ITER, Compare>::begins() const
+{
+    return new Iterator(this->first_, this);
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+typename original::rangeView<TYPE, K_TYPE, ITER, Compare>::Iterator*
+original::rangeView<TYPE, K_TYPE, ITER, Compare>::ends() const
+{
+    return new Iterator(this->last_, this);
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+std::string original::rangeView<TYPE, K_TYPE, ITER, Compare>::className() const
+{
+    return "rangeView";
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+std::string original::rangeView<TYPE, K_TYPE, ITER, Compare>::toString(const bool enter) const
+{
+    std::stringstream ss;
+    ss << this->className();
+    ss << "(";
+    bool first = true;
+    for (auto it = this->begin(); it != this->end(); it.next()){
+        if (!first){
+            ss << ", ";
+        }
+        ss << printable::formatString(it.get());
+        first = false;
+    }
+    ss << ")";
+    if (enter)
+        ss << "\n";
+    return ss.str();
+}
+
+#endif //RANGEVIEW_H
@@ -0,0 +1,924 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <limits>
+#include "baseList.h"
+#include "iterationStream.h"
+#include "array.h"
+
+/**
+ * @file ringBuffer.h
+ * @brief Growable circular buffer list.
+ * @details This file provides the definition of the ringBuffer class, a contiguous list whose
+ *          elements wrap around a power-of-two buffer. Both ends grow and shrink in constant time
+ *          without moving other elements, which makes it a compact SERIAL backend for queue,
+ *          deque and stack.
+ */
+
+namespace original {
+    /**
+     * @class ringBuffer
+     * @tparam TYPE Type of elements stored in the ringBuffer
+     * @tparam ALLOC Allocator type to use for memory management (default: allocator<TYPE>)
+     * @brief Contiguous circular buffer with constant time operations at both ends.
+     * @extends baseList
+     * @extends iterationStream
+     * @details Elements live in one buffer whose capacity is always a power of two, so a
+     *          logical index maps to a slot with a single mask: `(head + index) & (capacity - 1)`.
+     *          Features:
+     *          - O(1) pushBegin/pushEnd/popBegin/popEnd, amortized over doubling growth
+     *          - O(1) random access through get, set and operator[]
+     *          - Insertion and removal in the middle shift the shorter side
+     *          - No per-element allocation, slots are reused as the buffer wraps
+     *
+     *          Like vector, every slot of the buffer is default-constructed on allocation, and
+     *          popped elements are moved out of their slots.
+     */
+    template <typename TYPE, typename ALLOC = allocator<TYPE>>
+    class ringBuffer final : public baseList<TYPE, ALLOC>, public iterationStream<TYPE, ringBuffer<TYPE, ALLOC>> {
+        static constexpr u_integer INNER_SIZE_INIT = 16; ///< Initial buffer capacity, a power of two
+
+        TYPE* body;           ///< Internal storage buffer
+        u_integer capacity_;  ///< Number of slots in the buffer, always a power of two
+        u_integer head_;      ///< Slot of the first element
+        u_integer size_;      ///< Current number of elements
+
+        /**
+         * @brief Initializes an empty ringBuffer with the initial capacity.
+         */
+        void ringInit();
+
+        /**
+         * @brief Allocates a buffer and default-constructs every slot.
+         * @param capacity Number of slots to allocate
+         * @return Pointer to the new buffer
+         */
+        TYPE* ringArrayInit(u_integer capacity);
+
+        /**
+         * @brief Destroys every slot and deallocates the buffer.
+         * @details Safe to call on a moved-from ringBuffer whose body is nullptr.
+         */
+        void ringArrayDestroy() noexcept;
+
+        /**
+         * @brief Converts a logical index to a slot of the buffer.
+         * @param index Logical index, may equal size() or wrap past the buffer end
+         * @return The slot holding the element
+         */
+        [[nodiscard]] u_integer toInnerIdx(u_integer index) const;
+
+        /**
+         * @brief Grows the buffer so it holds at least the given number of elements.
+         * @param min_capacity Required number of slots
+         * @throw allocateError If the capacity cannot be doubled any further
+         * @details Doubles the capacity until it is large enough and unwraps the elements
+         *          to the start of the new buffer.
+         */
+        void grow(u_integer min_capacity);
+
+        /**
+         * @brief Ensures there is room for the given number of new elements.
+         * @param increment Number of elements to accommodate
+         */
+        void adjust(u_integer increment);
+
+    public:
+        /**
+         * @class Iterator
+         * @brief Random access iterator for ringBuffer.
+         * @extends baseIterator
+         * @details Tracks a logical index, so it stays correct when the elements wrap around
+         *          the end of the buffer.
+         */
+        class Iterator final : public baseIterator<TYPE> {
+            mutable integer pos_; ///< Logical index of the current element
+            const ringBuffer* container_; ///< Pointer to the containing ringBuffer
+
+            /**
+             * @brief Constructs an iterator at a logical index.
+             * @param pos The logical index of the element.
+             * @param container The ringBuffer container.
+             */
+            explicit Iterator(integer pos, const ringBuffer* container);
+
+            /**
+             * @brief Checks if two iterators point to the same element.
+             * @param other The other iterator to compare.
+             * @return True if the iterators point to the same element, false otherwise.
+             */
+            bool equalPtr(const iterator<TYPE>* other) const override;
+
+        public:
+            friend ringBuffer;
+
+            /**
+             * @brief Copy constructor for the Iterator.
+             * @param other The iterator to copy.
+             */
+            Iterator(const Iterator& other);
+
+            /**
+             * @brief Assignment operator for the Iterator.
+             * @param other The iterator to assign.
+             * @return A reference to this iterator.
+             */
+            Iterator& operator=(const Iterator& other);
+
+            /**
+             * @brief Clones the iterator.
+             * @return A new iterator pointing to the same element.
+             */
+            Iterator* clone() const override;
+
+            /**
+             * @brief Checks if there is a next element.
+             * @return True if there is a next element, false otherwise.
+             */
+            [[nodiscard]] bool hasNext() const override;
+
+            /**
+             * @brief Checks if there is a previous element.
+             * @return True if there is a previous element, false otherwise.
+             */
+            [[nodiscard]] bool hasPrev() const override;
+
+            /**
+             * @brief Moves the iterator to the next element.
+             */
+            void next() const override;
+
+            /**
+             * @brief Moves the iterator to the previous element.
+             */
+            void prev() const override;
+
+            /**
+             * @brief Advances the iterator by the specified number of steps.
+             * @param steps The number of steps to advance.
+             */
+            void operator+=(integer steps) const override;
+
+            /**
+             * @brief Moves the iterator backward by the specified number of steps.
+             * @param steps The number of steps to move backward.
+             */
+            void operator-=(integer steps) const override;
+
+            /**
+             * @brief Computes the distance between two iterators.
+             * @param other The other iterator to compare.
+             * @return The distance between the two iterators.
+             */
+            integer operator-(const iterator<TYPE>& other) const override;
+
+            /**
+             * @brief Gets the previous iterator.
+             * @return A new iterator pointing to the previous element.
+             */
+            Iterator* getPrev() const override;
+
+            /**
+             * @brief Gets the next iterator.
+             * @return A new iterator pointing to the next element.
+             */
+            Iterator* getNext() const override;
+
+            /**
+             * @brief Gets the element pointed to by the iterator.
+             * @return A reference to the element.
+             */
+            TYPE& get() override;
+
+            /**
+             * @brief Gets the element pointed to by the iterator (const version).
+             * @return A copy of the element.
+             */
+            TYPE get() const override;
+
+            /**
+             * @brief Sets the value of the element pointed to by the iterator.
+             * @param data The value to set.
+             */
+            void set(const TYPE& data) override;
+
+            /**
+             * @brief Checks if the iterator is valid.
+             * @return True if the iterator is valid, false otherwise.
+             */
+            [[nodiscard]] bool isValid() const override;
+
+            /**
+             * @brief Checks if the iterator is at the previous element relative to another iterator.
+             * @param other The other iterator to compare.
+             * @return True if the iterator is at the previous element, false otherwise.
+             */
+            bool atPrev(const iterator<TYPE>* other) const override;
+
+            /**
+             * @brief Checks if the iterator is at the next element relative to another iterator.
+             * @param other The other iterator to compare.
+             * @return True if the iterator is at the next element, false otherwise.
+             */
+            bool atNext(const iterator<TYPE>* other) const override;
+
+            /**
+             * @brief Gets the class name of the iterator.
+             * @return The class name as a string.
+             */
+            [[nodiscard]] std::string className() const override;
+        };
+
+        friend Iterator;
+
+        /**
+         * @brief Constructs an empty ringBuffer.
+         * @param alloc Allocator instance to use for memory management
+         */
+        explicit ringBuffer(ALLOC alloc = ALLOC{});
+
+        /**
+         * @brief Constructs a ringBuffer from an initializer list.
+         * @param lst The initializer list to construct the ringBuffer from.
+         */
+        ringBuffer(const std::initializer_list<TYPE>& lst);
+
+        /**
+         * @brief Constructs a ringBuffer from an array.
+         * @param arr The array to construct the ringBuffer from.
+         */
+        explicit ringBuffer(const array<TYPE>& arr);
+
+        /**
+         * @brief Copy constructor.
+         * @param other The ringBuffer to copy from.
+         * @details If ALLOC::propagate_on_container_copy_assignment is true, the allocator is also copied.
+         */
+        ringBuffer(const ringBuffer& other);
+
+        /**
+         * @brief Copy assignment operator.
+         * @param other The ringBuffer to assign from.
+         * @return A reference to this ringBuffer.
+         * @details Copies the elements unwrapped into a buffer of the same capacity.
+         *          If ALLOC::propagate_on_container_copy_assignment is true, the allocator is also copied.
+         */
+        ringBuffer& operator=(const ringBuffer& other);
+
+        /**
+         * @brief Move constructor.
+         * @param other The ringBuffer to move from.
+         * @details If ALLOC::propagate_on_container_move_assignment is true, the allocator is also moved.
+         */
+        ringBuffer(ringBuffer&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator.
+         * @param other The ringBuffer to move from.
+         * @return A reference to this ringBuffer.
+         * @details Takes over the buffer of other, which is left empty.
+         *          If ALLOC::propagate_on_container_move_assignment is true, the allocator is also moved.
+         */
+        ringBuffer& operator=(ringBuffer&& other) noexcept;
+
+        /**
+         * @brief Swaps the contents of this ringBuffer with another.
+         * @param other The ringBuffer to swap with.
+         * @details Exchanges the contents and allocators (if propagate_on_container_swap is true)
+         *          of this ringBuffer with another.
+         */
+        void swap(ringBuffer& other) noexcept;
+
+        /**
+         * @brief Gets the size of the ringBuffer.
+         * @return The number of elements in the ringBuffer.
+         */
+        [[nodiscard]] u_integer size() const override;
+
+        /**
+         * @brief Gets the number of slots in the buffer.
+         * @return The current capacity, always a power of two.
+         */
+        [[nodiscard]] u_integer capacity() const noexcept;
+
+        /**
+         * @brief Grows the buffer to hold at least the given number of elements.
+         * @param capacity Number of elements to make room for
+         * @details Rounds up to the next power of two. Never shrinks the buffer.
+         */
+        void reserve(u_integer capacity);
+
+        /**
+         * @brief Gets the element at the specified index.
+         * @param index The index of the element to retrieve.
+         * @return The element at the specified index.
+         */
+        TYPE get(integer index) const override;
+
+        /**
+         * @brief Gets a reference to the element at the specified index.
+         * @param index The index of the element to retrieve.
+         * @return A reference to the element at the specified index.
+         */
+        TYPE& operator[](integer index) override;
+
+        /**
+         * @brief Sets the element at the specified index.
+         * @param index The index of the element to set.
+         * @param e The value to set the element to.
+         */
+        void set(integer index, const TYPE& e) override;
+
+        /**
+         * @brief Finds the index of the first occurrence of the specified element.
+         * @param e The element to search for.
+         * @return The index of the element, or the size of the ringBuffer if not found.
+         */
+        u_integer indexOf(const TYPE& e) const override;
+
+        /**
+         * @brief Pushes an element to the specified index in the ringBuffer.
+         * @param index The index at which to insert the element.
+         * @param e The element to insert.
+         * @details Shifts the elements on the shorter side of the index.
+         */
+        void push(integer index, const TYPE& e) override;
+
+        /**
+         * @brief Pops the element at the specified index in the ringBuffer.
+         * @param index The index of the element to pop.
+         * @return The element that was popped.
+         * @details Shifts the elements on the shorter side of the index.
+         */
+        TYPE pop(integer index) override;
+
+        /**
+         * @brief Pushes an element to the beginning of the ringBuffer.
+         * @param e The element to push.
+         */
+        void pushBegin(const TYPE& e) override;
+
+        /**
+         * @brief Pops the element from the beginning of the ringBuffer.
+         * @return The element that was popped.
+         */
+        TYPE popBegin() override;
+
+        /**
+         * @brief Pushes an element to the end of the ringBuffer.
+         * @param e The element to push.
+         */
+        void pushEnd(const TYPE& e) override;
+
+        /**
+         * @brief Pops the element from the end of the ringBuffer.
+         * @return The element that was popped.
+         */
+        TYPE popEnd() override;
+
+        /**
+         * @brief Gets an iterator to the beginning of the ringBuffer.
+         * @return An iterator to the beginning of the ringBuffer.
+         */
+        Iterator* begins() const override;
+
+        /**
+         * @brief Gets an iterator to the end of the ringBuffer.
+         * @return An iterator to the last element of the ringBuffer.
+         */
+        Iterator* ends() const override;
+
+        /**
+         * @brief Gets the class name of the ringBuffer.
+         * @return The class name as a string.
+         */
+        [[nodiscard]] std::string className() const override;
+
+        /**
+         * @brief Destructor for the ringBuffer.
+         */
+        ~ringBuffer() override;
+    };
+} // namespace original
+
+namespace std {
+    /**
+     * @brief Specialization of std::swap for original::ringBuffer
+     * @tparam TYPE Element type
+     * @tparam ALLOC Allocator type
+     * @param lhs Left ringBuffer
+     * @param rhs Right ringBuffer
+     */
+    template<typename TYPE, typename ALLOC>
+    void swap(original::ringBuffer<TYPE, ALLOC>& lhs, original::ringBuffer<TYPE, ALLOC>& rhs) noexcept; // NOLINT
+}
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::ringInit() -> void
+    {
+        this->capacity_ = INNER_SIZE_INIT;
+        this->head_ = 0;
+        this->size_ = 0;
+        this->body = this->ringArrayInit(INNER_SIZE_INIT);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::ringArrayInit(const u_integer capacity) -> TYPE*
+    {
+        auto arr = this->allocate(capacity);
+        for (u_integer i = 0; i < capacity; i++) {
+            this->construct(&arr[i]);
+        }
+        return arr;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::ringArrayDestroy() noexcept -> void
+    {
+        if (this->body) {
+            for (u_integer i = 0; i < this->capacity_; ++i) {
+                this->destroy(&this->body[i]);
+            }
+            this->deallocate(this->body, this->capacity_);
+            this->body = nullptr;
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::toInnerIdx(const u_integer index) const -> u_integer
+    {
+        return (this->head_ + index) & (this->capacity_ - 1);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::grow(const u_integer min_capacity) -> void
+    {
+        constexpr u_integer half_limit = std::numeric_limits<u_integer>::max() / 2 + 1;
+        u_integer new_capacity = this->capacity_;
+        while (new_capacity < min_capacity) {
+            if (new_capacity >= half_limit) {
+                throw allocateError();
+            }
+            new_capacity *= 2;
+        }
+        TYPE* new_body = this->ringArrayInit(new_capacity);
+        for (u_integer i = 0; i < this->size_; ++i) {
+            new_body[i] = std::move(this->body[this->toInnerIdx(i)]);
+        }
+        this->ringArrayDestroy();
+        this->body = new_body;
+        this->capacity_ = new_capacity;
+        this->head_ = 0;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::adjust(const u_integer increment) -> void
+    {
+        if (increment > this->capacity_ - this->size_) {
+            if (increment > std::numeric_limits<u_integer>::max() - this->size_) {
+                throw allocateError();
+            }
+            this->grow(this->size_ + increment);
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    original::ringBuffer<TYPE, ALLOC>::Iterator::Iterator(const integer pos, const ringBuffer* container)
+        : pos_(pos), container_(container) {}
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::equalPtr(const iterator<TYPE>* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        return other_it != nullptr
+               && this->pos_ == other_it->pos_
+               && this->container_ == other_it->container_;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    original::ringBuffer<TYPE, ALLOC>::Iterator::Iterator(const Iterator& other) : Iterator(0, nullptr)
+    {
+        this->operator=(other);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::operator=(const Iterator& other) -> Iterator&
+    {
+        if (this == &other)
+            return *this;
+
+        this->pos_ = other.pos_;
+        this->container_ = other.container_;
+        return *this;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::clone() const -> Iterator*
+    {
+        return new Iterator(*this);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::hasNext() const -> bool
+    {
+        return this->pos_ + 1 < static_cast<integer>(this->container_->size());
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::hasPrev() const -> bool
+    {
+        return this->pos_ > 0;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::next() const -> void
+    {
+        this->pos_ += 1;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::prev() const -> void
+    {
+        this->pos_ -= 1;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::operator+=(const integer steps) const -> void
+    {
+        this->pos_ += steps;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::operator-=(const integer steps) const -> void
+    {
+        this->pos_ -= steps;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::operator-(const iterator<TYPE>& other) const -> integer
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(&other);
+        if (other_it == nullptr)
+            return this > &other ?
+                std::numeric_limits<integer>::max() :
+                std::numeric_limits<integer>::min();
+        if (this->container_ != other_it->container_)
+            return this->container_ > other_it->container_ ?
+                std::numeric_limits<integer>::max() :
+                std::numeric_limits<integer>::min();
+
+        return this->pos_ - other_it->pos_;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::getPrev() const -> Iterator*
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        auto* it = this->clone();
+        it->prev();
+        return it;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::getNext() const -> Iterator*
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        auto* it = this->clone();
+        it->next();
+        return it;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::get() -> TYPE&
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        return this->container_->body[this->container_->toInnerIdx(this->pos_)];
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::get() const -> TYPE
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        return this->container_->body[this->container_->toInnerIdx(this->pos_)];
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::set(const TYPE& data) -> void
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        this->container_->body[this->container_->toInnerIdx(this->pos_)] = data;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::isValid() const -> bool
+    {
+        return this->container_ != nullptr && this->pos_ >= 0 &&
+               this->pos_ < static_cast<integer>(this->container_->size());
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::atPrev(const iterator<TYPE>* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        if (other_it == nullptr)
+            return false;
+        return this->operator-(*other_it) == -1;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::atNext(const iterator<TYPE>* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        if (other_it == nullptr)
+            return false;
+        return this->operator-(*other_it) == 1;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::Iterator::className() const -> std::string {
+        return "ringBuffer::Iterator";
+    }
+
+    template <typename TYPE, typename ALLOC>
+    original::ringBuffer<TYPE, ALLOC>::ringBuffer(ALLOC alloc)
+        : baseList<TYPE, ALLOC>(std::move(alloc)), body(nullptr), capacity_(), head_(), size_()
+    {
+        this->ringInit();
+    }
+
+    template <typename TYPE, typename ALLOC>
+    original::ringBuffer<TYPE, ALLOC>::ringBuffer(const std::initializer_list<TYPE>& lst) : ringBuffer()
+    {
+        this->adjust(lst.size());
+        for (const auto& e : lst) {
+            this->body[this->size_] = e;
+            this->size_ += 1;
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    original::ringBuffer<TYPE, ALLOC>::ringBuffer(const array<TYPE>& arr) : ringBuffer()
+    {
+        this->adjust(arr.size());
+        for (u_integer i = 0; i < arr.size(); ++i) {
+            this->body[this->size_] = arr.get(i);
+            this->size_ += 1;
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    original::ringBuffer<TYPE, ALLOC>::ringBuffer(const ringBuffer& other) : ringBuffer()
+    {
+        this->operator=(other);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::operator=(const ringBuffer& other) -> ringBuffer&
+    {
+        if (this == &other)
+            return *this;
+
+        this->ringArrayDestroy();
+        this->capacity_ = other.capacity_;
+        this->head_ = 0;
+        this->size_ = other.size_;
+        this->body = this->ringArrayInit(this->capacity_);
+        for (u_integer i = 0; i < this->size_; ++i) {
+            this->body[i] = other.body[other.toInnerIdx(i)];
+        }
+        if constexpr (ALLOC::propagate_on_container_copy_assignment::value){
+            this->allocator = other.allocator;
+        }
+        return *this;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    original::ringBuffer<TYPE, ALLOC>::ringBuffer(ringBuffer&& other) noexcept : ringBuffer()
+    {
+        this->operator=(std::move(other));
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::operator=(ringBuffer&& other) noexcept -> ringBuffer&
+    {
+        if (this == &other)
+            return *this;
+
+        this->ringArrayDestroy();
+        this->body = other.body;
+        other.body = nullptr;
+        this->capacity_ = other.capacity_;
+        this->head_ = other.head_;
+        this->size_ = other.size_;
+        if constexpr (ALLOC::propagate_on_container_move_assignment::value){
+            this->allocator = std::move(other.allocator);
+        }
+        other.ringInit();
+        return *this;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    void original::ringBuffer<TYPE, ALLOC>::swap(ringBuffer& other) noexcept
+    {
+        if (this == &other)
+            return;
+
+        std::swap(this->body, other.body);
+        std::swap(this->capacity_, other.capacity_);
+        std::swap(this->head_, other.head_);
+        std::swap(this->size_, other.size_);
+        if constexpr (ALLOC::propagate_on_container_swap::value) {
+            std::swap(this->allocator, other.allocator);
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::size() const -> u_integer
+    {
+        return this->size_;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::capacity() const noexcept -> u_integer
+    {
+        return this->capacity_;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::reserve(const u_integer capacity) -> void
+    {
+        if (capacity > this->capacity_) {
+            this->grow(capacity);
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::get(integer index) const -> TYPE
+    {
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError("ringBuffer::get: Index " + printable::formatString(index) +
+                                 " out of bounds for ringBuffer of size " + printable::formatString(this->size()));
+        }
+        return this->body[this->toInnerIdx(this->parseNegIndex(index))];
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::operator[](integer index) -> TYPE&
+    {
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError("ringBuffer::operator[]: Index " + printable::formatString(index) +
+                                 " out of bounds for ringBuffer of size " + printable::formatString(this->size()));
+        }
+        return this->body[this->toInnerIdx(this->parseNegIndex(index))];
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::set(integer index, const TYPE& e) -> void
+    {
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError("ringBuffer::set: Index " + printable::formatString(index) +
+                                 " out of bounds for ringBuffer of size " + printable::formatString(this->size()));
+        }
+        this->body[this->toInnerIdx(this->parseNegIndex(index))] = e;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::indexOf(const TYPE& e) const -> u_integer
+    {
+        for (u_integer i = 0; i < this->size_; ++i) {
+            if (this->body[this->toInnerIdx(i)] == e)
+                return i;
+        }
+        return this->size_;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::push(integer index, const TYPE& e) -> void
+    {
+        index = this->parseNegIndex(index);
+        if (index == 0){
+            this->pushBegin(e);
+        } else if (index == static_cast<integer>(this->size())){
+            this->pushEnd(e);
+        } else{
+            if (this->indexOutOfBound(index)){
+                throw outOfBoundError("ringBuffer::push: Index " + printable::formatString(index) +
+                                     " out of bounds for ringBuffer of size " + printable::formatString(this->size()));
+            }
+            this->adjust(1);
+            const auto pos = static_cast<u_integer>(index);
+            if (pos <= this->size_ / 2){
+                this->head_ = (this->head_ - 1) & (this->capacity_ - 1);
+                for (u_integer i = 0; i < pos; ++i) {
+                    this->body[this->toInnerIdx(i)] = std::move(this->body[this->toInnerIdx(i + 1)]);
+                }
+            } else{
+                for (u_integer i = this->size_; i > pos; --i) {
+                    this->body[this->toInnerIdx(i)] = std::move(this->body[this->toInnerIdx(i - 1)]);
+                }
+            }
+            this->body[this->toInnerIdx(pos)] = e;
+            this->size_ += 1;
+        }
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::pop(integer index) -> TYPE
+    {
+        index = this->parseNegIndex(index);
+        if (index == 0){
+            return this->popBegin();
+        }
+        if (index == static_cast<integer>(this->size()) - 1){
+            return this->popEnd();
+        }
+        if (this->indexOutOfBound(index)){
+            throw outOfBoundError("ringBuffer::pop: Index " + printable::formatString(index) +
+                                 " out of bounds for ringBuffer of size " + printable::formatString(this->size()));
+        }
+        const auto pos = static_cast<u_integer>(index);
+        TYPE res = std::move(this->body[this->toInnerIdx(pos)]);
+        if (pos < this->size_ / 2){
+            for (u_integer i = pos; i > 0; --i) {
+                this->body[this->toInnerIdx(i)] = std::move(this->body[this->toInnerIdx(i - 1)]);
+            }
+            this->head_ = this->toInnerIdx(1);
+        } else{
+            for (u_integer i = pos; i + 1 < this->size_; ++i) {
+                this->body[this->toInnerIdx(i)] = std::move(this->body[this->toInnerIdx(i + 1)]);
+            }
+        }
+        this->size_ -= 1;
+        return res;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::pushBegin(const TYPE& e) -> void
+    {
+        this->adjust(1);
+        this->head_ = (this->head_ - 1) & (this->capacity_ - 1);
+        this->body[this->head_] = e;
+        this->size_ += 1;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::popBegin() -> TYPE
+    {
+        if (this->size_ == 0){
+            throw noElementError("ringBuffer::popBegin: Cannot pop from empty ringBuffer");
+        }
+        TYPE res = std::move(this->body[this->head_]);
+        this->head_ = this->toInnerIdx(1);
+        this->size_ -= 1;
+        return res;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::pushEnd(const TYPE& e) -> void
+    {
+        this->adjust(1);
+        this->body[this->toInnerIdx(this->size_)] = e;
+        this->size_ += 1;
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::popEnd() -> TYPE
+    {
+        if (this->size_ == 0){
+            throw noElementError("ringBuffer::popEnd: Cannot pop from empty ringBuffer");
+        }
+        this->size_ -= 1;
+        return std::move(this->body[this->toInnerIdx(this->size_)]);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::begins() const -> Iterator*
+    {
+        return new Iterator(0, this);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::ends() const -> Iterator*
+    {
+        return new Iterator(static_cast<integer>(this->size_) - 1, this);
+    }
+
+    template <typename TYPE, typename ALLOC>
+    auto original::ringBuffer<TYPE, ALLOC>::className() const -> std::string
+    {
+        return "ringBuffer";
+    }
+
+    template <typename TYPE, typename ALLOC>
+    original::ringBuffer<TYPE, ALLOC>::~ringBuffer()
+    {
+        this->ringArrayDestroy();
+    }
+
+    template <typename TYPE, typename ALLOC>
+    void std::swap(original::ringBuffer<TYPE, ALLOC>& lhs, original::ringBuffer<TYPE, ALLOC>& rhs) noexcept // NOLINT
+    {
+        lhs.swap(rhs);
+    }
+
+#endif //RINGBUFFER_H
@@ -0,0 +1,1982 @@
+#ifndef ROARINGBITMAP_H
+#define ROARINGBITMAP_H
+
+#include <bit>
+#include <cstdint>
+#include "array.h"
+#include "bitSet.h"
+#include "iterationStream.h"
+#include "set.h"
+#include "vector.h"
+
+
+namespace original {
+    /**
+     * @file roaringBitmap.h
+     * @brief Compressed bitmap over u_integer values
+     * @details Declares roaringBitmap, a set of u_integer values stored the way Roaring bitmaps
+     *          store them: the value space is cut into chunks of 2^16 values sharing all but
+     *          their low 16 bits, and every non-empty chunk picks the cheapest of three layouts:
+     *          - array: sorted 16-bit values, used while the chunk holds at most 4096 values
+     *          - bitmap: 1024 64-bit words, used above 4096 values
+     *          - run: sorted (first, last) pairs, chosen by runOptimize() or addRange()
+     *            when it is smaller than the other two
+     *
+     *          Sparse data costs about 2 bytes per value, dense data at most 8KB per chunk, and
+     *          long runs 4 bytes per run, while bitSet always pays one bit per possible value.
+     */
+
+    /**
+     * @class roaringBitmap
+     * @tparam ALLOC Allocator type to use for memory management (default: allocator<u_integer>)
+     * @brief A compressed set of u_integer values
+     * @extends set
+     * @extends iterationStream
+     * @details Chunks are kept in a vector sorted by their high 16 bits, so lookups cost a binary
+     *          search over the chunks followed by a search inside one chunk. The boolean operators
+     *          walk both chunk lists in step and combine matching chunks by their layouts: two
+     *          arrays are merged, an array intersected with anything is filtered by lookups, and
+     *          everything else runs on whole 64-bit words before the result is repacked.
+     *
+     *          Iteration visits the values in increasing order. rank() and select() skip whole
+     *          chunks by their cardinality, so iterator arithmetic does not walk element by element.
+     *          With 32-bit sizes it holds at most 2^32 - 1 values, the largest count size() can report.
+     */
+    template<typename ALLOC = allocator<u_integer>>
+    class roaringBitmap final : public set<u_integer, ALLOC>,
+                                public iterationStream<u_integer, roaringBitmap<ALLOC>> {
+            using low_type = std::uint16_t;    ///< Low 16 bits of a value, stored by array and run chunks
+            using word_type = ul_integer;      ///< Word of a bitmap chunk
+            using rebind_alloc_low = typename ALLOC::template rebind_alloc<low_type>;   ///< Allocator of chunk values
+            using rebind_alloc_word = typename ALLOC::template rebind_alloc<word_type>; ///< Allocator of bitmap words
+
+            static constexpr u_integer CHUNK_BITS = 16;                     ///< Bits addressed inside a chunk
+            static constexpr u_integer LOW_MASK = (1u << CHUNK_BITS) - 1;   ///< Mask of the in-chunk bits
+            static constexpr u_integer ARRAY_MAX = 4096;                    ///< Largest array chunk
+            static constexpr u_integer WORD_BITS = sizeof(word_type) * 8;   ///< Bits in a bitmap word
+            static constexpr u_integer BITMAP_WORDS = (LOW_MASK + 1) / WORD_BITS; ///< Words in a bitmap chunk
+
+            /**
+             * @enum setOperation
+             * @brief Boolean operation combining two bitmaps
+             */
+            enum class setOperation {
+                AND,        ///< Values of both sides
+                OR,         ///< Values of either side
+                XOR,        ///< Values of exactly one side
+                AND_NOT,    ///< Values of the left side only
+            };
+
+            /**
+             * @class chunk
+             * @brief Values of the bitmap sharing the same high 16 bits
+             * @details Stores the low 16 bits of its values in one of three layouts. values_ holds
+             *          the sorted values of an array chunk or the (first, last) pairs of a run chunk,
+             *          words_ holds the bits of a bitmap chunk; the unused one stays empty.
+             */
+            class chunk {
+            public:
+                /**
+                 * @enum kind
+                 * @brief Layout of a chunk
+                 */
+                enum class kind {
+                    ARRAY,      ///< Sorted values
+                    BITMAP,     ///< One bit per possible value
+                    RUN,        ///< Sorted inclusive (first, last) pairs
+                };
+
+                u_integer key_;                                 ///< High 16 bits shared by the values
+                kind kind_;                                     ///< Current layout
+                u_integer cardinality_;                         ///< Number of values
+                vector<low_type, rebind_alloc_low> values_;     ///< Array values or run bounds
+                array<word_type, rebind_alloc_word> words_;     ///< Bitmap words
+
+                /**
+                 * @brief Constructs an empty array chunk
+                 * @param key High 16 bits of the values
+                 */
+                explicit chunk(u_integer key);
+
+                /**
+                 * @brief Checks whether a value is in the chunk
+                 * @param low Low 16 bits of the value
+                 * @return true if the value is present
+                 */
+                [[nodiscard]] bool contains(u_integer low) const;
+
+                /**
+                 * @brief Adds a value
+                 * @param low Low 16 bits of the value
+                 * @return true if the value was absent
+                 * @details Run chunks are unpacked first, full arrays become bitmaps.
+                 */
+                bool add(u_integer low);
+
+                /**
+                 * @brief Removes a value
+                 * @param low Low 16 bits of the value
+                 * @return true if the value was present
+                 * @details Run chunks are unpacked first, bitmaps shrinking to ARRAY_MAX values become arrays.
+                 */
+                bool remove(u_integer low);
+
+                /**
+                 * @brief Adds every value of the inclusive range [first, last]
+                 * @param first Low 16 bits of the first value
+                 * @param last Low 16 bits of the last value
+                 * @details Filling an empty chunk gives a single run, otherwise the range is set on
+                 *          bitmap words and the chunk repacked into its smallest layout.
+                 */
+                void addRange(u_integer first, u_integer last);
+
+                /**
+                 * @brief Counts the values below a bound
+                 * @param low Low 16 bits of the bound, LOW_MASK + 1 counting every value
+                 * @return Number of values smaller than low
+                 */
+                [[nodiscard]] u_integer rank(u_integer low) const;
+
+                /**
+                 * @brief Finds a value by position
+                 * @param index Position below cardinality_
+                 * @return Low 16 bits of the value at index in increasing order
+                 */
+                [[nodiscard]] u_integer select(u_integer index) const;
+
+                /**
+                 * @brief Finds the smallest value at or above a bound
+                 * @param low Low 16 bits of the bound, may exceed LOW_MASK
+                 * @return The value, or -1 if there is none
+                 */
+                [[nodiscard]] integer nextValue(integer low) const;
+
+                /**
+                 * @brief Finds the largest value at or below a bound
+                 * @param low Low 16 bits of the bound, may be negative
+                 * @return The value, or -1 if there is none
+                 */
+                [[nodiscard]] integer prevValue(integer low) const;
+
+                /**
+                 * @brief Combines another chunk with the same key into this one
+                 * @tparam OP Operation to apply
+                 * @param other Chunk to combine with, must not be this chunk
+                 */
+                template<setOperation OP>
+                void combine(const chunk& other);
+
+                /**
+                 * @brief Switches to the smallest of the three layouts
+                 * @return true if the chunk is now a run chunk
+                 */
+                bool optimize();
+
+                /**
+                 * @brief Gets the bytes used by the values
+                 * @return Payload size of the current layout
+                 */
+                [[nodiscard]] u_integer storageSize() const;
+
+            private:
+                /**
+                 * @brief Counts the maximal runs of consecutive values
+                 * @return Number of runs
+                 */
+                [[nodiscard]] u_integer countRuns() const;
+
+                /**
+                 * @brief Finds the run that may contain a value
+                 * @param low Low 16 bits of the value
+                 * @return Index of the last run starting at or before low, or -1
+                 */
+                [[nodiscard]] integer findRun(u_integer low) const;
+
+                /**
+                 * @brief Writes the values as bits
+                 * @param words BITMAP_WORDS words, overwritten
+                 */
+                void fillWords(word_type* words) const;
+
+                /**
+                 * @brief Switches to the bitmap layout
+                 */
+                void toBitmap();
+
+                /**
+                 * @brief Switches to the array layout
+                 * @details The chunk must hold at most ARRAY_MAX values.
+                 */
+                void toArray();
+
+                /**
+                 * @brief Switches to the run layout
+                 */
+                void toRun();
+
+                /**
+                 * @brief Switches a run chunk to the array or bitmap layout fitting its cardinality
+                 */
+                void unpack();
+
+                /**
+                 * @brief Moves between the array and bitmap layouts after the cardinality changed
+                 */
+                void normalize();
+
+                /**
+                 * @brief Merges two array chunks
+                 * @tparam OP Operation to apply
+                 * @param other Array chunk to merge with
+                 */
+                template<setOperation OP>
+                void mergeArrays(const chunk& other);
+
+                /**
+                 * @brief Keeps the array values whose presence in another chunk matches
+                 * @param other Chunk to look the values up in
+                 * @param present Whether kept values must be present in other
+                 * @param source Array chunk providing the values, this chunk or other
+                 */
+                void filterArray(const chunk& other, bool present, const chunk& source);
+
+                /**
+                 * @brief Replaces the values by a copy of a buffer
+                 * @param values Values to copy
+                 * @param n Number of values
+                 */
+                void assignValues(const low_type* values, u_integer n);
+
+                /**
+                 * @brief Finds the first position at or above a bound holding a set bit
+                 * @param words Bitmap words
+                 * @param from Starting position
+                 * @return The position, or -1 if there is none
+                 */
+                static integer nextSet(const word_type* words, u_integer from);
+
+                /**
+                 * @brief Finds the first position at or above a bound holding a clear bit
+                 * @param words Bitmap words
+                 * @param from Starting position
+                 * @return The position, or LOW_MASK + 1 if there is none
+                 */
+                static u_integer nextClear(const word_type* words, u_integer from);
+
+                /**
+                 * @brief Finds the first array value not below a bound
+                 * @param values Sorted values
+                 * @param n Number of values
+                 * @param low Bound
+                 * @return Index of the first value >= low, or n
+                 */
+                static u_integer lowerBound(const low_type* values, u_integer n, u_integer low);
+
+                /**
+                 * @brief Applies an operation to the bits of a mask
+                 * @tparam OP Operation to apply, AND is applied as keeping the mask
+                 * @param word Word to modify
+                 * @param mask Bits taking part
+                 */
+                template<setOperation OP>
+                static void applyMask(word_type& word, word_type mask);
+
+                /**
+                 * @brief Applies an operation to the inclusive bit range [first, last]
+                 * @tparam OP Operation to apply, one of OR, XOR and AND_NOT
+                 * @param words Bitmap words
+                 * @param first First bit
+                 * @param last Last bit
+                 */
+                template<setOperation OP>
+                static void applyRange(word_type* words, u_integer first, u_integer last);
+
+                /**
+                 * @brief Applies an operation word by word
+                 * @tparam OP Operation to apply
+                 * @param dst Words of the left side, receiving the result
+                 * @param src Words of the right side
+                 */
+                template<setOperation OP>
+                static void applyWords(word_type* dst, const word_type* src);
+
+                /**
+                 * @brief Counts the set bits of a bitmap
+                 * @param words Bitmap words
+                 * @return Number of set bits
+                 */
+                static u_integer countWords(const word_type* words);
+            };
+
+            using rebind_alloc_chunk = typename ALLOC::template rebind_alloc<chunk>;       ///< Allocator of chunks
+            using rebind_alloc_pointer = typename ALLOC::template rebind_alloc<chunk*>;    ///< Allocator of the chunk list
+            using chunks_type = vector<chunk*, rebind_alloc_pointer>;                     ///< Chunk list type
+
+            chunks_type chunks_;                        ///< Non-empty chunks sorted by key
+            u_integer size_;                            ///< Number of values
+            mutable rebind_alloc_chunk chunk_alloc{};   ///< Chunk allocator
+
+            /**
+             * @brief Allocates an empty chunk
+             * @param key High 16 bits of the chunk
+             * @return The new chunk
+             */
+            chunk* createChunk(u_integer key) const;
+
+            /**
+             * @brief Allocates a copy of a chunk
+             * @param other Chunk to copy
+             * @return The new chunk
+             */
+            chunk* copyChunk(const chunk& other) const;
+
+            /**
+             * @brief Releases a chunk
+             * @param c Chunk to release
+             */
+            void destroyChunk(chunk* c) const noexcept;
+
+            /**
+             * @brief Releases every chunk and empties the bitmap
+             */
+            void destroyChunks() noexcept;
+
+            /**
+             * @brief Finds the position of a chunk key
+             * @param key High 16 bits to look for
+             * @return Index of the first chunk with a key not below key
+             */
+            [[nodiscard]] u_integer chunkIndex(u_integer key) const;
+
+            /**
+             * @brief Finds the chunk holding a position
+             * @param index Position below size(), reduced to the position inside the chunk
+             * @return Index of the chunk
+             */
+            [[nodiscard]] u_integer selectChunk(u_integer& index) const;
+
+            /**
+             * @brief Combines another bitmap into this one
+             * @tparam OP Operation to apply
+             * @param other Bitmap to combine with
+             * @return Reference to this bitmap
+             */
+            template<setOperation OP>
+            roaringBitmap& combine(const roaringBitmap& other);
+
+        public:
+            /**
+             * @class Iterator
+             * @brief Iterator over the values of a roaringBitmap in increasing order
+             * @extends baseIterator
+             * @details Holds the current value, the index of its chunk and its index inside the chunk,
+             *          which lets array chunks step without searching. The values are computed, so get()
+             *          returns a reference to a copy inside the iterator and set() is not supported.
+             */
+            class Iterator final : public baseIterator<u_integer> {
+                    const roaringBitmap* container_;    ///< Iterated bitmap
+                    mutable integer chunk_;             ///< Index of the current chunk
+                    mutable u_integer slot_;            ///< Index of the current value inside its chunk
+                    mutable u_integer value_;           ///< Current value
+
+                    /**
+                     * @brief Constructs an iterator
+                     * @param container Iterated bitmap
+                     * @param chunk Index of the current chunk
+                     * @param slot Index of the current value inside its chunk
+                     * @param value Current value
+                     */
+                    explicit Iterator(const roaringBitmap* container, integer chunk, u_integer slot, u_integer value);
+
+                    /**
+                     * @brief Gets the position of the iterator
+                     * @return Index of the current value, -1 before the first value and size() after the last
+                     */
+                    [[nodiscard]] integer position() const;
+
+                    /**
+                     * @brief Checks if two iterators are equal
+                     * @param other The iterator to compare to
+                     * @return True if both point to the same value or both are invalid
+                     */
+                    bool equalPtr(const iterator* other) const override;
+
+                public:
+                    friend class roaringBitmap;
+
+                    /**
+                     * @brief Clones the iterator
+                     * @return A new iterator pointing to the same value
+                     */
+                    Iterator* clone() const override;
+
+                    /**
+                     * @brief Checks if there is a next value
+                     * @return True if a larger value exists
+                     */
+                    [[nodiscard]] bool hasNext() const override;
+
+                    /**
+                     * @brief Checks if there is a previous value
+                     * @return True if a smaller value exists
+                     */
+                    [[nodiscard]] bool hasPrev() const override;
+
+                    /**
+                     * @brief Checks if the iterator is just before another one
+                     * @param other The other iterator
+                     * @return True if other points to the next value
+                     */
+                    bool atPrev(const iterator* other) const override;
+
+                    /**
+                     * @brief Checks if the iterator is just after another one
+                     * @param other The other iterator
+                     * @return True if other points to the previous value
+                     */
+                    bool atNext(const iterator* other) const override;
+
+                    /**
+                     * @brief Moves to the next value
+                     */
+                    void next() const override;
+
+                    /**
+                     * @brief Moves to the previous value
+                     */
+                    void prev() const override;
+
+                    /**
+                     * @brief Gets an iterator at the previous value
+                     * @return A new iterator
+                     */
+                    Iterator* getPrev() const override;
+
+                    /**
+                     * @brief Gets an iterator at the next value
+                     * @return A new iterator
+                     */
+                    Iterator* getNext() const override;
+
+                    /**
+                     * @brief Moves forward by a number of values
+                     * @param steps Number of values to skip
+                     * @details Uses rank() and select(), so the cost depends on the number of chunks only.
+                     */
+                    void operator+=(integer steps) const override;
+
+                    /**
+                     * @brief Moves backward by a number of values
+                     * @param steps Number of values to skip
+                     */
+                    void operator-=(integer steps) const override;
+
+                    /**
+                     * @brief Computes the distance between two iterators
+                     * @param other The other iterator
+                     * @return Number of values between them
+                     */
+                    integer operator-(const iterator& other) const override;
+
+                    /**
+                     * @return Reference to the copy held by the iterator, writing to it does not change the bitmap
+                     * @return Reference to the copy held by the iterator
+                     */
+                    u_integer& get() override;
+
+                    /**
+                     * @brief Returns the class name of this iterator
+                     * @return "roaringBitmap::Iterator"
+                     */
+                    [[nodiscard]] std::string className() const override;
+
+                    /**
+                     * @brief Gets the current value (const version)
+                     * @return The current value
+                     */
+                    [[nodiscard]] u_integer get() const override;
+
+                    /**
+                     * @brief Not supported, values are changed through the bitmap
+                     * @throw original::unSupportedMethodError
+                     */
+                    void set(const u_integer& data) override;
+
+                    /**
+                     * @brief Checks if the iterator points to a value
+                     * @return True if the iterator is valid
+                     */
+                    [[nodiscard]] bool isValid() const override;
+            };
+
+            /**
+             * @brief Constructs an empty bitmap
+             * @param alloc Allocator instance to use for memory management
+             */
+            explicit roaringBitmap(ALLOC alloc = ALLOC{});
+
+            /**
+             * @brief Constructs a bitmap from a list of values
+             * @param lst Values to add, duplicates are ignored
+             */
+            roaringBitmap(const std::initializer_list<u_integer>& lst);
+
+            /**
+             * @brief Constructs a bitmap holding the indexes of the set bits of a bitSet
+             * @tparam BALLOC Allocator type of the bitSet
+             * @param bits Source bits
+             * @param alloc Allocator instance to use for memory management
+             */
+            template<typename BALLOC>
+            explicit roaringBitmap(const bitSet<BALLOC>& bits, ALLOC alloc = ALLOC{});
+
+            /**
+             * @brief Copy constructor
+             * @param other The bitmap to copy
+             */
+            roaringBitmap(const roaringBitmap& other);
+
+            /**
+             * @brief Copy assignment operator
+             * @param other The bitmap to copy
+             * @return A reference to this bitmap
+             * @details If ALLOC::propagate_on_container_copy_assignment is true, the allocator is also copied.
+             */
+            roaringBitmap& operator=(const roaringBitmap& other);
+
+            /**
+             * @brief Move constructor
+             * @param other The bitmap to move, left empty
+             */
+            roaringBitmap(roaringBitmap&& other) noexcept;
+
+            /**
+             * @brief Move assignment operator
+             * @param other The bitmap to move, left empty
+             * @return A reference to this bitmap
+             * @details If ALLOC::propagate_on_container_move_assignment is true, the allocator is also moved.
+             */
+            roaringBitmap& operator=(roaringBitmap&& other) noexcept;
+
+            /**
+             * @brief Swaps the contents of two bitmaps
+             * @param other The bitmap to swap with
+             */
+            void swap(roaringBitmap& other) noexcept;
+
+            /**
+             * @brief Gets the number of values
+             * @return The number of values
+             */
+            [[nodiscard]] u_integer size() const override;
+
+            /**
+             * @brief Checks whether a value is in the bitmap
+             * @param e The value to look for
+             * @return true if the value is present
+             */
+            [[nodiscard]] bool contains(const u_integer& e) const override;
+
+            /**
+             * @brief Adds a value
+             * @param e The value to add
+             * @return true if the value was absent
+             */
+            bool add(const u_integer& e) override;
+
+            /**
+             * @brief Removes a value
+             * @param e The value to remove
+             * @return true if the value was present
+             */
+            bool remove(const u_integer& e) override;
+
+            /**
+             * @brief Adds every value of the inclusive range [first, last]
+             * @param first First value
+             * @param last Last value, nothing is added if it is below first
+             * @details Fills whole chunks as single runs, so large ranges take a few bytes.
+             */
+            void addRange(u_integer first, u_integer last);
+
+            /**
+             * @brief Removes every value
+             */
+            void clear();
+
+            /**
+             * @brief Counts the values below a bound
+             * @param e The bound
+             * @return Number of values smaller than e
+             */
+            [[nodiscard]] u_integer rank(u_integer e) const;
+
+            /**
+             * @brief Finds a value by position
+             * @param index Position in increasing order
+             * @return The value at index
+             * @throw outOfBoundError if index is not below size()
+             */
+            [[nodiscard]] u_integer select(u_integer index) const;
+
+            /**
+             * @brief Switches every chunk to its smallest layout, using runs where they pay off
+             * @return true if at least one chunk is stored as runs
+             */
+            bool runOptimize();
+
+            /**
+             * @brief Gets the bytes used by the values of all chunks
+             * @return Payload size, excluding the chunk list and allocator overhead
+             */
+            [[nodiscard]] u_integer storageSize() const;
+
+            /**
+             * @brief Converts the bitmap to a bitSet
+             * @tparam BALLOC Allocator type of the bitSet
+             * @param size Size of the bitSet, values not below it are left out
+             * @return bitSet with the bits of the values set
+             */
+            template<typename BALLOC = allocator<bool>>
+            [[nodiscard]] bitSet<BALLOC> toBitSet(u_integer size) const;
+
+            /**
+             * @brief Gets the iterator to the smallest value
+             * @return An iterator pointing to the beginning
+             */
+            [[nodiscard]] Iterator* begins() const override;
+
+            /**
+             * @brief Gets the iterator to the largest value
+             * @return An iterator pointing to the end
+             */
+            [[nodiscard]] Iterator* ends() const override;
+
+            /**
+             * @brief Keeps the values also present in another bitmap
+             * @param other The bitmap to intersect with
+             * @return A reference to this bitmap
+             */
+            roaringBitmap& operator&=(const roaringBitmap& other);
+
+            /**
+             * @brief Adds the values of another bitmap
+             * @param other The bitmap to unite with
+             * @return A reference to this bitmap
+             */
+            roaringBitmap& operator|=(const roaringBitmap& other);
+
+            /**
+             * @brief Keeps the values present in exactly one of the bitmaps
+             * @param other The bitmap to combine with
+             * @return A reference to this bitmap
+             */
+            roaringBitmap& operator^=(const roaringBitmap& other);
+
+            /**
+             * @brief Removes the values present in another bitmap
+             * @param other The bitmap whose values are removed
+             * @return A reference to this bitmap
+             */
+            roaringBitmap& andNot(const roaringBitmap& other);
+
+            /**
+             * @brief Gets the class name
+             * @return "roaringBitmap"
+             */
+            [[nodiscard]] std::string className() const override;
+
+            ~roaringBitmap() override;
+    };
+
+    /**
+     * @brief Intersection of two roaringBitmaps
+     * @tparam ALLOC_ Allocator type
+     * @param lrb Left bitmap
+     * @param rrb Right bitmap
+     * @return Values present in both
+     */
+    template<typename ALLOC_>
+    roaringBitmap<ALLOC_> operator&(const roaringBitmap<ALLOC_>& lrb, const roaringBitmap<ALLOC_>& rrb);
+
+    /**
+     * @brief Union of two roaringBitmaps
+     * @tparam ALLOC_ Allocator type
+     * @param lrb Left bitmap
+     * @param rrb Right bitmap
+     * @return Values present in either
+     */
+    template<typename ALLOC_>
+    roaringBitmap<ALLOC_> operator|(const roaringBitmap<ALLOC_>& lrb, const roaringBitmap<ALLOC_>& rrb);
+
+    /**
+     * @brief Symmetric difference of two roaringBitmaps
+     * @tparam ALLOC_ Allocator type
+     * @param lrb Left bitmap
+     * @param rrb Right bitmap
+     * @return Values present in exactly one
+     */
+    template<typename ALLOC_>
+    roaringBitmap<ALLOC_> operator^(const roaringBitmap<ALLOC_>& lrb, const roaringBitmap<ALLOC_>& rrb);
+}
+
+namespace std {
+    /**
+     * @brief Specialization of std::swap for original::roaringBitmap
+     * @tparam ALLOC Allocator type
+     * @param lhs Left bitmap
+     * @param rhs Right bitmap
+     */
+    template<typename ALLOC>
+    void swap(original::roaringBitmap<ALLOC>& lhs, original::roaringBitmap<ALLOC>& rhs) noexcept; // NOLINT
+}
+
+    template<typename ALLOC>
+    original::roaringBitmap<ALLOC>::chunk::chunk(const u_integer key)
+        : key_(key), kind_(kind::ARRAY), cardinality_(0) {}
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::contains(const u_integer low) const -> bool
+    {
+        switch (this->kind_) {
+            case kind::ARRAY: {
+                const low_type* values = &this->values_.data();
+                const u_integer pos = lowerBound(values, this->cardinality_, low);
+                return pos < this->cardinality_ && values[pos] == low;
+            }
+            case kind::BITMAP:
+                return (&this->words_.data())[low / WORD_BITS] >> low % WORD_BITS & 1;
+            default: {
+                const integer run = this->findRun(low);
+                return run >= 0 && low <= (&this->values_.data())[2 * run + 1];
+            }
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::add(const u_integer low) -> bool
+    {
+        if (this->kind_ == kind::RUN) {
+            if (this->contains(low))
+                return false;
+            this->unpack();
+        }
+        if (this->kind_ == kind::ARRAY) {
+            const u_integer pos = lowerBound(&this->values_.data(), this->cardinality_, low);
+            if (pos < this->cardinality_ && (&this->values_.data())[pos] == low)
+                return false;
+            if (this->cardinality_ < ARRAY_MAX) {
+                this->values_.push(pos, static_cast<low_type>(low));
+                this->cardinality_ += 1;
+                return true;
+            }
+            this->toBitmap();
+        }
+
+        word_type& word = (&this->words_.data())[low / WORD_BITS];
+        const word_type mask = word_type{1} << low % WORD_BITS;
+        if (word & mask)
+            return false;
+        word |= mask;
+        this->cardinality_ += 1;
+        return true;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::remove(const u_integer low) -> bool
+    {
+        if (!this->contains(low))
+            return false;
+        if (this->kind_ == kind::RUN)
+            this->unpack();
+
+        if (this->kind_ == kind::ARRAY) {
+            this->values_.pop(lowerBound(&this->values_.data(), this->cardinality_, low));
+            this->cardinality_ -= 1;
+            return true;
+        }
+        (&this->words_.data())[low / WORD_BITS] &= ~(word_type{1} << low % WORD_BITS);
+        this->cardinality_ -= 1;
+        this->normalize();
+        return true;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::addRange(const u_integer first, const u_integer last) -> void
+    {
+        if (this->cardinality_ == 0 || (first == 0 && last == LOW_MASK)) {
+            this->values_ = vector<low_type, rebind_alloc_low>{};
+            this->values_.pushEnd(static_cast<low_type>(first));
+            this->values_.pushEnd(static_cast<low_type>(last));
+            this->words_ = array<word_type, rebind_alloc_word>{};
+            this->kind_ = kind::RUN;
+            this->cardinality_ = last - first + 1;
+            return;
+        }
+
+        this->toBitmap();
+        word_type* words = &this->words_.data();
+        applyRange<setOperation::OR>(words, first, last);
+        this->cardinality_ = countWords(words);
+        this->optimize();
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::rank(const u_integer low) const -> u_integer
+    {
+        switch (this->kind_) {
+            case kind::ARRAY:
+                return lowerBound(&this->values_.data(), this->cardinality_, low);
+            case kind::BITMAP: {
+                const word_type* words = &this->words_.data();
+                const u_integer full = low / WORD_BITS;
+                u_integer count = 0;
+                for (u_integer i = 0; i < full; i++) {
+                    count += static_cast<u_integer>(std::popcount(words[i]));
+                }
+                if (full < BITMAP_WORDS) {
+                    count += static_cast<u_integer>(
+                        std::popcount(words[full] & ((word_type{1} << low % WORD_BITS) - 1)));
+                }
+                return count;
+            }
+            default: {
+                const low_type* runs = &this->values_.data();
+                u_integer count = 0;
+                for (u_integer i = 0; i < this->values_.size() && runs[i] < low; i += 2) {
+                    count += (runs[i + 1] < low ? runs[i + 1] + 1u : low) - runs[i];
+                }
+                return count;
+            }
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::select(u_integer index) const -> u_integer
+    {
+        switch (this->kind_) {
+            case kind::ARRAY:
+                return (&this->values_.data())[index];
+            case kind::BITMAP: {
+                const word_type* words = &this->words_.data();
+                for (u_integer i = 0;; i++) {
+                    const auto count = static_cast<u_integer>(std::popcount(words[i]));
+                    if (index < count) {
+                        word_type word = words[i];
+                        for (; index > 0; index--) {
+                            word &= word - 1;
+                        }
+                        return i * WORD_BITS + std::countr_zero(word);
+                    }
+                    index -= count;
+                }
+            }
+            default: {
+                const low_type* runs = &this->values_.data();
+                for (u_integer i = 0;; i += 2) {
+                    const u_integer length = runs[i + 1] - runs[i] + 1u;
+                    if (index < length)
+                        return runs[i] + index;
+                    index -= length;
+                }
+            }
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::nextValue(const integer low) const -> integer
+    {
+        if (low > static_cast<integer>(LOW_MASK))
+            return -1;
+
+        const auto from = static_cast<u_integer>(low < 0 ? 0 : low);
+        switch (this->kind_) {
+            case kind::ARRAY: {
+                const u_integer pos = lowerBound(&this->values_.data(), this->cardinality_, from);
+                return pos < this->cardinality_ ? (&this->values_.data())[pos] : -1;
+            }
+            case kind::BITMAP:
+                return nextSet(&this->words_.data(), from);
+            default: {
+                const low_type* runs = &this->values_.data();
+                const integer run = this->findRun(from);
+                if (run >= 0 && from <= runs[2 * run + 1])
+                    return from;
+                const u_integer next = 2 * static_cast<u_integer>(run + 1);
+                return next < this->values_.size() ? runs[next] : -1;
+            }
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::prevValue(const integer low) const -> integer
+    {
+        if (low < 0)
+            return -1;
+
+        const auto from = static_cast<u_integer>(low > static_cast<integer>(LOW_MASK) ? LOW_MASK : low);
+        switch (this->kind_) {
+            case kind::ARRAY: {
+                const u_integer pos = lowerBound(&this->values_.data(), this->cardinality_, from + 1);
+                return pos > 0 ? (&this->values_.data())[pos - 1] : -1;
+            }
+            case kind::BITMAP: {
+                const word_type* words = &this->words_.data();
+                integer i = from / WORD_BITS;
+                word_type word = words[i] & ~word_type{0} >> (WORD_BITS - 1 - from % WORD_BITS);
+                while (word == 0) {
+                    if (i == 0)
+                        return -1;
+                    i -= 1;
+                    word = words[i];
+                }
+                return i * WORD_BITS + WORD_BITS - 1 - std::countl_zero(word);
+            }
+            default: {
+                const integer run = this->findRun(from);
+                if (run < 0)
+                    return -1;
+                const u_integer last = (&this->values_.data())[2 * run + 1];
+                return from < last ? from : last;
+            }
+        }
+    }
+
+    template<typename ALLOC>
+    template<typename original::roaringBitmap<ALLOC>::setOperation OP>
+    auto original::roaringBitmap<ALLOC>::chunk::combine(const chunk& other) -> void
+    {
+        constexpr bool may_grow = OP == setOperation::OR || OP == setOperation::XOR;
+        if (this->kind_ == kind::ARRAY && other.kind_ == kind::ARRAY
+            && (!may_grow || this->cardinality_ + other.cardinality_ <= ARRAY_MAX)) {
+            this->template mergeArrays<OP>(other);
+            return;
+        }
+        if constexpr (OP == setOperation::AND) {
+            if (this->kind_ == kind::ARRAY) {
+                this->filterArray(other, true, *this);
+                return;
+            }
+            if (other.kind_ == kind::ARRAY) {
+                this->filterArray(*this, true, other);
+                return;
+            }
+        }
+        if constexpr (OP == setOperation::AND_NOT) {
+            if (this->kind_ == kind::ARRAY) {
+                this->filterArray(other, false, *this);
+                return;
+            }
+        }
+
+        this->toBitmap();
+        word_type* words = &this->words_.data();
+        if (other.kind_ == kind::BITMAP) {
+            applyWords<OP>(words, &other.words_.data());
+        } else if (other.kind_ == kind::ARRAY) {
+            const low_type* values = &other.values_.data();
+            for (u_integer i = 0; i < other.cardinality_; i++) {
+                applyMask<OP>(words[values[i] / WORD_BITS], word_type{1} << values[i] % WORD_BITS);
+            }
+        } else if constexpr (OP == setOperation::AND) {
+            array<word_type, rebind_alloc_word> other_words(BITMAP_WORDS, rebind_alloc_word{});
+            other.fillWords(&other_words.data());
+            applyWords<OP>(words, &other_words.data());
+        } else {
+            const low_type* runs = &other.values_.data();
+            for (u_integer i = 0; i < other.values_.size(); i += 2) {
+                applyRange<OP>(words, runs[i], runs[i + 1]);
+            }
+        }
+        this->cardinality_ = countWords(words);
+        this->normalize();
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::optimize() -> bool
+    {
+        const u_integer run_bytes = this->countRuns() * 2 * sizeof(low_type);
+        const u_integer packed_bytes = this->cardinality_ <= ARRAY_MAX ?
+            this->cardinality_ * static_cast<u_integer>(sizeof(low_type)) : BITMAP_WORDS * sizeof(word_type);
+        if (run_bytes < packed_bytes) {
+            this->toRun();
+            return true;
+        }
+        this->unpack();
+        return false;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::storageSize() const -> u_integer
+    {
+        switch (this->kind_) {
+            case kind::ARRAY:
+                return this->cardinality_ * sizeof(low_type);
+            case kind::BITMAP:
+                return BITMAP_WORDS * sizeof(word_type);
+            default:
+                return this->values_.size() * sizeof(low_type);
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::countRuns() const -> u_integer
+    {
+        switch (this->kind_) {
+            case kind::ARRAY: {
+                const low_type* values = &this->values_.data();
+                u_integer runs = this->cardinality_ > 0 ? 1 : 0;
+                for (u_integer i = 1; i < this->cardinality_; i++) {
+                    runs += values[i] != values[i - 1] + 1u;
+                }
+                return runs;
+            }
+            case kind::BITMAP: {
+                const word_type* words = &this->words_.data();
+                u_integer runs = 0;
+                word_type carry = 0;
+                for (u_integer i = 0; i < BITMAP_WORDS; i++) {
+                    runs += static_cast<u_integer>(std::popcount(words[i] & ~(words[i] << 1 | carry)));
+                    carry = words[i] >> (WORD_BITS - 1);
+                }
+                return runs;
+            }
+            default:
+                return this->values_.size() / 2;
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::findRun(const u_integer low) const -> integer
+    {
+        const low_type* runs = &this->values_.data();
+        u_integer lo = 0;
+        u_integer hi = this->values_.size() / 2;
+        while (lo < hi) {
+            const u_integer mid = lo + (hi - lo) / 2;
+            if (runs[2 * mid] <= low) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return static_cast<integer>(lo) - 1;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::fillWords(word_type* words) const -> void
+    {
+        if (this->kind_ == kind::BITMAP) {
+            const word_type* src = &this->words_.data();
+            for (u_integer i = 0; i < BITMAP_WORDS; i++) {
+                words[i] = src[i];
+            }
+            return;
+        }
+
+        for (u_integer i = 0; i < BITMAP_WORDS; i++) {
+            words[i] = 0;
+        }
+        const low_type* values = &this->values_.data();
+        if (this->kind_ == kind::ARRAY) {
+            for (u_integer i = 0; i < this->cardinality_; i++) {
+                words[values[i] / WORD_BITS] |= word_type{1} << values[i] % WORD_BITS;
+            }
+        } else {
+            for (u_integer i = 0; i < this->values_.size(); i += 2) {
+                applyRange<setOperation::OR>(words, values[i], values[i + 1]);
+            }
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::toBitmap() -> void
+    {
+        if (this->kind_ == kind::BITMAP)
+            return;
+
+        array<word_type, rebind_alloc_word> words(BITMAP_WORDS, rebind_alloc_word{});
+        this->fillWords(&words.data());
+        this->words_ = std::move(words);
+        this->values_ = vector<low_type, rebind_alloc_low>{};
+        this->kind_ = kind::BITMAP;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::toArray() -> void
+    {
+        if (this->kind_ == kind::ARRAY)
+            return;
+
+        low_type values[ARRAY_MAX];
+        u_integer count = 0;
+        if (this->kind_ == kind::BITMAP) {
+            const word_type* words = &this->words_.data();
+            for (u_integer i = 0; i < BITMAP_WORDS; i++) {
+                for (word_type word = words[i]; word != 0; word &= word - 1) {
+                    values[count++] = static_cast<low_type>(i * WORD_BITS + std::countr_zero(word));
+                }
+            }
+        } else {
+            const low_type* runs = &this->values_.data();
+            for (u_integer i = 0; i < this->values_.size(); i += 2) {
+                for (u_integer v = runs[i]; v <= runs[i + 1]; v++) {
+                    values[count++] = static_cast<low_type>(v);
+                }
+            }
+        }
+        this->assignValues(values, count);
+        this->words_ = array<word_type, rebind_alloc_word>{};
+        this->kind_ = kind::ARRAY;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::toRun() -> void
+    {
+        if (this->kind_ == kind::RUN)
+            return;
+
+        vector<low_type, rebind_alloc_low> runs;
+        if (this->kind_ == kind::ARRAY) {
+            const low_type* values = &this->values_.data();
+            for (u_integer i = 0; i < this->cardinality_; i++) {
+                if (i == 0 || values[i] != values[i - 1] + 1u) {
+                    if (i != 0)
+                        runs.pushEnd(values[i - 1]);
+                    runs.pushEnd(values[i]);
+                }
+            }
+            if (this->cardinality_ > 0)
+                runs.pushEnd(values[this->cardinality_ - 1]);
+        } else {
+            const word_type* words = &this->words_.data();
+            for (integer first = nextSet(words, 0); first >= 0;) {
+                const u_integer end = nextClear(words, static_cast<u_integer>(first));
+                runs.pushEnd(static_cast<low_type>(first));
+                runs.pushEnd(static_cast<low_type>(end - 1));
+                first = end > LOW_MASK ? -1 : nextSet(words, end);
+            }
+        }
+        this->values_ = std::move(runs);
+        this->words_ = array<word_type, rebind_alloc_word>{};
+        this->kind_ = kind::RUN;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::unpack() -> void
+    {
+        if (this->kind_ != kind::RUN)
+            return;
+        this->cardinality_ <= ARRAY_MAX ? this->toArray() : this->toBitmap();
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::normalize() -> void
+    {
+        if (this->kind_ == kind::BITMAP && this->cardinality_ <= ARRAY_MAX) {
+            this->toArray();
+        } else if (this->kind_ == kind::ARRAY && this->cardinality_ > ARRAY_MAX) {
+            this->toBitmap();
+        }
+    }
+
+    template<typename ALLOC>
+    template<typename original::roaringBitmap<ALLOC>::setOperation OP>
+    auto original::roaringBitmap<ALLOC>::chunk::mergeArrays(const chunk& other) -> void
+    {
+        constexpr bool keep_left = OP != setOperation::AND;
+        constexpr bool keep_right = OP == setOperation::OR || OP == setOperation::XOR;
+        constexpr bool keep_both = OP == setOperation::AND || OP == setOperation::OR;
+
+        const low_type* left = &this->values_.data();
+        const low_type* right = &other.values_.data();
+        const u_integer n = this->cardinality_;
+        const u_integer m = other.cardinality_;
+        low_type values[ARRAY_MAX];
+        u_integer count = 0;
+        u_integer i = 0;
+        u_integer j = 0;
+        while (i < n && j < m) {
+            const low_type l = left[i];
+            const low_type r = right[j];
+            const bool less = l < r;
+            const bool greater = r < l;
+            values[count] = less ? l : r;
+            count += keep_left * less + keep_right * greater + keep_both * (less == greater);
+            i += !greater;
+            j += !less;
+        }
+        if constexpr (keep_left) {
+            for (; i < n; i++) {
+                values[count++] = left[i];
+            }
+        }
+        if constexpr (keep_right) {
+            for (; j < m; j++) {
+                values[count++] = right[j];
+            }
+        }
+        this->assignValues(values, count);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::filterArray(const chunk& other, const bool present,
+                                                            const chunk& source) -> void
+    {
+        const low_type* src = &source.values_.data();
+        low_type values[ARRAY_MAX];
+        u_integer count = 0;
+        for (u_integer i = 0; i < source.cardinality_; i++) {
+            if (other.contains(src[i]) == present)
+                values[count++] = src[i];
+        }
+        this->assignValues(values, count);
+        this->words_ = array<word_type, rebind_alloc_word>{};
+        this->kind_ = kind::ARRAY;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::assignValues(const low_type* values, const u_integer n) -> void
+    {
+        vector<low_type, rebind_alloc_low> copy;
+        if (n > 0) {
+            copy = vector<low_type, rebind_alloc_low>(n, rebind_alloc_low{}, low_type{});
+            low_type* dst = &copy.data();
+            for (u_integer i = 0; i < n; i++) {
+                dst[i] = values[i];
+            }
+        }
+        this->values_ = std::move(copy);
+        this->cardinality_ = n;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::nextSet(const word_type* words, const u_integer from) -> integer
+    {
+        u_integer i = from / WORD_BITS;
+        word_type word = words[i] & ~word_type{0} << from % WORD_BITS;
+        while (word == 0) {
+            i += 1;
+            if (i == BITMAP_WORDS)
+                return -1;
+            word = words[i];
+        }
+        return i * WORD_BITS + std::countr_zero(word);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::nextClear(const word_type* words, const u_integer from) -> u_integer
+    {
+        u_integer i = from / WORD_BITS;
+        word_type word = ~words[i] & ~word_type{0} << from % WORD_BITS;
+        while (word == 0) {
+            i += 1;
+            if (i == BITMAP_WORDS)
+                return LOW_MASK + 1;
+            word = ~words[i];
+        }
+        return i * WORD_BITS + std::countr_zero(word);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::lowerBound(const low_type* values, const u_integer n,
+                                                           const u_integer low) -> u_integer
+    {
+        u_integer lo = 0;
+        u_integer hi = n;
+        while (lo < hi) {
+            const u_integer mid = lo + (hi - lo) / 2;
+            if (values[mid] < low) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    template<typename ALLOC>
+    template<typename original::roaringBitmap<ALLOC>::setOperation OP>
+    auto original::roaringBitmap<ALLOC>::chunk::applyMask(word_type& word, const word_type mask) -> void
+    {
+        if constexpr (OP == setOperation::AND) {
+            word &= mask;
+        } else if constexpr (OP == setOperation::OR) {
+            word |= mask;
+        } else if constexpr (OP == setOperation::XOR) {
+            word ^= mask;
+        } else {
+            word &= ~mask;
+        }
+    }
+
+    template<typename ALLOC>
+    template<typename original::roaringBitmap<ALLOC>::setOperation OP>
+    auto original::roaringBitmap<ALLOC>::chunk::applyRange(word_type* words, const u_integer first,
+                                                           const u_integer last) -> void
+    {
+        const u_integer first_word = first / WORD_BITS;
+        const u_integer last_word = last / WORD_BITS;
+        const word_type first_mask = ~word_type{0} << first % WORD_BITS;
+        const word_type last_mask = ~word_type{0} >> (WORD_BITS - 1 - last % WORD_BITS);
+        if (first_word == last_word) {
+            applyMask<OP>(words[first_word], first_mask & last_mask);
+            return;
+        }
+        applyMask<OP>(words[first_word], first_mask);
+        for (u_integer i = first_word + 1; i < last_word; i++) {
+            applyMask<OP>(words[i], ~word_type{0});
+        }
+        applyMask<OP>(words[last_word], last_mask);
+    }
+
+    template<typename ALLOC>
+    template<typename original::roaringBitmap<ALLOC>::setOperation OP>
+    auto original::roaringBitmap<ALLOC>::chunk::applyWords(word_type* dst, const word_type* src) -> void
+    {
+        for (u_integer i = 0; i < BITMAP_WORDS; i++) {
+            applyMask<OP>(dst[i], src[i]);
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunk::countWords(const word_type* words) -> u_integer
+    {
+        u_integer count = 0;
+        for (u_integer i = 0; i < BITMAP_WORDS; i++) {
+            count += static_cast<u_integer>(std::popcount(words[i]));
+        }
+        return count;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::createChunk(const u_integer key) const -> chunk*
+    {
+        auto c = this->chunk_alloc.allocate(1);
+        this->chunk_alloc.construct(c, key);
+        return c;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::copyChunk(const chunk& other) const -> chunk*
+    {
+        auto c = this->chunk_alloc.allocate(1);
+        this->chunk_alloc.construct(c, other);
+        return c;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::destroyChunk(chunk* c) const noexcept -> void
+    {
+        this->chunk_alloc.destroy(c);
+        this->chunk_alloc.deallocate(c, 1);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::destroyChunks() noexcept -> void
+    {
+        chunk** chunks = &this->chunks_.data();
+        for (u_integer i = 0; i < this->chunks_.size(); i++) {
+            this->destroyChunk(chunks[i]);
+        }
+        this->chunks_ = chunks_type{};
+        this->size_ = 0;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::chunkIndex(const u_integer key) const -> u_integer
+    {
+        chunk** chunks = &this->chunks_.data();
+        const u_integer n = this->chunks_.size();
+        if (n == 0 || chunks[n - 1]->key_ < key)
+            return n;
+
+        u_integer lo = 0;
+        u_integer hi = n - 1;
+        while (lo < hi) {
+            const u_integer mid = lo + (hi - lo) / 2;
+            if (chunks[mid]->key_ < key) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::selectChunk(u_integer& index) const -> u_integer
+    {
+        chunk** chunks = &this->chunks_.data();
+        u_integer i = 0;
+        while (index >= chunks[i]->cardinality_) {
+            index -= chunks[i]->cardinality_;
+            i += 1;
+        }
+        return i;
+    }
+
+    template<typename ALLOC>
+    template<typename original::roaringBitmap<ALLOC>::setOperation OP>
+    auto original::roaringBitmap<ALLOC>::combine(const roaringBitmap& other) -> roaringBitmap&
+    {
+        constexpr bool keep_left = OP != setOperation::AND;
+        constexpr bool keep_right = OP == setOperation::OR || OP == setOperation::XOR;
+
+        if (this == &other) {
+            if constexpr (OP == setOperation::XOR || OP == setOperation::AND_NOT)
+                this->clear();
+            return *this;
+        }
+
+        chunk** left = &this->chunks_.data();
+        chunk** right = &other.chunks_.data();
+        const u_integer n = this->chunks_.size();
+        const u_integer m = other.chunks_.size();
+        chunks_type chunks;
+        u_integer size = 0;
+        u_integer i = 0;
+        u_integer j = 0;
+        const auto keep = [&](chunk* c) {
+            chunks.pushEnd(c);
+            size += c->cardinality_;
+        };
+        while (i < n && j < m) {
+            if (left[i]->key_ < right[j]->key_) {
+                keep_left ? keep(left[i]) : this->destroyChunk(left[i]);
+                i += 1;
+            } else if (right[j]->key_ < left[i]->key_) {
+                if constexpr (keep_right)
+                    keep(this->copyChunk(*right[j]));
+                j += 1;
+            } else {
+                left[i]->template combine<OP>(*right[j]);
+                left[i]->cardinality_ > 0 ? keep(left[i]) : this->destroyChunk(left[i]);
+                i += 1;
+                j += 1;
+            }
+        }
+        for (; i < n; i++) {
+            keep_left ? keep(left[i]) : this->destroyChunk(left[i]);
+        }
+        if constexpr (keep_right) {
+            for (; j < m; j++) {
+                keep(this->copyChunk(*right[j]));
+            }
+        }
+        this->chunks_ = std::move(chunks);
+        this->size_ = size;
+        return *this;
+    }
+
+    template<typename ALLOC>
+    original::roaringBitmap<ALLOC>::Iterator::Iterator(const roaringBitmap* container, const integer chunk,
+                                                       const u_integer slot, const u_integer value)
+        : container_(container), chunk_(chunk), slot_(slot), value_(value) {}
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::position() const -> integer
+    {
+        if (this->isValid())
+            return this->container_->rank(this->value_ & ~LOW_MASK) + this->slot_;
+        return this->chunk_ < 0 ? -1 : this->container_->size();
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::equalPtr(const iterator* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        if (other_it == nullptr || this->container_ != other_it->container_)
+            return false;
+        if (!this->isValid() || !other_it->isValid())
+            return this->isValid() == other_it->isValid();
+        return this->value_ == other_it->value_;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::clone() const -> Iterator*
+    {
+        return new Iterator(*this);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::hasNext() const -> bool
+    {
+        if (!this->isValid())
+            return false;
+        return this->chunk_ + 1 < static_cast<integer>(this->container_->chunks_.size())
+            || this->slot_ + 1 < (&this->container_->chunks_.data())[this->chunk_]->cardinality_;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::hasPrev() const -> bool
+    {
+        if (!this->isValid())
+            return false;
+        return this->chunk_ > 0 || this->slot_ > 0;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::atPrev(const iterator* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        if (other_it == nullptr)
+            return false;
+        return this->operator-(*other_it) == -1;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::atNext(const iterator* other) const -> bool
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(other);
+        if (other_it == nullptr)
+            return false;
+        return this->operator-(*other_it) == 1;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::next() const -> void
+    {
+        if (!this->isValid())
+            return;
+
+        chunk** chunks = &this->container_->chunks_.data();
+        const chunk* c = chunks[this->chunk_];
+        if (this->slot_ + 1 < c->cardinality_) {
+            this->slot_ += 1;
+            const u_integer low = c->kind_ == chunk::kind::ARRAY ?
+                (&c->values_.data())[this->slot_] : static_cast<u_integer>(c->nextValue((this->value_ & LOW_MASK) + 1));
+            this->value_ = c->key_ << CHUNK_BITS | low;
+            return;
+        }
+        this->chunk_ += 1;
+        this->slot_ = 0;
+        if (this->isValid()) {
+            c = chunks[this->chunk_];
+            this->value_ = c->key_ << CHUNK_BITS | static_cast<u_integer>(c->nextValue(0));
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::prev() const -> void
+    {
+        if (!this->isValid())
+            return;
+
+        chunk** chunks = &this->container_->chunks_.data();
+        const chunk* c = chunks[this->chunk_];
+        if (this->slot_ > 0) {
+            this->slot_ -= 1;
+            const u_integer low = c->kind_ == chunk::kind::ARRAY ?
+                (&c->values_.data())[this->slot_] : static_cast<u_integer>(c->prevValue(static_cast<integer>(this->value_ & LOW_MASK) - 1));
+            this->value_ = c->key_ << CHUNK_BITS | low;
+            return;
+        }
+        this->chunk_ -= 1;
+        if (this->isValid()) {
+            c = chunks[this->chunk_];
+            this->slot_ = c->cardinality_ - 1;
+            this->value_ = c->key_ << CHUNK_BITS | static_cast<u_integer>(c->prevValue(LOW_MASK));
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::getPrev() const -> Iterator*
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        auto* it = this->clone();
+        it->prev();
+        return it;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::getNext() const -> Iterator*
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        auto* it = this->clone();
+        it->next();
+        return it;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::operator+=(const integer steps) const -> void
+    {
+        const integer target = this->position() + steps;
+        if (target < 0) {
+            this->chunk_ = -1;
+            return;
+        }
+        if (target >= static_cast<integer>(this->container_->size())) {
+            this->chunk_ = this->container_->chunks_.size();
+            return;
+        }
+
+        auto index = static_cast<u_integer>(target);
+        this->chunk_ = this->container_->selectChunk(index);
+        const chunk* c = (&this->container_->chunks_.data())[this->chunk_];
+        this->slot_ = index;
+        this->value_ = c->key_ << CHUNK_BITS | c->select(index);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::operator-=(const integer steps) const -> void
+    {
+        this->operator+=(-steps);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::operator-(const iterator& other) const -> integer
+    {
+        auto* other_it = dynamic_cast<const Iterator*>(&other);
+        if (other_it == nullptr)
+            return this > &other ?
+                std::numeric_limits<integer>::max() :
+                std::numeric_limits<integer>::min();
+        if (this->container_ != other_it->container_)
+            return this->container_ > other_it->container_ ?
+                std::numeric_limits<integer>::max() :
+                std::numeric_limits<integer>::min();
+
+        return this->position() - other_it->position();
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::get() -> u_integer&
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        return this->value_;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::className() const -> std::string
+    {
+        return "roaringBitmap::Iterator";
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::get() const -> u_integer
+    {
+        if (!this->isValid()) throw outOfBoundError();
+        return this->value_;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::set(const u_integer&) -> void
+    {
+        throw unSupportedMethodError();
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::Iterator::isValid() const -> bool
+    {
+        return this->chunk_ >= 0 && this->chunk_ < static_cast<integer>(this->container_->chunks_.size());
+    }
+
+    template<typename ALLOC>
+    original::roaringBitmap<ALLOC>::roaringBitmap(ALLOC alloc)
+        : set<u_integer, ALLOC>(std::move(alloc)), size_(0) {}
+
+    template<typename ALLOC>
+    original::roaringBitmap<ALLOC>::roaringBitmap(const std::initializer_list<u_integer>& lst) : roaringBitmap()
+    {
+        for (const auto& e : lst) {
+            this->add(e);
+        }
+    }
+
+    template<typename ALLOC>
+    template<typename BALLOC>
+    original::roaringBitmap<ALLOC>::roaringBitmap(const bitSet<BALLOC>& bits, ALLOC alloc)
+        : roaringBitmap(std::move(alloc))
+    {
+        for (u_integer i = bits.findFirst(); i < bits.size(); i = bits.findNext(i)) {
+            this->add(i);
+        }
+    }
+
+    template<typename ALLOC>
+    original::roaringBitmap<ALLOC>::roaringBitmap(const roaringBitmap& other) : roaringBitmap()
+    {
+        this->operator=(other);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::operator=(const roaringBitmap& other) -> roaringBitmap&
+    {
+        if (this == &other)
+            return *this;
+
+        this->destroyChunks();
+        if constexpr (ALLOC::propagate_on_container_copy_assignment::value) {
+            this->allocator = other.allocator;
+        }
+        chunk** chunks = &other.chunks_.data();
+        for (u_integer i = 0; i < other.chunks_.size(); i++) {
+            this->chunks_.pushEnd(this->copyChunk(*chunks[i]));
+        }
+        this->size_ = other.size_;
+        return *this;
+    }
+
+    template<typename ALLOC>
+    original::roaringBitmap<ALLOC>::roaringBitmap(roaringBitmap&& other) noexcept : roaringBitmap()
+    {
+        this->operator=(std::move(other));
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::operator=(roaringBitmap&& other) noexcept -> roaringBitmap&
+    {
+        if (this == &other)
+            return *this;
+
+        this->destroyChunks();
+        this->chunks_.swap(other.chunks_);
+        this->size_ = other.size_;
+        other.size_ = 0;
+        if constexpr (ALLOC::propagate_on_container_move_assignment::value) {
+            this->allocator = std::move(other.allocator);
+        }
+        return *this;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::swap(roaringBitmap& other) noexcept -> void
+    {
+        if (this == &other)
+            return;
+
+        this->chunks_.swap(other.chunks_);
+        std::swap(this->size_, other.size_);
+        if constexpr (ALLOC::propagate_on_container_swap::value) {
+            std::swap(this->allocator, other.allocator);
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::size() const -> u_integer
+    {
+        return this->size_;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::contains(const u_integer& e) const -> bool
+    {
+        const u_integer key = e >> CHUNK_BITS;
+        const u_integer i = this->chunkIndex(key);
+        if (i == this->chunks_.size())
+            return false;
+        const chunk* c = (&this->chunks_.data())[i];
+        return c->key_ == key && c->contains(e & LOW_MASK);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::add(const u_integer& e) -> bool
+    {
+        const u_integer key = e >> CHUNK_BITS;
+        const u_integer i = this->chunkIndex(key);
+        if (i == this->chunks_.size() || (&this->chunks_.data())[i]->key_ != key) {
+            this->chunks_.push(i, this->createChunk(key));
+        }
+        if (!(&this->chunks_.data())[i]->add(e & LOW_MASK))
+            return false;
+        this->size_ += 1;
+        return true;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::remove(const u_integer& e) -> bool
+    {
+        const u_integer key = e >> CHUNK_BITS;
+        const u_integer i = this->chunkIndex(key);
+        if (i == this->chunks_.size())
+            return false;
+        chunk* c = (&this->chunks_.data())[i];
+        if (c->key_ != key || !c->remove(e & LOW_MASK))
+            return false;
+        if (c->cardinality_ == 0) {
+            this->destroyChunk(this->chunks_.pop(i));
+        }
+        this->size_ -= 1;
+        return true;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::addRange(const u_integer first, const u_integer last) -> void
+    {
+        if (last < first)
+            return;
+
+        for (u_integer key = first >> CHUNK_BITS;; key++) {
+            const u_integer low = key == first >> CHUNK_BITS ? first & LOW_MASK : 0;
+            const u_integer high = key == last >> CHUNK_BITS ? last & LOW_MASK : LOW_MASK;
+            const u_integer i = this->chunkIndex(key);
+            if (i == this->chunks_.size() || (&this->chunks_.data())[i]->key_ != key) {
+                this->chunks_.push(i, this->createChunk(key));
+            }
+            chunk* c = (&this->chunks_.data())[i];
+            this->size_ -= c->cardinality_;
+            c->addRange(low, high);
+            this->size_ += c->cardinality_;
+            if (key == last >> CHUNK_BITS)
+                break;
+        }
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::clear() -> void
+    {
+        this->destroyChunks();
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::rank(const u_integer e) const -> u_integer
+    {
+        const u_integer key = e >> CHUNK_BITS;
+        chunk** chunks = &this->chunks_.data();
+        u_integer count = 0;
+        for (u_integer i = 0; i < this->chunks_.size() && chunks[i]->key_ <= key; i++) {
+            count += chunks[i]->key_ < key ? chunks[i]->cardinality_ : chunks[i]->rank(e & LOW_MASK);
+        }
+        return count;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::select(const u_integer index) const -> u_integer
+    {
+        if (index >= this->size_) {
+            throw outOfBoundError("Index " + std::to_string(index) +
+                                  " out of bound max index " + std::to_string(this->size_) + ".");
+        }
+
+        u_integer inner = index;
+        const chunk* c = (&this->chunks_.data())[this->selectChunk(inner)];
+        return c->key_ << CHUNK_BITS | c->select(inner);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::runOptimize() -> bool
+    {
+        chunk** chunks = &this->chunks_.data();
+        bool has_runs = false;
+        for (u_integer i = 0; i < this->chunks_.size(); i++) {
+            has_runs = chunks[i]->optimize() || has_runs;
+        }
+        return has_runs;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::storageSize() const -> u_integer
+    {
+        chunk** chunks = &this->chunks_.data();
+        u_integer bytes = 0;
+        for (u_integer i = 0; i < this->chunks_.size(); i++) {
+            bytes += chunks[i]->storageSize();
+        }
+        return bytes;
+    }
+
+    template<typename ALLOC>
+    template<typename BALLOC>
+    auto original::roaringBitmap<ALLOC>::toBitSet(const u_integer size) const -> bitSet<BALLOC>
+    {
+        bitSet<BALLOC> bits(size);
+        chunk** chunks = &this->chunks_.data();
+        for (u_integer i = 0; i < this->chunks_.size(); i++) {
+            const u_integer base = chunks[i]->key_ << CHUNK_BITS;
+            for (integer low = chunks[i]->nextValue(0); low >= 0; low = chunks[i]->nextValue(low + 1)) {
+                if (base + low >= size)
+                    return bits;
+                bits.set(base + low, true);
+            }
+        }
+        return bits;
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::begins() const -> Iterator*
+    {
+        if (this->chunks_.size() == 0)
+            return new Iterator(this, 0, 0, 0);
+        const chunk* c = (&this->chunks_.data())[0];
+        return new Iterator(this, 0, 0, c->key_ << CHUNK_BITS | static_cast<u_integer>(c->nextValue(0)));
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::ends() const -> Iterator*
+    {
+        const integer last = static_cast<integer>(this->chunks_.size()) - 1;
+        if (last < 0)
+            return new Iterator(this, last, 0, 0);
+        const chunk* c = (&this->chunks_.data())[last];
+        return new Iterator(this, last, c->cardinality_ - 1,
+                            c->key_ << CHUNK_BITS | static_cast<u_integer>(c->prevValue(LOW_MASK)));
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::operator&=(const roaringBitmap& other) -> roaringBitmap&
+    {
+        return this->combine<setOperation::AND>(other);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::operator|=(const roaringBitmap& other) -> roaringBitmap&
+    {
+        return this->combine<setOperation::OR>(other);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::operator^=(const roaringBitmap& other) -> roaringBitmap&
+    {
+        return this->combine<setOperation::XOR>(other);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::andNot(const roaringBitmap& other) -> roaringBitmap&
+    {
+        return this->combine<setOperation::AND_NOT>(other);
+    }
+
+    template<typename ALLOC>
+    auto original::roaringBitmap<ALLOC>::className() const -> std::string
+    {
+        return "roaringBitmap";
+    }
+
+    template<typename ALLOC>
+    original::roaringBitmap<ALLOC>::~roaringBitmap()
+    {
+        this->destroyChunks();
+    }
+
+    template<typename ALLOC_>
+    auto original::operator&(const roaringBitmap<ALLOC_>& lrb, const roaringBitmap<ALLOC_>& rrb) -> roaringBitmap<ALLOC_>
+    {
+        roaringBitmap rb{lrb};
+        rb &= rrb;
+        return rb;
+    }
+
+    template<typename ALLOC_>
+    auto original::operator|(const roaringBitmap<ALLOC_>& lrb, const roaringBitmap<ALLOC_>& rrb) -> roaringBitmap<ALLOC_>
+    {
+        roaringBitmap rb{lrb};
+        rb |= rrb;
+        return rb;
+    }
+
+    template<typename ALLOC_>
+    auto original::operator^(const roaringBitmap<ALLOC_>& lrb, const roaringBitmap<ALLOC_>& rrb) -> roaringBitmap<ALLOC_>
+    {
+        roaringBitmap rb{lrb};
+        rb ^= rrb;
+        return rb;
+    }
+
+    template <typename ALLOC>
+    void std::swap(original::roaringBitmap<ALLOC>& lhs, original::roaringBitmap<ALLOC>& rhs) noexcept // NOLINT
+    {
+        lhs.swap(rhs);
+    }
+
+#endif //ROARINGBITMAP_H
@@ -133,7 +133,7 @@ template<typename TYPE, typename ALLOC>
 auto original::serial<TYPE, ALLOC>::indexOutOfBound(const integer index) const -> bool
 {
     integer parsed_index = this->parseNegIndex(index);
-    return parsed_index < 0 || parsed_index >= this->size();
+    return parsed_index < 0 || parsed_index >= static_cast<integer>(this->size());
 }
 
 template<typename TYPE, typename ALLOC>
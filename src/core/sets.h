@@ -5,21 +5,26 @@
 #include "couple.h"
 #include "hash.h"
 #include "hashTable.h"
+#include "openHashTable.h"
 #include "set.h"
 #include "ownerPtr.h"
 #include "comparator.h"
 #include "RBTree.h"
+#include "bTree.h"
 #include "skipList.h"
+#include "rangeView.h"
+#include "sortedMerge.h"
 
 
 /**
  * @file sets.h
  * @brief Implementation of set containers with different underlying data structures
- * @details Provides three set implementations with different performance characteristics
+ * @details Provides four set implementations with different performance characteristics
  * and iteration capabilities:
  * 1. hashSet - Hash table based implementation (unordered, fastest average case)
  * 2. treeSet - Red-Black Tree based implementation (ordered, consistent performance)
- * 3. JSet - Skip List based implementation (ordered, probabilistic balance)
+ * 3. bTreeSet - B+ tree based implementation (ordered, cache-friendly)
+ * 4. JSet - Skip List based implementation (ordered, probabilistic balance)
  *
  * Common Features:
  * - Unique element storage (no duplicates)
@@ -30,21 +35,35 @@
  * - Polymorphic usage through set interface
  * - Integration with printable for string representation
  *
+ * Ordered containers (all except hashSet) also provide lowerBound(), upperBound(),
+ * floor() and ceiling() in O(log n), a lazy range(low, high) view and eraseRange(low, high).
+ * treeSet and JSet can be built from sorted elements in O(n) with fromSorted(), merge()
+ * another set of their type in O(n + m), and all three of hashSet, treeSet and JSet offer
+ * unite(), intersect() and difference() producing new sets.
+ *
  * Performance Characteristics:
  * | Container | Insertion    | Lookup   | Deletion | Ordered | Memory Usage |
  * |-----------|--------------|----------|----------|---------|--------------|
  * | hashSet   | O(1) avg     | O(1)     | O(1)     | No      | Medium-High  |
  * | treeSet   | O(log n)     | O(log n) | O(log n) | Yes     | Low          |
+ * | bTreeSet  | O(log n)     | O(log n) | O(log n) | Yes     | Medium       |
  * | JSet      | O(log n) avg | O(log n) | O(log n) | Yes     | Medium       |
  *
  * Usage Guidelines:
  * - Use hashSet for maximum performance when order doesn't matter and elements are hashable
  * - Use treeSet for ordered traversal, range queries, and consistent worst-case performance
+ * - Use bTreeSet instead of treeSet for large sets of small elements, where lookups and scans are cache-bound
  * - Use JSet for concurrent scenarios (external synchronization) or when probabilistic balance is preferred
  *
  * Iterator Invalidation:
  * - hashSet: Iterators invalidate on rehash (insertion that causes capacity change)
+ *   With the incrementalHashTable engine a rehash is spread over the following
+ *   insertions, and each of them invalidates iterators until it completes; removals
+ *   never invalidate iterators to other elements.
+ *   With the openHashTable engine every insertion or removal invalidates iterators.
+ *   Lookups and value updates never invalidate iterators.
  * - treeSet: Iterators invalidate on element removal that affects the current position
+ * - bTreeSet: Iterators invalidate on any insertion or removal in the same or a neighbouring leaf
  * - JSet: Iterators invalidate on any structural modification
  *
  * Exception Safety:
@@ -55,6 +74,7 @@
  * @see set.h For the base interface definition
  * @see hashTable.h For hashSet implementation details
  * @see RBTree.h For treeSet implementation details
+ * @see bTree.h For bTreeSet implementation details
  * @see skipList.h For JSet implementation details
  * @see printable.h For string formatting support
  */
@@ -65,13 +85,21 @@ namespace original {
      * @tparam TYPE Element type (must be hashable)
      * @tparam HASH Hash function type (default: hash<TYPE>)
      * @tparam ALLOC Allocator type (default: allocator<couple<const TYPE, const bool>>)
+     * @tparam TABLE Hash table engine (default: hashTable)
      * @brief Hash table based implementation of the set interface
      * @details This class provides a concrete implementation of the set interface
-     * using a hash table with separate chaining. It combines the functionality of:
+     * using a hash table engine. It combines the functionality of:
      * - set (interface)
-     * - hashTable (storage with bool values)
+     * - TABLE (storage with bool values)
      * - iterable (iteration support)
      *
+     * Available engines:
+     * - hashTable: separate chaining, element addresses stay stable until removal
+     * - openHashTable: Robin Hood open addressing with inline slots, faster lookups
+     *   but every insertion or removal invalidates iterators and references
+     * - incrementalHashTable: separate chaining that migrates a resize a few buckets
+     *   per insertion or removal instead of all at once, bounding the worst-case latency
+     *
      * Performance Characteristics:
      * - Insertion: Average O(1), Worst O(n)
      * - Lookup: Average O(1), Worst O(n)
@@ -85,23 +113,18 @@ namespace original {
      */
     template <typename TYPE,
               typename HASH = hash<TYPE>,
-              typename ALLOC = allocator<couple<const TYPE, const bool>>>
-    class hashSet final : public hashTable<TYPE, const bool, ALLOC, HASH>,
+              typename ALLOC = allocator<couple<const TYPE, const bool>>,
+              template <typename, typename, typename, typename> typename TABLE = hashTable>
+    class hashSet final : public TABLE<TYPE, const bool, ALLOC, HASH>,
                           public set<TYPE, ALLOC>,
                           public iterable<const TYPE>,
                           public printable{
 
         /**
-         * @typedef hashNode
-         * @brief Internal node type used for hash table storage
-         */
-        using hashNode = hashTable<TYPE, const bool, ALLOC, HASH>::hashNode;
-
-        /**
-         * @typedef rebind_alloc_pointer
-         * @brief Rebound allocator type for pointer storage
+         * @typedef table_type
+         * @brief Hash table engine used for storage
          */
-        using rebind_alloc_pointer = hashTable<TYPE, const bool, ALLOC, HASH>::rebind_alloc_pointer;
+        using table_type = TABLE<TYPE, const bool, ALLOC, HASH>;
 
     public:
         /**
@@ -117,18 +140,15 @@ namespace original {
          * - Invalidates on rehash
          * - Lightweight copy semantics
          */
-        class Iterator final : public hashTable<TYPE, const bool, ALLOC, HASH>::Iterator,
+        class Iterator final : public table_type::Iterator,
                              public baseIterator<const TYPE> {
 
             /**
-             * @brief Constructs iterator pointing to specific bucket/node
-             * @param buckets Pointer to buckets vector
-             * @param bucket Current bucket index
-             * @param node Current node pointer
+             * @brief Constructs iterator from a position of the table engine
+             * @param it Engine iterator to wrap
              * @note Internal constructor, not meant for direct use
              */
-            explicit Iterator(vector<hashNode*, rebind_alloc_pointer>* buckets = nullptr,
-                              u_integer bucket = 0, hashNode* node = nullptr);
+            explicit Iterator(const typename table_type::Iterator& it);
 
             /**
              * @brief Compares iterator pointers for equality
@@ -341,6 +361,30 @@ namespace original {
          */
         bool remove(const TYPE &e) override;
 
+        /**
+         * @brief Union of two sets
+         * @param other Set to unite with
+         * @return New set with the elements of either set
+         * @details Copies this set and adds the elements of other, O(n + m) on average
+         * @note Named unite since union is a keyword
+         */
+        hashSet unite(const hashSet& other) const;
+
+        /**
+         * @brief Intersection of two sets
+         * @param other Set to intersect with
+         * @return New set with the elements of both sets
+         * @details Probes the larger set with the elements of the smaller one, O(min(n, m)) on average
+         */
+        hashSet intersect(const hashSet& other) const;
+
+        /**
+         * @brief Difference of two sets
+         * @param other Set whose elements are excluded
+         * @return New set with the elements of this set missing from other, O(n) on average
+         */
+        hashSet difference(const hashSet& other) const;
+
         /**
          * @brief Gets begin iterator
          * @return New iterator at first element
@@ -374,6 +418,8 @@ namespace original {
      * @tparam TYPE Element type (must be comparable)
      * @tparam Compare Comparison function type (default: increaseComparator<TYPE>)
      * @tparam ALLOC Allocator type (default: allocator<couple<const TYPE, const bool>>)
+     * @tparam AUGMENT Node augmentation policy (default: noOrderStatistic); orderStatistic
+     * enables select(), rank() and O(log n) iterator jumps and distances
      * @brief Red-Black Tree based implementation of the set interface
      * @details This class provides a concrete implementation of the set interface
      * using a Red-Black Tree. It combines the functionality of:
@@ -396,18 +442,27 @@ namespace original {
      */
     template <typename TYPE,
               typename Compare = increaseComparator<TYPE>,
-              typename ALLOC = allocator<couple<const TYPE, const bool>>>
-    class treeSet final : public RBTree<TYPE, const bool, ALLOC, Compare>,
+              typename ALLOC = allocator<couple<const TYPE, const bool>>,
+              typename AUGMENT = noOrderStatistic>
+    class treeSet final : public RBTree<TYPE, const bool, ALLOC, Compare, AUGMENT>,
                           public set<TYPE, ALLOC>,
                           public iterable<const TYPE>,
                           public printable {
-        using RBTreeType = RBTree<TYPE, const bool, ALLOC, Compare>;
+        using RBTreeType = RBTree<TYPE, const bool, ALLOC, Compare, AUGMENT>;
 
         /**
          * @typedef RBNode
          * @brief Internal node type used for Red-Black Tree storage
          */
         using RBNode = RBTreeType::RBNode;
+
+        /**
+         * @brief Combines this set with another one into a new set
+         * @param other Set to combine with
+         * @param rule Elements to keep
+         * @return New set built in O(n + m) from a merged walk of both sets
+         */
+        treeSet combine(const treeSet& other, mergeRule rule) const;
     public:
         /**
          * @class Iterator
@@ -481,7 +536,10 @@ namespace original {
             void operator-=(integer steps) const override;
 
             /**
-             * @brief Not supported (throws unSupportedMethodError)
+             * @brief Distance between iterators
+             * @param other Iterator to compare with
+             * @return Number of steps from other to this, in O(log n)
+             * @throw unSupportedMethodError unless AUGMENT is orderStatistic
              */
             integer operator-(const iterator<const TYPE> &other) const override;
 
@@ -648,6 +706,124 @@ namespace original {
          */
         bool remove(const TYPE &e) override;
 
+        /**
+         * @typedef rangeType
+         * @brief Lazy view type returned by range()
+         */
+        using rangeType = rangeView<const TYPE, TYPE, Iterator, Compare>;
+
+        /**
+         * @brief Finds the first element that is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator lowerBound(const TYPE& k) const;
+
+        /**
+         * @brief Finds the first element that is greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator upperBound(const TYPE& k) const;
+
+        /**
+         * @brief Finds the last element that is not greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator floor(const TYPE& k) const;
+
+        /**
+         * @brief Finds the first element that is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note Same position as lowerBound, O(log n)
+         */
+        Iterator ceiling(const TYPE& k) const;
+
+        /**
+         * @brief Gets a lazy view of the elements with elements in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return View iterating the range in order
+         * @details Creating the view costs two O(log n) searches, and iterating it
+         * visits only the elements in range. The view is empty if high is not
+         * greater than low.
+         */
+        rangeType range(const TYPE& low, const TYPE& high) const;
+
+        /**
+         * @brief Removes all elements with elements in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return Number of removed elements
+         */
+        u_integer eraseRange(const TYPE& low, const TYPE& high);
+
+        /**
+         * @brief Builds a treeSet from sorted elements in O(n)
+         * @tparam ELEM Element type of the input iterators
+         * @param begin Iterator at the first element
+         * @param end Iterator at the last element (inclusive, as in algorithms)
+         * @param comp Comparison function, under which the keys must be strictly increasing
+         * @param alloc Allocator to use
+         * @return treeSet holding the elements in a perfectly balanced red-black tree
+         * @throw valueError if the keys are not strictly increasing
+         * @details Reads the input twice, once to count and check it and once to build,
+         * without any search, rotation or per-element rebalancing.
+         */
+        template<typename ELEM>
+        static treeSet fromSorted(const iterator<ELEM>& begin, const iterator<ELEM>& end,
+                                  Compare comp = Compare{}, ALLOC alloc = ALLOC{});
+
+        /**
+         * @brief Adds the elements of another set
+         * @param other treeSet to merge from, left unchanged
+         * @details O(n + m), see RBTree::mergeFrom.
+         */
+        void merge(const treeSet& other);
+
+        /**
+         * @brief Union of two sets
+         * @param other Set to unite with
+         * @return New set with the elements of either set, built in O(n + m)
+         * @note Named unite since union is a keyword
+         */
+        treeSet unite(const treeSet& other) const;
+
+        /**
+         * @brief Intersection of two sets
+         * @param other Set to intersect with
+         * @return New set with the elements of both sets, built in O(n + m)
+         */
+        treeSet intersect(const treeSet& other) const;
+
+        /**
+         * @brief Difference of two sets
+         * @param other Set whose elements are excluded
+         * @return New set with the elements of this set missing from other, built in O(n + m)
+         */
+        treeSet difference(const treeSet& other) const;
+
+        /**
+         * @brief Finds the element at an in-order position
+         * @param index Zero-based position, 0 being the smallest key
+         * @return Iterator at the element, invalid if index is not less than size()
+         * @note Requires orderStatistic, O(log n)
+         */
+        Iterator select(u_integer index) const requires AUGMENT::SUBTREE_SIZE;
+
+        /**
+         * @brief Counts the elements less than a key
+         * @param k Key to rank, need not be present
+         * @return Number of elements less than k, which is the position of k if present
+         * @note Requires orderStatistic, O(log n)
+         */
+        u_integer rank(const TYPE& k) const requires AUGMENT::SUBTREE_SIZE;
+
         /**
          * @brief Gets begin iterator
          * @return New iterator at first element (minimum element)
@@ -680,23 +856,27 @@ namespace original {
         ~treeSet() override;
     };
 
-
     /**
-     * @class JSet
+     * @class bTreeSet
      * @tparam TYPE Element type (must be comparable)
      * @tparam Compare Comparison function type (default: increaseComparator<TYPE>)
      * @tparam ALLOC Allocator type (default: allocator<couple<const TYPE, const bool>>)
-     * @brief Skip List based implementation of the set interface
+     * @brief B+ tree based implementation of the set interface
      * @details This class provides a concrete implementation of the set interface
-     * using a probabilistic skip list. It combines the functionality of:
+     * using a B+ tree with cache-line sized nodes. It combines the functionality of:
      * - set (interface)
-     * - skipList (storage with bool values)
+     * - bTree (storage with bool values)
      * - iterable (iteration support)
      *
      * Performance Characteristics:
-     * - Insertion: Average O(log n), Worst O(n)
-     * - Lookup: Average O(log n), Worst O(n)
-     * - Deletion: Average O(log n), Worst O(n)
+     * - Insertion: O(log n)
+     * - Lookup: O(log n)
+     * - Deletion: O(log n)
+     * - Traversal: O(n), walking linked leaves
+     *
+     * A drop-in alternative to treeSet whose nodes keep many elements in contiguous
+     * arrays, so lookups and scans touch far fewer cache lines. Insertion and removal
+     * move elements within a node, so they invalidate iterators into the affected leaves.
      *
      * The implementation guarantees:
      * - Elements sorted according to comparator
@@ -706,36 +886,44 @@ namespace original {
      * - Iterator validity unless modified
      */
     template <typename TYPE,
-            typename Compare = increaseComparator<TYPE>,
-            typename ALLOC = allocator<couple<const TYPE, const bool>>>
-    class JSet final : public skipList<const TYPE, const bool, ALLOC, Compare>,
-                       public set<TYPE, ALLOC>,
-                       public iterable<const TYPE>,
-                       public printable {
-        using skipListType = skipList<const TYPE, const bool, ALLOC, Compare>;
+              typename Compare = increaseComparator<TYPE>,
+              typename ALLOC = allocator<couple<const TYPE, const bool>>>
+    class bTreeSet final : public bTree<TYPE, const bool, ALLOC, Compare>,
+                           public set<TYPE, ALLOC>,
+                           public iterable<const TYPE>,
+                           public printable {
+        using bTreeType = bTree<TYPE, const bool, ALLOC, Compare>;
 
         /**
-         * @typedef skipListNode
-         * @brief Internal node type used for Skip List storage
+         * @typedef leafNode
+         * @brief Leaf node type used for B+ tree storage
          */
-        using skipListNode = skipListType::skipListNode;
-
+        using leafNode = bTreeType::leafNode;
     public:
         /**
          * @class Iterator
-         * @brief Forward iterator for JSet
-         * @details Provides iteration over JSet elements while maintaining:
+         * @brief Bidirectional iterator for bTreeSet
+         * @details Provides iteration over bTreeSet elements while maintaining:
          * - Sorted traversal order (according to comparator)
          * - Safe invalidation detection
          * - Const-correct access
          *
          * Iterator Characteristics:
-         * - Forward iteration only (throws on reverse operations)
-         * - Invalidates on container modification
+         * - Both forward and backward iteration
+         * - Invalidates on tree modification
          * - Lightweight copy semantics
          */
-        class Iterator final : public skipListType::Iterator,
-                               public baseIterator<const TYPE> {
+        class Iterator final : public bTreeType::Iterator,
+                               public baseIterator<const TYPE>
+        {
+            /**
+             * @brief Constructs iterator pointing to specific leaf slot
+             * @param tree Pointer to owning tree
+             * @param leaf Current leaf pointer
+             * @param index Slot in the leaf
+             * @note Internal constructor, not meant for direct use
+             */
+            explicit Iterator(bTreeType* tree, leafNode* leaf, u_integer index);
 
             /**
              * @brief Compares iterator pointers for equality
@@ -744,16 +932,8 @@ namespace original {
              * @internal
              */
             bool equalPtr(const iterator<const TYPE>* other) const override;
-
         public:
-            friend class JSet;
-
-            /**
-             * @brief Constructs iterator pointing to specific skip list node
-             * @param cur Current node pointer
-             * @note Internal constructor, not meant for direct use
-             */
-            explicit Iterator(skipListNode* cur);
+            friend class bTreeSet;
 
             /**
              * @brief Copy constructor
@@ -776,7 +956,7 @@ namespace original {
 
             /**
              * @brief Gets iterator class name
-             * @return "JSet::Iterator"
+             * @return "bTreeSet::Iterator"
              */
             [[nodiscard]] std::string className() const override;
 
@@ -787,17 +967,15 @@ namespace original {
             void operator+=(integer steps) const override;
 
             /**
-             * @brief Not supported (throws unSupportedMethodError)
+             * @brief Rewinds iterator by steps
+             * @param steps Number of positions to rewind
              */
             void operator-=(integer steps) const override;
 
             /**
-             * @brief Calculates distance between iterators
-             * @param other Iterator to calculate distance to
-             * @return Distance between iterators
-             * @note Returns max/min integer values if iterators are not compatible
+             * @brief Not supported (throws unSupportedMethodError)
              */
-            integer operator-(const iterator<const TYPE>& other) const override;
+            integer operator-(const iterator<const TYPE> &other) const override;
 
             /**
              * @brief Checks if more elements exist in forward direction
@@ -806,7 +984,8 @@ namespace original {
             [[nodiscard]] bool hasNext() const override;
 
             /**
-             * @brief Not supported (throws unSupportedMethodError)
+             * @brief Checks if more elements exist in backward direction
+             * @return true if more elements available
              */
             [[nodiscard]] bool hasPrev() const override;
 
@@ -830,12 +1009,13 @@ namespace original {
             void next() const override;
 
             /**
-             * @brief Not supported (throws unSupportedMethodError)
+             * @brief Moves to previous element
              */
             void prev() const override;
 
             /**
-             * @brief Not supported (throws unSupportedMethodError)
+             * @brief Gets previous iterator
+             * @return New iterator at previous position
              */
             Iterator* getPrev() const override;
 
@@ -852,7 +1032,8 @@ namespace original {
             const TYPE get() const override;
 
             /**
-             * @brief Not supported (throws unSupportedMethodError)
+             * @brief Not supported
+             * @throw unSupportedMethodError
              */
             void set(const TYPE& data) override;
 
@@ -868,53 +1049,53 @@ namespace original {
         friend class Iterator;
 
         /**
-         * @brief Constructs empty JSet
+         * @brief Constructs empty bTreeSet
          * @param comp Comparison function to use
          * @param alloc Allocator to use
          */
-        explicit JSet(Compare comp = Compare{}, ALLOC alloc = ALLOC{});
+        explicit bTreeSet(Compare comp = Compare{}, ALLOC alloc = ALLOC{});
 
         /**
          * @brief Copy constructor
-         * @param other JSet to copy
-         * @details Performs deep copy of all elements and skip list structure
+         * @param other bTreeSet to copy
+         * @details Performs deep copy of all elements and tree structure
          * @note Allocator is copied if propagate_on_container_copy_assignment is true
          */
-        JSet(const JSet& other);
+        bTreeSet(const bTreeSet& other);
 
         /**
          * @brief Copy assignment operator
-         * @param other JSet to copy
-         * @return Reference to this JSet
-         * @details Performs deep copy of all elements and skip list structure
+         * @param other bTreeSet to copy
+         * @return Reference to this bTreeSet
+         * @details Performs deep copy of all elements and tree structure
          * @note Allocator is copied if propagate_on_container_copy_assignment is true
          */
-        JSet& operator=(const JSet& other);
+        bTreeSet& operator=(const bTreeSet& other);
 
         /**
          * @brief Move constructor
-         * @param other JSet to move from
+         * @param other bTreeSet to move from
          * @details Transfers ownership of resources from other
          * @note Leaves other in valid but unspecified state
          */
-        JSet(JSet&& other) noexcept;
+        bTreeSet(bTreeSet&& other) noexcept;
 
         /**
          * @brief Move assignment operator
-         * @param other JSet to move from
-         * @return Reference to this JSet
+         * @param other bTreeSet to move from
+         * @return Reference to this bTreeSet
          * @details Transfers ownership of resources from other
          * @note Leaves other in valid but unspecified state
          * @note Allocator is moved if propagate_on_container_move_assignment is true
          */
-        JSet& operator=(JSet&& other) noexcept;
+        bTreeSet& operator=(bTreeSet&& other) noexcept;
 
         /**
-         * @brief Swaps contents with another JSet
-         * @param other JSet to swap with
+         * @brief Swaps contents with another bTreeSet
+         * @param other bTreeSet to swap with
          * @note No-throw guarantee if element swap and allocator swap are noexcept
          * @details Efficiently exchanges:
-         * - Head nodes of the skip lists
+         * - Root nodes of the B+ trees
          * - Size counters
          * - Comparison function instances
          * - Allocators (if propagate_on_container_swap is true)
@@ -924,13 +1105,13 @@ namespace original {
          *
          * Example usage:
          * @code{.cpp}
-         * JSet<int> set1, set2;
+         * bTreeSet<int> set1, set2;
          * set1.add(1); set2.add(2);
          * set1.swap(set2);
          * // Now set1 contains 2, set2 contains 1
          * @endcode
          */
-        void swap(JSet& other) noexcept;
+        void swap(bTreeSet& other) noexcept;
 
         /**
          * @brief Gets number of elements
@@ -956,27 +1137,81 @@ namespace original {
          * @brief Removes element
          * @param e Element to remove
          * @return true if removed, false if element didn't exist
-         * @note Average O(log n), worst case O(n) time complexity
          */
         bool remove(const TYPE &e) override;
 
+        /**
+         * @typedef rangeType
+         * @brief Lazy view type returned by range()
+         */
+        using rangeType = rangeView<const TYPE, TYPE, Iterator, Compare>;
+
+        /**
+         * @brief Finds the first element that is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator lowerBound(const TYPE& k) const;
+
+        /**
+         * @brief Finds the first element that is greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator upperBound(const TYPE& k) const;
+
+        /**
+         * @brief Finds the last element that is not greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator floor(const TYPE& k) const;
+
+        /**
+         * @brief Finds the first element that is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note Same position as lowerBound, O(log n)
+         */
+        Iterator ceiling(const TYPE& k) const;
+
+        /**
+         * @brief Gets a lazy view of the elements with elements in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return View iterating the range in order
+         * @details Creating the view costs two O(log n) searches, and iterating it
+         * visits only the elements in range. The view is empty if high is not
+         * greater than low.
+         */
+        rangeType range(const TYPE& low, const TYPE& high) const;
+
+        /**
+         * @brief Removes all elements with elements in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return Number of removed elements
+         */
+        u_integer eraseRange(const TYPE& low, const TYPE& high);
+
         /**
          * @brief Gets begin iterator
          * @return New iterator at first element (minimum element)
-         * @note O(log n) time complexity to find first element
          */
         Iterator* begins() const override;
 
         /**
          * @brief Gets end iterator
          * @return New iterator at last element (maximum element)
-         * @note O(log n) time complexity to find last element
          */
         Iterator* ends() const override;
 
         /**
          * @brief Gets class name
-         * @return "JSet"
+         * @return "bTreeSet"
          */
         [[nodiscard]] std::string className() const override;
 
@@ -984,70 +1219,512 @@ namespace original {
          * @brief Converts to string representation
          * @param enter Add newline if true
          * @return String representation of elements
-         * @note O(n) time complexity
          */
         [[nodiscard]] std::string toString(bool enter) const override;
 
         /**
          * @brief Destructor
-         * @details Cleans up all skip list nodes and allocated memory
-         * @note O(n) time complexity
+         * @details Cleans up all tree nodes and allocated memory
          */
-        ~JSet() override;
+        ~bTreeSet() override;
     };
-}
 
-namespace std {
-    /**
-     * @brief std::swap specialization for hashSet
-     * @tparam TYPE Element type
-     * @tparam HASH Hash function type
-     * @tparam ALLOC Allocator type
-     * @param lhs First hashSet to swap
-     * @param rhs Second hashSet to swap
-     * @note No-throw guarantee if hashSet::swap is noexcept
-     * @details Enables ADL-friendly swapping for use with standard algorithms
-     * and containers. Delegates to hashSet::swap for actual implementation.
-     *
-     * Example usage with standard algorithms:
-     * @code{.cpp}
-     * hashSet<int> set1, set2;
-     * std::swap(set1, set2);  // Uses this specialization
-     * std::sort(/* ... * /, [](auto& a, auto& b) {
-     *     std::swap(a, b);    // Also uses this specialization
-     * });
-     * @endcode
-     */
-    template <typename TYPE, typename HASH, typename ALLOC>
-    void swap(original::hashSet<TYPE, HASH, ALLOC>& lhs, // NOLINT
-              original::hashSet<TYPE, HASH, ALLOC>& rhs) noexcept;
 
     /**
-     * @brief std::swap specialization for treeSet
-     * @tparam TYPE Element type
-     * @tparam COMPARE Comparison function type
-     * @tparam ALLOC Allocator type
-     * @param lhs First treeSet to swap
-     * @param rhs Second treeSet to swap
-     * @note No-throw guarantee if treeSet::swap is noexcept
-     * @details Enables ADL-friendly swapping for use with standard algorithms
-     * and containers. Delegates to treeSet::swap for actual implementation.
+     * @class JSet
+     * @tparam TYPE Element type (must be comparable)
+     * @tparam Compare Comparison function type (default: increaseComparator<TYPE>)
+     * @tparam ALLOC Allocator type (default: allocator<couple<const TYPE, const bool>>)
+     * @brief Skip List based implementation of the set interface
+     * @details This class provides a concrete implementation of the set interface
+     * using a probabilistic skip list. It combines the functionality of:
+     * - set (interface)
+     * - skipList (storage with bool values)
+     * - iterable (iteration support)
      *
-     * Example usage with standard algorithms:
-     * @code{.cpp}
-     * treeSet<int> set1, set2;
-     * std::swap(set1, set2);  // Uses this specialization
-     * std::sort(/* ... * /, [](auto& a, auto& b) {
-     *     std::swap(a, b);    // Also uses this specialization
-     * });
-     * @endcode
+     * Performance Characteristics:
+     * - Insertion: Average O(log n), Worst O(n)
+     * - Lookup: Average O(log n), Worst O(n)
+     * - Deletion: Average O(log n), Worst O(n)
+     *
+     * The implementation guarantees:
+     * - Elements sorted according to comparator
+     * - Unique elements (no duplicates)
+     * - Type safety
+     * - Exception safety (basic guarantee)
+     * - Iterator validity unless modified
      */
-    template <typename TYPE, typename COMPARE, typename ALLOC>
-    void swap(original::treeSet<TYPE, COMPARE, ALLOC>& lhs, // NOLINT
-              original::treeSet<TYPE, COMPARE, ALLOC>& rhs) noexcept;
+    template <typename TYPE,
+            typename Compare = increaseComparator<TYPE>,
+            typename ALLOC = allocator<couple<const TYPE, const bool>>>
+    class JSet final : public skipList<const TYPE, const bool, ALLOC, Compare>,
+                       public set<TYPE, ALLOC>,
+                       public iterable<const TYPE>,
+                       public printable {
+        using skipListType = skipList<const TYPE, const bool, ALLOC, Compare>;
 
-    /**
-     * @brief std::swap specialization for JSet
+        /**
+         * @typedef skipListNode
+         * @brief Internal node type used for Skip List storage
+         */
+        using skipListNode = skipListType::skipListNode;
+
+
+        /**
+         * @brief Combines this set with another one into a new set
+         * @param other Set to combine with
+         * @param rule Elements to keep
+         * @return New set built in O(n + m) from a merged walk of both sets
+         */
+        JSet combine(const JSet& other, mergeRule rule) const;
+    public:
+        /**
+         * @class Iterator
+         * @brief Forward iterator for JSet
+         * @details Provides iteration over JSet elements while maintaining:
+         * - Sorted traversal order (according to comparator)
+         * - Safe invalidation detection
+         * - Const-correct access
+         *
+         * Iterator Characteristics:
+         * - Forward iteration only (throws on reverse operations)
+         * - Invalidates on container modification
+         * - Lightweight copy semantics
+         */
+        class Iterator final : public skipListType::Iterator,
+                               public baseIterator<const TYPE> {
+
+            /**
+             * @brief Compares iterator pointers for equality
+             * @param other Iterator to compare with
+             * @return true if iterators point to same element
+             * @internal
+             */
+            bool equalPtr(const iterator<const TYPE>* other) const override;
+
+        public:
+            friend class JSet;
+
+            /**
+             * @brief Constructs iterator pointing to specific skip list node
+             * @param cur Current node pointer
+             * @note Internal constructor, not meant for direct use
+             */
+            explicit Iterator(skipListNode* cur);
+
+            /**
+             * @brief Copy constructor
+             * @param other Iterator to copy
+             */
+            Iterator(const Iterator& other);
+
+            /**
+             * @brief Copy assignment operator
+             * @param other Iterator to copy
+             * @return Reference to this iterator
+             */
+            Iterator& operator=(const Iterator& other);
+
+            /**
+             * @brief Creates a copy of this iterator
+             * @return New iterator instance
+             */
+            Iterator* clone() const override;
+
+            /**
+             * @brief Gets iterator class name
+             * @return "JSet::Iterator"
+             */
+            [[nodiscard]] std::string className() const override;
+
+            /**
+             * @brief Advances iterator by steps
+             * @param steps Number of positions to advance
+             */
+            void operator+=(integer steps) const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            void operator-=(integer steps) const override;
+
+            /**
+             * @brief Calculates distance between iterators
+             * @param other Iterator to calculate distance to
+             * @return Distance between iterators
+             * @note Returns max/min integer values if iterators are not compatible
+             */
+            integer operator-(const iterator<const TYPE>& other) const override;
+
+            /**
+             * @brief Checks if more elements exist in forward direction
+             * @return true if more elements available
+             */
+            [[nodiscard]] bool hasNext() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            [[nodiscard]] bool hasPrev() const override;
+
+            /**
+             * @brief Checks if other is previous to this
+             * @param other Iterator to check
+             * @return true if other is previous
+             */
+            bool atPrev(const iterator<const TYPE>* other) const override;
+
+            /**
+             * @brief Checks if other is next to this
+             * @param other Iterator to check
+             * @return true if other is next
+             */
+            bool atNext(const iterator<const TYPE>* other) const override;
+
+            /**
+             * @brief Moves to next element
+             */
+            void next() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            void prev() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            Iterator* getPrev() const override;
+
+            /**
+             * @brief Gets current element (non-const)
+             * @return Reference to current element
+             */
+            const TYPE& get() override;
+
+            /**
+             * @brief Gets current element (const)
+             * @return Copy of current element
+             */
+            const TYPE get() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            void set(const TYPE& data) override;
+
+            /**
+             * @brief Checks if iterator is valid
+             * @return true if iterator points to valid element
+             */
+            [[nodiscard]] bool isValid() const override;
+
+            ~Iterator() override = default;
+        };
+
+        friend class Iterator;
+
+        /**
+         * @brief Constructs empty JSet
+         * @param comp Comparison function to use
+         * @param alloc Allocator to use
+         */
+        explicit JSet(Compare comp = Compare{}, ALLOC alloc = ALLOC{});
+
+        /**
+         * @brief Copy constructor
+         * @param other JSet to copy
+         * @details Performs deep copy of all elements and skip list structure
+         * @note Allocator is copied if propagate_on_container_copy_assignment is true
+         */
+        JSet(const JSet& other);
+
+        /**
+         * @brief Copy assignment operator
+         * @param other JSet to copy
+         * @return Reference to this JSet
+         * @details Performs deep copy of all elements and skip list structure
+         * @note Allocator is copied if propagate_on_container_copy_assignment is true
+         */
+        JSet& operator=(const JSet& other);
+
+        /**
+         * @brief Move constructor
+         * @param other JSet to move from
+         * @details Transfers ownership of resources from other
+         * @note Leaves other in valid but unspecified state
+         */
+        JSet(JSet&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator
+         * @param other JSet to move from
+         * @return Reference to this JSet
+         * @details Transfers ownership of resources from other
+         * @note Leaves other in valid but unspecified state
+         * @note Allocator is moved if propagate_on_container_move_assignment is true
+         */
+        JSet& operator=(JSet&& other) noexcept;
+
+        /**
+         * @brief Swaps contents with another JSet
+         * @param other JSet to swap with
+         * @note No-throw guarantee if element swap and allocator swap are noexcept
+         * @details Efficiently exchanges:
+         * - Head nodes of the skip lists
+         * - Size counters
+         * - Comparison function instances
+         * - Allocators (if propagate_on_container_swap is true)
+         *
+         * Performance: O(1) - pointer swaps only
+         * Iterator Invalidation: All iterators from both sets are invalidated
+         *
+         * Example usage:
+         * @code{.cpp}
+         * JSet<int> set1, set2;
+         * set1.add(1); set2.add(2);
+         * set1.swap(set2);
+         * // Now set1 contains 2, set2 contains 1
+         * @endcode
+         */
+        void swap(JSet& other) noexcept;
+
+        /**
+         * @brief Gets number of elements
+         * @return Current size
+         */
+        [[nodiscard]] u_integer size() const override;
+
+        /**
+         * @brief Checks if element exists
+         * @param e Element to check
+         * @return true if element exists
+         */
+        bool contains(const TYPE &e) const override;
+
+        /**
+         * @brief Adds new element
+         * @param e Element to add
+         * @return true if added, false if element existed
+         */
+        bool add(const TYPE &e) override;
+
+        /**
+         * @brief Removes element
+         * @param e Element to remove
+         * @return true if removed, false if element didn't exist
+         * @note Average O(log n), worst case O(n) time complexity
+         */
+        bool remove(const TYPE &e) override;
+
+        /**
+         * @typedef rangeType
+         * @brief Lazy view type returned by range()
+         */
+        using rangeType = rangeView<const TYPE, TYPE, Iterator, Compare>;
+
+        /**
+         * @brief Finds the first element that is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator lowerBound(const TYPE& k) const;
+
+        /**
+         * @brief Finds the first element that is greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator upperBound(const TYPE& k) const;
+
+        /**
+         * @brief Finds the last element that is not greater than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note O(log n)
+         */
+        Iterator floor(const TYPE& k) const;
+
+        /**
+         * @brief Finds the first element that is not less than k
+         * @param k Key to search for
+         * @return Iterator at the element, invalid if no such element exists
+         * @note Same position as lowerBound, O(log n)
+         */
+        Iterator ceiling(const TYPE& k) const;
+
+        /**
+         * @brief Gets a lazy view of the elements with elements in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return View iterating the range in order
+         * @details Creating the view costs two O(log n) searches, and iterating it
+         * visits only the elements in range. The view is empty if high is not
+         * greater than low.
+         * @note JSet iterators are forward only, so the view is traversed forward only
+         */
+        rangeType range(const TYPE& low, const TYPE& high) const;
+
+        /**
+         * @brief Removes all elements with elements in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return Number of removed elements
+         */
+        u_integer eraseRange(const TYPE& low, const TYPE& high);
+
+        /**
+         * @brief Builds a JSet from sorted elements in O(n)
+         * @tparam ELEM Element type of the input iterators
+         * @param begin Iterator at the first element
+         * @param end Iterator at the last element (inclusive, as in algorithms)
+         * @param comp Comparison function, under which the keys must be strictly increasing
+         * @param alloc Allocator to use
+         * @return JSet holding the elements in a deterministic skip list
+         * @throw valueError if the keys are not strictly increasing
+         * @details Reads the input twice, once to count and check it and once to build,
+         * without any search, random draw or per-element rebalancing.
+         */
+        template<typename ELEM>
+        static JSet fromSorted(const iterator<ELEM>& begin, const iterator<ELEM>& end,
+                               Compare comp = Compare{}, ALLOC alloc = ALLOC{});
+
+        /**
+         * @brief Adds the elements of another set
+         * @param other JSet to merge from, left unchanged
+         * @details O(n + m), see skipList::mergeFrom.
+         */
+        void merge(const JSet& other);
+
+        /**
+         * @brief Union of two sets
+         * @param other Set to unite with
+         * @return New set with the elements of either set, built in O(n + m)
+         * @note Named unite since union is a keyword
+         */
+        JSet unite(const JSet& other) const;
+
+        /**
+         * @brief Intersection of two sets
+         * @param other Set to intersect with
+         * @return New set with the elements of both sets, built in O(n + m)
+         */
+        JSet intersect(const JSet& other) const;
+
+        /**
+         * @brief Difference of two sets
+         * @param other Set whose elements are excluded
+         * @return New set with the elements of this set missing from other, built in O(n + m)
+         */
+        JSet difference(const JSet& other) const;
+
+        /**
+         * @brief Gets begin iterator
+         * @return New iterator at first element (minimum element)
+         * @note O(log n) time complexity to find first element
+         */
+        Iterator* begins() const override;
+
+        /**
+         * @brief Gets end iterator
+         * @return New iterator at last element (maximum element)
+         * @note O(log n) time complexity to find last element
+         */
+        Iterator* ends() const override;
+
+        /**
+         * @brief Gets class name
+         * @return "JSet"
+         */
+        [[nodiscard]] std::string className() const override;
+
+        /**
+         * @brief Converts to string representation
+         * @param enter Add newline if true
+         * @return String representation of elements
+         * @note O(n) time complexity
+         */
+        [[nodiscard]] std::string toString(bool enter) const override;
+
+        /**
+         * @brief Destructor
+         * @details Cleans up all skip list nodes and allocated memory
+         * @note O(n) time complexity
+         */
+        ~JSet() override;
+    };
+}
+
+namespace std {
+    /**
+     * @brief std::swap specialization for hashSet
+     * @tparam TYPE Element type
+     * @tparam HASH Hash function type
+     * @tparam ALLOC Allocator type
+     * @tparam TABLE Hash table engine
+     * @param lhs First hashSet to swap
+     * @param rhs Second hashSet to swap
+     * @note No-throw guarantee if hashSet::swap is noexcept
+     * @details Enables ADL-friendly swapping for use with standard algorithms
+     * and containers. Delegates to hashSet::swap for actual implementation.
+     *
+     * Example usage with standard algorithms:
+     * @code{.cpp}
+     * hashSet<int> set1, set2;
+     * std::swap(set1, set2);  // Uses this specialization
+     * std::sort(/* ... * /, [](auto& a, auto& b) {
+     *     std::swap(a, b);    // Also uses this specialization
+     * });
+     * @endcode
+     */
+    template <typename TYPE, typename HASH, typename ALLOC,
+              template <typename, typename, typename, typename> typename TABLE>
+    void swap(original::hashSet<TYPE, HASH, ALLOC, TABLE>& lhs, // NOLINT
+              original::hashSet<TYPE, HASH, ALLOC, TABLE>& rhs) noexcept;
+
+    /**
+     * @brief std::swap specialization for treeSet
+     * @tparam TYPE Element type
+     * @tparam COMPARE Comparison function type
+     * @tparam ALLOC Allocator type
+     * @param lhs First treeSet to swap
+     * @param rhs Second treeSet to swap
+     * @note No-throw guarantee if treeSet::swap is noexcept
+     * @details Enables ADL-friendly swapping for use with standard algorithms
+     * and containers. Delegates to treeSet::swap for actual implementation.
+     *
+     * Example usage with standard algorithms:
+     * @code{.cpp}
+     * treeSet<int> set1, set2;
+     * std::swap(set1, set2);  // Uses this specialization
+     * std::sort(/* ... * /, [](auto& a, auto& b) {
+     *     std::swap(a, b);    // Also uses this specialization
+     * });
+     * @endcode
+     */
+    template <typename TYPE, typename COMPARE, typename ALLOC, typename AUGMENT>
+    void swap(original::treeSet<TYPE, COMPARE, ALLOC, AUGMENT>& lhs, // NOLINT
+              original::treeSet<TYPE, COMPARE, ALLOC, AUGMENT>& rhs) noexcept;
+
+    /**
+     * @brief std::swap specialization for bTreeSet
+     * @tparam TYPE Element type
+     * @tparam COMPARE Comparison function type
+     * @tparam ALLOC Allocator type
+     * @param lhs First bTreeSet to swap
+     * @param rhs Second bTreeSet to swap
+     * @note No-throw guarantee if bTreeSet::swap is noexcept
+     * @details Enables ADL-friendly swapping for use with standard algorithms
+     * and containers. Delegates to bTreeSet::swap for actual implementation.
+     */
+    template <typename TYPE, typename COMPARE, typename ALLOC>
+    void swap(original::bTreeSet<TYPE, COMPARE, ALLOC>& lhs, // NOLINT
+              original::bTreeSet<TYPE, COMPARE, ALLOC>& rhs) noexcept;
+
+    /**
+     * @brief std::swap specialization for JSet
      * @tparam TYPE Element type
      * @tparam COMPARE Comparison function type
      * @tparam ALLOC Allocator type
@@ -1071,75 +1748,403 @@ namespace std {
               original::JSet<TYPE, COMPARE, ALLOC>& rhs) noexcept;
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::Iterator::Iterator(vector<hashNode*, rebind_alloc_pointer> *buckets,
-u_integer bucket, hashNode *node) : hashTable<TYPE, const bool, ALLOC, HASH>::Iterator(
-    const_cast<vector<hashNode*, rebind_alloc_pointer>*>(buckets), bucket, node) {}
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::Iterator(const typename table_type::Iterator& it)
+    : table_type::Iterator(it) {}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::equalPtr(const iterator<const TYPE> *other) const {
+    auto other_it = dynamic_cast<const Iterator*>(other);
+    return other_it && this->equalTo(*other_it);
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::Iterator(const Iterator &other)
+    : table_type::Iterator(other) {}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator&
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::operator=(const Iterator &other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    table_type::Iterator::operator=(other);
+    return *this;
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator*
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::clone() const {
+    return new Iterator(*this);
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+std::string original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::className() const {
+    return "hashSet::Iterator";
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::operator+=(integer steps) const {
+    table_type::Iterator::operator+=(steps);
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::operator-=(integer) const {
+    throw unSupportedMethodError();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::integer
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::operator-(const iterator<const TYPE>&) const {
+    throw unSupportedMethodError();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::hasNext() const {
+    return table_type::Iterator::hasNext();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::hasPrev() const {
+    throw unSupportedMethodError();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::atPrev(const iterator<const TYPE> *other) const {
+    auto other_it = dynamic_cast<const Iterator*>(other);
+    if (!other_it) {
+        return false;
+    }
+    auto next = ownerPtr(this->clone());
+    if (!next->isValid()){
+        return false;
+    }
+
+    next->next();
+    return next->equalPtr(other_it);
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::atNext(const iterator<const TYPE> *other) const {
+    return other->atPrev(*this);
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::next() const {
+    table_type::Iterator::next();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::prev() const {
+    throw unSupportedMethodError();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator*
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::getPrev() const {
+    throw unSupportedMethodError();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+const TYPE& original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::get() {
+    return table_type::Iterator::get().template get<0>();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+const TYPE original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::get() const {
+    return table_type::Iterator::get().template get<0>();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::set(const TYPE&) {
+    throw unSupportedMethodError();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator::isValid() const {
+    return table_type::Iterator::isValid();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::hashSet(HASH hash, ALLOC alloc)
+    : table_type(std::move(hash)),
+      set<TYPE, ALLOC>(std::move(alloc)) {}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::hashSet(const hashSet &other) : hashSet() {
+    this->operator=(other);
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>&
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::operator=(const hashSet &other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    this->tableCopy(other);
+    if constexpr(ALLOC::propagate_on_container_copy_assignment::value) {
+        this->allocator = other.allocator;
+    }
+    return *this;
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::hashSet(hashSet &&other) noexcept : hashSet() {
+    this->operator=(std::move(other));
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>&
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::operator=(hashSet &&other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+
+    this->tableMove(std::move(other));
+    if constexpr(ALLOC::propagate_on_container_move_assignment::value) {
+        this->allocator = std::move(other.allocator);
+    }
+    return *this;
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void original::hashSet<TYPE, HASH, ALLOC, TABLE>::swap(hashSet& other) noexcept
+{
+    if (this == &other)
+        return;
+
+    this->tableSwap(other);
+    if constexpr (ALLOC::propagate_on_container_swap::value) {
+        std::swap(this->allocator, other.allocator);
+    }
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::u_integer original::hashSet<TYPE, HASH, ALLOC, TABLE>::size() const {
+    return this->size_;
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashSet<TYPE, HASH, ALLOC, TABLE>::contains(const TYPE &e) const {
+    return this->find(e);
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashSet<TYPE, HASH, ALLOC, TABLE>::add(const TYPE &e) {
+    return this->insert(e, true);
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+bool original::hashSet<TYPE, HASH, ALLOC, TABLE>::remove(const TYPE &e) {
+    return this->erase(e);
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::unite(const hashSet& other) const {
+    hashSet result(*this);
+    for (Iterator it(other.firstIterator()); it.isValid(); it.next()) {
+        result.add(it.get());
+    }
+    return result;
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::intersect(const hashSet& other) const {
+    const hashSet& smaller = this->size_ <= other.size_ ? *this : other;
+    const hashSet& larger = this->size_ <= other.size_ ? other : *this;
+    hashSet result(this->hash_, this->allocator);
+    for (Iterator it(smaller.firstIterator()); it.isValid(); it.next()) {
+        const TYPE e = it.get();
+        if (larger.contains(e)) {
+            result.add(e);
+        }
+    }
+    return result;
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::difference(const hashSet& other) const {
+    hashSet result(this->hash_, this->allocator);
+    for (Iterator it(this->firstIterator()); it.isValid(); it.next()) {
+        const TYPE e = it.get();
+        if (!other.contains(e)) {
+            result.add(e);
+        }
+    }
+    return result;
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator*
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::begins() const {
+    return new Iterator(this->firstIterator());
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::Iterator*
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::ends() const {
+    return new Iterator(this->lastIterator());
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+std::string original::hashSet<TYPE, HASH, ALLOC, TABLE>::className() const {
+    return "hashSet";
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+std::string original::hashSet<TYPE, HASH, ALLOC, TABLE>::toString(const bool enter) const {
+    std::stringstream ss;
+    ss << this->className();
+    ss << "(";
+    bool first = true;
+    for (auto it = this->begin(); it != this->end(); it.next()){
+        if (!first){
+            ss << ", ";
+        }
+        ss << printable::formatString(it.get());
+        first = false;
+    }
+    ss << ")";
+    if (enter)
+        ss << "\n";
+    return ss.str();
+}
+
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+original::hashSet<TYPE, HASH, ALLOC, TABLE>::~hashSet() = default;
 
-template<typename TYPE, typename HASH, typename ALLOC>
-bool original::hashSet<TYPE, HASH, ALLOC>::Iterator::equalPtr(const iterator<const TYPE> *other) const {
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::Iterator(RBTreeType* tree, RBNode* cur)
+    : RBTreeType::Iterator(tree, cur)  {}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::equalPtr(const iterator<const TYPE>* other) const
+{
     auto other_it = dynamic_cast<const Iterator*>(other);
     return other_it &&
-           this->p_buckets == other_it->p_buckets &&
-           this->cur_bucket == other_it->cur_bucket &&
-           this->p_node == other_it->p_node;
+           this->tree_ == other_it->tree_ &&
+           this->cur_ == other_it->cur_;
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::Iterator::Iterator(const Iterator &other) : Iterator() {
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::Iterator(const Iterator& other)
+    : Iterator(nullptr, nullptr)
+{
     this->operator=(other);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::Iterator&
-original::hashSet<TYPE, HASH, ALLOC>::Iterator::operator=(const Iterator &other) {
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator&
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::operator=(const Iterator& other)
+{
     if (this == &other) {
         return *this;
     }
 
-    hashTable<TYPE, const bool, ALLOC, HASH>::Iterator::operator=(other);
+    this->tree_ = other.tree_;
+    this->cur_ = other.cur_;
     return *this;
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::Iterator*
-original::hashSet<TYPE, HASH, ALLOC>::Iterator::clone() const {
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator*
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::clone() const
+{
     return new Iterator(*this);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-std::string original::hashSet<TYPE, HASH, ALLOC>::Iterator::className() const {
-    return "hashSet::Iterator";
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+std::string original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::className() const
+{
+    return "treeSet::Iterator";
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-void original::hashSet<TYPE, HASH, ALLOC>::Iterator::operator+=(integer steps) const {
-    hashTable<TYPE, const bool, ALLOC, HASH>::Iterator::operator+=(steps);
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::operator+=(integer steps) const
+{
+    RBTreeType::Iterator::operator+=(steps);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-void original::hashSet<TYPE, HASH, ALLOC>::Iterator::operator-=(integer) const {
-    throw unSupportedMethodError();
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::operator-=(integer steps) const
+{
+    RBTreeType::Iterator::operator-=(steps);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
 original::integer
-original::hashSet<TYPE, HASH, ALLOC>::Iterator::operator-(const iterator<const TYPE>&) const {
-    throw unSupportedMethodError();
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::operator-(const iterator<const TYPE>& other) const
+{
+    if constexpr (!AUGMENT::SUBTREE_SIZE) {
+        throw unSupportedMethodError();
+    } else {
+        auto other_it = dynamic_cast<const Iterator*>(&other);
+        if (other_it == nullptr)
+            return this > &other ?
+                   std::numeric_limits<integer>::max() :
+                   std::numeric_limits<integer>::min();
+        return RBTreeType::Iterator::operator-(*other_it);
+    }
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-bool original::hashSet<TYPE, HASH, ALLOC>::Iterator::hasNext() const {
-    return hashTable<TYPE, const bool, ALLOC, HASH>::Iterator::hasNext();
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::hasNext() const
+{
+    return RBTreeType::Iterator::hasNext();
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-bool original::hashSet<TYPE, HASH, ALLOC>::Iterator::hasPrev() const {
-    throw unSupportedMethodError();
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::hasPrev() const
+{
+    return RBTreeType::Iterator::hasPrev();
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-bool original::hashSet<TYPE, HASH, ALLOC>::Iterator::atPrev(const iterator<const TYPE> *other) const {
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::atPrev(const iterator<const TYPE>* other) const
+{
     auto other_it = dynamic_cast<const Iterator*>(other);
     if (!other_it) {
         return false;
@@ -1153,67 +2158,78 @@ bool original::hashSet<TYPE, HASH, ALLOC>::Iterator::atPrev(const iterator<const
     return next->equalPtr(other_it);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-bool original::hashSet<TYPE, HASH, ALLOC>::Iterator::atNext(const iterator<const TYPE> *other) const {
-    return other->atPrev(*this);
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::atNext(const iterator<const TYPE>* other) const
+{
+    return other->atNext(*this);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-void original::hashSet<TYPE, HASH, ALLOC>::Iterator::next() const {
-    hashTable<TYPE, const bool, ALLOC, HASH>::Iterator::next();
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::next() const
+{
+    RBTreeType::Iterator::next();
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-void original::hashSet<TYPE, HASH, ALLOC>::Iterator::prev() const {
-    throw unSupportedMethodError();
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::prev() const
+{
+    RBTreeType::Iterator::prev();
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::Iterator*
-original::hashSet<TYPE, HASH, ALLOC>::Iterator::getPrev() const {
-    throw unSupportedMethodError();
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator*
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::getPrev() const
+{
+    auto it = this->clone();
+    it->prev();
+    return it;
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-const TYPE& original::hashSet<TYPE, HASH, ALLOC>::Iterator::get() {
-    return hashTable<TYPE, const bool, ALLOC, HASH>::Iterator::get().template get<0>();
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+const TYPE& original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::get()
+{
+    return RBTreeType::Iterator::get().template get<0>();
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-const TYPE original::hashSet<TYPE, HASH, ALLOC>::Iterator::get() const {
-    return hashTable<TYPE, const bool, ALLOC, HASH>::Iterator::get().template get<0>();
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+const TYPE original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::get() const
+{
+    return RBTreeType::Iterator::get().template get<0>();
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-void original::hashSet<TYPE, HASH, ALLOC>::Iterator::set(const TYPE&) {
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::set(const TYPE&)
+{
     throw unSupportedMethodError();
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-bool original::hashSet<TYPE, HASH, ALLOC>::Iterator::isValid() const {
-    return hashTable<TYPE, const bool, ALLOC, HASH>::Iterator::isValid();
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator::isValid() const
+{
+    return RBTreeType::Iterator::isValid();
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::hashSet(HASH hash, ALLOC alloc)
-    : hashTable<TYPE, const bool, ALLOC, HASH>(std::move(hash)),
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::treeSet(Compare comp, ALLOC alloc)
+    : RBTreeType(std::move(comp)),
       set<TYPE, ALLOC>(std::move(alloc)) {}
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::hashSet(const hashSet &other) : hashSet() {
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::treeSet(const treeSet& other) : treeSet() {
     this->operator=(other);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>&
-original::hashSet<TYPE, HASH, ALLOC>::operator=(const hashSet &other) {
-    if (this == &other) {
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>&
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::operator=(const treeSet& other) {
+    if (this == &other){
         return *this;
     }
 
-    this->buckets = this->bucketsCopy(other.buckets);
+    this->destroyTree();
+    this->root_ = other.treeCopy();
     this->size_ = other.size_;
-    this->hash_ = other.hash_;
+    this->compare_ = other.compare_;
     if constexpr(ALLOC::propagate_on_container_copy_assignment::value) {
         this->allocator = other.allocator;
         this->rebind_alloc = other.rebind_alloc;
@@ -1221,22 +2237,24 @@ original::hashSet<TYPE, HASH, ALLOC>::operator=(const hashSet &other) {
     return *this;
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::hashSet(hashSet &&other) noexcept : hashSet() {
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::treeSet(treeSet&& other) noexcept : treeSet() {
     this->operator=(std::move(other));
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>&
-original::hashSet<TYPE, HASH, ALLOC>::operator=(hashSet &&other) noexcept {
-    if (this == &other) {
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>&
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::operator=(treeSet&& other) noexcept {
+    if (this == &other){
         return *this;
     }
 
-    this->buckets = std::move(other.buckets);
+    this->destroyTree();
+    this->root_ = other.root_;
+    other.root_ = nullptr;
     this->size_ = other.size_;
     other.size_ = 0;
-    this->hash_ = std::move(other.hash_);
+    this->compare_ = std::move(other.compare_);
     if constexpr(ALLOC::propagate_on_container_move_assignment::value) {
         this->allocator = std::move(other.allocator);
         this->rebind_alloc = std::move(other.rebind_alloc);
@@ -1244,71 +2262,177 @@ original::hashSet<TYPE, HASH, ALLOC>::operator=(hashSet &&other) noexcept {
     return *this;
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-void original::hashSet<TYPE, HASH, ALLOC>::swap(hashSet& other) noexcept
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::swap(treeSet& other) noexcept
 {
     if (this == &other)
         return;
 
+    std::swap(this->root_, other.root_);
     std::swap(this->size_, other.size_);
-    std::swap(this->buckets, other.buckets);
-    std::swap(this->hash_, other.hash_);
+    std::swap(this->compare_, other.compare_);
     if constexpr (ALLOC::propagate_on_container_swap::value) {
         std::swap(this->allocator, other.allocator);
         std::swap(this->rebind_alloc, other.rebind_alloc);
     }
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::u_integer original::hashSet<TYPE, HASH, ALLOC>::size() const {
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::u_integer original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::size() const {
     return this->size_;
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-bool original::hashSet<TYPE, HASH, ALLOC>::contains(const TYPE &e) const {
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::contains(const TYPE &e) const {
     return this->find(e);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-bool original::hashSet<TYPE, HASH, ALLOC>::add(const TYPE &e) {
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::add(const TYPE &e) {
     return this->insert(e, true);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-bool original::hashSet<TYPE, HASH, ALLOC>::remove(const TYPE &e) {
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+bool original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::remove(const TYPE &e) {
     return this->erase(e);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::Iterator*
-original::hashSet<TYPE, HASH, ALLOC>::begins() const {
-    auto p_buckets = const_cast<vector<hashNode*, rebind_alloc_pointer>*>(&this->buckets);
-    if (this->buckets[0]) {
-        return new Iterator(p_buckets, 0, this->buckets[0]);
-    }
-    auto bucket = Iterator::findNextValidBucket(p_buckets, 0);
-    return new Iterator(p_buckets, bucket, p_buckets->get(bucket));
-}
-
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::Iterator*
-original::hashSet<TYPE, HASH, ALLOC>::ends() const {
-    auto p_buckets = const_cast<vector<hashNode*, rebind_alloc_pointer>*>(&this->buckets);
-    auto bucket = Iterator::findPrevValidBucket(p_buckets, this->buckets.size());
-    auto node = this->buckets[bucket];
-    while (node && node->getPNext()) {
-        node = node->getPNext();
-    }
-    return new Iterator(p_buckets, bucket, node);
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::lowerBound(const TYPE& k) const
+{
+    return Iterator(const_cast<treeSet*>(this), this->ceilingNode(k));
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-std::string original::hashSet<TYPE, HASH, ALLOC>::className() const {
-    return "hashSet";
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::upperBound(const TYPE& k) const
+{
+    return Iterator(const_cast<treeSet*>(this), this->higherNode(k));
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::floor(const TYPE& k) const
+{
+    return Iterator(const_cast<treeSet*>(this), this->floorNode(k));
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::ceiling(const TYPE& k) const
+{
+    return Iterator(const_cast<treeSet*>(this), this->ceilingNode(k));
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::rangeType
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::range(const TYPE& low, const TYPE& high) const
+{
+    return rangeType(this->lowerBound(low), Iterator(const_cast<treeSet*>(this), this->lowerNode(high)), low, high, this->compare_);
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-std::string original::hashSet<TYPE, HASH, ALLOC>::toString(const bool enter) const {
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::u_integer
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::eraseRange(const TYPE& low, const TYPE& high)
+{
+    return RBTreeType::eraseRange(low, high);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+template <typename ELEM>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::fromSorted(const iterator<ELEM>& begin, const iterator<ELEM>& end,
+    Compare comp, ALLOC alloc)
+{
+    treeSet result(std::move(comp), std::move(alloc));
+    sortedRange<ELEM, TYPE, Compare> cursor(begin, end, result.compare_);
+    result.rebuildSorted(cursor.remaining(), [&cursor] {
+        couple<const TYPE, const bool> elem(cursor.get(), true);
+        cursor.next();
+        return elem;
+    });
+    return result;
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+void original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::merge(const treeSet& other)
+{
+    RBTreeType::mergeFrom(other);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::combine(const treeSet& other, const mergeRule rule) const
+{
+    treeSet result(this->compare_, this->allocator);
+    sortedMerge<const TYPE, TYPE, Iterator, Compare> cursor(Iterator(const_cast<treeSet*>(this), this->getMinNode()),
+                                                 Iterator(const_cast<treeSet*>(&other), other.getMinNode()),
+                                                 rule, this->compare_);
+    result.rebuildSorted(cursor.remaining(), [&cursor] {
+        couple<const TYPE, const bool> elem(cursor.get(), true);
+        cursor.next();
+        return elem;
+    });
+    return result;
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::unite(const treeSet& other) const
+{
+    return this->combine(other, mergeRule::UNION);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::intersect(const treeSet& other) const
+{
+    return this->combine(other, mergeRule::INTERSECTION);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::difference(const treeSet& other) const
+{
+    return this->combine(other, mergeRule::DIFFERENCE);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::select(const u_integer index) const requires AUGMENT::SUBTREE_SIZE
+{
+    return Iterator(const_cast<treeSet*>(this), this->selectNode(index));
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::u_integer
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::rank(const TYPE& k) const requires AUGMENT::SUBTREE_SIZE
+{
+    return this->rankOf(k);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator*
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::begins() const
+{
+    return new Iterator(const_cast<treeSet*>(this), this->getMinNode());
+}
+
+template <typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::Iterator*
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::ends() const
+{
+    return new Iterator(const_cast<treeSet*>(this), this->getMaxNode());
+}
+
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+std::string original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::className() const {
+    return "treeSet";
+}
+
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+std::string original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::toString(const bool enter) const {
     std::stringstream ss;
     ss << this->className();
     ss << "(";
@@ -1326,88 +2450,90 @@ std::string original::hashSet<TYPE, HASH, ALLOC>::toString(const bool enter) con
     return ss.str();
 }
 
-template<typename TYPE, typename HASH, typename ALLOC>
-original::hashSet<TYPE, HASH, ALLOC>::~hashSet() = default;
+template<typename TYPE, typename Compare, typename ALLOC, typename AUGMENT>
+original::treeSet<TYPE, Compare, ALLOC, AUGMENT>::~treeSet() = default;
 
 template <typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::Iterator::Iterator(RBTreeType* tree, RBNode* cur)
-    : RBTreeType::Iterator(tree, cur)  {}
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::Iterator(bTreeType* tree, leafNode* leaf, const u_integer index)
+    : bTreeType::Iterator(tree, leaf, index)  {}
 
 template <typename TYPE, typename Compare, typename ALLOC>
-bool original::treeSet<TYPE, Compare, ALLOC>::Iterator::equalPtr(const iterator<const TYPE>* other) const
+bool original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::equalPtr(const iterator<const TYPE>* other) const
 {
     auto other_it = dynamic_cast<const Iterator*>(other);
     return other_it &&
            this->tree_ == other_it->tree_ &&
-           this->cur_ == other_it->cur_;
+           this->leaf_ == other_it->leaf_ &&
+           this->index_ == other_it->index_;
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::Iterator::Iterator(const Iterator& other)
-    : Iterator(nullptr, nullptr)
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::Iterator(const Iterator& other)
+    : Iterator(nullptr, nullptr, 0)
 {
     this->operator=(other);
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::Iterator&
-original::treeSet<TYPE, Compare, ALLOC>::Iterator::operator=(const Iterator& other)
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator&
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::operator=(const Iterator& other)
 {
     if (this == &other) {
         return *this;
     }
 
     this->tree_ = other.tree_;
-    this->cur_ = other.cur_;
+    this->leaf_ = other.leaf_;
+    this->index_ = other.index_;
     return *this;
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::Iterator*
-original::treeSet<TYPE, Compare, ALLOC>::Iterator::clone() const
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator*
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::clone() const
 {
     return new Iterator(*this);
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-std::string original::treeSet<TYPE, Compare, ALLOC>::Iterator::className() const
+std::string original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::className() const
 {
-    return "treeSet::Iterator";
+    return "bTreeSet::Iterator";
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-void original::treeSet<TYPE, Compare, ALLOC>::Iterator::operator+=(integer steps) const
+void original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::operator+=(integer steps) const
 {
-    RBTreeType::Iterator::operator+=(steps);
+    bTreeType::Iterator::operator+=(steps);
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-void original::treeSet<TYPE, Compare, ALLOC>::Iterator::operator-=(integer steps) const
+void original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::operator-=(integer steps) const
 {
-    RBTreeType::Iterator::operator-=(steps);
+    bTreeType::Iterator::operator-=(steps);
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
 original::integer
-original::treeSet<TYPE, Compare, ALLOC>::Iterator::operator-(const iterator<const TYPE>&) const
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::operator-(const iterator<const TYPE>&) const
 {
     throw unSupportedMethodError();
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-bool original::treeSet<TYPE, Compare, ALLOC>::Iterator::hasNext() const
+bool original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::hasNext() const
 {
-    return RBTreeType::Iterator::hasNext();
+    return bTreeType::Iterator::hasNext();
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-bool original::treeSet<TYPE, Compare, ALLOC>::Iterator::hasPrev() const
+bool original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::hasPrev() const
 {
-    return RBTreeType::Iterator::hasPrev();
+    return bTreeType::Iterator::hasPrev();
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-bool original::treeSet<TYPE, Compare, ALLOC>::Iterator::atPrev(const iterator<const TYPE>* other) const
+bool original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::atPrev(const iterator<const TYPE>* other) const
 {
     auto other_it = dynamic_cast<const Iterator*>(other);
     if (!other_it) {
@@ -1423,26 +2549,26 @@ bool original::treeSet<TYPE, Compare, ALLOC>::Iterator::atPrev(const iterator<co
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-bool original::treeSet<TYPE, Compare, ALLOC>::Iterator::atNext(const iterator<const TYPE>* other) const
+bool original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::atNext(const iterator<const TYPE>* other) const
 {
     return other->atNext(*this);
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-void original::treeSet<TYPE, Compare, ALLOC>::Iterator::next() const
+void original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::next() const
 {
-    RBTreeType::Iterator::next();
+    bTreeType::Iterator::next();
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-void original::treeSet<TYPE, Compare, ALLOC>::Iterator::prev() const
+void original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::prev() const
 {
-    RBTreeType::Iterator::prev();
+    bTreeType::Iterator::prev();
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::Iterator*
-original::treeSet<TYPE, Compare, ALLOC>::Iterator::getPrev() const
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator*
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::getPrev() const
 {
     auto it = this->clone();
     it->prev();
@@ -1450,42 +2576,42 @@ original::treeSet<TYPE, Compare, ALLOC>::Iterator::getPrev() const
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-const TYPE& original::treeSet<TYPE, Compare, ALLOC>::Iterator::get()
+const TYPE& original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::get()
 {
-    return RBTreeType::Iterator::get().template get<0>();
+    return bTreeType::Iterator::get().template get<0>();
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-const TYPE original::treeSet<TYPE, Compare, ALLOC>::Iterator::get() const
+const TYPE original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::get() const
 {
-    return RBTreeType::Iterator::get().template get<0>();
+    return bTreeType::Iterator::get().template get<0>();
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-void original::treeSet<TYPE, Compare, ALLOC>::Iterator::set(const TYPE&)
+void original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::set(const TYPE&)
 {
     throw unSupportedMethodError();
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-bool original::treeSet<TYPE, Compare, ALLOC>::Iterator::isValid() const
+bool original::bTreeSet<TYPE, Compare, ALLOC>::Iterator::isValid() const
 {
-    return RBTreeType::Iterator::isValid();
+    return bTreeType::Iterator::isValid();
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::treeSet(Compare comp, ALLOC alloc)
-    : RBTreeType(std::move(comp)),
+original::bTreeSet<TYPE, Compare, ALLOC>::bTreeSet(Compare comp, ALLOC alloc)
+    : bTreeType(std::move(comp)),
       set<TYPE, ALLOC>(std::move(alloc)) {}
 
 template<typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::treeSet(const treeSet& other) : treeSet() {
+original::bTreeSet<TYPE, Compare, ALLOC>::bTreeSet(const bTreeSet& other) : bTreeSet() {
     this->operator=(other);
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>&
-original::treeSet<TYPE, Compare, ALLOC>::operator=(const treeSet& other) {
+original::bTreeSet<TYPE, Compare, ALLOC>&
+original::bTreeSet<TYPE, Compare, ALLOC>::operator=(const bTreeSet& other) {
     if (this == &other){
         return *this;
     }
@@ -1497,18 +2623,19 @@ original::treeSet<TYPE, Compare, ALLOC>::operator=(const treeSet& other) {
     if constexpr(ALLOC::propagate_on_container_copy_assignment::value) {
         this->allocator = other.allocator;
         this->rebind_alloc = other.rebind_alloc;
+        this->rebind_alloc_inner_ = other.rebind_alloc_inner_;
     }
     return *this;
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::treeSet(treeSet&& other) noexcept : treeSet() {
+original::bTreeSet<TYPE, Compare, ALLOC>::bTreeSet(bTreeSet&& other) noexcept : bTreeSet() {
     this->operator=(std::move(other));
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>&
-original::treeSet<TYPE, Compare, ALLOC>::operator=(treeSet&& other) noexcept {
+original::bTreeSet<TYPE, Compare, ALLOC>&
+original::bTreeSet<TYPE, Compare, ALLOC>::operator=(bTreeSet&& other) noexcept {
     if (this == &other){
         return *this;
     }
@@ -1522,12 +2649,13 @@ original::treeSet<TYPE, Compare, ALLOC>::operator=(treeSet&& other) noexcept {
     if constexpr(ALLOC::propagate_on_container_move_assignment::value) {
         this->allocator = std::move(other.allocator);
         this->rebind_alloc = std::move(other.rebind_alloc);
+        this->rebind_alloc_inner_ = std::move(other.rebind_alloc_inner_);
     }
     return *this;
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-void original::treeSet<TYPE, Compare, ALLOC>::swap(treeSet& other) noexcept
+void original::bTreeSet<TYPE, Compare, ALLOC>::swap(bTreeSet& other) noexcept
 {
     if (this == &other)
         return;
@@ -1538,50 +2666,105 @@ void original::treeSet<TYPE, Compare, ALLOC>::swap(treeSet& other) noexcept
     if constexpr (ALLOC::propagate_on_container_swap::value) {
         std::swap(this->allocator, other.allocator);
         std::swap(this->rebind_alloc, other.rebind_alloc);
+        std::swap(this->rebind_alloc_inner_, other.rebind_alloc_inner_);
     }
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-original::u_integer original::treeSet<TYPE, Compare, ALLOC>::size() const {
+original::u_integer original::bTreeSet<TYPE, Compare, ALLOC>::size() const {
     return this->size_;
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-bool original::treeSet<TYPE, Compare, ALLOC>::contains(const TYPE &e) const {
+bool original::bTreeSet<TYPE, Compare, ALLOC>::contains(const TYPE &e) const {
     return this->find(e);
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-bool original::treeSet<TYPE, Compare, ALLOC>::add(const TYPE &e) {
+bool original::bTreeSet<TYPE, Compare, ALLOC>::add(const TYPE &e) {
     return this->insert(e, true);
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-bool original::treeSet<TYPE, Compare, ALLOC>::remove(const TYPE &e) {
+bool original::bTreeSet<TYPE, Compare, ALLOC>::remove(const TYPE &e) {
     return this->erase(e);
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::Iterator*
-original::treeSet<TYPE, Compare, ALLOC>::begins() const
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator
+original::bTreeSet<TYPE, Compare, ALLOC>::lowerBound(const TYPE& k) const
 {
-    return new Iterator(const_cast<treeSet*>(this), this->getMinNode());
+    u_integer index = 0;
+    auto leaf = this->ceilingSlot(k, index);
+    return Iterator(const_cast<bTreeSet*>(this), leaf, index);
 }
 
 template <typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::Iterator*
-original::treeSet<TYPE, Compare, ALLOC>::ends() const
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator
+original::bTreeSet<TYPE, Compare, ALLOC>::upperBound(const TYPE& k) const
 {
-    return new Iterator(const_cast<treeSet*>(this), this->getMaxNode());
+    u_integer index = 0;
+    auto leaf = this->higherSlot(k, index);
+    return Iterator(const_cast<bTreeSet*>(this), leaf, index);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator
+original::bTreeSet<TYPE, Compare, ALLOC>::floor(const TYPE& k) const
+{
+    u_integer index = 0;
+    auto leaf = this->floorSlot(k, index);
+    return Iterator(const_cast<bTreeSet*>(this), leaf, index);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator
+original::bTreeSet<TYPE, Compare, ALLOC>::ceiling(const TYPE& k) const
+{
+    u_integer index = 0;
+    auto leaf = this->ceilingSlot(k, index);
+    return Iterator(const_cast<bTreeSet*>(this), leaf, index);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::bTreeSet<TYPE, Compare, ALLOC>::rangeType
+original::bTreeSet<TYPE, Compare, ALLOC>::range(const TYPE& low, const TYPE& high) const
+{
+    u_integer index = 0;
+    auto leaf = this->lowerSlot(high, index);
+    return rangeType(this->lowerBound(low), Iterator(const_cast<bTreeSet*>(this), leaf, index),
+                     low, high, this->compare_);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::u_integer
+original::bTreeSet<TYPE, Compare, ALLOC>::eraseRange(const TYPE& low, const TYPE& high)
+{
+    return bTreeType::eraseRange(low, high);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator*
+original::bTreeSet<TYPE, Compare, ALLOC>::begins() const
+{
+    return new Iterator(const_cast<bTreeSet*>(this), this->getMinLeaf(), 0);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::bTreeSet<TYPE, Compare, ALLOC>::Iterator*
+original::bTreeSet<TYPE, Compare, ALLOC>::ends() const
+{
+    auto leaf = this->getMaxLeaf();
+    return new Iterator(const_cast<bTreeSet*>(this), leaf, leaf ? leaf->count() - 1 : 0);
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-std::string original::treeSet<TYPE, Compare, ALLOC>::className() const {
-    return "treeSet";
+std::string original::bTreeSet<TYPE, Compare, ALLOC>::className() const {
+    return "bTreeSet";
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-std::string original::treeSet<TYPE, Compare, ALLOC>::toString(const bool enter) const {
+std::string original::bTreeSet<TYPE, Compare, ALLOC>::toString(const bool enter) const {
     std::stringstream ss;
     ss << this->className();
     ss << "(";
@@ -1600,7 +2783,7 @@ std::string original::treeSet<TYPE, Compare, ALLOC>::toString(const bool enter)
 }
 
 template<typename TYPE, typename Compare, typename ALLOC>
-original::treeSet<TYPE, Compare, ALLOC>::~treeSet() = default;
+original::bTreeSet<TYPE, Compare, ALLOC>::~bTreeSet() = default;
 
 template<typename TYPE, typename Compare, typename ALLOC>
 bool original::JSet<TYPE, Compare, ALLOC>::Iterator::equalPtr(
@@ -1763,7 +2946,7 @@ original::JSet<TYPE, Compare, ALLOC>::operator=(JSet&& other) noexcept {
 
     this->listDestroy();
     this->head_ = other.head_;
-    other.head_ = other.createNode();
+    other.head_ = other.createHead();
     this->size_ = other.size_;
     other.size_ = 0;
     this->compare_ = std::move(other.compare_);
@@ -1809,6 +2992,107 @@ bool original::JSet<TYPE, Compare, ALLOC>::remove(const TYPE &e) {
     return this->erase(e);
 }
 
+template <typename TYPE, typename Compare, typename ALLOC>
+original::JSet<TYPE, Compare, ALLOC>::Iterator
+original::JSet<TYPE, Compare, ALLOC>::lowerBound(const TYPE& k) const
+{
+    return Iterator(this->ceilingNode(k));
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::JSet<TYPE, Compare, ALLOC>::Iterator
+original::JSet<TYPE, Compare, ALLOC>::upperBound(const TYPE& k) const
+{
+    return Iterator(this->higherNode(k));
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::JSet<TYPE, Compare, ALLOC>::Iterator
+original::JSet<TYPE, Compare, ALLOC>::floor(const TYPE& k) const
+{
+    return Iterator(this->floorNode(k));
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::JSet<TYPE, Compare, ALLOC>::Iterator
+original::JSet<TYPE, Compare, ALLOC>::ceiling(const TYPE& k) const
+{
+    return Iterator(this->ceilingNode(k));
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::JSet<TYPE, Compare, ALLOC>::rangeType
+original::JSet<TYPE, Compare, ALLOC>::range(const TYPE& low, const TYPE& high) const
+{
+    return rangeType(this->lowerBound(low), Iterator(this->lowerNode(high)), low, high, this->compare_);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::u_integer
+original::JSet<TYPE, Compare, ALLOC>::eraseRange(const TYPE& low, const TYPE& high)
+{
+    return skipListType::eraseRange(low, high);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+template <typename ELEM>
+original::JSet<TYPE, Compare, ALLOC>
+original::JSet<TYPE, Compare, ALLOC>::fromSorted(const iterator<ELEM>& begin, const iterator<ELEM>& end,
+    Compare comp, ALLOC alloc)
+{
+    JSet result(std::move(comp), std::move(alloc));
+    sortedRange<ELEM, TYPE, Compare> cursor(begin, end, result.compare_);
+    result.rebuildSorted(cursor.remaining(), [&cursor] {
+        couple<const TYPE, const bool> elem(cursor.get(), true);
+        cursor.next();
+        return elem;
+    });
+    return result;
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+void original::JSet<TYPE, Compare, ALLOC>::merge(const JSet& other)
+{
+    skipListType::mergeFrom(other);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::JSet<TYPE, Compare, ALLOC>
+original::JSet<TYPE, Compare, ALLOC>::combine(const JSet& other, const mergeRule rule) const
+{
+    JSet result(this->compare_, this->allocator);
+    sortedMerge<const TYPE, TYPE, Iterator, Compare> cursor(Iterator(this->head_->getPNext(1)),
+                                                 Iterator(other.head_->getPNext(1)),
+                                                 rule, this->compare_);
+    result.rebuildSorted(cursor.remaining(), [&cursor] {
+        couple<const TYPE, const bool> elem(cursor.get(), true);
+        cursor.next();
+        return elem;
+    });
+    return result;
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::JSet<TYPE, Compare, ALLOC>
+original::JSet<TYPE, Compare, ALLOC>::unite(const JSet& other) const
+{
+    return this->combine(other, mergeRule::UNION);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::JSet<TYPE, Compare, ALLOC>
+original::JSet<TYPE, Compare, ALLOC>::intersect(const JSet& other) const
+{
+    return this->combine(other, mergeRule::INTERSECTION);
+}
+
+template <typename TYPE, typename Compare, typename ALLOC>
+original::JSet<TYPE, Compare, ALLOC>
+original::JSet<TYPE, Compare, ALLOC>::difference(const JSet& other) const
+{
+    return this->combine(other, mergeRule::DIFFERENCE);
+}
+
 template<typename TYPE, typename Compare, typename ALLOC>
 original::JSet<TYPE, Compare, ALLOC>::Iterator*
 original::JSet<TYPE, Compare, ALLOC>::begins() const {
@@ -1848,16 +3132,24 @@ std::string original::JSet<TYPE, Compare, ALLOC>::toString(bool enter) const {
 template<typename TYPE, typename Compare, typename ALLOC>
 original::JSet<TYPE, Compare, ALLOC>::~JSet() = default;
 
-template <typename TYPE, typename HASH, typename ALLOC>
-void std::swap(original::hashSet<TYPE, HASH, ALLOC>& lhs, // NOLINT
-               original::hashSet<TYPE, HASH, ALLOC>& rhs) noexcept
+template<typename TYPE, typename HASH, typename ALLOC,
+         template <typename, typename, typename, typename> typename TABLE>
+void std::swap(original::hashSet<TYPE, HASH, ALLOC, TABLE>& lhs, // NOLINT
+               original::hashSet<TYPE, HASH, ALLOC, TABLE>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+template <typename TYPE, typename COMPARE, typename ALLOC, typename AUGMENT>
+void std::swap(original::treeSet<TYPE, COMPARE, ALLOC, AUGMENT>& lhs, // NOLINT
+               original::treeSet<TYPE, COMPARE, ALLOC, AUGMENT>& rhs) noexcept
 {
     lhs.swap(rhs);
 }
 
 template <typename TYPE, typename COMPARE, typename ALLOC>
-void std::swap(original::treeSet<TYPE, COMPARE, ALLOC>& lhs, // NOLINT
-               original::treeSet<TYPE, COMPARE, ALLOC>& rhs) noexcept
+void std::swap(original::bTreeSet<TYPE, COMPARE, ALLOC>& lhs, // NOLINT
+               original::bTreeSet<TYPE, COMPARE, ALLOC>& rhs) noexcept
 {
     lhs.swap(rhs);
 }
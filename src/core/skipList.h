@@ -1,5 +1,8 @@
 #ifndef SKIPLIST_H
 #define SKIPLIST_H
+#include <algorithm>
+#include <bit>
+#include <cstdint>
 #include <random>
 #include "comparator.h"
 #include "vector.h"
@@ -21,6 +24,7 @@
  * - Customizable comparison and allocation
  * - Full iterator support
  * - Exception safety (basic guarantee)
+ * - Single allocation per node, next pointers stored inline after the node
  */
 
 namespace original {
@@ -49,13 +53,27 @@ namespace original {
          * @brief Internal node class for Skip List
          * @details Represents a single node in the list with:
          * - Key-value pair storage
-         * - Vector of next pointers for multiple levels
+         * - Next pointers for multiple levels, stored in the same allocation right after the node
+         *
+         * A node is only created by skipList::createNode() or skipList::createHead(),
+         * which reserve room for capacity next pointers behind the object.
          */
         class skipListNode {
             couple<const K_TYPE, V_TYPE> data_;  ///< Key-value pair storage
-            vector<skipListNode*> next_;         ///< Vector of next pointers for each level
+            u_integer levels_;                   ///< Number of levels in use
+            u_integer capacity_;                 ///< Number of next pointers reserved after the node
 
-            using rebind_alloc_pointer = ALLOC::template rebind_alloc<skipListNode*>;
+            /**
+             * @brief Gets the next pointers stored after the node
+             * @return Pointer to the first next pointer (level 1)
+             */
+            skipListNode** nextPointers();
+
+            /**
+             * @brief Gets the next pointers stored after the node (const)
+             * @return Pointer to the first next pointer (level 1)
+             */
+            skipListNode* const* nextPointers() const;
         public:
             friend class skipList;
 
@@ -64,10 +82,13 @@ namespace original {
              * @param key Key to store
              * @param value Value to store
              * @param levels Number of levels for this node
-             * @param next Initializer list of next pointers
+             * @param capacity Number of next pointers reserved after the node (at least levels)
              */
             explicit skipListNode(const K_TYPE& key = K_TYPE{}, const V_TYPE& value = V_TYPE{},
-                                  u_integer levels = 1, std::initializer_list<skipListNode*> next = {});
+                                  u_integer levels = 1, u_integer capacity = 1);
+
+            skipListNode(const skipListNode&) = delete;
+            skipListNode& operator=(const skipListNode&) = delete;
 
             /**
              * @brief Gets key-value pair (non-const)
@@ -108,6 +129,7 @@ namespace original {
             /**
              * @brief Expands node to more levels
              * @param new_levels New total number of levels
+             * @throw outOfBoundError if new_levels exceeds the reserved capacity
              */
             void expandLevels(u_integer new_levels);
 
@@ -146,15 +168,26 @@ namespace original {
             static void connect(u_integer levels, skipListNode* prev, skipListNode* next);
         };
 
-        using rebind_alloc_node = ALLOC::template rebind_alloc<skipListNode>;       ///< Rebound allocator for nodes
-        using rebind_alloc_pointer = ALLOC::template rebind_alloc<skipListNode*>;  ///< Rebound allocator for pointers
+        /**
+         * @brief Allocation unit of a node together with its next pointers
+         */
+        struct alignas(skipListNode) nodeBlock {
+            byte storage[alignof(skipListNode)];
+        };
+
+        using rebind_alloc_node = ALLOC::template rebind_alloc<nodeBlock>;         ///< Rebound allocator for nodes
+
+        /**
+         * @brief Maximum number of levels of a node, also the capacity of the head node
+         * @details Levels are drawn with p = 0.5, so 32 levels cover lists far beyond 2^32 elements.
+         */
+        static constexpr u_integer MAX_LEVELS = 32;
 
         u_integer size_;                     ///< Number of elements
         skipListNode* head_;                 ///< Head node pointer
         Compare compare_;                     ///< Comparison function
         mutable rebind_alloc_node rebind_alloc{};  ///< Node allocator
-        mutable std::mt19937 gen_{std::random_device{}()};  ///< Random number generator
-        mutable std::uniform_real_distribution<> dis_{0.0, 1.0};  ///< Uniform distribution for level generation
+        mutable std::uint64_t random_state_{std::random_device{}() | 1};  ///< xorshift64 state for level generation
 
         /**
          * @class Iterator
@@ -241,12 +274,25 @@ namespace original {
          * @param key Key for new node
          * @param value Value for new node
          * @param levels Number of levels for new node
-         * @param next Initializer list of next pointers
          * @return Pointer to newly created node
-         * @details Uses allocator to construct node in place
+         * @details Allocates the node and its levels next pointers as one block,
+         * then constructs the node in place
          */
         skipListNode* createNode(const K_TYPE& key = K_TYPE{}, const V_TYPE& value = V_TYPE{},
-                                 u_integer levels = 1, std::initializer_list<skipListNode*> next = {}) const;
+                                 u_integer levels = 1) const;
+
+        /**
+         * @brief Creates an empty head node with room for MAX_LEVELS levels
+         * @return Pointer to newly created head node with one level
+         */
+        skipListNode* createHead() const;
+
+        /**
+         * @brief Gets the number of nodeBlock units holding a node and its next pointers
+         * @param capacity Number of next pointers reserved after the node
+         * @return Number of allocation units
+         */
+        static u_integer blocksOf(u_integer capacity);
 
         /**
          * @brief Destroys a node and deallocates memory
@@ -283,7 +329,9 @@ namespace original {
 
         /**
          * @brief Generates random number of levels for new node
-         * @return Random number of levels (geometric distribution)
+         * @return Random number of levels (geometric distribution, at most MAX_LEVELS)
+         * @details Draws one xorshift64 value and counts its trailing zero bits,
+         * each bit being a fair coin flip.
          */
         u_integer getRandomLevels() const;
 
@@ -313,10 +361,25 @@ namespace original {
 
         /**
          * @brief Finds last node in list
-         * @return Pointer to last node
+         * @return Pointer to last node, or the head node if empty
+         * @details Descends from the top level, O(log n) on average
          */
         skipListNode* findLastNode() const;
 
+        /**
+         * @brief Finds the last node ordered before a key
+         * @param key Key to search for
+         * @param inclusive Whether a node equal to key counts as before it
+         * @return Last node with key less than (or equal to, if inclusive) key,
+         * or the head node if there is none
+         */
+        skipListNode* findLastBefore(const K_TYPE& key, bool inclusive) const;
+
+        /**
+         * @brief Lowers the list levels to the highest level still in use
+         */
+        void trimCurLevels();
+
         /**
          * @brief Constructs skipList with given comparison function
          * @param compare Comparison function to use
@@ -331,6 +394,34 @@ namespace original {
          */
         skipListNode* find(const K_TYPE& key) const;
 
+        /**
+         * @brief Finds the first node whose key is not less than a key
+         * @param key Key to search for
+         * @return Pointer to the node, or nullptr if every key is less than key
+         */
+        skipListNode* ceilingNode(const K_TYPE& key) const;
+
+        /**
+         * @brief Finds the first node whose key is greater than a key
+         * @param key Key to search for
+         * @return Pointer to the node, or nullptr if no key is greater than key
+         */
+        skipListNode* higherNode(const K_TYPE& key) const;
+
+        /**
+         * @brief Finds the last node whose key is not greater than a key
+         * @param key Key to search for
+         * @return Pointer to the node, or nullptr if every key is greater than key
+         */
+        skipListNode* floorNode(const K_TYPE& key) const;
+
+        /**
+         * @brief Finds the last node whose key is less than a key
+         * @param key Key to search for
+         * @return Pointer to the node, or nullptr if no key is less than key
+         */
+        skipListNode* lowerNode(const K_TYPE& key) const;
+
         /**
          * @brief Modifies value for existing key
          * @param key Key to modify
@@ -356,12 +447,44 @@ namespace original {
          */
         bool erase(const K_TYPE& key);
 
+        /**
+         * @brief Erases all nodes with keys in [low, high)
+         * @param low Inclusive lower bound
+         * @param high Exclusive upper bound
+         * @return Number of erased nodes
+         * @details Searches once and unlinks the whole run, O(log n + m) for m erased nodes
+         */
+        u_integer eraseRange(const K_TYPE& low, const K_TYPE& high);
+
+        /**
+         * @brief Inserts the nodes of another list whose keys are absent
+         * @param other List to merge from, left unchanged
+         * @details Existing values win on equal keys. Walks other in key order and keeps
+         * the predecessors of the last inserted key on every level as fingers, so each
+         * search starts where the previous one stopped: O(n + m) expected, and the nodes
+         * already present are neither moved nor reallocated.
+         */
+        void mergeFrom(const skipList& other);
+
         /**
          * @brief Destroys entire list and deallocates all nodes
          * @details Uses sequential traversal to destroy all nodes
          */
         void listDestroy() noexcept;
 
+        /**
+         * @brief Replaces the list with a deterministic skip list built from sorted input
+         * @tparam SOURCE Callable returning the next couple<const K_TYPE, V_TYPE>
+         * @param count Number of elements source yields
+         * @param source Element source, called count times, yielding strictly increasing keys
+         * @details O(count) with no comparison and no random draw. The i-th node (from 1)
+         * gets 1 + countr_zero(i) levels, the ideal shape the random levels approximate.
+         * The old list is destroyed only after the new one is built, so source may read
+         * from it.
+         */
+        template<typename SOURCE>
+        void rebuildSorted(u_integer count, SOURCE&& source);
+
         /**
          * @brief Destructor
          * @details Cleans up all list nodes and allocated memory
@@ -372,18 +495,29 @@ namespace original {
 
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::skipListNode(const K_TYPE& key, const V_TYPE& value,
-    u_integer levels, std::initializer_list<skipListNode*> next)
-    : data_({key, value}), next_(vector<skipListNode*>(levels, rebind_alloc_pointer{}, nullptr)) {
-    if (next.size() != 0 && static_cast<u_integer>(next.size()) != levels) {
+    const u_integer levels, const u_integer capacity)
+    : data_({key, value}), levels_(levels), capacity_(capacity) {
+    if (levels > capacity) {
         throw outOfBoundError();
     }
-    u_integer i = 0;
-    for (auto&& ptr: next) {
-        this->next_[i] = ptr;
-        i += 1;
+    auto nexts = this->nextPointers();
+    for (u_integer i = 0; i < capacity; ++i) {
+        nexts[i] = nullptr;
     }
 }
 
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode**
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::nextPointers() {
+    return reinterpret_cast<skipListNode**>(reinterpret_cast<byte*>(this) + sizeof(skipListNode));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode* const*
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::nextPointers() const {
+    return reinterpret_cast<skipListNode* const*>(reinterpret_cast<const byte*>(this) + sizeof(skipListNode));
+}
+
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 original::couple<const K_TYPE, V_TYPE>&
 original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::getVal() {
@@ -416,7 +550,7 @@ original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::getValue() {
 
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 original::u_integer original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::getLevels() const {
-    return this->next_.size();
+    return this->levels_;
 }
 
 template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
@@ -424,10 +558,14 @@ void original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::expandLev
     if (this->getLevels() >= new_levels){
         return;
     }
-    auto increment = new_levels - this->getLevels();
-    for (u_integer i = 0; i < increment; ++i) {
-        this->next_.pushEnd(nullptr);
+    if (new_levels > this->capacity_){
+        throw outOfBoundError();
+    }
+    auto nexts = this->nextPointers();
+    for (u_integer i = this->levels_; i < new_levels; ++i) {
+        nexts[i] = nullptr;
     }
+    this->levels_ = new_levels;
 }
 
 template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
@@ -435,10 +573,7 @@ void original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::shrinkLev
     if (new_levels >= this->getLevels() || new_levels == 0){
         return;
     }
-    auto decrement = this->getLevels() - new_levels;
-    for (u_integer i = 0; i < decrement; ++i) {
-        this->next_.popEnd();
-    }
+    this->levels_ = new_levels;
 }
 
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
@@ -449,13 +584,13 @@ void original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::setValue(
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
  original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
 original::skipList<K_TYPE, V_TYPE, ALLOC,Compare>::skipListNode::getPNext(const u_integer levels) const {
-    return this->next_[levels - 1];
+    return this->nextPointers()[levels - 1];
 }
 
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 void original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::setPNext(const u_integer levels, skipListNode* next)
 {
-    this->next_[levels - 1] = next;
+    this->nextPointers()[levels - 1] = next;
 }
 
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
@@ -571,17 +706,43 @@ original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::Iterator::ptrDistance(const
 
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
-original::skipList<K_TYPE, V_TYPE, ALLOC,Compare>::createNode(const K_TYPE& key, const V_TYPE& value, u_integer levels,
-    std::initializer_list<skipListNode*> next) const {
-    auto node = this->rebind_alloc.allocate(1);
-    this->rebind_alloc.construct(node, key, value, levels, next);
+original::skipList<K_TYPE, V_TYPE, ALLOC,Compare>::createNode(const K_TYPE& key, const V_TYPE& value,
+                                                             const u_integer levels) const {
+    const u_integer blocks = blocksOf(levels);
+    auto node = reinterpret_cast<skipListNode*>(this->rebind_alloc.allocate(blocks));
+    try {
+        this->rebind_alloc.construct(node, key, value, levels, levels);
+    } catch (...) {
+        this->rebind_alloc.deallocate(reinterpret_cast<nodeBlock*>(node), blocks);
+        throw;
+    }
     return node;
 }
 
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::createHead() const {
+    const u_integer blocks = blocksOf(MAX_LEVELS);
+    auto node = reinterpret_cast<skipListNode*>(this->rebind_alloc.allocate(blocks));
+    try {
+        this->rebind_alloc.construct(node, K_TYPE{}, V_TYPE{}, static_cast<u_integer>(1), MAX_LEVELS);
+    } catch (...) {
+        this->rebind_alloc.deallocate(reinterpret_cast<nodeBlock*>(node), blocks);
+        throw;
+    }
+    return node;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::u_integer original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::blocksOf(const u_integer capacity) {
+    return (sizeof(skipListNode) + capacity * sizeof(skipListNode*) + sizeof(nodeBlock) - 1) / sizeof(nodeBlock);
+}
+
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 void original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::destroyNode(skipListNode* node) const {
+    const u_integer blocks = blocksOf(node->capacity_);
     this->rebind_alloc.destroy(node);
-    this->rebind_alloc.deallocate(node, 1);
+    this->rebind_alloc.deallocate(reinterpret_cast<nodeBlock*>(node), blocks);
 }
 
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
@@ -615,12 +776,12 @@ bool original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::equal(const K_TYPE& key
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 original::u_integer original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::getRandomLevels() const
 {
-    constexpr floating p = 0.5;
-    u_integer levels = 1;
-    while (this->dis_(this->gen_) < p) {
-        levels += 1;
-    }
-    return levels;
+    auto x = this->random_state_;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    this->random_state_ = x;
+    return static_cast<u_integer>(std::countr_zero(x | std::uint64_t{1} << (MAX_LEVELS - 1))) + 1;
 }
 
 template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
@@ -642,10 +803,13 @@ void original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::shrinkCurLevels(u_integ
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
 original::skipList<K_TYPE, V_TYPE, ALLOC,Compare>::listCopy() const {
-    auto copied_head =
-    this->createNode(this->head_->getKey(), this->head_->getValue(), this->getCurLevels());
+    auto copied_head = this->createHead();
+    copied_head->expandLevels(this->getCurLevels());
 
-    vector<skipListNode*> copied_curs{this->getCurLevels(), rebind_alloc_pointer{}, copied_head};
+    skipListNode* copied_curs[MAX_LEVELS];
+    for (u_integer i = 0; i < this->getCurLevels(); ++i) {
+        copied_curs[i] = copied_head;
+    }
     auto src_cur = this->head_;
     while (src_cur->getPNext(1)){
         auto src_next = src_cur->getPNext(1);
@@ -664,15 +828,50 @@ template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
 original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::findLastNode() const {
     auto cur = this->head_;
-    while (cur->getPNext(1)){
-        cur = cur->getPNext(1);
+    for (u_integer i = this->getCurLevels(); i > 0; --i) {
+        while (cur->getPNext(i)){
+            cur = cur->getPNext(i);
+        }
     }
     return cur;
 }
 
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::findLastBefore(const K_TYPE& key, const bool inclusive) const {
+    auto cur = this->head_;
+    for (u_integer i = this->getCurLevels(); i > 0; --i) {
+        for (auto next = cur->getPNext(i); next; next = cur->getPNext(i)) {
+            const bool before = inclusive ? !this->compare_(key, next->getKey())
+                                          : this->compare_(next->getKey(), key);
+            if (!before) {
+                break;
+            }
+            cur = next;
+        }
+    }
+    return cur;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::trimCurLevels() {
+    u_integer decrement = 0;
+    for (u_integer i = this->getCurLevels(); i > 0; --i) {
+        if (this->head_->getPNext(i)){
+            break;
+        }
+        decrement += 1;
+    }
+    if (decrement > 0){
+        this->shrinkCurLevels(this->getCurLevels() - decrement);
+    }
+}
+
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipList(Compare compare)
-    : size_(0), head_(this->createNode()), compare_(std::move(compare)) {}
+    : size_(0), head_(nullptr), compare_(std::move(compare)) {
+    this->head_ = this->createHead();
+}
 
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
@@ -701,6 +900,36 @@ original::skipList<K_TYPE, V_TYPE, ALLOC,Compare>::find(const K_TYPE& key) const
     return equal(key, next_p) ? next_p : nullptr;
 }
 
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::ceilingNode(const K_TYPE& key) const
+{
+    return this->findLastBefore(key, false)->getPNext(1);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::higherNode(const K_TYPE& key) const
+{
+    return this->findLastBefore(key, true)->getPNext(1);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::floorNode(const K_TYPE& key) const
+{
+    auto node = this->findLastBefore(key, true);
+    return node == this->head_ ? nullptr : node;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::lowerNode(const K_TYPE& key) const
+{
+    auto node = this->findLastBefore(key, false);
+    return node == this->head_ ? nullptr : node;
+}
+
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 bool original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::modify(const K_TYPE& key, const V_TYPE& value)
 {
@@ -721,7 +950,7 @@ bool original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::insert(const K_TYPE& ke
         this->expandCurLevels(new_levels);
     }
 
-    vector<skipListNode*> update(new_levels, rebind_alloc_pointer{}, nullptr);
+    skipListNode* update[MAX_LEVELS]{};
     skipListNode* cur = this->head_;
 
     for (u_integer i = this->getCurLevels(); i > 0; --i) {
@@ -751,42 +980,116 @@ bool original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::insert(const K_TYPE& ke
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 bool original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::erase(const K_TYPE& key)
 {
-    auto cur_p = this->find(key);
-    if (!cur_p){
+    if (this->size_ == 0){
         return false;
     }
 
-    auto cur_levels = cur_p->getLevels();
-    vector<skipListNode*> prev_nodes{cur_levels, rebind_alloc_pointer{}, this->head_};
-    vector<skipListNode*> next_nodes{cur_levels, rebind_alloc_pointer{}, nullptr};
-    for (u_integer i = 0; i < cur_levels; ++i) {
-        next_nodes[i] = cur_p->getPNext(i + 1);
-        while (true){
-            skipListNode* cur_node = prev_nodes[i];
-            skipListNode* next_node = cur_node->getPNext(i + 1);
-            if (!next_node || !this->highPriority(next_node, cur_p)){
-                break;
-            }
-            prev_nodes[i] = next_node;
+    skipListNode* prev_nodes[MAX_LEVELS];
+    skipListNode* cur = this->head_;
+    for (u_integer i = this->getCurLevels(); i > 0; --i) {
+        while (cur->getPNext(i) && this->compare_(cur->getPNext(i)->getKey(), key)) {
+            cur = cur->getPNext(i);
         }
+        prev_nodes[i - 1] = cur;
     }
-    for (u_integer i = 0; i < cur_levels; ++i) {
-        skipListNode::connect(i + 1, prev_nodes[i], next_nodes[i]);
+
+    auto cur_p = cur->getPNext(1);
+    if (!equal(key, cur_p)){
+        return false;
+    }
+
+    for (u_integer i = 0; i < cur_p->getLevels(); ++i) {
+        skipListNode::connect(i + 1, prev_nodes[i], cur_p->getPNext(i + 1));
     }
     this->destroyNode(cur_p);
 
-    u_integer decrement = 0;
+    this->trimCurLevels();
+    this->size_ -= 1;
+    return true;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::u_integer
+original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::eraseRange(const K_TYPE& low, const K_TYPE& high)
+{
+    if (this->size_ == 0 || !this->compare_(low, high)){
+        return 0;
+    }
+
+    skipListNode* prev_nodes[MAX_LEVELS];
+    skipListNode* cur = this->head_;
     for (u_integer i = this->getCurLevels(); i > 0; --i) {
-        if (this->head_->getPNext(i)){
-            break;
+        while (cur->getPNext(i) && this->compare_(cur->getPNext(i)->getKey(), low)) {
+            cur = cur->getPNext(i);
         }
-        decrement += 1;
+        prev_nodes[i - 1] = cur;
     }
-    if (decrement > 0){
-        this->shrinkCurLevels(this->getCurLevels() - decrement);
+
+    // Every node of the run is the direct successor of prev_nodes on its levels,
+    // since the nodes before it in the run are already unlinked
+    u_integer erased = 0;
+    auto cur_p = cur->getPNext(1);
+    while (cur_p && this->compare_(cur_p->getKey(), high)) {
+        auto next = cur_p->getPNext(1);
+        for (u_integer i = 0; i < cur_p->getLevels(); ++i) {
+            skipListNode::connect(i + 1, prev_nodes[i], cur_p->getPNext(i + 1));
+        }
+        this->destroyNode(cur_p);
+        erased += 1;
+        cur_p = next;
+    }
+
+    this->trimCurLevels();
+    this->size_ -= erased;
+    return erased;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::mergeFrom(const skipList& other)
+{
+    if (this == &other) {
+        return;
+    }
+
+    skipListNode* fingers[MAX_LEVELS];
+    for (u_integer i = 0; i < MAX_LEVELS; ++i) {
+        fingers[i] = this->head_;
+    }
+
+    for (auto node = other.head_->getPNext(1); node; node = node->getPNext(1)) {
+        const K_TYPE& key = node->getKey();
+
+        // Climb while the finger one level up is stale, the fingers above it still precede key
+        u_integer top = 1;
+        while (top < this->getCurLevels() && fingers[top]->getPNext(top + 1)
+               && this->compare_(fingers[top]->getPNext(top + 1)->getKey(), key)) {
+            top += 1;
+        }
+
+        skipListNode* cur = fingers[top - 1];
+        for (u_integer i = top; i > 0; --i) {
+            while (cur->getPNext(i) && this->compare_(cur->getPNext(i)->getKey(), key)) {
+                cur = cur->getPNext(i);
+            }
+            fingers[i - 1] = cur;
+        }
+
+        if (auto next = cur->getPNext(1); next && !this->compare_(key, next->getKey())) {
+            continue;
+        }
+
+        const u_integer new_levels = this->getRandomLevels();
+        if (new_levels > this->getCurLevels()) {
+            this->expandCurLevels(new_levels);
+        }
+        auto new_node = this->createNode(key, node->getValue(), new_levels);
+        for (u_integer i = 0; i < new_levels; ++i) {
+            skipListNode::connect(i + 1, new_node, fingers[i]->getPNext(i + 1));
+            skipListNode::connect(i + 1, fingers[i], new_node);
+            fingers[i] = new_node;
+        }
+        this->size_ += 1;
     }
-    this->size_ -= 1;
-    return true;
 }
 
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
@@ -800,6 +1103,34 @@ void original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::listDestroy() noexcept
     }
 }
 
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+template <typename SOURCE>
+void original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::rebuildSorted(const u_integer count, SOURCE&& source)
+{
+    auto head = this->createHead();
+    skipListNode* tails[MAX_LEVELS];
+    for (u_integer i = 0; i < MAX_LEVELS; ++i) {
+        tails[i] = head;
+    }
+
+    for (u_integer i = 1; i <= count; ++i) {
+        const u_integer levels = std::min(static_cast<u_integer>(std::countr_zero(i)) + 1, MAX_LEVELS);
+        if (levels > head->getLevels()) {
+            head->expandLevels(levels);
+        }
+        const auto elem = source();
+        auto node = this->createNode(elem.first(), elem.second(), levels);
+        for (u_integer j = 0; j < levels; ++j) {
+            skipListNode::connect(j + 1, tails[j], node);
+            tails[j] = node;
+        }
+    }
+
+    this->listDestroy();
+    this->head_ = head;
+    this->size_ = count;
+}
+
 template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
 original::skipList<K_TYPE, V_TYPE, ALLOC, Compare>::~skipList()
 {
@@ -0,0 +1,309 @@
+#ifndef SORTEDMERGE_H
+#define SORTEDMERGE_H
+
+#include <type_traits>
+#include "error.h"
+#include "iterator.h"
+#include "ownerPtr.h"
+
+/**
+ * @file sortedMerge.h
+ * @brief Cursors feeding sorted input to the bulk builders of ordered containers
+ * @details Provides two single-pass cursors with the same interface
+ * (isValid(), get(), next() and remaining()):
+ * - sortedRange walks an iterator range whose keys must be strictly increasing
+ * - sortedMerge walks two ordered containers in step and yields their union,
+ *   intersection or difference
+ *
+ * The ordered maps and sets count the elements of a cursor with remaining(), then
+ * pull them from a second cursor while building a balanced tree or skip list, so
+ * both bulk construction and set algebra run in linear time without lookups.
+ */
+
+
+namespace original {
+
+    /**
+     * @enum mergeRule
+     * @brief Elements yielded by sortedMerge
+     */
+    enum class mergeRule {
+        UNION,          ///< Keys of either side, the left element winning on equal keys
+        INTERSECTION,   ///< Keys of both sides, taking the left element
+        DIFFERENCE,     ///< Keys of the left side only
+    };
+
+    /**
+     * @class sortedRange
+     * @tparam TYPE Element type of the iterators
+     * @tparam K_TYPE Key type, TYPE itself for sets and the first component for maps
+     * @tparam Compare Comparison function type
+     * @brief Cursor over the inclusive iterator range [begin, end]
+     * @details Uses the range convention of algorithms: end points to the last element.
+     * An invalid begin gives an empty range, and the walk also stops if end is never met.
+     */
+    template<typename TYPE, typename K_TYPE, typename Compare>
+    class sortedRange {
+        ownerPtr<iterator<TYPE>> cur_;  ///< Current position
+        ownerPtr<iterator<TYPE>> end_;  ///< Last position
+        Compare compare_;               ///< Comparison function
+        bool done_;                     ///< Whether the range is exhausted
+
+    public:
+        /**
+         * @brief Constructs a cursor at begin
+         * @param begin First element
+         * @param end Last element
+         * @param compare Comparison function
+         */
+        sortedRange(const iterator<TYPE>& begin, const iterator<TYPE>& end, Compare compare);
+
+        /**
+         * @brief Checks whether the cursor points to an element
+         * @return true if an element remains
+         */
+        [[nodiscard]] bool isValid() const;
+
+        /**
+         * @brief Gets the current element
+         * @return Copy of the current element
+         */
+        TYPE get() const;
+
+        /**
+         * @brief Moves to the next element
+         */
+        void next();
+
+        /**
+         * @brief Counts the elements from the current one to the end
+         * @return Number of remaining elements
+         * @throw valueError if the keys are not strictly increasing
+         */
+        [[nodiscard]] u_integer remaining() const;
+    };
+
+    /**
+     * @class sortedMerge
+     * @tparam TYPE Element type of the containers
+     * @tparam K_TYPE Key type, TYPE itself for sets and the first component for maps
+     * @tparam ITER Iterator type of the containers
+     * @tparam Compare Comparison function type
+     * @brief Cursor merging two ordered containers in O(n + m)
+     * @details Both iterators advance in key order and equal keys are matched without
+     * any lookup. The cursor is copyable, and copies walk independently.
+     */
+    template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+    class sortedMerge {
+        ITER left_;         ///< Position in the left container
+        ITER right_;        ///< Position in the right container
+        mergeRule rule_;    ///< Elements to yield
+        Compare compare_;   ///< Comparison function
+        bool take_left_;    ///< Whether the current element comes from the left side
+        bool done_;         ///< Whether the merge is exhausted
+
+        /**
+         * @brief Advances to the next position that yields an element
+         */
+        void settle();
+
+    public:
+        /**
+         * @brief Constructs a cursor at the first yielded element
+         * @param left Iterator at the first element of the left container
+         * @param right Iterator at the first element of the right container
+         * @param rule Elements to yield
+         * @param compare Comparison function
+         */
+        sortedMerge(const ITER& left, const ITER& right, mergeRule rule, Compare compare);
+
+        /**
+         * @brief Checks whether the cursor points to an element
+         * @return true if an element remains
+         */
+        [[nodiscard]] bool isValid() const;
+
+        /**
+         * @brief Gets the current element
+         * @return Copy of the current element
+         */
+        TYPE get() const;
+
+        /**
+         * @brief Moves to the next element
+         */
+        void next();
+
+        /**
+         * @brief Counts the elements from the current one to the end
+         * @return Number of remaining elements
+         */
+        [[nodiscard]] u_integer remaining() const;
+    };
+
+    /**
+     * @brief Extracts the key of a container element
+     * @tparam K_TYPE Key type
+     * @tparam TYPE Element type
+     * @param elem Element
+     * @return The element itself for sets, its first component for maps
+     */
+    template<typename K_TYPE, typename TYPE>
+    const K_TYPE& sortedKeyOf(const TYPE& elem);
+}
+
+template<typename K_TYPE, typename TYPE>
+const K_TYPE& original::sortedKeyOf(const TYPE& elem)
+{
+    if constexpr (std::is_same_v<std::remove_cv_t<TYPE>, std::remove_cv_t<K_TYPE>>) {
+        return elem;
+    } else {
+        return elem.template get<0>();
+    }
+}
+
+template<typename TYPE, typename K_TYPE, typename Compare>
+original::sortedRange<TYPE, K_TYPE, Compare>::sortedRange(const iterator<TYPE>& begin,
+                                                          const iterator<TYPE>& end, Compare compare)
+    : cur_(begin.clone()), end_(end.clone()), compare_(std::move(compare)), done_(!begin.isValid()) {}
+
+template<typename TYPE, typename K_TYPE, typename Compare>
+bool original::sortedRange<TYPE, K_TYPE, Compare>::isValid() const
+{
+    return !this->done_;
+}
+
+template<typename TYPE, typename K_TYPE, typename Compare>
+TYPE original::sortedRange<TYPE, K_TYPE, Compare>::get() const
+{
+    return this->cur_->get();
+}
+
+template<typename TYPE, typename K_TYPE, typename Compare>
+void original::sortedRange<TYPE, K_TYPE, Compare>::next()
+{
+    if (this->done_) {
+        return;
+    }
+
+    if (this->cur_->equal(*this->end_)) {
+        this->done_ = true;
+        return;
+    }
+    this->cur_->next();
+    this->done_ = !this->cur_->isValid();
+}
+
+template<typename TYPE, typename K_TYPE, typename Compare>
+original::u_integer original::sortedRange<TYPE, K_TYPE, Compare>::remaining() const
+{
+    if (this->done_) {
+        return 0;
+    }
+
+    auto it = ownerPtr<iterator<TYPE>>(this->cur_->clone());
+    u_integer count = 1;
+    while (!it->equal(*this->end_)) {
+        const TYPE prev = it->get();
+        it->next();
+        if (!it->isValid()) {
+            break;
+        }
+        if (!this->compare_(sortedKeyOf<K_TYPE>(prev), sortedKeyOf<K_TYPE>(it->get()))) {
+            throw valueError("Keys of the sorted input are not strictly increasing");
+        }
+        count += 1;
+    }
+    return count;
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+void original::sortedMerge<TYPE, K_TYPE, ITER, Compare>::settle()
+{
+    while (true) {
+        const bool has_left = this->left_.isValid();
+        const bool has_right = this->right_.isValid();
+        if (!has_left && (!has_right || this->rule_ != mergeRule::UNION)) {
+            this->done_ = true;
+            return;
+        }
+        if (!has_right) {
+            if (this->rule_ == mergeRule::INTERSECTION) {
+                this->done_ = true;
+                return;
+            }
+            this->take_left_ = true;
+            return;
+        }
+        if (!has_left) {
+            this->take_left_ = false;
+            return;
+        }
+
+        const auto& left = this->left_.get();
+        const auto& right = this->right_.get();
+        if (this->compare_(sortedKeyOf<K_TYPE>(left), sortedKeyOf<K_TYPE>(right))) {
+            if (this->rule_ != mergeRule::INTERSECTION) {
+                this->take_left_ = true;
+                return;
+            }
+            this->left_.next();
+        } else if (this->compare_(sortedKeyOf<K_TYPE>(right), sortedKeyOf<K_TYPE>(left))) {
+            if (this->rule_ == mergeRule::UNION) {
+                this->take_left_ = false;
+                return;
+            }
+            this->right_.next();
+        } else {
+            this->right_.next();
+            if (this->rule_ != mergeRule::DIFFERENCE) {
+                this->take_left_ = true;
+                return;
+            }
+            this->left_.next();
+        }
+    }
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+original::sortedMerge<TYPE, K_TYPE, ITER, Compare>::sortedMerge(const ITER& left, const ITER& right,
+                                                                const mergeRule rule, Compare compare)
+    : left_(left), right_(right), rule_(rule), compare_(std::move(compare)), take_left_(true), done_(false)
+{
+    this->settle();
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+bool original::sortedMerge<TYPE, K_TYPE, ITER, Compare>::isValid() const
+{
+    return !this->done_;
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+TYPE original::sortedMerge<TYPE, K_TYPE, ITER, Compare>::get() const
+{
+    return this->take_left_ ? this->left_.get() : this->right_.get();
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+void original::sortedMerge<TYPE, K_TYPE, ITER, Compare>::next()
+{
+    if (this->done_) {
+        return;
+    }
+
+    this->take_left_ ? this->left_.next() : this->right_.next();
+    this->settle();
+}
+
+template<typename TYPE, typename K_TYPE, typename ITER, typename Compare>
+original::u_integer original::sortedMerge<TYPE, K_TYPE, ITER, Compare>::remaining() const
+{
+    u_integer count = 0;
+    for (auto cursor = *this; cursor.isValid(); cursor.next()) {
+        count += 1;
+    }
+    return count;
+}
+
+#endif //SORTEDMERGE_H
@@ -16,6 +16,9 @@
 
 namespace original {
 
+    template<typename TYPE, typename... TRANSFORMS>
+    class transformPipeline;
+
     /**
      * @class transform
      * @tparam TYPE The type of element being transformed
@@ -71,6 +74,9 @@ namespace original {
          */
         void apply(TYPE &t) override;
 
+        template<typename, typename...>
+        friend class transformPipeline;
+
     public:
         /**
          * @brief Clones the addOptTransform object.
@@ -102,6 +108,9 @@ namespace original {
          */
         void apply(TYPE &t) override;
 
+        template<typename, typename...>
+        friend class transformPipeline;
+
     public:
         /**
          * @brief Clones the assignOptTransform object.
@@ -133,6 +142,9 @@ namespace original {
          */
         void apply(TYPE &t) override;
 
+        template<typename, typename...>
+        friend class transformPipeline;
+
     public:
         /**
          * @brief Clones the multiOptTransform object.
@@ -162,6 +174,9 @@ namespace original {
          */
         void apply(TYPE &t) override;
 
+        template<typename, typename...>
+        friend class transformPipeline;
+
     public:
         /**
          * @brief Clones the absTransform object.
@@ -192,6 +207,9 @@ namespace original {
          */
         void apply(TYPE &t) override;
 
+        template<typename, typename...>
+        friend class transformPipeline;
+
     public:
         /**
          * @brief Clones the copyTransform object.
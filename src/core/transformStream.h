@@ -6,11 +6,17 @@
  * @brief Transform pipeline composition and execution
  * @details Defines a stream of transformations that can be sequentially applied to data.
  * Supports building transformation pipelines through operator chaining.
+ * Two forms are provided:
+ * - transformStream: runtime-polymorphic, clones transforms and dispatches virtually
+ * - transformPipeline: compile-time composition of concrete transforms, fused into one loop body
  */
 
+#include <tuple>
 #include "transform.h"
+#include "array.h"
 #include "chain.h"
 #include "refCntPtr.h"
+#include "vector.h"
 
 
 namespace original {
@@ -43,6 +49,9 @@ namespace original {
          */
         explicit transformStream();
 
+        template<typename, typename...>
+        friend class transformPipeline;
+
     public:
         /**
          * @brief Applies all transformations sequentially
@@ -104,6 +113,132 @@ namespace original {
      */
     template <typename T>
     transformStream<T> operator+(const transform<T>& t, const transformStream<T>& ots);
+
+    /**
+     * @class transformPipeline
+     * @tparam TYPE Type of data to be transformed
+     * @tparam TRANSFORMS Concrete transformation types, applied in order
+     * @brief Compile-time fused sequence of transformations
+     * @details Holds the concrete transforms by value and applies them through direct,
+     * non-virtual calls, so the whole sequence inlines into a single loop body.
+     * Features:
+     * - Composable through + operator, each step yields a new pipeline type
+     * - Bulk application over raw ranges, vector and array that the compiler can vectorize
+     * - Conversion to transformStream when the sequence has to be stored at runtime
+     *
+     * Transforms that are not friends of the pipeline are invoked through their
+     * public call operator instead of apply().
+     *
+     * @code{.cpp}
+     * auto p = pipeline(addOptTransform(1), multiOptTransform(3), absTransform<int>());
+     * vector<int> v{-4, 2, 7};
+     * p(v); // 9, 9, 24
+     * @endcode
+     */
+    template<typename TYPE, typename... TRANSFORMS>
+    class transformPipeline {
+        static_assert((ExtendsOf<transform<TYPE>, TRANSFORMS> && ...),
+                      "transformPipeline requires transforms of the same element type");
+
+        std::tuple<TRANSFORMS...> transforms_; ///< Transforms in application order
+
+        /**
+         * @brief Applies one transform without virtual dispatch
+         * @param tr Transformation to apply
+         * @param t Data to be transformed (modified in-place)
+         */
+        template<typename TRANSFORM>
+        static void applyOne(TRANSFORM& tr, TYPE& t);
+
+        /**
+         * @brief Applies every transform of the given tuple to one element
+         * @param transforms Transforms to apply
+         * @param t Data to be transformed (modified in-place)
+         */
+        static void applyAll(std::tuple<TRANSFORMS...>& transforms, TYPE& t);
+
+        template<typename, typename...>
+        friend class transformPipeline;
+
+    public:
+        /**
+         * @brief Constructs a pipeline from transforms
+         * @param transforms Transformations applied in argument order
+         */
+        explicit transformPipeline(const TRANSFORMS&... transforms);
+
+        /**
+         * @brief Applies all transformations sequentially
+         * @param t Data to be transformed (modified in-place)
+         */
+        void operator()(TYPE& t);
+
+        /**
+         * @brief Applies the pipeline to every element of a contiguous range
+         * @param data Pointer to the first element
+         * @param size Number of elements
+         * @details The transforms are copied into a local for the duration of the loop,
+         * so their operands cannot alias the range and stay in registers. The copy is
+         * written back afterwards to keep stateful transforms consistent.
+         */
+        void operator()(TYPE* data, u_integer size);
+
+        /**
+         * @brief Applies the pipeline to every element of a vector
+         * @param v Vector to transform in-place
+         */
+        template<typename ALLOC>
+        void operator()(vector<TYPE, ALLOC>& v);
+
+        /**
+         * @brief Applies the pipeline to every element of an array
+         * @param arr Array to transform in-place
+         */
+        template<typename ALLOC>
+        void operator()(array<TYPE, ALLOC>& arr);
+
+        /**
+         * @brief Creates a pipeline with one more transformation appended
+         * @param t Transformation to append
+         * @return New pipeline applying this pipeline then t
+         */
+        template<typename TRANSFORM>
+        auto operator+(const TRANSFORM& t) const -> transformPipeline<TYPE, TRANSFORMS..., TRANSFORM>;
+
+        /**
+         * @brief Concatenates two pipelines
+         * @param other Pipeline applied after this one
+         * @return New pipeline applying both
+         */
+        template<typename... OTHERS>
+        auto operator+(const transformPipeline<TYPE, OTHERS...>& other) const
+            -> transformPipeline<TYPE, TRANSFORMS..., OTHERS...>;
+
+        /**
+         * @brief Converts to the runtime-polymorphic form
+         * @return transformStream holding clones of the transforms in the same order
+         */
+        transformStream<TYPE> toStream() const;
+    };
+
+    /**
+     * @brief Element type of a transformation, used to deduce pipeline types
+     * @note Declaration only, for use in unevaluated contexts
+     */
+    template<typename TYPE>
+    auto transformElementOf(const transform<TYPE>&) -> TYPE;
+
+    /**
+     * @brief Creates a fused pipeline from concrete transforms
+     * @tparam FIRST Type of the first transformation, determines the element type
+     * @tparam REST Types of the remaining transformations
+     * @param first First transformation
+     * @param rest Remaining transformations
+     * @return Pipeline applying the transforms in argument order
+     */
+    template<typename FIRST, typename... REST>
+    auto pipeline(const FIRST& first, const REST&... rest)
+        -> transformPipeline<decltype(transformElementOf(first)), FIRST, REST...>;
 }
 
     template<typename TYPE>
@@ -156,4 +291,100 @@ namespace original {
         return ts;
     }
 
+    template<typename TYPE, typename... TRANSFORMS>
+    template<typename TRANSFORM>
+    auto original::transformPipeline<TYPE, TRANSFORMS...>::applyOne(TRANSFORM& tr, TYPE& t) -> void
+    {
+        if constexpr (requires { tr.apply(t); }) {
+            tr.TRANSFORM::apply(t);
+        } else {
+            tr(t);
+        }
+    }
+
+    template<typename TYPE, typename... TRANSFORMS>
+    auto original::transformPipeline<TYPE, TRANSFORMS...>::applyAll(std::tuple<TRANSFORMS...>& transforms, TYPE& t) -> void
+    {
+        std::apply([&t](TRANSFORMS&... tr) {
+            (applyOne(tr, t), ...);
+        }, transforms);
+    }
+
+    template<typename TYPE, typename... TRANSFORMS>
+    original::transformPipeline<TYPE, TRANSFORMS...>::transformPipeline(const TRANSFORMS&... transforms)
+        : transforms_(transforms...) {}
+
+    template<typename TYPE, typename... TRANSFORMS>
+    auto original::transformPipeline<TYPE, TRANSFORMS...>::operator()(TYPE& t) -> void
+    {
+        applyAll(this->transforms_, t);
+    }
+
+    template<typename TYPE, typename... TRANSFORMS>
+    auto original::transformPipeline<TYPE, TRANSFORMS...>::operator()(TYPE* data, const u_integer size) -> void
+    {
+        auto transforms = this->transforms_;
+        for (u_integer i = 0; i < size; ++i) {
+            applyAll(transforms, data[i]);
+        }
+        this->transforms_ = transforms;
+    }
+
+    template<typename TYPE, typename... TRANSFORMS>
+    template<typename ALLOC>
+    auto original::transformPipeline<TYPE, TRANSFORMS...>::operator()(vector<TYPE, ALLOC>& v) -> void
+    {
+        if (v.empty())
+            return;
+        (*this)(&v.data(), v.size());
+    }
+
+    template<typename TYPE, typename... TRANSFORMS>
+    template<typename ALLOC>
+    auto original::transformPipeline<TYPE, TRANSFORMS...>::operator()(array<TYPE, ALLOC>& arr) -> void
+    {
+        if (arr.empty())
+            return;
+        (*this)(&arr.data(), arr.size());
+    }
+
+    template<typename TYPE, typename... TRANSFORMS>
+    template<typename TRANSFORM>
+    auto original::transformPipeline<TYPE, TRANSFORMS...>::operator+(const TRANSFORM& t) const
+        -> transformPipeline<TYPE, TRANSFORMS..., TRANSFORM>
+    {
+        return std::apply([&t](const TRANSFORMS&... tr) {
+            return transformPipeline<TYPE, TRANSFORMS..., TRANSFORM>(tr..., t);
+        }, this->transforms_);
+    }
+
+    template<typename TYPE, typename... TRANSFORMS>
+    template<typename... OTHERS>
+    auto original::transformPipeline<TYPE, TRANSFORMS...>::operator+(const transformPipeline<TYPE, OTHERS...>& other) const
+        -> transformPipeline<TYPE, TRANSFORMS..., OTHERS...>
+    {
+        return std::apply([&other](const TRANSFORMS&... tr) {
+            return std::apply([&tr...](const OTHERS&... ot) {
+                return transformPipeline<TYPE, TRANSFORMS..., OTHERS...>(tr..., ot...);
+            }, other.transforms_);
+        }, this->transforms_);
+    }
+
+    template<typename TYPE, typename... TRANSFORMS>
+    auto original::transformPipeline<TYPE, TRANSFORMS...>::toStream() const -> transformStream<TYPE>
+    {
+        transformStream<TYPE> ts;
+        std::apply([&ts](const TRANSFORMS&... tr) {
+            (ts.pushEnd(tr), ...);
+        }, this->transforms_);
+        return ts;
+    }
+
+    template<typename FIRST, typename... REST>
+    auto original::pipeline(const FIRST& first, const REST&... rest)
+        -> transformPipeline<decltype(transformElementOf(first)), FIRST, REST...>
+    {
+        return transformPipeline<decltype(transformElementOf(first)), FIRST, REST...>(first, rest...);
+    }
+
 #endif // TRANSFORMSTREAM_H
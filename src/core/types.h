@@ -5,6 +5,7 @@
 #include <concepts>
 #include <iosfwd>
 #include <functional>
+#include <utility>
 #include "config.h"
 
 /**
@@ -516,6 +517,27 @@ namespace original {
         c.pop_back();
     };
 
+    /**
+     * @concept ContiguousContainer
+     * @brief Container whose elements occupy one contiguous block.
+     * @tparam C Container type
+     * @details Requires data() returning a reference to the first element and
+     *          size(), with element i stored at (&c.data())[i]. Satisfied by
+     *          `vector` and `array`.
+     */
+    template <typename C>
+    concept ContiguousContainer = requires(C& c) {
+        requires std::is_lvalue_reference_v<decltype(c.data())>;
+        { c.size() } -> std::convertible_to<u_integer>;
+    };
+
+    /**
+     * @brief Element type stored by a ContiguousContainer.
+     * @tparam C Container type
+     */
+    template <ContiguousContainer C>
+    using contiguousElemType = std::remove_reference_t<decltype(std::declval<C&>().data())>;
+
     // ==================== Compile-time Index Sequences ====================
 
     /**
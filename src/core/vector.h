@@ -8,6 +8,7 @@
  * and auto-centering memory management. Supports random access and iterator-based traversal.
  */
 
+#include <limits>
 #include "baseList.h"
 #include "iterationStream.h"
 #include "array.h"
@@ -148,6 +149,7 @@ namespace original {
         /**
          * @brief Adjusts the vector's internal buffer to accommodate an increment in size.
          * @param increment The number of elements to accommodate.
+         * @throw allocateError if the grown capacity does not fit in u_integer
          */
         void adjust(u_integer increment);
 
@@ -579,6 +581,10 @@ namespace std {
                                  this->body, offset);
             this->inner_begin = new_begin;
         } else {
+            constexpr u_integer half_limit = std::numeric_limits<u_integer>::max() / 2;
+            if (this->size() > half_limit || increment > half_limit - this->size()) {
+                throw allocateError();
+            }
             const u_integer new_max_size = (this->size() + increment) * 2;
             this->grow(new_max_size);
         }
@@ -647,7 +653,10 @@ original::vector<TYPE, ALLOC>::vector(u_integer size, ALLOC alloc, ARGS&&... arg
 template<typename TYPE, typename ALLOC>
     original::vector<TYPE, ALLOC>::vector(const u_integer size, ALLOC alloc)
     : baseList<TYPE, ALLOC>(std::move(alloc)), size_(size),
-      max_size(size * 4 / 3), inner_begin(size / 3 >= 1 ? size / 3 - 1 : 0), body(nullptr) {
+      max_size(size + size / 3), inner_begin(size / 3 >= 1 ? size / 3 - 1 : 0), body(nullptr) {
+        if (this->max_size < size) {
+            throw allocateError();
+        }
 }
 
     template <typename TYPE, typename ALLOC>
@@ -806,7 +815,7 @@ template<typename TYPE, typename ALLOC>
     template <typename TYPE, typename ALLOC>
     auto original::vector<TYPE, ALLOC>::push(integer index, const TYPE &e) -> void
     {
-        if (this->parseNegIndex(index) == this->size())
+        if (this->parseNegIndex(index) == static_cast<integer>(this->size()))
         {
             this->pushEnd(e);
         }else if (this->parseNegIndex(index) == 0)
@@ -864,7 +873,7 @@ template<typename TYPE, typename ALLOC>
         {
             return this->popBegin();
         }
-        if (this->parseNegIndex(index) == this->size() - 1)
+        if (this->parseNegIndex(index) == static_cast<integer>(this->size()) - 1)
         {
             return this->popEnd();
         }
@@ -1,72 +1,264 @@
 #ifndef ORIGINAL_ASYNC_H
 #define ORIGINAL_ASYNC_H
 
-#include "atomic.h"
-#include "condition.h"
+#include "config.h"
+#include "coroutines.h"
 #include "optional.h"
 #include "refCntPtr.h"
 #include "thread.h"
+#include "vector.h"
+#include "zeit.h"
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <coroutine>
 #include <exception>
 #include <functional>
+#include <type_traits>
 #include <utility>
 
+#if ORIGINAL_PLATFORM_LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include "condition.h"
+#include "mutex.h"
+#endif
+
 namespace original {
 
+    class taskDelegator;
+
     /**
      * @class async
      * @brief Asynchronous programming utilities with future/promise pattern
      * @details Provides a thread-safe implementation of the future/promise pattern
      * for asynchronous computation. Supports both value-returning and void functions.
+     * Futures accept non-blocking continuations through then() and can be combined
+     * with whenAll() and whenAny(). Inside a coroutine, futures can be co_awaited
+     * directly and coroutine tasks are started with spawn().
      */
     class async {
+        friend class taskDelegator;
+
         // ==================== Async Wrapper (Internal) ====================
 
+        class asyncWrapperBase;
+
         /**
-         * @class asyncWrapper
-         * @brief Internal wrapper for asynchronous result storage
-         * @tparam TYPE The result type of the asynchronous computation
-         * @details Manages the state and synchronization of asynchronous results
+         * @class continuation
+         * @brief Callback node attached to an async wrapper
+         * @details Nodes form an intrusive lock-free stack inside the wrapper. Once the
+         * wrapper publishes its result every node is fired exactly once, in registration
+         * order; a wrapper destroyed without a result cancels its nodes instead. A node
+         * that has been fired or cancelled manages its own lifetime.
          */
-        template<typename TYPE>
-        class asyncWrapper {
-            atomic<bool> ready_{makeAtomic(false)};  ///< Atomic flag indicating result readiness
-            strongPtr<TYPE> result_;                      ///< Storage of asynchronous computation result
-            mutable pCondition cond_{};                   ///< Condition variable for synchronization
-            mutable pMutex mutex_{};                      ///< Mutex for thread safety
-            std::exception_ptr e_{};                      ///< Exception pointer for error handling
+        class continuation {
+            continuation* next_{nullptr};  ///< Next node in the wrapper's stack
+
+            friend class asyncWrapperBase;
 
         public:
-            asyncWrapper();
+            /**
+             * @brief Called by the completing thread once the source is ready
+             * @details Runs the node inline by default; nodes bound to a taskDelegator
+             * override it to post run() instead.
+             */
+            virtual void fire() noexcept;
 
             /**
-             * @brief Sets the result value and marks as ready
-             * @param v The result value to store
+             * @brief Reads the ready source and completes the node
              */
-            void setValue(TYPE&& v);
+            virtual void run() noexcept = 0;
 
             /**
-             * @brief Sets an exception and marks as ready
-             * @param e Exception pointer to store
+             * @brief Completes the node with an error without reading the source
+             * @param e Error to report
              */
-            void setException(std::exception_ptr e);
+            virtual void cancel(std::exception_ptr e) noexcept = 0;
+
+            virtual ~continuation() = default;
+        };
+
+        /**
+         * @class asyncWrapperBase
+         * @brief Reference count and state word shared by all async wrappers
+         * @details Futures, shared futures and promises reach their wrapper through
+         * wrapperPtr, so a result channel costs a single allocation instead of a
+         * separate control block. Producers that embed the wrapper in a larger block
+         * (such as pooled tasks of taskDelegator) override destroy() to hand the
+         * block back to its owner.
+         *
+         * Readiness lives in one 32-bit state word (EMPTY, VALUE or EXCEPTION, plus a
+         * WAITING bit set by blocked consumers). A ready wrapper is observed with a
+         * single acquire load; consumers that have to block sleep on the word itself
+         * (futex on Linux, a shared mutex and condition pair elsewhere) and the producer
+         * only issues a wake when the WAITING bit was set.
+         *
+         * Continuations are pushed onto a lock-free stack that publish() closes and
+         * drains, so they run on the completing thread without any consumer blocking.
+         */
+        class asyncWrapperBase {
+        protected:
+            /// @brief State word type, 32 bits wide as the futex syscall requires regardless of u_integer
+            using state_type = std::uint32_t;
+
+            static constexpr state_type EMPTY = 0;       ///< No result yet
+            static constexpr state_type VALUE = 1;       ///< A value has been stored
+            static constexpr state_type EXCEPTION = 2;   ///< An exception has been stored
+            static constexpr state_type WAITING = 4;     ///< A consumer is blocked on the state word
+            static constexpr state_type READY_MASK = VALUE | EXCEPTION;
+
+        private:
+            u_integer refs_{0};                 ///< Reference count, accessed through atomic builtins
+            mutable state_type state_{EMPTY};   ///< State word, accessed through atomic builtins
+            continuation* conts_{nullptr};      ///< Pending continuations, closed() once published
+
+            /**
+             * @brief Marker stored in conts_ after the result has been published
+             */
+            static continuation* closed() noexcept;
+
+            /**
+             * @brief Reverses a detached continuation stack into registration order
+             */
+            static continuation* reversed(continuation* head) noexcept;
+
+            /**
+             * @brief Blocks while the state word equals expected
+             * @param expected Value the caller has observed
+             * @param timeout Maximum time to sleep, nullptr for no limit
+             * @note May return spuriously; callers re-check the state word
+             */
+            void sleepOn(state_type expected, const time::duration* timeout) const noexcept;
+
+            /**
+             * @brief Wakes every consumer sleeping on the state word
+             */
+            void wakeAll() noexcept;
+
+#if !ORIGINAL_PLATFORM_LINUX
+            /**
+             * @brief Mutex and condition that consumers sleep on off Linux
+             * @details Wrappers share PARK_SLOTS slots picked by address, so the state word
+             * stays the only per-wrapper cost. Wrappers sharing a slot may wake each other
+             * spuriously, which sleepOn() callers already tolerate.
+             */
+            struct parkSlot {
+                pMutex mutex;
+                pCondition condition;
+            };
+
+            static constexpr u_integer PARK_SLOTS = 64;  ///< Number of shared parking slots
+
+            /**
+             * @brief Gets the parking slot of this wrapper
+             */
+            parkSlot& parkSlotOf() const noexcept;
+#endif
+
+        protected:
+            /**
+             * @brief Frees the wrapper after the last reference is dropped
+             */
+            virtual void destroy() noexcept;
+
+            /**
+             * @brief Loads the state word with acquire ordering
+             */
+            [[nodiscard]] state_type state() const noexcept;
+
+            /**
+             * @brief Publishes the final state, wakes blocked consumers and fires continuations
+             * @param state VALUE or EXCEPTION
+             * @note The result must be written before calling this
+             */
+            void publish(state_type state) noexcept;
+
+        public:
+            asyncWrapperBase() = default;
+
+            asyncWrapperBase(const asyncWrapperBase&) = delete;
+            asyncWrapperBase& operator=(const asyncWrapperBase&) = delete;
+
+            /**
+             * @brief Adds a reference
+             */
+            void retain() noexcept;
+
+            /**
+             * @brief Drops a reference and destroys the wrapper when it was the last one
+             */
+            void release() noexcept;
 
             /**
              * @brief Checks if the result is ready
              * @return True if result is available (value or exception)
              */
-            [[nodiscard]] bool ready() const;
+            [[nodiscard]] bool ready() const noexcept;
 
             /**
              * @brief Waits until the result becomes ready
              */
-            void wait() const;
+            void wait() const noexcept;
 
             /**
              * @brief Waits for the result with a timeout
              * @param timeout Maximum time to wait
              * @return True if result is ready within timeout, false otherwise
              */
-            bool waitFor(time::duration timeout) const;
+            bool waitFor(const time::duration& timeout) const noexcept;
+
+            /**
+             * @brief Registers a continuation unless the result is already there
+             * @param node Continuation to fire once the result is published
+             * @return False if the result was already published and the node was not attached
+             * @note Once this returns true the node may fire at any time on another thread
+             */
+            bool tryAttach(continuation* node) noexcept;
+
+            /**
+             * @brief Registers a continuation
+             * @param node Continuation to fire once the result is published
+             * @details Fires the node right away on the calling thread if the result
+             * is already there.
+             */
+            void attach(continuation* node) noexcept;
+
+            /**
+             * @brief Cancels continuations still waiting for a result that never came
+             */
+            virtual ~asyncWrapperBase();
+        };
+
+        /**
+         * @class asyncWrapper
+         * @brief Internal wrapper for asynchronous result storage
+         * @tparam TYPE The result type of the asynchronous computation
+         * @details Stores the value or the exception inline; which of them is valid
+         * is decided by the state word of asyncWrapperBase.
+         */
+        template<typename TYPE>
+        class asyncWrapper : public asyncWrapperBase {
+            alternative<TYPE> result_;                        ///< Storage of asynchronous computation result
+            std::exception_ptr e_{};                          ///< Exception pointer for error handling
+            mutable strongPtr<TYPE>* shared_result_{nullptr}; ///< Copy handed out by getPtr(), created on demand
+
+        public:
+            asyncWrapper();
+
+            /**
+             * @brief Sets the result value and marks as ready
+             * @param v The result value to store
+             */
+            void setValue(TYPE&& v);
+
+            /**
+             * @brief Sets an exception and marks as ready
+             * @param e Exception pointer to store
+             */
+            void setException(std::exception_ptr e);
 
             /**
              * @brief Retrieves the result value (blocks until ready)
@@ -85,6 +277,8 @@ namespace original {
             /**
              * @brief Gets a strong pointer to the result value
              * @return Strong pointer to the result
+             * @note The first call copies the result into a strongPtr that is
+             *       shared by all later calls.
              */
             strongPtr<TYPE> getPtr() const;
 
@@ -98,6 +292,298 @@ namespace original {
              * @return Exception pointer (nullptr if no exception)
              */
             [[nodiscard]] std::exception_ptr exception() const;
+
+            ~asyncWrapper() override;
+        };
+
+        /**
+         * @class wrapperPtr
+         * @brief Intrusive pointer to an async wrapper
+         * @tparam TYPE The result type of the asynchronous computation
+         * @details Copies add a reference, moves transfer it, destruction drops it.
+         */
+        template<typename TYPE>
+        class wrapperPtr {
+            asyncWrapper<TYPE>* awr_{nullptr};  ///< Referenced wrapper, or nullptr
+
+        public:
+            wrapperPtr() = default;
+
+            /**
+             * @brief Takes a new reference to the given wrapper
+             * @param awr Wrapper to reference, may be nullptr
+             */
+            explicit wrapperPtr(asyncWrapper<TYPE>* awr) noexcept;
+
+            wrapperPtr(const wrapperPtr& other) noexcept;
+            wrapperPtr& operator=(const wrapperPtr& other) noexcept;
+            wrapperPtr(wrapperPtr&& other) noexcept;
+            wrapperPtr& operator=(wrapperPtr&& other) noexcept;
+
+            asyncWrapper<TYPE>* operator->() const noexcept;
+
+            /**
+             * @brief Gets the referenced wrapper
+             */
+            asyncWrapper<TYPE>* get() const noexcept;
+
+            explicit operator bool() const noexcept;
+
+            ~wrapperPtr();
+        };
+
+        /**
+         * @struct continuationResult
+         * @brief Result type of a continuation callback
+         * @tparam TYPE Result type of the source
+         * @tparam Callback Callback type
+         * @tparam CONSUME Whether the source value is moved into the callback
+         */
+        template<typename TYPE, typename Callback, bool CONSUME>
+        struct continuationResult {
+            using type = std::invoke_result_t<Callback&, std::conditional_t<CONSUME, TYPE, const TYPE&>>;
+        };
+
+        template<typename Callback, bool CONSUME>
+        struct continuationResult<void, Callback, CONSUME> {
+            using type = std::invoke_result_t<Callback&>;
+        };
+
+        /**
+         * @class thenContinuation
+         * @brief Continuation that feeds the source result into a callback
+         * @tparam TYPE Result type of the source
+         * @tparam RESULT Result type of the callback
+         * @tparam Callback Callback type
+         * @tparam CONSUME Whether the source value is moved out (future) or copied (sharedFuture)
+         * @tparam POSTED Whether the callback is posted to a taskDelegator instead of running inline
+         * @details The source is not owned while the node is attached, so a source that
+         * is dropped without a result cancels the node instead of leaking it. When the
+         * node is posted to a taskDelegator it keeps the source alive until it has run.
+         */
+        template<typename TYPE, typename RESULT, typename Callback, bool CONSUME, bool POSTED>
+        class thenContinuation final : public continuation {
+            asyncWrapper<TYPE>* src_;     ///< Source wrapper
+            wrapperPtr<RESULT> dst_;      ///< Wrapper of the future returned by then()
+            Callback c_;                  ///< User callback
+            taskDelegator* delegator_;    ///< Delegator running the callback if POSTED
+            bool retained_{false};        ///< Whether src_ holds a reference taken by fire()
+
+            /**
+             * @brief Passes the source result to the callback
+             * @throws std::exception stored in the source, or thrown by the callback
+             */
+            RESULT invoke();
+
+        public:
+            /**
+             * @brief Constructs an unattached continuation
+             * @param src Source wrapper
+             * @param dst Wrapper receiving the callback result
+             * @param c Callback
+             * @param delegator Delegator to post to, nullptr unless POSTED
+             */
+            template<typename Fn>
+            thenContinuation(asyncWrapper<TYPE>* src, wrapperPtr<RESULT> dst, Fn&& c, taskDelegator* delegator);
+
+            void fire() noexcept override;
+
+            void run() noexcept override;
+
+            void cancel(std::exception_ptr e) noexcept override;
+        };
+
+        /**
+         * @class allJoin
+         * @brief Shared state of whenAll()
+         * @tparam TYPE Result type of the joined futures
+         * @details Every source gets a slot that copies its result when it completes.
+         * The slot that arrives last builds the combined result in source order and
+         * frees the join together with all slots.
+         */
+        template<typename TYPE>
+        class allJoin {
+        public:
+            using resultType = std::conditional_t<std::is_void_v<TYPE>, void, vector<TYPE>>;
+
+        private:
+            /**
+             * @class slot
+             * @brief Per-source continuation of a join
+             */
+            class slot final : public continuation {
+                allJoin* owner_;              ///< Join this slot reports to
+                asyncWrapper<TYPE>* src_;     ///< Source wrapper
+                alternative<TYPE> value_;     ///< Copy of the source value
+                std::exception_ptr e_{};      ///< Exception of the source, if any
+
+                friend class allJoin;
+
+            public:
+                slot(allJoin* owner, asyncWrapper<TYPE>* src);
+
+                void run() noexcept override;
+
+                void cancel(std::exception_ptr e) noexcept override;
+            };
+
+            vector<slot*> slots_;         ///< One slot per source, in source order
+            wrapperPtr<resultType> dst_;  ///< Wrapper of the future returned by whenAll()
+            u_integer pending_{0};        ///< Slots that have not arrived yet
+
+            /**
+             * @brief Records the arrival of one slot, completing the join on the last one
+             */
+            void arrive() noexcept;
+
+        public:
+            /**
+             * @brief Constructs an empty join
+             * @param dst Wrapper receiving the combined result
+             */
+            explicit allJoin(wrapperPtr<resultType> dst);
+
+            /**
+             * @brief Adds a source
+             * @param src Source wrapper
+             */
+            void add(asyncWrapper<TYPE>* src);
+
+            /**
+             * @brief Attaches every slot to its source
+             * @note The join may be freed before this returns
+             */
+            void start() noexcept;
+
+            /**
+             * @brief Frees all slots
+             */
+            ~allJoin();
+        };
+
+        /**
+         * @class anyJoin
+         * @brief Shared state of whenAny()
+         * @details The first slot to arrive publishes its index; the last one frees
+         * the join.
+         */
+        class anyJoin {
+            /**
+             * @class slot
+             * @brief Per-source continuation of a join
+             */
+            class slot final : public continuation {
+                anyJoin* owner_;    ///< Join this slot reports to
+                u_integer index_;   ///< Position of the source
+
+            public:
+                slot(anyJoin* owner, u_integer index);
+
+                void run() noexcept override;
+
+                void cancel(std::exception_ptr e) noexcept override;
+            };
+
+            wrapperPtr<u_integer> dst_;  ///< Wrapper of the future returned by whenAny()
+            u_integer pending_;          ///< Slots that have not arrived yet
+            bool done_{false};           ///< Whether an index has been published
+
+            /**
+             * @brief Records the arrival of one slot
+             * @param index Position of the source
+             * @param e Non-null if the source was dropped without a result
+             */
+            void arrive(u_integer index, std::exception_ptr e) noexcept;
+
+        public:
+            /**
+             * @brief Constructs a join over count sources
+             * @param dst Wrapper receiving the index
+             * @param count Number of sources
+             */
+            anyJoin(wrapperPtr<u_integer> dst, u_integer count);
+
+            /**
+             * @brief Attaches a new slot to a source
+             * @param src Source wrapper
+             * @param index Position of the source
+             * @note The join may be freed before this returns once the last source is attached
+             */
+            void attach(asyncWrapperBase* src, u_integer index);
+        };
+
+        /**
+         * @class postedContinuation
+         * @brief Move-only callable that runs a continuation on a taskDelegator
+         * @details Cancels the continuation if it is destroyed without being called,
+         * which happens when the delegator rejects or discards the task.
+         */
+        class postedContinuation {
+            continuation* node_;  ///< Continuation to run, nullptr once handed over
+
+        public:
+            explicit postedContinuation(continuation* node) noexcept;
+
+            postedContinuation(const postedContinuation&) = delete;
+            postedContinuation& operator=(const postedContinuation&) = delete;
+            postedContinuation(postedContinuation&& other) noexcept;
+            postedContinuation& operator=(postedContinuation&& other) = delete;
+
+            /**
+             * @brief Runs the continuation
+             */
+            void operator()() noexcept;
+
+            ~postedContinuation();
+        };
+
+        /**
+         * @class futureAwaiter
+         * @brief Suspends a coroutine until a future is ready
+         * @tparam FUTURE Future type, const for shared futures
+         * @details The awaiter is itself the continuation attached to the wrapper, so
+         * awaiting does not allocate. The coroutine resumes on the thread that
+         * completes the future.
+         */
+        template<typename FUTURE>
+        class futureAwaiter final : public continuation {
+            FUTURE& f_;                         ///< Awaited future, alive until the co_await finishes
+            std::coroutine_handle<> handle_{};  ///< Suspended coroutine
+
+        public:
+            /**
+             * @brief Constructs an awaiter for a future
+             * @param f Future to await
+             */
+            explicit futureAwaiter(FUTURE& f) noexcept;
+
+            [[nodiscard]] bool await_ready() const;
+
+            bool await_suspend(std::coroutine_handle<> h) noexcept;
+
+            decltype(auto) await_resume();
+
+            void run() noexcept override;
+
+            void cancel(std::exception_ptr e) noexcept override;
+        };
+
+        /**
+         * @struct detachedCoroutine
+         * @brief Fire-and-forget coroutine whose frame frees itself on completion
+         */
+        struct detachedCoroutine {
+            struct promise_type {
+                static detachedCoroutine get_return_object() noexcept;
+
+                static std::suspend_never initial_suspend() noexcept;
+
+                static std::suspend_never final_suspend() noexcept;
+
+                static void return_void() noexcept;
+
+                [[noreturn]] static void unhandled_exception() noexcept;
+            };
         };
 
     public:
@@ -163,10 +649,10 @@ namespace original {
          */
         template<typename TYPE>
         class future final : public futureBase {
-            strongPtr<asyncWrapper<TYPE>> awr_{};  ///< Shared pointer to the async wrapper
+            wrapperPtr<TYPE> awr_{};  ///< Reference to the async wrapper
 
             friend class async;
-            explicit future(strongPtr<asyncWrapper<TYPE>> awr);
+            explicit future(wrapperPtr<TYPE> awr);
 
         public:
             future() = default;
@@ -221,6 +707,44 @@ namespace original {
              * @return True if result is ready within timeout, false otherwise
              */
             [[nodiscard]] bool waitFor(time::duration timeout) const override;
+
+            /**
+             * @brief Awaits the result from a coroutine without blocking a thread
+             * @return Awaiter yielding the result, or rethrowing the stored exception
+             * @details The coroutine resumes on the thread that completes this future,
+             * or continues at once if the result is already there. The result is
+             * consumed as by result().
+             * @throws sysError if the future is invalid
+             */
+            auto operator co_await();
+
+            /**
+             * @brief Registers a continuation that runs once the result is ready
+             * @tparam Callback Callable accepting TYPE
+             * @param c Callback receiving the result
+             * @return A future holding the result of the callback
+             * @details No thread blocks on this future: the callback runs on the thread that
+             * completes it, or right away on the calling thread if the result is already
+             * there. If the computation failed, the callback is skipped and the exception is
+             * forwarded. This future is consumed and becomes invalid.
+             * @throws sysError if the future is invalid
+             */
+            template<typename Callback>
+            auto then(Callback&& c);
+
+            /**
+             * @brief Registers a continuation that is posted to a taskDelegator
+             * @tparam Callback Callable accepting TYPE
+             * @param delegator Delegator running the callback once the result is ready
+             * @param c Callback receiving the result
+             * @return A future holding the result of the callback
+             * @details Same as then(c), except that the completing thread only submits the
+             * callback as a NORMAL task. If the delegator rejects or drops the task, the
+             * returned future holds the error. Requires tasks.h.
+             * @throws sysError if the future is invalid
+             */
+            template<typename Callback>
+            auto then(taskDelegator& delegator, Callback&& c);
         };
 
         /**
@@ -233,10 +757,10 @@ namespace original {
          */
         template<typename TYPE>
         class sharedFuture final : public futureBase, public hashable<sharedFuture<TYPE>> {
-            strongPtr<asyncWrapper<TYPE>> awr_{};
+            wrapperPtr<TYPE> awr_{};
 
             friend class async;
-            explicit sharedFuture(strongPtr<asyncWrapper<TYPE>> awr);
+            explicit sharedFuture(wrapperPtr<TYPE> awr);
 
         public:
             sharedFuture() = default;
@@ -264,8 +788,9 @@ namespace original {
              * @brief Gets a strong pointer to the result value
              * @details Returns a strong reference pointer to the asynchronous result,
              * extending the lifetime of the referenced object and avoiding dangling references.
-             * The pointer approach avoids unnecessary copying
-             * @warning the returned pointer directly references the result stored within the async module.
+             * The result is copied into the pointed-to object on the first call only; later calls
+             * share it, so repeated access avoids unnecessary copying
+             * @warning the returned pointer is shared by all copies of this shared future.
              * Modifying the stored result through constCastTo or other means may cause unexpected behavior
              * and is strongly discouraged.
              * @return Strong pointer to the const result value
@@ -325,6 +850,38 @@ namespace original {
              */
             bool equals(const sharedFuture& other) const noexcept override;
 
+            /**
+             * @brief Awaits the result from a coroutine without blocking a thread
+             * @return Awaiter yielding a copy of the result, or rethrowing the stored exception
+             * @throws sysError if the shared future is invalid
+             * @see future::operator co_await()
+             */
+            auto operator co_await() const;
+
+            /**
+             * @brief Registers a continuation that runs once the result is ready
+             * @tparam Callback Callable accepting const TYPE&
+             * @param c Callback receiving the result
+             * @return A future holding the result of the callback
+             * @details Like future::then(), but the result is passed by const reference and
+             * this shared future stays valid, so several continuations can be attached.
+             * @throws sysError if the shared future is invalid
+             */
+            template<typename Callback>
+            auto then(Callback&& c) const;
+
+            /**
+             * @brief Registers a continuation that is posted to a taskDelegator
+             * @tparam Callback Callable accepting const TYPE&
+             * @param delegator Delegator running the callback once the result is ready
+             * @param c Callback receiving the result
+             * @return A future holding the result of the callback
+             * @details Requires tasks.h.
+             * @throws sysError if the shared future is invalid
+             */
+            template<typename Callback>
+            auto then(taskDelegator& delegator, Callback&& c) const;
+
             ~sharedFuture() override = default;
         };
 
@@ -348,7 +905,7 @@ namespace original {
         template<typename TYPE, typename Callback>
         class promise {
             std::function<TYPE()> c_{};                ///< The computation to execute (one-time use)
-            strongPtr<asyncWrapper<TYPE>> awr_{};      ///< Shared pointer to the async wrapper
+            wrapperPtr<TYPE> awr_{};                    ///< Reference to the async wrapper
             bool valid_{false};                         ///< Whether the promise still holds a valid task
 
         public:
@@ -443,6 +1000,93 @@ namespace original {
          */
         template <typename Callback, typename... Args>
         static auto get(Callback&& c, Args&&... args) -> future<std::invoke_result_t<std::decay_t<Callback>, std::decay_t<Args>...>>;
+
+        /**
+         * @brief Starts a coroutine task and returns a future for its result
+         * @tparam TYPE Result type of the task
+         * @param t Task to start
+         * @return A future that will hold the result of the task
+         * @details The task runs on the calling thread until it first suspends, and
+         * later on whichever thread resumes it: the thread completing an awaited
+         * future, or a taskDelegator worker after `co_await delegator.schedule()`.
+         * Its frame is freed as soon as it finishes.
+         * @throws sysError if the task is invalid
+         */
+        template <typename TYPE>
+        static future<TYPE> spawn(coroutine::task<TYPE> t);
+
+        // ==================== Combinators ====================
+
+        /**
+         * @brief Combines shared futures into one future of all their results
+         * @tparam TYPE The result type of the shared futures
+         * @param futures Shared futures to wait for
+         * @return A future of a vector holding the results in the order of futures
+         *         (future<void> if TYPE is void), ready once every input is ready
+         * @details Registers a continuation on each input, so no thread blocks while
+         * waiting. If any input failed, the result holds the exception of the first
+         * failed input in order. An empty vector gives a ready future.
+         * @throws sysError if any shared future is invalid
+         */
+        template <typename TYPE>
+        static auto whenAll(const vector<sharedFuture<TYPE>>& futures)
+            -> future<typename allJoin<TYPE>::resultType>;
+
+        /**
+         * @brief Waits for the first of several shared futures to become ready
+         * @tparam TYPE The result type of the shared futures
+         * @param futures Shared futures to wait for
+         * @return A future of the index of the first input that became ready,
+         *         with either a value or an exception
+         * @details Registers a continuation on each input, so no thread blocks while
+         * waiting.
+         * @throws sysError if futures is empty or any shared future is invalid
+         */
+        template <typename TYPE>
+        static future<u_integer> whenAny(const vector<sharedFuture<TYPE>>& futures);
+
+    private:
+        /**
+         * @brief Attaches a callback to a wrapper and returns the future of its result
+         * @tparam CONSUME Whether the value is moved out of the source
+         * @tparam POSTED Whether the callback is posted to delegator
+         * @tparam TYPE Result type of the source
+         * @tparam Callback Callback type
+         * @param src Source wrapper
+         * @param delegator Delegator to post the callback to, nullptr unless POSTED
+         * @param c Callback
+         * @return Future of the callback result
+         */
+        template <bool CONSUME, bool POSTED, typename TYPE, typename Callback>
+        static auto chain(asyncWrapper<TYPE>* src, taskDelegator* delegator, Callback&& c);
+
+        /**
+         * @brief Awaits a task and stores its outcome in a wrapper
+         * @tparam TYPE Result type of the task
+         * @param t Task to run, owned by the coroutine frame
+         * @param awr Wrapper receiving the result
+         */
+        template <typename TYPE>
+        static detachedCoroutine drive(coroutine::task<TYPE> t, wrapperPtr<TYPE> awr);
+
+        /**
+         * @brief Submits a continuation to a taskDelegator
+         * @param delegator Delegator to submit to
+         * @param node Continuation to run; cancelled if the delegator rejects or drops it
+         * @note Defined in tasks.h
+         */
+        static void post(taskDelegator& delegator, continuation* node) noexcept;
+
+        /**
+         * @brief Creates a future that references an existing async wrapper
+         * @tparam TYPE The result type of the computation
+         * @param awr Wrapper the future will read from
+         * @return A future sharing ownership of the wrapper
+         * @details Used by producers that allocate the wrapper themselves,
+         * such as taskDelegator for its pooled tasks.
+         */
+        template <typename TYPE>
+        static future<TYPE> makeFuture(asyncWrapper<TYPE>* awr);
     };
 
     /**
@@ -450,6 +1094,7 @@ namespace original {
      * @details This operator dynamically attaches a new callback to an already running future.
      * The callback will be executed once the asynchronous result becomes available.
      * Unlike a lazy pipeline builder, this version modifies the execution flow immediately.
+     * Equivalent to `f.then(c)`: no thread is parked while the result is pending.
      *
      * @tparam T Result type of the future
      * @tparam Callback Callable type, must accept T or T&& (depending on constness and value category)
@@ -465,6 +1110,7 @@ namespace original {
      * @details This operator dynamically attaches a new callback to an already running future<void>.
      * The callback will be executed once the asynchronous task completes. This is suitable for
      * chaining tasks that do not produce a value. Execution is immediate, not deferred.
+     * Equivalent to `f.then(c)`.
      *
      * @tparam Callback Callable type, must accept no arguments
      * @param f Source future<void> representing completion of an asynchronous task
@@ -479,6 +1125,7 @@ namespace original {
      * @details This operator dynamically attaches a new callback to an already running sharedFuture.
      * Unlike lazy task builders, the continuation is immediately scheduled to run once the sharedFuture
      * produces a value. This makes it possible to share and extend asynchronous results across multiple consumers.
+     * Equivalent to `sf.then(c).share()`.
      *
      * @tparam T Result type of the sharedFuture
      * @tparam Callback Callable type, must accept T const& or T (depending on design)
@@ -494,6 +1141,7 @@ namespace original {
      * @details This operator dynamically attaches a new callback to an already running sharedFuture<void>.
      * The callback will be executed once the asynchronous task completes. Since sharedFuture can be copied,
      * multiple consumers can each dynamically attach their own continuations.
+     * Equivalent to `sf.then(c).share()`.
      *
      * @tparam Callback Callable type, must accept no arguments
      * @param sf Source sharedFuture<void> representing completion of an asynchronous task
@@ -553,11 +1201,7 @@ namespace original {
      * @brief Specialization of asyncWrapper for void results
      */
     template <>
-    class async::asyncWrapper<void> {
-        atomic<bool> ready_{makeAtomic(false)};  ///< Atomic flag indicating completion
-        alternative<void> result_;                    ///< Mark of asynchronous computation status
-        mutable pCondition cond_{};                   ///< Condition variable for synchronization
-        mutable pMutex mutex_{};                      ///< Mutex for thread safety
+    class async::asyncWrapper<void> : public asyncWrapperBase {
         std::exception_ptr e_{};                      ///< Exception pointer for error handling
 
     public:
@@ -574,24 +1218,6 @@ namespace original {
          */
         void setException(std::exception_ptr e);
 
-        /**
-         * @brief Checks if the computation is completed
-         * @return True if completed (successfully or with exception)
-         */
-        [[nodiscard]] bool ready() const;
-
-        /**
-         * @brief Waits until the computation completes
-         */
-        void wait() const;
-
-        /**
-         * @brief Waits for the result with a timeout
-         * @param timeout Maximum time to wait
-         * @return True if result is ready within timeout, false otherwise
-         */
-        bool waitFor(const time::duration& timeout) const;
-
         /**
          * @brief Waits for completion and checks for exceptions
          * @throws std::exception if the computation threw an exception
@@ -622,10 +1248,10 @@ namespace original {
      */
     template <>
     class async::future<void> final : public futureBase {
-        strongPtr<asyncWrapper<void>> awr_{};  ///< Shared pointer to the async wrapper
+        wrapperPtr<void> awr_{};  ///< Reference to the async wrapper
 
         friend class async;
-        explicit future(strongPtr<asyncWrapper<void>> awr);
+        explicit future(wrapperPtr<void> awr);
 
     public:
         future() = default;
@@ -679,14 +1305,45 @@ namespace original {
          * @return True if result is ready within timeout, false otherwise
          */
         [[nodiscard]] bool waitFor(time::duration timeout) const override;
+
+        /**
+         * @brief Awaits completion from a coroutine without blocking a thread
+         * @return Awaiter rethrowing the stored exception, if any
+         * @throws sysError if the future is invalid
+         * @see future::operator co_await()
+         */
+        auto operator co_await();
+
+        /**
+         * @brief Registers a continuation that runs once the computation completes
+         * @tparam Callback Callable taking no arguments
+         * @param c Callback to run
+         * @return A future holding the result of the callback
+         * @throws sysError if the future is invalid
+         * @see future::then()
+         */
+        template<typename Callback>
+        auto then(Callback&& c);
+
+        /**
+         * @brief Registers a continuation that is posted to a taskDelegator
+         * @tparam Callback Callable taking no arguments
+         * @param delegator Delegator running the callback once the computation completes
+         * @param c Callback to run
+         * @return A future holding the result of the callback
+         * @throws sysError if the future is invalid
+         * @see future::then()
+         */
+        template<typename Callback>
+        auto then(taskDelegator& delegator, Callback&& c);
     };
 
     template <>
     class async::sharedFuture<void> final : public futureBase, public hashable<sharedFuture<void>> {
-        strongPtr<asyncWrapper<void>> awr_{};
+        wrapperPtr<void> awr_{};
 
         friend class async;
-        explicit sharedFuture(strongPtr<asyncWrapper<void>> awr);
+        explicit sharedFuture(wrapperPtr<void> awr);
 
     public:
         sharedFuture() = default;
@@ -760,6 +1417,37 @@ namespace original {
          */
         [[nodiscard]] bool equals(const sharedFuture& other) const noexcept override;
 
+        /**
+         * @brief Awaits completion from a coroutine without blocking a thread
+         * @return Awaiter rethrowing the stored exception, if any
+         * @throws sysError if the shared future is invalid
+         * @see future::operator co_await()
+         */
+        auto operator co_await() const;
+
+        /**
+         * @brief Registers a continuation that runs once the computation completes
+         * @tparam Callback Callable taking no arguments
+         * @param c Callback to run
+         * @return A future holding the result of the callback
+         * @throws sysError if the shared future is invalid
+         * @see sharedFuture::then()
+         */
+        template<typename Callback>
+        auto then(Callback&& c) const;
+
+        /**
+         * @brief Registers a continuation that is posted to a taskDelegator
+         * @tparam Callback Callable taking no arguments
+         * @param delegator Delegator running the callback once the computation completes
+         * @param c Callback to run
+         * @return A future holding the result of the callback
+         * @throws sysError if the shared future is invalid
+         * @see sharedFuture::then()
+         */
+        template<typename Callback>
+        auto then(taskDelegator& delegator, Callback&& c) const;
+
         ~sharedFuture() override = default;
     };
 
@@ -771,7 +1459,7 @@ namespace original {
     template <typename Callback>
     class async::promise<void, Callback> {
         std::function<void()> c_{};                  ///< The computation to execute (one-time use)
-        strongPtr<asyncWrapper<void>> awr_{};        ///< Shared pointer to the async wrapper
+        wrapperPtr<void> awr_{};                      ///< Reference to the async wrapper
         bool valid_{false};                           ///< Whether the promise still holds a valid task
 
     public:
@@ -807,130 +1495,629 @@ namespace original {
          */
         [[nodiscard]] bool valid() const noexcept;
 
-        /**
-         * @brief Extracts the computation function from the promise
-         * @return The computation function that was associated with this promise
-         * @throws sysError if the promise is invalid
-         */
-        std::function<void()> function();
+        /**
+         * @brief Extracts the computation function from the promise
+         * @return The computation function that was associated with this promise
+         * @throws sysError if the promise is invalid
+         */
+        std::function<void()> function();
+
+        /**
+         * @brief Executes the computation and marks completion in the associated future
+         * @throws sysError if the promise is invalid
+         * @throws Any exception thrown by the computation function
+         */
+        void run();
+    };
+} // namespace original
+
+inline void original::async::continuation::fire() noexcept
+{
+    this->run();
+}
+
+inline original::async::continuation* original::async::asyncWrapperBase::closed() noexcept
+{
+    return reinterpret_cast<continuation*>(alignof(continuation));
+}
+
+inline original::async::continuation* original::async::asyncWrapperBase::reversed(continuation* head) noexcept
+{
+    continuation* prev = nullptr;
+    while (head) {
+        continuation* next = head->next_;
+        head->next_ = prev;
+        prev = head;
+        head = next;
+    }
+    return prev;
+}
+
+inline void original::async::asyncWrapperBase::sleepOn(const state_type expected,
+                                                      const time::duration* timeout) const noexcept
+{
+#if ORIGINAL_PLATFORM_LINUX
+    timespec ts{};
+    if (timeout) {
+        ts = timeout->toTimespec();
+    }
+    syscall(SYS_futex, &this->state_, FUTEX_WAIT_PRIVATE, expected, timeout ? &ts : nullptr, nullptr, 0);
+#else
+    parkSlot& slot = this->parkSlotOf();
+    uniqueLock lock{slot.mutex};
+    // publish() changes the word before it takes the slot mutex to wake, so checking
+    // under the mutex cannot miss the wake
+    if (__atomic_load_n(&this->state_, __ATOMIC_ACQUIRE) != expected) {
+        return;
+    }
+    if (timeout) {
+        slot.condition.waitFor(slot.mutex, *timeout);
+    } else {
+        slot.condition.wait(slot.mutex);
+    }
+#endif
+}
+
+inline void original::async::asyncWrapperBase::wakeAll() noexcept
+{
+#if ORIGINAL_PLATFORM_LINUX
+    syscall(SYS_futex, &this->state_, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+    parkSlot& slot = this->parkSlotOf();
+    uniqueLock lock{slot.mutex};
+    slot.condition.notifyAll();
+#endif
+}
+
+#if !ORIGINAL_PLATFORM_LINUX
+inline original::async::asyncWrapperBase::parkSlot&
+original::async::asyncWrapperBase::parkSlotOf() const noexcept
+{
+    static parkSlot slots[PARK_SLOTS];
+    return slots[reinterpret_cast<std::uintptr_t>(this) / alignof(std::max_align_t) % PARK_SLOTS];
+}
+#endif
+
+inline void original::async::asyncWrapperBase::destroy() noexcept
+{
+    delete this;
+}
+
+inline original::async::asyncWrapperBase::state_type original::async::asyncWrapperBase::state() const noexcept
+{
+    return __atomic_load_n(&this->state_, __ATOMIC_ACQUIRE);
+}
+
+inline void original::async::asyncWrapperBase::publish(const state_type state) noexcept
+{
+    if (__atomic_exchange_n(&this->state_, state, __ATOMIC_ACQ_REL) & WAITING) {
+        this->wakeAll();
+    }
+    continuation* node = reversed(__atomic_exchange_n(&this->conts_, closed(), __ATOMIC_ACQ_REL));
+    while (node) {
+        continuation* next = node->next_;
+        node->fire();
+        node = next;
+    }
+}
+
+inline void original::async::asyncWrapperBase::retain() noexcept
+{
+    __atomic_add_fetch(&this->refs_, 1, __ATOMIC_RELAXED);
+}
+
+inline void original::async::asyncWrapperBase::release() noexcept
+{
+    if (__atomic_sub_fetch(&this->refs_, 1, __ATOMIC_ACQ_REL) == 0) {
+        this->destroy();
+    }
+}
+
+inline bool original::async::asyncWrapperBase::ready() const noexcept
+{
+    return (this->state() & READY_MASK) != 0;
+}
+
+inline void original::async::asyncWrapperBase::wait() const noexcept
+{
+    state_type s = this->state();
+    while (!(s & READY_MASK)) {
+        // Announce the sleeper first so that publish() knows it has to wake someone
+        if (!(s & WAITING) &&
+            !__atomic_compare_exchange_n(&this->state_, &s, s | WAITING, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            continue;
+        }
+        this->sleepOn(s | WAITING, nullptr);
+        s = this->state();
+    }
+}
+
+inline bool original::async::asyncWrapperBase::waitFor(const time::duration& timeout) const noexcept
+{
+    state_type s = this->state();
+    if (s & READY_MASK) {
+        return true;
+    }
+    const time::point start = time::point::now();
+    while (!(s & READY_MASK)) {
+        const time::duration elapsed = time::point::now() - start;
+        if (elapsed >= timeout) {
+            return false;
+        }
+        if (!(s & WAITING) &&
+            !__atomic_compare_exchange_n(&this->state_, &s, s | WAITING, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            continue;
+        }
+        const time::duration remaining = timeout - elapsed;
+        this->sleepOn(s | WAITING, &remaining);
+        s = this->state();
+    }
+    return true;
+}
+
+inline bool original::async::asyncWrapperBase::tryAttach(continuation* node) noexcept
+{
+    continuation* head = __atomic_load_n(&this->conts_, __ATOMIC_ACQUIRE);
+    while (head != closed()) {
+        node->next_ = head;
+        if (__atomic_compare_exchange_n(&this->conts_, &head, node, true, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void original::async::asyncWrapperBase::attach(continuation* node) noexcept
+{
+    if (!this->tryAttach(node)) {
+        node->fire();
+    }
+}
+
+inline original::async::asyncWrapperBase::~asyncWrapperBase()
+{
+    if (this->conts_ == closed()) {
+        return;
+    }
+    continuation* node = reversed(this->conts_);
+    if (!node) {
+        return;
+    }
+    const auto e = std::make_exception_ptr(sysError("Async result dropped before it was set"));
+    while (node) {
+        continuation* next = node->next_;
+        node->cancel(e);
+        node = next;
+    }
+}
+
+template <typename TYPE>
+original::async::asyncWrapper<TYPE>::asyncWrapper() = default;
+
+template <typename TYPE>
+void original::async::asyncWrapper<TYPE>::setValue(TYPE&& v)
+{
+    this->result_.emplace(std::move(v));
+    this->publish(VALUE);
+}
+
+template <typename TYPE>
+void original::async::asyncWrapper<TYPE>::setException(std::exception_ptr e)
+{
+    this->e_ = std::move(e);
+    this->publish(EXCEPTION);
+}
+
+template <typename TYPE>
+TYPE original::async::asyncWrapper<TYPE>::get()
+{
+    this->wait();
+    this->rethrowIfException();
+
+    TYPE result = std::move(*this->result_);
+    this->result_.reset();
+    return result;
+}
+
+template <typename TYPE>
+const TYPE& original::async::asyncWrapper<TYPE>::peek() const
+{
+    this->wait();
+    this->rethrowIfException();
+    return *this->result_;
+}
+
+template <typename TYPE>
+original::strongPtr<TYPE> original::async::asyncWrapper<TYPE>::getPtr() const
+{
+    this->rethrowIfException();
+    strongPtr<TYPE>* cached = __atomic_load_n(&this->shared_result_, __ATOMIC_ACQUIRE);
+    if (!cached) {
+        auto created = new strongPtr<TYPE>(makeStrongPtr<TYPE>(*this->result_));
+        if (__atomic_compare_exchange_n(&this->shared_result_, &cached, created,
+                                        false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            cached = created;
+        } else {
+            delete created;
+        }
+    }
+    return *cached;
+}
+
+template <typename TYPE>
+void original::async::asyncWrapper<TYPE>::rethrowIfException() const
+{
+    if (this->state() & EXCEPTION)
+        std::rethrow_exception(this->e_);
+}
+
+template <typename TYPE>
+std::exception_ptr
+original::async::asyncWrapper<TYPE>::exception() const
+{
+    if (this->state() & EXCEPTION) {
+        return this->e_;
+    }
+    return {};
+}
+
+template <typename TYPE>
+original::async::asyncWrapper<TYPE>::~asyncWrapper()
+{
+    delete this->shared_result_;
+}
+
+template <typename TYPE>
+original::async::wrapperPtr<TYPE>::wrapperPtr(asyncWrapper<TYPE>* awr) noexcept
+    : awr_(awr)
+{
+    if (this->awr_) {
+        this->awr_->retain();
+    }
+}
+
+template <typename TYPE>
+original::async::wrapperPtr<TYPE>::wrapperPtr(const wrapperPtr& other) noexcept
+    : wrapperPtr(other.awr_) {}
+
+template <typename TYPE>
+original::async::wrapperPtr<TYPE>&
+original::async::wrapperPtr<TYPE>::operator=(const wrapperPtr& other) noexcept
+{
+    if (this == &other) {
+        return *this;
+    }
+    if (other.awr_) {
+        other.awr_->retain();
+    }
+    if (this->awr_) {
+        this->awr_->release();
+    }
+    this->awr_ = other.awr_;
+    return *this;
+}
+
+template <typename TYPE>
+original::async::wrapperPtr<TYPE>::wrapperPtr(wrapperPtr&& other) noexcept
+    : awr_(other.awr_)
+{
+    other.awr_ = nullptr;
+}
+
+template <typename TYPE>
+original::async::wrapperPtr<TYPE>&
+original::async::wrapperPtr<TYPE>::operator=(wrapperPtr&& other) noexcept
+{
+    if (this == &other) {
+        return *this;
+    }
+    if (this->awr_) {
+        this->awr_->release();
+    }
+    this->awr_ = other.awr_;
+    other.awr_ = nullptr;
+    return *this;
+}
+
+template <typename TYPE>
+original::async::asyncWrapper<TYPE>* original::async::wrapperPtr<TYPE>::operator->() const noexcept
+{
+    return this->awr_;
+}
+
+template <typename TYPE>
+original::async::asyncWrapper<TYPE>* original::async::wrapperPtr<TYPE>::get() const noexcept
+{
+    return this->awr_;
+}
+
+template <typename TYPE>
+original::async::wrapperPtr<TYPE>::operator bool() const noexcept
+{
+    return this->awr_ != nullptr;
+}
+
+template <typename TYPE>
+original::async::wrapperPtr<TYPE>::~wrapperPtr()
+{
+    if (this->awr_) {
+        this->awr_->release();
+    }
+}
+
+template <typename TYPE, typename RESULT, typename Callback, bool CONSUME, bool POSTED>
+template <typename Fn>
+original::async::thenContinuation<TYPE, RESULT, Callback, CONSUME, POSTED>::thenContinuation(
+    asyncWrapper<TYPE>* src, wrapperPtr<RESULT> dst, Fn&& c, taskDelegator* delegator)
+    : src_(src), dst_(std::move(dst)), c_(std::forward<Fn>(c)), delegator_(delegator) {}
+
+template <typename TYPE, typename RESULT, typename Callback, bool CONSUME, bool POSTED>
+RESULT original::async::thenContinuation<TYPE, RESULT, Callback, CONSUME, POSTED>::invoke()
+{
+    if constexpr (std::is_void_v<TYPE>) {
+        this->src_->peek();
+        return this->c_();
+    } else if constexpr (CONSUME) {
+        return this->c_(this->src_->get());
+    } else {
+        return this->c_(this->src_->peek());
+    }
+}
+
+template <typename TYPE, typename RESULT, typename Callback, bool CONSUME, bool POSTED>
+void original::async::thenContinuation<TYPE, RESULT, Callback, CONSUME, POSTED>::fire() noexcept
+{
+    if constexpr (POSTED) {
+        // The source may lose its last owner before the posted task runs
+        this->src_->retain();
+        this->retained_ = true;
+        async::post(*this->delegator_, this);
+    } else {
+        this->run();
+    }
+}
 
-        /**
-         * @brief Executes the computation and marks completion in the associated future
-         * @throws sysError if the promise is invalid
-         * @throws Any exception thrown by the computation function
-         */
-        void run();
-    };
-} // namespace original
+template <typename TYPE, typename RESULT, typename Callback, bool CONSUME, bool POSTED>
+void original::async::thenContinuation<TYPE, RESULT, Callback, CONSUME, POSTED>::run() noexcept
+{
+    try {
+        if constexpr (std::is_void_v<RESULT>) {
+            this->invoke();
+            this->dst_->setValue();
+        } else {
+            this->dst_->setValue(this->invoke());
+        }
+    } catch (...) {
+        this->dst_->setException(std::current_exception());
+    }
+    if (this->retained_) {
+        this->src_->release();
+    }
+    delete this;
+}
+
+template <typename TYPE, typename RESULT, typename Callback, bool CONSUME, bool POSTED>
+void original::async::thenContinuation<TYPE, RESULT, Callback, CONSUME, POSTED>::cancel(std::exception_ptr e) noexcept
+{
+    this->dst_->setException(std::move(e));
+    if (this->retained_) {
+        this->src_->release();
+    }
+    delete this;
+}
 
 template <typename TYPE>
-original::async::asyncWrapper<TYPE>::asyncWrapper() = default;
+original::async::allJoin<TYPE>::slot::slot(allJoin* owner, asyncWrapper<TYPE>* src)
+    : owner_(owner), src_(src) {}
 
 template <typename TYPE>
-void original::async::asyncWrapper<TYPE>::setValue(TYPE&& v)
+void original::async::allJoin<TYPE>::slot::run() noexcept
 {
-    {
-        uniqueLock lock{this->mutex_};
-        this->result_ = makeStrongPtr<TYPE>(std::move(v));
-        this->ready_.store(true);
+    try {
+        if constexpr (std::is_void_v<TYPE>) {
+            this->src_->peek();
+        } else {
+            this->value_.emplace(this->src_->peek());
+        }
+    } catch (...) {
+        this->e_ = std::current_exception();
     }
-    this->cond_.notifyAll();
+    this->owner_->arrive();
 }
 
 template <typename TYPE>
-void original::async::asyncWrapper<TYPE>::setException(std::exception_ptr e)
+void original::async::allJoin<TYPE>::slot::cancel(std::exception_ptr e) noexcept
 {
-    {
-        uniqueLock lock{this->mutex_};
-        this->e_ = std::move(e);
-        this->ready_.store(true);
-    }
-    this->cond_.notifyAll();
+    this->e_ = std::move(e);
+    this->owner_->arrive();
 }
 
 template <typename TYPE>
-bool original::async::asyncWrapper<TYPE>::ready() const
+original::async::allJoin<TYPE>::allJoin(wrapperPtr<resultType> dst)
+    : dst_(std::move(dst)) {}
+
+template <typename TYPE>
+void original::async::allJoin<TYPE>::add(asyncWrapper<TYPE>* src)
 {
-    return *this->ready_;
+    this->slots_.pushEnd(new slot(this, src));
+    this->pending_ += 1;
 }
 
 template <typename TYPE>
-void original::async::asyncWrapper<TYPE>::wait() const
+void original::async::allJoin<TYPE>::start() noexcept
 {
-    uniqueLock lock{this->mutex_};
-    this->cond_.wait(this->mutex_, [this]
-    {
-        return this->ready();
-    });
+    const u_integer count = this->slots_.size();
+    for (u_integer i = 0; i < count; ++i) {
+        slot* s = this->slots_[i];
+        s->src_->attach(s);
+    }
 }
 
 template <typename TYPE>
-bool original::async::asyncWrapper<TYPE>::waitFor(time::duration timeout) const
+void original::async::allJoin<TYPE>::arrive() noexcept
 {
-    uniqueLock lock{this->mutex_};
-    return this->cond_.waitFor(this->mutex_, timeout, [this]
-    {
-        return this->ready();
-    });
+    if (__atomic_sub_fetch(&this->pending_, 1, __ATOMIC_ACQ_REL) != 0) {
+        return;
+    }
+    const u_integer count = this->slots_.size();
+    try {
+        for (u_integer i = 0; i < count; ++i) {
+            if (this->slots_[i]->e_) {
+                std::rethrow_exception(this->slots_[i]->e_);
+            }
+        }
+        if constexpr (std::is_void_v<TYPE>) {
+            this->dst_->setValue();
+        } else {
+            vector<TYPE> values;
+            for (u_integer i = 0; i < count; ++i) {
+                values.pushEnd(*this->slots_[i]->value_);
+            }
+            this->dst_->setValue(std::move(values));
+        }
+    } catch (...) {
+        this->dst_->setException(std::current_exception());
+    }
+    delete this;
 }
 
 template <typename TYPE>
-TYPE original::async::asyncWrapper<TYPE>::get()
+original::async::allJoin<TYPE>::~allJoin()
 {
-    uniqueLock lock{this->mutex_};
-    this->cond_.wait(this->mutex_, [this]{
-        return this->ready();
-    });
+    const u_integer count = this->slots_.size();
+    for (u_integer i = 0; i < count; ++i) {
+        delete this->slots_[i];
+    }
+}
 
-    this->rethrowIfException();
+inline original::async::anyJoin::slot::slot(anyJoin* owner, const u_integer index)
+    : owner_(owner), index_(index) {}
 
-    TYPE result = std::move(*this->result_);
-    this->result_.reset();
-    return result;
+inline void original::async::anyJoin::slot::run() noexcept
+{
+    this->owner_->arrive(this->index_, nullptr);
+    delete this;
 }
 
-template <typename TYPE>
-const TYPE& original::async::asyncWrapper<TYPE>::peek() const
+inline void original::async::anyJoin::slot::cancel(std::exception_ptr e) noexcept
 {
-    uniqueLock lock{this->mutex_};
-    this->cond_.wait(this->mutex_, [this]{
-        return this->ready();
-    });
+    this->owner_->arrive(this->index_, std::move(e));
+    delete this;
+}
 
-    this->rethrowIfException();
-    return *this->result_;
+inline original::async::anyJoin::anyJoin(wrapperPtr<u_integer> dst, const u_integer count)
+    : dst_(std::move(dst)), pending_(count) {}
+
+inline void original::async::anyJoin::arrive(const u_integer index, std::exception_ptr e) noexcept
+{
+    if (!e && !__atomic_exchange_n(&this->done_, true, __ATOMIC_ACQ_REL)) {
+        this->dst_->setValue(u_integer{index});
+    }
+    if (__atomic_sub_fetch(&this->pending_, 1, __ATOMIC_ACQ_REL) != 0) {
+        return;
+    }
+    // Every source was dropped without a result
+    if (!__atomic_load_n(&this->done_, __ATOMIC_ACQUIRE)) {
+        this->dst_->setException(std::move(e));
+    }
+    delete this;
 }
 
-template <typename TYPE>
-original::strongPtr<TYPE> original::async::asyncWrapper<TYPE>::getPtr() const
+inline void original::async::anyJoin::attach(asyncWrapperBase* src, const u_integer index)
 {
-    this->rethrowIfException();
-    return this->result_;
+    src->attach(new slot(this, index));
 }
 
-template <typename TYPE>
-void original::async::asyncWrapper<TYPE>::rethrowIfException() const
+inline original::async::postedContinuation::postedContinuation(continuation* node) noexcept
+    : node_(node) {}
+
+inline original::async::postedContinuation::postedContinuation(postedContinuation&& other) noexcept
+    : node_(other.node_)
 {
-    if (this->e_)
-        std::rethrow_exception(this->e_);
+    other.node_ = nullptr;
 }
 
-template <typename TYPE>
-std::exception_ptr
-original::async::asyncWrapper<TYPE>::exception() const
+inline void original::async::postedContinuation::operator()() noexcept
+{
+    continuation* node = this->node_;
+    this->node_ = nullptr;
+    node->run();
+}
+
+inline original::async::postedContinuation::~postedContinuation()
+{
+    if (this->node_) {
+        this->node_->cancel(std::make_exception_ptr(sysError("Continuation dropped by its taskDelegator")));
+    }
+}
+
+template <typename FUTURE>
+original::async::futureAwaiter<FUTURE>::futureAwaiter(FUTURE& f) noexcept
+    : f_(f) {}
+
+template <typename FUTURE>
+bool original::async::futureAwaiter<FUTURE>::await_ready() const
+{
+    return this->f_.ready();
+}
+
+template <typename FUTURE>
+bool original::async::futureAwaiter<FUTURE>::await_suspend(const std::coroutine_handle<> h) noexcept
+{
+    this->handle_ = h;
+    return this->f_.awr_->tryAttach(this);
+}
+
+template <typename FUTURE>
+decltype(auto) original::async::futureAwaiter<FUTURE>::await_resume()
+{
+    return this->f_.result();
+}
+
+template <typename FUTURE>
+void original::async::futureAwaiter<FUTURE>::run() noexcept
+{
+    this->handle_.resume();
+}
+
+template <typename FUTURE>
+void original::async::futureAwaiter<FUTURE>::cancel(std::exception_ptr) noexcept
 {
-    uniqueLock lock{this->mutex_};
-    return this->e_;
+    // Unreachable while the awaited future holds its wrapper; resume so await_resume reports the state
+    this->handle_.resume();
+}
+
+inline original::async::detachedCoroutine
+original::async::detachedCoroutine::promise_type::get_return_object() noexcept
+{
+    return detachedCoroutine{};
+}
+
+inline std::suspend_never original::async::detachedCoroutine::promise_type::initial_suspend() noexcept
+{
+    return std::suspend_never{};
+}
+
+inline std::suspend_never original::async::detachedCoroutine::promise_type::final_suspend() noexcept
+{
+    return std::suspend_never{};
+}
+
+inline void original::async::detachedCoroutine::promise_type::return_void() noexcept {}
+
+inline void original::async::detachedCoroutine::promise_type::unhandled_exception() noexcept
+{
+    std::terminate();
 }
 
 template <typename TYPE>
-original::async::future<TYPE>::future(strongPtr<asyncWrapper<TYPE>> awr)
+original::async::future<TYPE>::future(wrapperPtr<TYPE> awr)
     : awr_(std::move(awr)) {}
 
 template <typename TYPE>
 bool original::async::future<TYPE>::valid() const noexcept
 {
-    return this->awr_ != nullptr;
+    return static_cast<bool>(this->awr_);
 }
 
 template <typename TYPE>
@@ -986,13 +2173,44 @@ bool original::async::future<TYPE>::waitFor(time::duration timeout) const
 }
 
 template <typename TYPE>
-original::async::sharedFuture<TYPE>::sharedFuture(strongPtr<asyncWrapper<TYPE>> awr)
+auto original::async::future<TYPE>::operator co_await()
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid future");
+    }
+    return futureAwaiter<future>{*this};
+}
+
+template <typename TYPE>
+template <typename Callback>
+auto original::async::future<TYPE>::then(Callback&& c)
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid future");
+    }
+    const wrapperPtr<TYPE> src = std::move(this->awr_);
+    return async::chain<true, false>(src.get(), nullptr, std::forward<Callback>(c));
+}
+
+template <typename TYPE>
+template <typename Callback>
+auto original::async::future<TYPE>::then(taskDelegator& delegator, Callback&& c)
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid future");
+    }
+    const wrapperPtr<TYPE> src = std::move(this->awr_);
+    return async::chain<true, true>(src.get(), &delegator, std::forward<Callback>(c));
+}
+
+template <typename TYPE>
+original::async::sharedFuture<TYPE>::sharedFuture(wrapperPtr<TYPE> awr)
     : awr_(std::move(awr)) {}
 
 template <typename TYPE>
 bool original::async::sharedFuture<TYPE>::valid() const noexcept
 {
-    return this->awr_ != nullptr;
+    return static_cast<bool>(this->awr_);
 }
 
 template <typename TYPE>
@@ -1037,13 +2255,13 @@ std::exception_ptr original::async::sharedFuture<TYPE>::exception() const noexce
 template <typename TYPE>
 bool original::async::sharedFuture<TYPE>::operator==(const sharedFuture& other) const noexcept
 {
-    return this->awr_ == other.awr_;
+    return this->awr_.get() == other.awr_.get();
 }
 
 template <typename TYPE>
 bool original::async::sharedFuture<TYPE>::operator!=(const sharedFuture& other) const noexcept
 {
-    return this->awr_ != other.awr_;
+    return this->awr_.get() != other.awr_.get();
 }
 
 template <typename TYPE>
@@ -1067,7 +2285,7 @@ bool original::async::sharedFuture<TYPE>::waitFor(time::duration timeout) const
 template <typename TYPE>
 original::u_integer original::async::sharedFuture<TYPE>::toHash() const noexcept
 {
-    return this->awr_.toHash();
+    return hash<asyncWrapper<TYPE>>::hashFunc(this->awr_.get());
 }
 
 template <typename TYPE>
@@ -1076,6 +2294,35 @@ bool original::async::sharedFuture<TYPE>::equals(const sharedFuture& other) cons
     return *this == other;
 }
 
+template <typename TYPE>
+auto original::async::sharedFuture<TYPE>::operator co_await() const
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid sharedFuture");
+    }
+    return futureAwaiter<const sharedFuture>{*this};
+}
+
+template <typename TYPE>
+template <typename Callback>
+auto original::async::sharedFuture<TYPE>::then(Callback&& c) const
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid sharedFuture");
+    }
+    return async::chain<false, false>(this->awr_.get(), nullptr, std::forward<Callback>(c));
+}
+
+template <typename TYPE>
+template <typename Callback>
+auto original::async::sharedFuture<TYPE>::then(taskDelegator& delegator, Callback&& c) const
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid sharedFuture");
+    }
+    return async::chain<false, true>(this->awr_.get(), &delegator, std::forward<Callback>(c));
+}
+
 template <typename TYPE, typename Callback>
 original::async::promise<TYPE, Callback>::promise(promise&& other) noexcept
 {
@@ -1104,7 +2351,7 @@ original::async::promise<TYPE, Callback>::operator=(promise&& other) noexcept
 
 template <typename TYPE, typename Callback>
 original::async::promise<TYPE, Callback>::promise(Callback&& c)
-    : c_(std::forward<Callback>(c)), awr_(makeStrongPtr<asyncWrapper<TYPE>>()), valid_(true) {}
+    : c_(std::forward<Callback>(c)), awr_(new asyncWrapper<TYPE>), valid_(true) {}
 
 template <typename TYPE, typename Callback>
 original::async::future<TYPE>
@@ -1172,44 +2419,129 @@ auto original::async::get(Callback&& c, Args&&... args)
     return fut;
 }
 
+template <typename TYPE>
+original::async::future<TYPE> original::async::spawn(coroutine::task<TYPE> t)
+{
+    if (!t.valid()) {
+        throw sysError("Spawn an invalid coroutine task");
+    }
+    wrapperPtr<TYPE> awr{new asyncWrapper<TYPE>};
+    future<TYPE> f{awr};
+    drive(std::move(t), std::move(awr));
+    return f;
+}
+
+template <typename TYPE>
+original::async::detachedCoroutine
+original::async::drive(coroutine::task<TYPE> t, wrapperPtr<TYPE> awr)
+{
+    try {
+        if constexpr (std::is_void_v<TYPE>) {
+            co_await std::move(t);
+            awr->setValue();
+        } else {
+            awr->setValue(co_await std::move(t));
+        }
+    } catch (...) {
+        awr->setException(std::current_exception());
+    }
+}
+
+template <typename TYPE>
+auto original::async::whenAll(const vector<sharedFuture<TYPE>>& futures)
+    -> future<typename allJoin<TYPE>::resultType>
+{
+    using ResultType = typename allJoin<TYPE>::resultType;
+    const u_integer count = futures.size();
+    for (u_integer i = 0; i < count; ++i) {
+        if (!futures.get(i).valid()) {
+            throw sysError("Access an invalid sharedFuture");
+        }
+    }
+    wrapperPtr<ResultType> dst{new asyncWrapper<ResultType>};
+    future<ResultType> f{dst};
+    if (count == 0) {
+        if constexpr (std::is_void_v<TYPE>) {
+            dst->setValue();
+        } else {
+            dst->setValue(ResultType{});
+        }
+        return f;
+    }
+    auto join = new allJoin<TYPE>(std::move(dst));
+    try {
+        for (u_integer i = 0; i < count; ++i) {
+            join->add(futures.get(i).awr_.get());
+        }
+    } catch (...) {
+        delete join;
+        throw;
+    }
+    join->start();
+    return f;
+}
+
+template <typename TYPE>
+original::async::future<original::u_integer> original::async::whenAny(const vector<sharedFuture<TYPE>>& futures)
+{
+    const u_integer count = futures.size();
+    if (count == 0) {
+        throw sysError("whenAny() needs at least one sharedFuture");
+    }
+    for (u_integer i = 0; i < count; ++i) {
+        if (!futures.get(i).valid()) {
+            throw sysError("Access an invalid sharedFuture");
+        }
+    }
+    wrapperPtr<u_integer> dst{new asyncWrapper<u_integer>};
+    future<u_integer> f{dst};
+    auto join = new anyJoin(std::move(dst), count);
+    for (u_integer i = 0; i < count; ++i) {
+        join->attach(futures.get(i).awr_.get(), i);
+    }
+    return f;
+}
+
+template <bool CONSUME, bool POSTED, typename TYPE, typename Callback>
+auto original::async::chain(asyncWrapper<TYPE>* src, taskDelegator* delegator, Callback&& c)
+{
+    using CallbackType = std::decay_t<Callback>;
+    using ResultType = typename continuationResult<TYPE, CallbackType, CONSUME>::type;
+    wrapperPtr<ResultType> dst{new asyncWrapper<ResultType>};
+    future<ResultType> f{dst};
+    src->attach(new thenContinuation<TYPE, ResultType, CallbackType, CONSUME, POSTED>(
+        src, std::move(dst), std::forward<Callback>(c), delegator));
+    return f;
+}
+
+template <typename TYPE>
+original::async::future<TYPE> original::async::makeFuture(asyncWrapper<TYPE>* awr)
+{
+    return future<TYPE>(wrapperPtr<TYPE>{awr});
+}
+
 template <typename T, typename Callback>
 auto original::operator|(async::future<T> f, Callback&& c)
 {
-    using ResultType = std::invoke_result_t<Callback, T>;
-    strongPtr<async::future<T>> shared_f = makeStrongPtr<async::future<T>>(std::move(f));
-    return async::get([shared_f, c = std::forward<Callback>(c)] mutable -> ResultType {
-        return c(shared_f->result());
-    });
+    return f.then(std::forward<Callback>(c));
 }
 
 template <typename Callback>
 auto original::operator|(async::future<void> f, Callback&& c)
 {
-    using ResultType = std::invoke_result_t<Callback>;
-    strongPtr<async::future<void>> shared_f = makeStrongPtr<async::future<void>>(std::move(f));
-    return async::get([shared_f, c = std::forward<Callback>(c)]() mutable -> ResultType {
-        shared_f->result();
-        return c();
-    });
+    return f.then(std::forward<Callback>(c));
 }
 
 template <typename T, typename Callback>
 auto original::operator|(async::sharedFuture<T> sf, Callback&& c)
 {
-    using ResultType = std::invoke_result_t<Callback, T>;
-    return async::get([sf, c = std::forward<Callback>(c)] mutable -> ResultType {
-        return c(sf.result());
-    }).share();
+    return sf.then(std::forward<Callback>(c)).share();
 }
 
 template <typename Callback>
 auto original::operator|(async::sharedFuture<void> sf, Callback&& c)
 {
-    using ResultType = std::invoke_result_t<Callback>;
-    return async::get([sf, c = std::forward<Callback>(c)]() mutable -> ResultType {
-        sf.result();
-        return c();
-    }).share();
+    return sf.then(std::forward<Callback>(c)).share();
 }
 
 template <typename T, typename Callback1, typename Callback2>
@@ -1241,87 +2573,48 @@ auto original::operator|(async::promise<void, Callback1> p, Callback2&& c)
 
 inline void original::async::asyncWrapper<void>::setValue()
 {
-    {
-        uniqueLock lock{this->mutex_};
-        this->result_.set();
-        this->ready_.store(true);
-    }
-    this->cond_.notifyAll();
+    this->publish(VALUE);
 }
 
 inline void original::async::asyncWrapper<void>::setException(std::exception_ptr e)
 {
-    {
-        uniqueLock lock{this->mutex_};
-        this->e_ = std::move(e);
-        this->ready_.store(true);
-    }
-    this->cond_.notifyAll();
-}
-
-inline bool original::async::asyncWrapper<void>::ready() const
-{
-    return *this->ready_;
-}
-
-inline void original::async::asyncWrapper<void>::wait() const
-{
-    uniqueLock lock{this->mutex_};
-    this->cond_.wait(this->mutex_, [this]
-    {
-        return this->ready();
-    });
-}
-
-inline bool original::async::asyncWrapper<void>::waitFor(const time::duration& timeout) const
-{
-    uniqueLock lock{this->mutex_};
-    return this->cond_.waitFor(this->mutex_, timeout, [this]
-    {
-       return this->ready();
-    });
+    this->e_ = std::move(e);
+    this->publish(EXCEPTION);
 }
 
 inline void original::async::asyncWrapper<void>::get()
 {
-    uniqueLock lock{this->mutex_};
-    this->cond_.wait(this->mutex_, [this] {
-        return this->ready();
-    });
-
+    this->wait();
     this->rethrowIfException();
-    this->result_.reset();
 }
 
 inline void original::async::asyncWrapper<void>::peek() const
 {
-    uniqueLock lock{this->mutex_};
-    this->cond_.wait(this->mutex_, [this] {
-        return this->ready();
-    });
-
+    this->wait();
     this->rethrowIfException();
 }
 
 inline void original::async::asyncWrapper<void>::rethrowIfException() const
 {
-    if (this->e_)
+    if (this->state() & EXCEPTION)
         std::rethrow_exception(this->e_);
 }
 
 inline std::exception_ptr
 original::async::asyncWrapper<void>::exception() const noexcept
 {
-    uniqueLock lock{this->mutex_};
-    return this->e_;
+    if (this->state() & EXCEPTION) {
+        return this->e_;
+    }
+    return {};
 }
 
-inline original::async::future<void>::future(strongPtr<asyncWrapper<void>> awr)
+inline original::async::future<void>::future(wrapperPtr<void> awr)
     : awr_(std::move(awr)) {}
 
 inline bool original::async::future<void>::valid() const noexcept
 {
-    return this->awr_ != nullptr;
+    return static_cast<bool>(this->awr_);
 }
 
 inline original::async::sharedFuture<void> original::async::future<void>::share()
@@ -1369,12 +2662,40 @@ inline bool original::async::future<void>::waitFor(const time::duration timeout)
     return this->awr_->waitFor(timeout);
 }
 
-inline original::async::sharedFuture<void>::sharedFuture(strongPtr<asyncWrapper<void>> awr)
+inline auto original::async::future<void>::operator co_await()
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid future");
+    }
+    return futureAwaiter<future>{*this};
+}
+
+template <typename Callback>
+auto original::async::future<void>::then(Callback&& c)
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid future");
+    }
+    const wrapperPtr<void> src = std::move(this->awr_);
+    return async::chain<true, false>(src.get(), nullptr, std::forward<Callback>(c));
+}
+
+template <typename Callback>
+auto original::async::future<void>::then(taskDelegator& delegator, Callback&& c)
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid future");
+    }
+    const wrapperPtr<void> src = std::move(this->awr_);
+    return async::chain<true, true>(src.get(), &delegator, std::forward<Callback>(c));
+}
+
+inline original::async::sharedFuture<void>::sharedFuture(wrapperPtr<void> awr)
     : awr_(std::move(awr)) {}
 
 inline bool original::async::sharedFuture<void>::valid() const noexcept
 {
-    return this->awr_ != nullptr;
+    return static_cast<bool>(this->awr_);
 }
 
 inline void original::async::sharedFuture<void>::result() const
@@ -1403,12 +2724,12 @@ inline std::exception_ptr original::async::sharedFuture<void>::exception() const
 
 inline bool original::async::sharedFuture<void>::operator==(const sharedFuture& other) const noexcept
 {
-    return this->awr_ == other.awr_;
+    return this->awr_.get() == other.awr_.get();
 }
 
 inline bool original::async::sharedFuture<void>::operator!=(const sharedFuture& other) const noexcept
 {
-    return this->awr_ != other.awr_;
+    return this->awr_.get() != other.awr_.get();
 }
 
 
@@ -1430,7 +2751,7 @@ inline bool original::async::sharedFuture<void>::waitFor(const time::duration ti
 
 inline original::u_integer original::async::sharedFuture<void>::toHash() const noexcept
 {
-    return this->awr_.toHash();
+    return hash<asyncWrapper<void>>::hashFunc(this->awr_.get());
 }
 
 inline bool original::async::sharedFuture<void>::equals(const sharedFuture& other) const noexcept
@@ -1438,6 +2759,32 @@ inline bool original::async::sharedFuture<void>::equals(const sharedFuture& othe
     return *this == other;
 }
 
+inline auto original::async::sharedFuture<void>::operator co_await() const
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid sharedFuture");
+    }
+    return futureAwaiter<const sharedFuture>{*this};
+}
+
+template <typename Callback>
+auto original::async::sharedFuture<void>::then(Callback&& c) const
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid sharedFuture");
+    }
+    return async::chain<false, false>(this->awr_.get(), nullptr, std::forward<Callback>(c));
+}
+
+template <typename Callback>
+auto original::async::sharedFuture<void>::then(taskDelegator& delegator, Callback&& c) const
+{
+    if (!this->valid()) {
+        throw sysError("Access an invalid sharedFuture");
+    }
+    return async::chain<false, true>(this->awr_.get(), &delegator, std::forward<Callback>(c));
+}
+
 template <typename Callback>
 original::async::promise<void, Callback>::promise(promise&& other) noexcept
 {
@@ -1465,7 +2812,7 @@ original::async::promise<void, Callback>& original::async::promise<void, Callbac
 
 template <typename Callback>
 original::async::promise<void, Callback>::promise(Callback&& c)
-    : c_(std::forward<Callback>(c)), awr_(makeStrongPtr<asyncWrapper<void>>()), valid_(true) {}
+    : c_(std::forward<Callback>(c)), awr_(new asyncWrapper<void>), valid_(true) {}
 
 template <typename Callback>
 original::async::future<void> original::async::promise<void, Callback>::getFuture() const
@@ -0,0 +1,649 @@
+/**
+ * @file concurrentMaps.h
+ * @brief Thread-safe map implementations
+ * @details
+ * This header defines `concurrentJMap`, an ordered map backed by the lock-free
+ * `concurrentSkipList`. It exposes the operations of the `map` interface, but every
+ * member function except assignment and destruction may be called from several
+ * threads at once without external locking:
+ * - Lookups (containsKey, get, contains) are lock-free and never write shared memory
+ * - add, remove and update are lock-free
+ * - operator[] returns a copy of the value and never inserts, since a reference
+ *   into a shared entry could outlive it or race with update()
+ * - Iteration is weakly consistent: an iterator never fails and never returns an
+ *   element twice, it returns every element present for the whole traversal, and
+ *   may or may not return elements added or removed during the traversal
+ *
+ * Removed nodes are reclaimed with epoch-based reclamation (see epochs.h). An
+ * iterator keeps the map pinned while it is alive, so the element it points to stays
+ * readable even if it is removed concurrently; long-lived iterators delay reclamation.
+ */
+
+#ifndef ORIGINAL_CONCURRENT_MAPS_H
+#define ORIGINAL_CONCURRENT_MAPS_H
+
+#include <limits>
+#include <sstream>
+#include "concurrentSkipList.h"
+#include "container.h"
+#include "couple.h"
+#include "iterable.h"
+#include "ownerPtr.h"
+
+namespace original {
+
+    /**
+     * @class concurrentJMap
+     * @tparam K_TYPE Key type (must be comparable, copyable and default-constructible)
+     * @tparam V_TYPE Value type
+     * @tparam Compare Comparison function type (default: increaseComparator<K_TYPE>)
+     * @tparam ALLOC Allocator type (default: allocator<couple<const K_TYPE, V_TYPE>>),
+     *         must be safe to use from several threads at once
+     * @brief Lock-free skip list based map
+     * @details Replacement for a `JMap` guarded by a `pMutex`: readers never
+     * serialize and writers only contend on the nodes they modify. It offers the
+     * operations of `map`, except that element access returns values instead of
+     * references, so it derives from `container` rather than `map`.
+     *
+     * Performance Characteristics:
+     * - Insertion: Average O(log n), lock-free
+     * - Lookup: Average O(log n), lock-free, no shared writes
+     * - Deletion: Average O(log n), lock-free
+     *
+     * The implementation guarantees:
+     * - Elements sorted by key according to comparator
+     * - Unique keys (no duplicates)
+     * - Linearizable add, remove, update, containsKey and get
+     * - Weakly consistent iteration, size() is exact only when no update is in flight
+     *
+     * @note Values are replaced as a whole by update(); references returned by
+     * Iterator::get() stay valid while the iterator lives and must not be written to
+     * while other threads access the same key.
+     * @note Copying takes a weakly consistent snapshot of the source. Assignment and
+     * destruction require exclusive access to the assigned or destroyed map.
+     */
+    template <typename K_TYPE,
+              typename V_TYPE,
+              typename Compare = increaseComparator<K_TYPE>,
+              typename ALLOC = allocator<couple<const K_TYPE, V_TYPE>>>
+    class concurrentJMap final : public concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>,
+                                 public container<couple<const K_TYPE, V_TYPE>, ALLOC>,
+                                 public iterable<couple<const K_TYPE, V_TYPE>>,
+                                 public printable {
+
+        using skipListType = concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>;
+
+        /**
+         * @typedef skipListNode
+         * @brief Internal node type used for Skip List storage
+         */
+        using skipListNode = skipListType::skipListNode;
+
+    public:
+        /**
+         * @class Iterator
+         * @brief Weakly consistent forward iterator for concurrentJMap
+         * @details Holds an epoch guard of the map for its whole lifetime, so the
+         * current node is never reclaimed under it. Deleted nodes are skipped when
+         * advancing.
+         *
+         * Iterator Characteristics:
+         * - Forward iteration only (throws on reverse operations)
+         * - Never invalidated by concurrent modification
+         * - Stepping past the iterator returned by ends() always reaches the end,
+         *   so end() is a stable sentinel under concurrent appends
+         */
+        class Iterator final : public baseIterator<couple<const K_TYPE, V_TYPE>> {
+            const concurrentJMap* map_;       ///< Iterated map
+            epochDomain::guard guard_;        ///< Keeps visited nodes alive
+            mutable skipListNode* cur_;       ///< Current node, nullptr at the end
+            mutable bool last_;               ///< Whether the next step ends the traversal
+
+            /**
+             * @brief Constructs iterator pointing to a node
+             * @param map Iterated map
+             * @param guard Guard pinned before cur was read
+             * @param cur Current node pointer
+             * @param last Whether the next step ends the traversal
+             */
+            Iterator(const concurrentJMap* map, epochDomain::guard guard, skipListNode* cur, bool last);
+
+            /**
+             * @brief Compares iterator pointers for equality
+             * @param other Iterator to compare with
+             * @return true if iterators point to same element
+             */
+            bool equalPtr(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
+
+        public:
+            friend class concurrentJMap;
+
+            /**
+             * @brief Copy constructor, pins the map again
+             * @param other Iterator to copy
+             */
+            Iterator(const Iterator& other);
+
+            /**
+             * @brief Copy assignment operator
+             * @param other Iterator to copy
+             * @return Reference to this iterator
+             */
+            Iterator& operator=(const Iterator& other);
+
+            /**
+             * @brief Creates a copy of this iterator
+             * @return New iterator instance
+             */
+            Iterator* clone() const override;
+
+            /**
+             * @brief Gets iterator class name
+             * @return "concurrentJMap::Iterator"
+             */
+            [[nodiscard]] std::string className() const override;
+
+            /**
+             * @brief Advances iterator by steps
+             * @param steps Number of positions to advance
+             * @throw unSupportedMethodError if steps is negative
+             */
+            void operator+=(integer steps) const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            void operator-=(integer steps) const override;
+
+            /**
+             * @brief Calculates distance between iterators
+             * @param other Iterator to calculate distance to
+             * @return Distance between iterators
+             * @note Returns max/min integer values if iterators are not compatible
+             */
+            integer operator-(const iterator<couple<const K_TYPE, V_TYPE>> &other) const override;
+
+            /**
+             * @brief Checks if more elements exist in forward direction
+             * @return true if more elements available
+             */
+            [[nodiscard]] bool hasNext() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            [[nodiscard]] bool hasPrev() const override;
+
+            /**
+             * @brief Checks if other is previous to this
+             * @param other Iterator to check
+             * @return true if other is previous
+             */
+            bool atPrev(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
+
+            /**
+             * @brief Checks if other is next to this
+             * @param other Iterator to check
+             * @return true if other is next
+             */
+            bool atNext(const iterator<couple<const K_TYPE, V_TYPE>>* other) const override;
+
+            /**
+             * @brief Moves to next live element
+             */
+            void next() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            void prev() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            Iterator* getPrev() const override;
+
+            /**
+             * @brief Gets current element (non-const)
+             * @return Reference to current key-value pair
+             * @throw outOfBoundError if the iterator is at the end
+             */
+            couple<const K_TYPE, V_TYPE>& get() override;
+
+            /**
+             * @brief Gets current element (const)
+             * @return Copy of current key-value pair
+             * @throw outOfBoundError if the iterator is at the end
+             */
+            couple<const K_TYPE, V_TYPE> get() const override;
+
+            /**
+             * @brief Not supported (throws unSupportedMethodError)
+             */
+            void set(const couple<const K_TYPE, V_TYPE> &data) override;
+
+            /**
+             * @brief Checks if iterator is valid
+             * @return true if iterator points to an element
+             */
+            [[nodiscard]] bool isValid() const override;
+
+            ~Iterator() override = default;
+        };
+
+        friend class Iterator;
+
+        /**
+         * @brief Constructs empty concurrentJMap
+         * @param comp Comparison function to use
+         * @param alloc Allocator to use
+         */
+        explicit concurrentJMap(Compare comp = Compare{}, ALLOC alloc = ALLOC{});
+
+        /**
+         * @brief Copy constructor
+         * @param other concurrentJMap to copy, may be modified concurrently
+         * @details Copies a weakly consistent snapshot of other
+         */
+        concurrentJMap(const concurrentJMap& other);
+
+        /**
+         * @brief Copy assignment operator
+         * @param other concurrentJMap to copy, may be modified concurrently
+         * @return Reference to this concurrentJMap
+         * @details Removes all elements, then copies a weakly consistent snapshot of other
+         * @note This map must not be accessed by other threads during the assignment
+         */
+        concurrentJMap& operator=(const concurrentJMap& other);
+
+        concurrentJMap(concurrentJMap&&) = delete;
+        concurrentJMap& operator=(concurrentJMap&&) = delete;
+
+        /**
+         * @brief Gets number of elements
+         * @return Current size, exact when no update is in flight
+         */
+        [[nodiscard]] u_integer size() const override;
+
+        /**
+         * @brief Checks if key-value pair exists
+         * @param e Pair to check
+         * @return true if both key exists and value matches
+         */
+        bool contains(const couple<const K_TYPE, V_TYPE> &e) const override;
+
+        /**
+         * @brief Adds new key-value pair
+         * @param k Key to add
+         * @param v Value to associate
+         * @return true if added, false if key existed
+         */
+        bool add(const K_TYPE &k, const V_TYPE &v);
+
+        /**
+         * @brief Removes key-value pair
+         * @param k Key to remove
+         * @return true if removed by this call, false if key didn't exist
+         */
+        bool remove(const K_TYPE &k);
+
+        /**
+         * @brief Checks if key exists
+         * @param k Key to check
+         * @return true if key exists
+         */
+        [[nodiscard]] bool containsKey(const K_TYPE &k) const;
+
+        /**
+         * @brief Gets value for key
+         * @param k Key to lookup
+         * @return Copy of the associated value
+         * @throw noElementError if key doesn't exist
+         */
+        V_TYPE get(const K_TYPE &k) const;
+
+        /**
+         * @brief Atomically replaces the value of an existing key
+         * @param key Key to update
+         * @param value New value
+         * @return true if updated, false if key didn't exist
+         */
+        bool update(const K_TYPE &key, const V_TYPE &value);
+
+        /**
+         * @brief Element access
+         * @param k Key to access
+         * @return Copy of the associated value, same as get()
+         * @throw noElementError if key doesn't exist
+         * @note Unlike map::operator[], this never inserts and cannot be assigned
+         * through; write with add() or update()
+         */
+        V_TYPE operator[](const K_TYPE &k) const;
+
+        /**
+         * @brief Gets begin iterator
+         * @return New iterator at first element (minimum key)
+         */
+        Iterator* begins() const override;
+
+        /**
+         * @brief Gets end iterator
+         * @return New iterator at last element (maximum key)
+         */
+        Iterator* ends() const override;
+
+        /**
+         * @brief Gets class name
+         * @return "concurrentJMap"
+         */
+        [[nodiscard]] std::string className() const override;
+
+        /**
+         * @brief Converts to string representation
+         * @param enter Add newline if true
+         * @return String representation of key-value pairs
+         */
+        [[nodiscard]] std::string toString(bool enter) const override;
+
+        /**
+         * @brief Destructor
+         * @details Frees all nodes and all retired memory
+         */
+        ~concurrentJMap() override;
+    };
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::Iterator(
+        const concurrentJMap* map, epochDomain::guard guard, skipListNode* cur, const bool last)
+    : map_(map), guard_(std::move(guard)), cur_(cur), last_(last) {}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::equalPtr(
+        const iterator<couple<const K_TYPE, V_TYPE>> *other) const {
+    auto other_it = dynamic_cast<const Iterator*>(other);
+    return other_it && this->cur_ == other_it->cur_;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::Iterator(const Iterator& other)
+    : map_(other.map_), guard_(other.guard_), cur_(other.cur_), last_(other.last_) {}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator&
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator=(const Iterator& other) {
+    if (this == &other){
+        return *this;
+    }
+
+    // Pin the new map before dropping the old guard
+    this->guard_ = other.guard_;
+    this->map_ = other.map_;
+    this->cur_ = other.cur_;
+    this->last_ = other.last_;
+    return *this;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::clone() const {
+    return new Iterator(*this);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+std::string
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::className() const {
+    return "concurrentJMap::Iterator";
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+void original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator+=(integer steps) const {
+    if (steps < 0){
+        throw unSupportedMethodError();
+    }
+
+    for (integer i = 0; i < steps; ++i) {
+        this->next();
+    }
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+void original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator-=(integer) const {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::integer
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::operator-(
+        const iterator<couple<const K_TYPE, V_TYPE>> &other) const {
+    auto other_it = dynamic_cast<const Iterator*>(&other);
+    if (other_it == nullptr)
+        return this > &other ?
+               std::numeric_limits<integer>::max() :
+               std::numeric_limits<integer>::min();
+
+    integer dis = 0;
+    for (auto it = ownerPtr(other_it->clone()); it->isValid(); it->next()) {
+        if (it->cur_ == this->cur_)
+            return dis;
+        dis += 1;
+    }
+    if (!this->isValid())
+        return dis;
+    dis = 0;
+    for (auto it = ownerPtr(this->clone()); it->isValid(); it->next()) {
+        if (it->cur_ == other_it->cur_)
+            return -dis;
+        dis += 1;
+    }
+    if (!other_it->isValid())
+        return -dis;
+    return this->cur_ > other_it->cur_ ?
+           std::numeric_limits<integer>::max() :
+           std::numeric_limits<integer>::min();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::hasNext() const {
+    return this->cur_ && !this->last_ && this->map_->nextNode(this->cur_);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::hasPrev() const {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::atPrev(
+        const iterator<couple<const K_TYPE, V_TYPE>>* other) const {
+    const auto other_it = dynamic_cast<const Iterator*>(other);
+    if (!other_it){
+        return false;
+    }
+    auto cloned_it = ownerPtr(other_it->clone());
+    cloned_it->next();
+    return this->equalPtr(cloned_it.get());
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::atNext(
+        const iterator<couple<const K_TYPE, V_TYPE>>* other) const {
+    return other->atPrev(*this);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+void original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::next() const {
+    if (!this->cur_){
+        return;
+    }
+
+    this->cur_ = this->last_ ? nullptr : this->map_->nextNode(this->cur_);
+    this->last_ = false;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+void original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::prev() const {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::getPrev() const {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::couple<const K_TYPE, V_TYPE>&
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::get() {
+    if (!this->isValid()){
+        throw outOfBoundError();
+    }
+
+    return *this->cur_->getEntry();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::couple<const K_TYPE, V_TYPE>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::get() const {
+    if (!this->isValid()){
+        throw outOfBoundError();
+    }
+
+    return *this->cur_->getEntry();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+void original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::set(const couple<const K_TYPE, V_TYPE>&) {
+    throw unSupportedMethodError();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator::isValid() const {
+    return this->cur_;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::concurrentJMap(Compare comp, ALLOC alloc)
+    : skipListType(std::move(comp)),
+      container<couple<const K_TYPE, V_TYPE>, ALLOC>(std::move(alloc)) {}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::concurrentJMap(const concurrentJMap& other)
+    : concurrentJMap(other.compare_, other.allocator) {
+    this->operator=(other);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>&
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator=(const concurrentJMap& other) {
+    if (this == &other){
+        return *this;
+    }
+
+    {
+        auto g = this->pin();
+        for (auto node = this->firstNode(); node; node = this->nextNode(node)) {
+            this->erase(node->getKey());
+        }
+    }
+    this->compare_ = other.compare_;
+    auto g = other.pin();
+    for (auto node = other.firstNode(); node; node = other.nextNode(node)) {
+        auto entry = node->getEntry();
+        this->insert(entry->template get<0>(), entry->template get<1>());
+    }
+    return *this;
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::u_integer original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::size() const {
+    return this->count();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::contains(const couple<const K_TYPE, V_TYPE> &e) const {
+    auto g = this->pin();
+    auto node = this->find(e.first());
+    return node && node->getEntry()->second() == e.second();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::add(const K_TYPE &k, const V_TYPE &v) {
+    return this->insert(k, v);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::remove(const K_TYPE &k) {
+    return this->erase(k);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::containsKey(const K_TYPE &k) const {
+    auto g = this->pin();
+    return this->find(k);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+V_TYPE original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::get(const K_TYPE &k) const {
+    auto g = this->pin();
+    auto node = this->find(k);
+    if (!node)
+        throw noElementError();
+    return node->getEntry()->second();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+bool original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::update(const K_TYPE &key, const V_TYPE &value) {
+    return this->modify(key, value);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+V_TYPE original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::operator[](const K_TYPE &k) const {
+    return this->get(k);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::begins() const {
+    auto g = this->pin();
+    auto node = this->firstNode();
+    return new Iterator(this, std::move(g), node, false);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::Iterator*
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::ends() const {
+    auto g = this->pin();
+    auto node = this->lastNode();
+    return new Iterator(this, std::move(g), node, true);
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+std::string original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::className() const {
+    return "concurrentJMap";
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+std::string original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::toString(bool enter) const {
+    std::stringstream ss;
+    ss << this->className();
+    ss << "(";
+    bool first = true;
+    for (auto it = this->begin(); it != this->end(); it.next()){
+        if (!first){
+            ss << ", ";
+        }
+        ss << "{" << printable::formatString(it.get().template get<0>()) << ": "
+           << printable::formatString(it.get().template get<1>()) << "}";
+        first = false;
+    }
+    ss << ")";
+    if (enter)
+        ss << "\n";
+    return ss.str();
+}
+
+template<typename K_TYPE, typename V_TYPE, typename Compare, typename ALLOC>
+original::concurrentJMap<K_TYPE, V_TYPE, Compare, ALLOC>::~concurrentJMap() = default;
+
+#endif //ORIGINAL_CONCURRENT_MAPS_H
@@ -0,0 +1,860 @@
+/**
+ * @file concurrentPool.h
+ * @brief Thread-caching memory pool shared by many threads
+ * @details
+ * This header defines `concurrentPool`, a size-class memory pool that can be
+ * shared by all workers of a `taskDelegator`, and `concurrentPoolAllocator`, the
+ * allocator handle that lets node-based containers (`chain`, `hashTable`,
+ * `RBTree`, ...) draw their nodes from it.
+ *
+ * Layout:
+ * - Blocks are grouped in power-of-two size classes from 16 to 4096 bytes; larger
+ *   requests fall back to `allocators::malloc`
+ * - Every size class has a central free list guarded by a mutex. Blocks are carved
+ *   from 64 KiB slabs aligned to their size, whose header records the owning pool
+ *   and the size class
+ * - Every thread using a pool owns a thread cache (a magazine per size class), so
+ *   the common allocation and de-allocation paths take no lock at all
+ *
+ * Transfers between a thread cache and the central lists move whole batches: an
+ * empty magazine is refilled with one batch under a single lock acquisition, and
+ * a magazine holding more than two batches hands one batch back. A block freed on
+ * another thread than the one that allocated it simply enters the cache of the
+ * freeing thread, and reaches the central list of its pool again through these
+ * batches. A block freed through an allocator bound to another pool is found by
+ * its slab header and returned to the pool owning it.
+ *
+ * When a thread exits, its caches are flushed back to the central lists of every
+ * pool still alive and become available to threads started later. Caches of the
+ * main thread are not flushed at process exit.
+ */
+
+#ifndef ORIGINAL_CONCURRENT_POOL_H
+#define ORIGINAL_CONCURRENT_POOL_H
+
+#include <cstdint>
+#include <limits>
+#include <new>
+#include "allocator.h"
+#include "atomic.h"
+#include "mutex.h"
+#include "vector.h"
+
+namespace original {
+
+    /**
+     * @class concurrentPool
+     * @brief Size-class memory pool with per-thread caches
+     * @details Hands out raw blocks of up to MAX_BLOCK_SIZE bytes. All methods are
+     * thread-safe. Memory is given back to the system only when the pool is destroyed;
+     * no block of the pool may be in use at that point.
+     *
+     * @note concurrentPool is **non-copyable** and **non-movable**.
+     * @see concurrentPoolAllocator
+     */
+    class concurrentPool {
+    public:
+        /// @brief Number of power-of-two size classes
+        static constexpr u_integer SIZE_CLASS_COUNT = 9;
+
+        /// @brief Size of the smallest size class in bytes
+        static constexpr u_integer MIN_BLOCK_SIZE = 16;
+
+        /// @brief Size of the largest size class in bytes, larger requests bypass the pool
+        static constexpr u_integer MAX_BLOCK_SIZE = MIN_BLOCK_SIZE << (SIZE_CLASS_COUNT - 1);
+
+        /// @brief Size and alignment of the slabs blocks are carved from
+        static constexpr u_integer SLAB_SIZE = 64 * 1024;
+
+        /// @brief Number of blocks moved by one transfer between a thread cache and a central list
+        static constexpr u_integer BATCH_SIZE = 32;
+
+        /**
+         * @struct statistics
+         * @brief Snapshot of the pool counters
+         * @details Counters of thread caches are updated without synchronization
+         * against the snapshot, so a snapshot taken while other threads allocate is
+         * only approximately consistent.
+         */
+        struct statistics {
+            ul_integer allocations = 0;         ///< Blocks handed out by the pool
+            ul_integer deallocations = 0;       ///< Blocks given back to the pool
+            ul_integer cache_hits = 0;          ///< Allocations served by a thread cache without locking
+            ul_integer refills = 0;             ///< Batches moved from central lists to thread caches
+            ul_integer flushes = 0;             ///< Batches moved from thread caches to central lists
+            ul_integer foreign_frees = 0;       ///< Blocks returned through an allocator bound to another pool
+            ul_integer large_allocations = 0;   ///< Requests above MAX_BLOCK_SIZE served by allocators::malloc
+            ul_integer slabs = 0;               ///< Slabs obtained from the system
+            ul_integer central_blocks = 0;      ///< Free blocks currently held by the central lists
+            ul_integer thread_caches = 0;       ///< Thread caches created so far
+        };
+
+    private:
+        /**
+         * @struct freeBlock
+         * @brief Free block, linked into a magazine or a central list
+         * @details The first block of a full batch on a central list also links
+         * the next batch.
+         */
+        struct freeBlock {
+            freeBlock* next;        ///< Next block of the same list or batch
+            freeBlock* next_batch;  ///< Next full batch, only meaningful for batch heads
+        };
+
+        /**
+         * @struct slabHeader
+         * @brief Header at the start of every slab
+         */
+        struct slabHeader {
+            concurrentPool* owner;  ///< Pool owning every block of the slab
+            u_integer index;        ///< Size class of the blocks of the slab
+            slabHeader* next;       ///< Next slab of the same size class
+        };
+
+        /**
+         * @struct magazine
+         * @brief Free blocks of one size class cached by a thread
+         */
+        struct magazine {
+            freeBlock* head = nullptr;  ///< First cached block
+            u_integer count = 0;        ///< Number of cached blocks
+        };
+
+        /**
+         * @struct threadCache
+         * @brief Cache owned by at most one thread at a time
+         * @details Only the owning thread writes the counters; they are atomic so
+         * that stats() may read them from any thread. The counters survive the thread
+         * and accumulate over every thread that owned the cache.
+         */
+        struct threadCache {
+            atomic<bool> in_use_{makeAtomic(false)};                         ///< Whether a thread owns the cache
+            threadCache* next_ = nullptr;                                    ///< Next cache of the pool
+            magazine magazines_[SIZE_CLASS_COUNT];                           ///< Cached blocks per size class
+            atomic<ul_integer> allocations_{makeAtomic<ul_integer>(0)};      ///< Blocks handed out
+            atomic<ul_integer> deallocations_{makeAtomic<ul_integer>(0)};    ///< Blocks given back
+            atomic<ul_integer> cache_hits_{makeAtomic<ul_integer>(0)};       ///< Allocations served without locking
+        };
+
+        /**
+         * @struct centralList
+         * @brief Shared free list of one size class
+         * @details Free blocks are kept as a stack of full batches, handed out in
+         * constant time, and a loose list for partial batches.
+         */
+        struct centralList {
+            mutable pMutex lock_;               ///< Guards every other member
+            freeBlock* batches_ = nullptr;      ///< Stack of batches of BATCH_SIZE blocks
+            u_integer batch_count_ = 0;         ///< Number of full batches
+            freeBlock* loose_ = nullptr;        ///< Blocks not grouped in a full batch
+            u_integer loose_count_ = 0;         ///< Number of loose blocks
+            slabHeader* slabs_ = nullptr;       ///< Slabs carved for this size class
+            ul_integer refills_ = 0;            ///< Batches handed to thread caches
+            ul_integer flushes_ = 0;            ///< Batches taken back from thread caches
+            ul_integer slab_count_ = 0;         ///< Number of slabs
+        };
+
+        /**
+         * @struct cacheEntry
+         * @brief Thread cache a thread owns in one pool
+         */
+        struct cacheEntry {
+            concurrentPool* pool;   ///< Pool of the cache, only dereferenced while the pool is alive
+            ul_integer id;          ///< Identifier of the pool
+            threadCache* cache;     ///< Cache owned by the thread
+        };
+
+        /**
+         * @class localCaches
+         * @brief Thread caches of the calling thread, one per pool it used
+         * @details Created on the first allocation of a thread and destroyed by the
+         * thread-specific data destructor of the registry key when the thread exits,
+         * which hands every cache back to its pool.
+         */
+        class localCaches {
+        public:
+            vector<cacheEntry> entries_;        ///< Caches of the thread
+            ul_integer last_id_ = 0;            ///< Pool of the most recently used cache
+            threadCache* last_cache_ = nullptr; ///< Most recently used cache
+
+            /**
+             * @brief Flushes the caches of the thread into the pools still alive
+             */
+            ~localCaches();
+        };
+
+        /**
+         * @struct liveRegistry
+         * @brief Identifiers of the pools alive in the process
+         * @details Pool identifiers are never reused, so a thread can tell a
+         * destroyed pool from a new pool created at the same address.
+         */
+        struct liveRegistry {
+            pMutex lock_;                   ///< Guards every other member
+            vector<ul_integer> live_;       ///< Identifiers of live pools
+            ul_integer next_id_ = 0;        ///< Last identifier handed out
+            pthread_key_t key_{};           ///< Key whose destructor releases the caches of exiting threads
+
+            /**
+             * @brief Creates the thread-specific data key
+             * @throws sysError if the key cannot be created
+             */
+            liveRegistry();
+        };
+
+        ul_integer id_;                                                    ///< Unique pool identifier
+        centralList central_[SIZE_CLASS_COUNT];                            ///< Central lists per size class
+        atomic<threadCache*> caches_{makeAtomic<threadCache*>(nullptr)};   ///< Lock-free list of thread caches
+        atomic<ul_integer> foreign_frees_{makeAtomic<ul_integer>(0)};      ///< Blocks returned by other pools
+        atomic<ul_integer> large_allocations_{makeAtomic<ul_integer>(0)};  ///< Requests above MAX_BLOCK_SIZE
+
+        /**
+         * @brief Gets the registry of live pools
+         * @return The process-wide registry
+         */
+        static liveRegistry& registry();
+
+        /**
+         * @brief Gets the caches of the calling thread
+         * @return The thread-local caches
+         */
+        static localCaches& threadCaches();
+
+        /**
+         * @brief Gets the slot holding the caches of the calling thread
+         * @return Thread-local pointer to the caches, nullptr before the first allocation
+         */
+        static localCaches*& threadCachesSlot();
+
+        /**
+         * @brief Destroys the caches of an exiting thread
+         * @param caches Caches of the thread
+         */
+        static void releaseCaches(void* caches);
+
+        /**
+         * @brief Gets the size class serving a request
+         * @param bytes Requested size, between 1 and MAX_BLOCK_SIZE
+         * @return Index of the smallest size class holding the request
+         */
+        [[nodiscard]] static constexpr u_integer sizeClass(u_integer bytes);
+
+        /**
+         * @brief Gets the block size of a size class
+         * @param index Size class index
+         * @return Block size in bytes
+         */
+        [[nodiscard]] static constexpr u_integer blockSize(u_integer index);
+
+        /**
+         * @brief Gets the slab a pooled block was carved from
+         * @param ptr Block of any pool
+         * @return Header of the slab holding the block
+         */
+        static slabHeader* slabOf(void* ptr);
+
+        /**
+         * @brief Increments a counter written by a single thread only
+         * @param counter Counter to increment
+         */
+        static void bump(atomic<ul_integer>& counter);
+
+        /**
+         * @brief Gets the cache of the calling thread, attaching one on first use
+         * @return Thread cache owned by the calling thread
+         */
+        threadCache* localCache();
+
+        /**
+         * @brief Takes ownership of a free thread cache, creating one if none is free
+         * @param caches Caches of the calling thread
+         * @return Cache owned by the calling thread
+         */
+        threadCache* attach(localCaches& caches);
+
+        /**
+         * @brief Flushes a thread cache and gives up its ownership
+         * @param cache Cache owned by the calling thread
+         */
+        void detach(threadCache* cache);
+
+        /**
+         * @brief Moves every block of a magazine to the loose list of its central list
+         * @param m Magazine to empty
+         * @param index Size class of the magazine
+         */
+        void drain(magazine& m, u_integer index);
+
+        /**
+         * @brief Refills an empty magazine with one batch from the central list
+         * @param m Empty magazine
+         * @param index Size class of the magazine
+         * @throw allocateError If a new slab is needed and cannot be allocated
+         */
+        void refill(magazine& m, u_integer index);
+
+        /**
+         * @brief Moves one batch from a magazine to the central list
+         * @param m Magazine holding more than BATCH_SIZE blocks
+         * @param index Size class of the magazine
+         */
+        void flush(magazine& m, u_integer index);
+
+        /**
+         * @brief Carves a new slab into free blocks of a central list
+         * @param c Central list, locked by the caller
+         * @param index Size class of the central list
+         * @throw allocateError If the slab cannot be allocated
+         */
+        void carve(centralList& c, u_integer index);
+
+        /**
+         * @brief Puts a block of this pool into the cache of the calling thread
+         * @param ptr Block carved by this pool
+         * @param index Size class of the block
+         */
+        void release(void* ptr, u_integer index);
+
+    public:
+        /**
+         * @brief Gets the process-wide pool
+         * @return Pool used by default-constructed concurrentPoolAllocator instances
+         */
+        static concurrentPool& shared();
+
+        /**
+         * @brief Constructs an empty pool
+         * @details No memory is obtained before the first allocation.
+         */
+        concurrentPool();
+
+        concurrentPool(const concurrentPool&) = delete;
+        concurrentPool& operator=(const concurrentPool&) = delete;
+
+        /**
+         * @brief Allocates a block
+         * @param bytes Requested size in bytes
+         * @return Block of at least the requested size, aligned to its size class,
+         *         or nullptr if bytes is 0
+         * @throw allocateError When memory allocation fails
+         */
+        void* allocate(u_integer bytes);
+
+        /**
+         * @brief Gives a block back
+         * @param ptr Block returned by allocate() of this or of any other live pool
+         * @param bytes Size passed to allocate()
+         * @details Blocks of another pool are returned to the pool owning them.
+         */
+        void deallocate(void* ptr, u_integer bytes);
+
+        /**
+         * @brief Moves every block cached by the calling thread back to the central lists
+         * @details Lets an idle worker hand its cached memory to busy ones.
+         */
+        void flushThreadCache();
+
+        /**
+         * @brief Takes a snapshot of the pool counters
+         * @return Current statistics
+         */
+        [[nodiscard]] statistics stats() const;
+
+        /**
+         * @brief Returns every slab to the system
+         * @pre No block of the pool is in use and no other thread uses the pool
+         */
+        ~concurrentPool();
+    };
+
+    /**
+     * @class concurrentPoolAllocator
+     * @tparam TYPE Type of objects to allocate
+     * @brief Allocator drawing memory from a concurrentPool
+     * @details A lightweight handle: copies share the pool, and since containers
+     * default-construct the allocators they rebind to, default-constructed handles
+     * use concurrentPool::shared(). Containers on different threads may therefore
+     * use pooled memory concurrently, and a node may be freed by another thread
+     * than the one that allocated it.
+     *
+     * Requests larger than concurrentPool::MAX_BLOCK_SIZE bytes bypass the pool.
+     * @extends allocatorBase
+     * @see objPoolAllocator For the single-threaded pool allocator
+     */
+    template<typename TYPE>
+    class concurrentPoolAllocator final : public allocatorBase<TYPE, concurrentPoolAllocator> {
+        concurrentPool* pool_; ///< Pool memory is drawn from
+
+        template<typename>
+        friend class concurrentPoolAllocator;
+
+    public:
+        using propagate_on_container_copy_assignment = std::true_type; ///< Allows propagation on copy
+        using propagate_on_container_move_assignment = std::true_type; ///< Allows propagation on move
+        using propagate_on_container_swap = std::true_type; ///< Allows propagation on swap
+        using propagate_on_container_merge = std::true_type; ///< Allows propagation on merge
+
+        /**
+         * @brief Constructs an allocator using the process-wide pool
+         */
+        concurrentPoolAllocator();
+
+        /**
+         * @brief Constructs an allocator using a given pool
+         * @param pool Pool to draw memory from, must outlive the allocator and its memory
+         */
+        explicit concurrentPoolAllocator(concurrentPool& pool) noexcept;
+
+        /**
+         * @brief Constructs an allocator sharing the pool of an allocator of another type
+         * @tparam O_TYPE Type allocated by the other allocator
+         * @param other Allocator to share the pool of
+         */
+        template<typename O_TYPE>
+        explicit concurrentPoolAllocator(const concurrentPoolAllocator<O_TYPE>& other) noexcept;
+
+        /**
+         * @brief Merges another allocator into this one
+         * @param other The allocator to merge
+         * @return Reference to this allocator
+         * @details Nothing is moved: blocks of the other pool keep returning to it
+         * when they are freed through this allocator.
+         */
+        concurrentPoolAllocator& operator+=(concurrentPoolAllocator& other) noexcept;
+
+        /**
+         * @brief Gets the pool memory is drawn from
+         * @return The pool of this allocator
+         */
+        [[nodiscard]] concurrentPool& pool() const noexcept;
+
+        /**
+         * @brief Allocates memory from the pool
+         * @param size Number of elements to allocate
+         * @return Pointer to allocated memory, nullptr if size is 0
+         * @throw allocateError When memory allocation fails
+         */
+        TYPE* allocate(u_integer size) override;
+
+        /**
+         * @brief Returns memory to the pool owning it
+         * @param ptr Pointer to memory to free
+         * @param size Number of elements originally allocated
+         */
+        void deallocate(TYPE* ptr, u_integer size) override;
+    };
+}
+
+inline original::concurrentPool::localCaches::~localCaches()
+{
+    auto& r = registry();
+    uniqueLock lock{r.lock_};
+    for (u_integer i = 0; i < this->entries_.size(); ++i) {
+        const cacheEntry& entry = this->entries_[i];
+        if (r.live_.indexOf(entry.id) != r.live_.size()) {
+            entry.pool->detach(entry.cache);
+        }
+    }
+}
+
+inline original::concurrentPool::liveRegistry::liveRegistry()
+{
+    if (const int code = pthread_key_create(&this->key_, &releaseCaches);
+        code != 0) {
+        throw sysError("Failed to create thread cache key (pthread_key_create returned " + printable::formatString(code) + ")");
+    }
+}
+
+inline original::concurrentPool::liveRegistry& original::concurrentPool::registry()
+{
+    static liveRegistry r;
+    return r;
+}
+
+inline original::concurrentPool::localCaches& original::concurrentPool::threadCaches()
+{
+    localCaches*& caches = threadCachesSlot();
+    if (!caches) {
+        caches = new localCaches;
+        pthread_setspecific(registry().key_, caches);
+    }
+    return *caches;
+}
+
+inline original::concurrentPool::localCaches*& original::concurrentPool::threadCachesSlot()
+{
+    // A trivially destructible thread_local, the caches are released through the registry key
+    thread_local localCaches* caches = nullptr;
+    return caches;
+}
+
+inline void original::concurrentPool::releaseCaches(void* caches)
+{
+    threadCachesSlot() = nullptr;
+    delete static_cast<localCaches*>(caches);
+}
+
+inline constexpr original::u_integer original::concurrentPool::sizeClass(const u_integer bytes)
+{
+    u_integer index = 0;
+    while (blockSize(index) < bytes) {
+        index += 1;
+    }
+    return index;
+}
+
+inline constexpr original::u_integer original::concurrentPool::blockSize(const u_integer index)
+{
+    return MIN_BLOCK_SIZE << index;
+}
+
+inline original::concurrentPool::slabHeader* original::concurrentPool::slabOf(void* ptr)
+{
+    return reinterpret_cast<slabHeader*>(reinterpret_cast<std::uintptr_t>(ptr) & ~static_cast<std::uintptr_t>(SLAB_SIZE - 1));
+}
+
+inline void original::concurrentPool::bump(atomic<ul_integer>& counter)
+{
+    counter.store(counter.load(memOrder::RELAXED) + 1, memOrder::RELAXED);
+}
+
+inline original::concurrentPool::threadCache* original::concurrentPool::localCache()
+{
+    localCaches& caches = threadCaches();
+    if (caches.last_id_ == this->id_) {
+        return caches.last_cache_;
+    }
+    for (u_integer i = 0; i < caches.entries_.size(); ++i) {
+        if (caches.entries_[i].id == this->id_) {
+            caches.last_id_ = this->id_;
+            caches.last_cache_ = caches.entries_[i].cache;
+            return caches.last_cache_;
+        }
+    }
+    return this->attach(caches);
+}
+
+inline original::concurrentPool::threadCache* original::concurrentPool::attach(localCaches& caches)
+{
+    {
+        // Forget the caches of pools destroyed since the thread last attached
+        auto& r = registry();
+        uniqueLock lock{r.lock_};
+        for (u_integer i = caches.entries_.size(); i > 0; --i) {
+            if (r.live_.indexOf(caches.entries_[i - 1].id) == r.live_.size()) {
+                caches.entries_.pop(static_cast<integer>(i - 1));
+            }
+        }
+    }
+
+    threadCache* cache = nullptr;
+    for (threadCache* c = this->caches_.load(memOrder::ACQUIRE); c; c = c->next_) {
+        bool expected = false;
+        if (!c->in_use_.load(memOrder::RELAXED) && c->in_use_.exchangeCmp(expected, true)) {
+            cache = c;
+            break;
+        }
+    }
+    if (!cache) {
+        cache = new threadCache;
+        cache->in_use_.store(true, memOrder::RELAXED);
+        threadCache* head = this->caches_.load(memOrder::RELAXED);
+        do {
+            cache->next_ = head;
+        } while (!this->caches_.exchangeCmp(head, cache));
+    }
+
+    caches.entries_.pushEnd(cacheEntry{this, this->id_, cache});
+    caches.last_id_ = this->id_;
+    caches.last_cache_ = cache;
+    return cache;
+}
+
+inline void original::concurrentPool::detach(threadCache* cache)
+{
+    for (u_integer i = 0; i < SIZE_CLASS_COUNT; ++i) {
+        this->drain(cache->magazines_[i], i);
+    }
+    cache->in_use_.store(false, memOrder::RELEASE);
+}
+
+inline void original::concurrentPool::drain(magazine& m, const u_integer index)
+{
+    if (!m.head) {
+        return;
+    }
+
+    freeBlock* tail = m.head;
+    while (tail->next) {
+        tail = tail->next;
+    }
+
+    centralList& c = this->central_[index];
+    uniqueLock lock{c.lock_};
+    tail->next = c.loose_;
+    c.loose_ = m.head;
+    c.loose_count_ += m.count;
+    m.head = nullptr;
+    m.count = 0;
+}
+
+inline void original::concurrentPool::refill(magazine& m, const u_integer index)
+{
+    centralList& c = this->central_[index];
+    uniqueLock lock{c.lock_};
+    if (!c.batches_ && !c.loose_) {
+        this->carve(c, index);
+    }
+
+    if (c.batches_) {
+        m.head = c.batches_;
+        m.count = BATCH_SIZE;
+        c.batches_ = c.batches_->next_batch;
+        c.batch_count_ -= 1;
+    } else {
+        // Only partial batches left, take up to one batch of loose blocks
+        freeBlock* tail = c.loose_;
+        u_integer count = 1;
+        while (count < BATCH_SIZE && tail->next) {
+            tail = tail->next;
+            count += 1;
+        }
+        m.head = c.loose_;
+        m.count = count;
+        c.loose_ = tail->next;
+        c.loose_count_ -= count;
+        tail->next = nullptr;
+    }
+    c.refills_ += 1;
+}
+
+inline void original::concurrentPool::flush(magazine& m, const u_integer index)
+{
+    freeBlock* batch = m.head;
+    freeBlock* tail = batch;
+    for (u_integer i = 1; i < BATCH_SIZE; ++i) {
+        tail = tail->next;
+    }
+    m.head = tail->next;
+    m.count -= BATCH_SIZE;
+    tail->next = nullptr;
+
+    centralList& c = this->central_[index];
+    uniqueLock lock{c.lock_};
+    batch->next_batch = c.batches_;
+    c.batches_ = batch;
+    c.batch_count_ += 1;
+    c.flushes_ += 1;
+}
+
+inline void original::concurrentPool::carve(centralList& c, const u_integer index)
+{
+    void* raw;
+    try {
+        raw = ::operator new(SLAB_SIZE, std::align_val_t{SLAB_SIZE});
+    } catch (const std::bad_alloc&) {
+        throw allocateError();
+    }
+
+    auto slab = static_cast<slabHeader*>(raw);
+    slab->owner = this;
+    slab->index = index;
+    slab->next = c.slabs_;
+    c.slabs_ = slab;
+    c.slab_count_ += 1;
+
+    // Blocks start at the first multiple of their size past the header, so every
+    // block is aligned to its size class
+    const u_integer block_size = blockSize(index);
+    const u_integer first = (sizeof(slabHeader) + block_size - 1) / block_size * block_size;
+    const u_integer count = (SLAB_SIZE - first) / block_size;
+    auto base = static_cast<byte*>(raw) + first;
+
+    u_integer i = 0;
+    for (; i + BATCH_SIZE <= count; i += BATCH_SIZE) {
+        for (u_integer j = 0; j < BATCH_SIZE; ++j) {
+            auto block = reinterpret_cast<freeBlock*>(base + (i + j) * block_size);
+            block->next = j + 1 < BATCH_SIZE ? reinterpret_cast<freeBlock*>(base + (i + j + 1) * block_size) : nullptr;
+        }
+        auto head = reinterpret_cast<freeBlock*>(base + i * block_size);
+        head->next_batch = c.batches_;
+        c.batches_ = head;
+        c.batch_count_ += 1;
+    }
+    for (; i < count; ++i) {
+        auto block = reinterpret_cast<freeBlock*>(base + i * block_size);
+        block->next = c.loose_;
+        c.loose_ = block;
+        c.loose_count_ += 1;
+    }
+}
+
+inline void original::concurrentPool::release(void* ptr, const u_integer index)
+{
+    threadCache* cache = this->localCache();
+    magazine& m = cache->magazines_[index];
+    auto block = static_cast<freeBlock*>(ptr);
+    block->next = m.head;
+    m.head = block;
+    m.count += 1;
+    bump(cache->deallocations_);
+    if (m.count > 2 * BATCH_SIZE) {
+        this->flush(m, index);
+    }
+}
+
+inline original::concurrentPool& original::concurrentPool::shared()
+{
+    static concurrentPool pool;
+    return pool;
+}
+
+inline original::concurrentPool::concurrentPool()
+{
+    auto& r = registry();
+    uniqueLock lock{r.lock_};
+    r.next_id_ += 1;
+    this->id_ = r.next_id_;
+    r.live_.pushEnd(this->id_);
+}
+
+inline void* original::concurrentPool::allocate(const u_integer bytes)
+{
+    if (bytes == 0) {
+        return nullptr;
+    }
+
+    if (bytes > MAX_BLOCK_SIZE) {
+        this->large_allocations_ += 1;
+        return allocators::malloc<byte>(bytes);
+    }
+
+    const u_integer index = sizeClass(bytes);
+    threadCache* cache = this->localCache();
+    magazine& m = cache->magazines_[index];
+    if (m.head) {
+        bump(cache->cache_hits_);
+    } else {
+        this->refill(m, index);
+    }
+
+    freeBlock* block = m.head;
+    m.head = block->next;
+    m.count -= 1;
+    bump(cache->allocations_);
+    return block;
+}
+
+inline void original::concurrentPool::deallocate(void* ptr, const u_integer bytes)
+{
+    if (!ptr || bytes == 0) {
+        return;
+    }
+
+    if (bytes > MAX_BLOCK_SIZE) {
+        allocators::free(static_cast<byte*>(ptr));
+        return;
+    }
+
+    const slabHeader* slab = slabOf(ptr);
+    if (slab->owner != this) {
+        slab->owner->foreign_frees_ += 1;
+    }
+    slab->owner->release(ptr, slab->index);
+}
+
+inline void original::concurrentPool::flushThreadCache()
+{
+    threadCache* cache = this->localCache();
+    for (u_integer i = 0; i < SIZE_CLASS_COUNT; ++i) {
+        this->drain(cache->magazines_[i], i);
+    }
+}
+
+inline original::concurrentPool::statistics original::concurrentPool::stats() const
+{
+    statistics s;
+    for (const threadCache* c = this->caches_.load(memOrder::ACQUIRE); c; c = c->next_) {
+        s.allocations += c->allocations_.load(memOrder::RELAXED);
+        s.deallocations += c->deallocations_.load(memOrder::RELAXED);
+        s.cache_hits += c->cache_hits_.load(memOrder::RELAXED);
+        s.thread_caches += 1;
+    }
+    for (auto& c : this->central_) {
+        uniqueLock lock{c.lock_};
+        s.refills += c.refills_;
+        s.flushes += c.flushes_;
+        s.slabs += c.slab_count_;
+        s.central_blocks += c.batch_count_ * BATCH_SIZE + c.loose_count_;
+    }
+    s.foreign_frees = this->foreign_frees_.load(memOrder::RELAXED);
+    s.large_allocations = this->large_allocations_.load(memOrder::RELAXED);
+    return s;
+}
+
+inline original::concurrentPool::~concurrentPool()
+{
+    {
+        auto& r = registry();
+        uniqueLock lock{r.lock_};
+        r.live_.pop(static_cast<integer>(r.live_.indexOf(this->id_)));
+    }
+
+    threadCache* cache = this->caches_.load(memOrder::ACQUIRE);
+    while (cache) {
+        threadCache* next = cache->next_;
+        delete cache;
+        cache = next;
+    }
+    for (auto& c : this->central_) {
+        slabHeader* slab = c.slabs_;
+        while (slab) {
+            slabHeader* next = slab->next;
+            ::operator delete(slab, std::align_val_t{SLAB_SIZE});
+            slab = next;
+        }
+    }
+}
+
+template<typename TYPE>
+original::concurrentPoolAllocator<TYPE>::concurrentPoolAllocator()
+    : pool_(&concurrentPool::shared()) {}
+
+template<typename TYPE>
+original::concurrentPoolAllocator<TYPE>::concurrentPoolAllocator(concurrentPool& pool) noexcept
+    : pool_(&pool) {}
+
+template<typename TYPE>
+template<typename O_TYPE>
+original::concurrentPoolAllocator<TYPE>::concurrentPoolAllocator(const concurrentPoolAllocator<O_TYPE>& other) noexcept
+    : pool_(other.pool_) {}
+
+template<typename TYPE>
+original::concurrentPoolAllocator<TYPE>&
+original::concurrentPoolAllocator<TYPE>::operator+=(concurrentPoolAllocator&) noexcept
+{
+    return *this;
+}
+
+template<typename TYPE>
+original::concurrentPool& original::concurrentPoolAllocator<TYPE>::pool() const noexcept
+{
+    return *this->pool_;
+}
+
+template<typename TYPE>
+TYPE* original::concurrentPoolAllocator<TYPE>::allocate(const u_integer size)
+{
+    if (size > std::numeric_limits<u_integer>::max() / sizeof(TYPE)) {
+        throw allocateError();
+    }
+    return static_cast<TYPE*>(this->pool_->allocate(size * sizeof(TYPE)));
+}
+
+template<typename TYPE>
+void original::concurrentPoolAllocator<TYPE>::deallocate(TYPE* ptr, const u_integer size)
+{
+    this->pool_->deallocate(ptr, size * sizeof(TYPE));
+}
+
+#endif //ORIGINAL_CONCURRENT_POOL_H
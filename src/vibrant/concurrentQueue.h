@@ -0,0 +1,467 @@
+/**
+ * @file concurrentQueue.h
+ * @brief Bounded lock-free queue for handing data between threads
+ * @details
+ * This header defines `concurrentQueue`, a fixed-capacity FIFO that many threads
+ * can push to and pop from without a lock, replacing a `queue` guarded by hand
+ * with `pMutex` and `pCondition`.
+ *
+ * Layout (after Dmitry Vyukov's bounded MPMC queue):
+ * - A power-of-two array of slots, each holding an element and a sequence number
+ * - An enqueue and a dequeue position, each on its own cache line
+ * - A slot at position `pos` is free for a producer when its sequence equals `pos`,
+ *   and ready for a consumer when it equals `pos + 1`. Popping it sets the sequence
+ *   to `pos + capacity`, handing it to the producer of the next lap
+ *
+ * Producers and consumers claim positions with a compare-and-swap on their shared
+ * position. With a single producer or a single consumer (`queueMode::SPSC` or
+ * `queueMode::MPSC`) the claim on that side becomes a plain store.
+ *
+ * The blocking `push` and `pop` spin through the lock-free path first and park on a
+ * condition variable only when the queue is full or empty. A successful operation
+ * takes the mutex only if a thread of the other side is parked.
+ */
+
+#ifndef ORIGINAL_CONCURRENT_QUEUE_H
+#define ORIGINAL_CONCURRENT_QUEUE_H
+
+#include <limits>
+#include "atomic.h"
+#include "condition.h"
+#include "error.h"
+#include "mutex.h"
+#include "zeit.h"
+
+namespace original {
+
+    /**
+     * @enum queueMode
+     * @brief Number of threads allowed on each side of a concurrentQueue
+     */
+    enum class queueMode {
+        SPSC,   ///< One producer thread, one consumer thread
+        MPSC,   ///< Many producer threads, one consumer thread
+        MPMC,   ///< Many producer threads, many consumer threads
+    };
+
+    /**
+     * @class concurrentQueue
+     * @brief Bounded lock-free FIFO queue
+     * @tparam TYPE Element type, must be default-constructible and move-assignable
+     * @tparam MODE Producer/consumer configuration (default: MPMC)
+     * @details All methods are thread-safe within the limits of MODE: with SPSC only one
+     * thread at a time may push and one may pop, with MPSC only one thread at a time may pop.
+     * The capacity is rounded up to a power of two of at least 2 and never changes.
+     *
+     * Every slot holds a default-constructed element; popping moves the element out.
+     *
+     * @note concurrentQueue is **non-copyable** and **non-movable**.
+     */
+    template<typename TYPE, queueMode MODE = queueMode::MPMC>
+    class concurrentQueue {
+    public:
+        /// @brief Assumed cache line size used to keep the positions apart
+        static constexpr u_integer CACHE_LINE = 64;
+
+    private:
+        static constexpr bool MULTI_PRODUCER = MODE != queueMode::SPSC;
+        static constexpr bool MULTI_CONSUMER = MODE == queueMode::MPMC;
+
+        /**
+         * @struct slot
+         * @brief Element storage tagged with the position it is ready for
+         */
+        struct slot {
+            atomic<ul_integer> sequence{makeAtomic<ul_integer>(0)};  ///< Position this slot is ready for
+            TYPE data{};                                              ///< Stored element
+        };
+
+        slot* slots_;                   ///< Ring of slots
+        const ul_integer mask_;         ///< Capacity minus one
+
+        alignas(CACHE_LINE) atomic<ul_integer> enqueue_pos_{makeAtomic<ul_integer>(0)};  ///< Next position to push
+        alignas(CACHE_LINE) atomic<ul_integer> dequeue_pos_{makeAtomic<ul_integer>(0)};  ///< Next position to pop
+
+        alignas(CACHE_LINE) atomic<u_integer> parked_producers_{makeAtomic<u_integer>(0)};  ///< Producers waiting for space
+        atomic<u_integer> parked_consumers_{makeAtomic<u_integer>(0)};                      ///< Consumers waiting for elements
+        mutable pMutex mutex_;          ///< Guards parking
+        pCondition not_full_;           ///< Signalled when slots are freed
+        pCondition not_empty_;          ///< Signalled when elements are published
+
+        /**
+         * @brief Rounds a requested capacity up to a power of two, at least 2
+         * @param capacity Requested capacity
+         * @note With a single slot the sequence of a full slot equals the next push position.
+         * @return The rounded capacity
+         * @throw valueError If capacity is 0 or too large
+         */
+        static ul_integer roundCapacity(u_integer capacity);
+
+        /**
+         * @brief Claims up to n consecutive positions on one side
+         * @param pos Shared position of the side
+         * @param n Maximum number of positions to claim
+         * @param lag 0 for producers (free slots), 1 for consumers (ready slots)
+         * @param first Receives the first claimed position
+         * @return Number of positions claimed, 0 if none is available
+         */
+        template<bool MULTI>
+        u_integer claim(atomic<ul_integer>& pos, u_integer n, ul_integer lag, ul_integer& first);
+
+        /**
+         * @brief Checks whether the next slot of a side is available
+         * @param pos Shared position of the side
+         * @param lag 0 for producers, 1 for consumers
+         * @return True if a claim could succeed
+         */
+        bool available(const atomic<ul_integer>& pos, ul_integer lag) const;
+
+        /**
+         * @brief Wakes threads parked on the other side after a successful operation
+         * @param parked Parked thread counter of the other side
+         * @param condition Condition the other side waits on
+         */
+        void wake(atomic<u_integer>& parked, pCondition& condition);
+
+        /**
+         * @brief Parks the calling thread until its side may make progress
+         * @param parked Parked thread counter of the calling side
+         * @param condition Condition to wait on
+         * @param pos Shared position of the calling side
+         * @param lag 0 for producers, 1 for consumers
+         * @param timeout Maximum time to wait, nullptr to wait without limit
+         * @return False if the timeout expired
+         */
+        bool park(atomic<u_integer>& parked, pCondition& condition,
+                  const atomic<ul_integer>& pos, ul_integer lag, const time::duration* timeout = nullptr);
+
+    public:
+        /**
+         * @brief Constructs an empty queue
+         * @param capacity Minimum number of elements the queue can hold, rounded up to a power of two
+         * @throw valueError If capacity is 0 or too large
+         */
+        explicit concurrentQueue(u_integer capacity);
+
+        concurrentQueue(const concurrentQueue&) = delete;
+        concurrentQueue& operator=(const concurrentQueue&) = delete;
+        concurrentQueue(concurrentQueue&&) = delete;
+        concurrentQueue& operator=(concurrentQueue&&) = delete;
+
+        /**
+         * @brief Attempts to push an element without blocking
+         * @param e Element to push
+         * @return False if the queue is full
+         */
+        bool tryPush(const TYPE& e);
+
+        /**
+         * @brief Attempts to pop an element without blocking
+         * @param e Receives the popped element
+         * @return False if the queue is empty
+         */
+        bool tryPop(TYPE& e);
+
+        /**
+         * @brief Pushes an element, waiting while the queue is full
+         * @param e Element to push
+         */
+        void push(const TYPE& e);
+
+        /**
+         * @brief Pops an element, waiting while the queue is empty
+         * @return The oldest element
+         */
+        TYPE pop();
+
+        /**
+         * @brief Pushes an element, waiting at most the given time for space
+         * @param e Element to push
+         * @param timeout Maximum time to wait
+         * @return False if the queue stayed full
+         */
+        bool pushFor(const TYPE& e, const time::duration& timeout);
+
+        /**
+         * @brief Pops an element, waiting at most the given time for one
+         * @param e Receives the popped element
+         * @param timeout Maximum time to wait
+         * @return False if the queue stayed empty
+         */
+        bool popFor(TYPE& e, const time::duration& timeout);
+
+        /**
+         * @brief Pushes as many elements of a range as fit without blocking
+         * @param data First element to push
+         * @param n Number of elements in the range
+         * @return Number of elements pushed, taken from the front of the range
+         * @details Claims consecutive slots with a single compare-and-swap, so the pushed
+         * elements stay contiguous in the queue even with concurrent producers.
+         */
+        u_integer pushBatch(const TYPE* data, u_integer n);
+
+        /**
+         * @brief Pops up to n elements without blocking
+         * @param data Receives the popped elements in queue order
+         * @param n Maximum number of elements to pop
+         * @return Number of elements popped
+         */
+        u_integer popBatch(TYPE* data, u_integer n);
+
+        /**
+         * @brief Gets the number of elements in the queue
+         * @return A snapshot of the size, exact only while no thread modifies the queue
+         */
+        [[nodiscard]] u_integer size() const;
+
+        /**
+         * @brief Checks whether the queue is empty
+         * @return A snapshot, exact only while no thread modifies the queue
+         */
+        [[nodiscard]] bool empty() const;
+
+        /**
+         * @brief Gets the capacity of the queue
+         * @return Number of slots, a power of two
+         */
+        [[nodiscard]] u_integer capacity() const noexcept;
+
+        /**
+         * @brief Destroys the queue and the elements left in it
+         */
+        ~concurrentQueue();
+    };
+}
+
+template<typename TYPE, original::queueMode MODE>
+original::ul_integer original::concurrentQueue<TYPE, MODE>::roundCapacity(const u_integer capacity)
+{
+    constexpr u_integer limit = std::numeric_limits<u_integer>::max() / 2 + 1;
+    if (capacity == 0 || capacity > limit) {
+        throw valueError("Invalid capacity " + printable::formatString(capacity) + " for concurrentQueue");
+    }
+    ul_integer rounded = 2;
+    while (rounded < capacity) {
+        rounded *= 2;
+    }
+    return rounded;
+}
+
+template<typename TYPE, original::queueMode MODE>
+original::concurrentQueue<TYPE, MODE>::concurrentQueue(const u_integer capacity)
+    : slots_(nullptr), mask_(roundCapacity(capacity) - 1)
+{
+    this->slots_ = new slot[this->mask_ + 1];
+    for (ul_integer i = 0; i <= this->mask_; ++i) {
+        this->slots_[i].sequence.store(i, memOrder::RELAXED);
+    }
+}
+
+template<typename TYPE, original::queueMode MODE>
+template<bool MULTI>
+original::u_integer original::concurrentQueue<TYPE, MODE>::claim(atomic<ul_integer>& pos, const u_integer n,
+                                                                const ul_integer lag, ul_integer& first)
+{
+    ul_integer cur = pos.load(memOrder::RELAXED);
+    while (true) {
+        u_integer count = 0;
+        bool behind = false;
+        while (count < n) {
+            const ul_integer seq = this->slots_[(cur + count) & this->mask_].sequence.load(memOrder::ACQUIRE);
+            const auto diff = static_cast<integer>(seq - (cur + count + lag));
+            if (diff != 0) {
+                // diff > 0: another thread of this side already moved past cur
+                behind = count == 0 && diff > 0;
+                break;
+            }
+            count += 1;
+        }
+        if (count == 0 && !behind) {
+            return 0;
+        }
+        if constexpr (MULTI) {
+            if (count > 0 && pos.exchangeCmp(cur, cur + count, memOrder::RELAXED)) {
+                first = cur;
+                return count;
+            }
+            if (count == 0) {
+                cur = pos.load(memOrder::RELAXED);
+            }
+        } else {
+            pos.store(cur + count, memOrder::RELAXED);
+            first = cur;
+            return count;
+        }
+    }
+}
+
+template<typename TYPE, original::queueMode MODE>
+bool original::concurrentQueue<TYPE, MODE>::available(const atomic<ul_integer>& pos, const ul_integer lag) const
+{
+    const ul_integer cur = pos.load(memOrder::ACQUIRE);
+    const ul_integer seq = this->slots_[cur & this->mask_].sequence.load(memOrder::ACQUIRE);
+    return static_cast<integer>(seq - (cur + lag)) >= 0;
+}
+
+template<typename TYPE, original::queueMode MODE>
+void original::concurrentQueue<TYPE, MODE>::wake(atomic<u_integer>& parked, pCondition& condition)
+{
+    // Pairs with the fence in park(): either the parked thread sees the new
+    // sequence, or this thread sees it parked
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (parked.load(memOrder::RELAXED) > 0) {
+        uniqueLock lock{this->mutex_};
+        condition.notifyAll();
+    }
+}
+
+template<typename TYPE, original::queueMode MODE>
+bool original::concurrentQueue<TYPE, MODE>::park(atomic<u_integer>& parked, pCondition& condition,
+                                                 const atomic<ul_integer>& pos, const ul_integer lag,
+                                                 const time::duration* timeout)
+{
+    parked += 1;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    bool ready;
+    {
+        uniqueLock lock{this->mutex_};
+        const auto predicate = [this, &pos, lag] {
+            return this->available(pos, lag);
+        };
+        if (timeout) {
+            ready = condition.waitFor(this->mutex_, *timeout, predicate);
+        } else {
+            condition.wait(this->mutex_, predicate);
+            ready = true;
+        }
+    }
+    parked -= 1;
+    return ready;
+}
+
+template<typename TYPE, original::queueMode MODE>
+bool original::concurrentQueue<TYPE, MODE>::tryPush(const TYPE& e)
+{
+    return this->pushBatch(&e, 1) == 1;
+}
+
+template<typename TYPE, original::queueMode MODE>
+bool original::concurrentQueue<TYPE, MODE>::tryPop(TYPE& e)
+{
+    return this->popBatch(&e, 1) == 1;
+}
+
+template<typename TYPE, original::queueMode MODE>
+void original::concurrentQueue<TYPE, MODE>::push(const TYPE& e)
+{
+    while (!this->tryPush(e)) {
+        this->park(this->parked_producers_, this->not_full_, this->enqueue_pos_, 0);
+    }
+}
+
+template<typename TYPE, original::queueMode MODE>
+TYPE original::concurrentQueue<TYPE, MODE>::pop()
+{
+    TYPE e{};
+    while (!this->tryPop(e)) {
+        this->park(this->parked_consumers_, this->not_empty_, this->dequeue_pos_, 1);
+    }
+    return e;
+}
+
+template<typename TYPE, original::queueMode MODE>
+bool original::concurrentQueue<TYPE, MODE>::pushFor(const TYPE& e, const time::duration& timeout)
+{
+    const auto deadline = time::point::now() + timeout;
+    while (!this->tryPush(e)) {
+        const auto remaining = deadline - time::point::now();
+        if (remaining <= time::duration::ZERO
+            || !this->park(this->parked_producers_, this->not_full_, this->enqueue_pos_, 0, &remaining)) {
+            return this->tryPush(e);
+        }
+    }
+    return true;
+}
+
+template<typename TYPE, original::queueMode MODE>
+bool original::concurrentQueue<TYPE, MODE>::popFor(TYPE& e, const time::duration& timeout)
+{
+    const auto deadline = time::point::now() + timeout;
+    while (!this->tryPop(e)) {
+        const auto remaining = deadline - time::point::now();
+        if (remaining <= time::duration::ZERO
+            || !this->park(this->parked_consumers_, this->not_empty_, this->dequeue_pos_, 1, &remaining)) {
+            return this->tryPop(e);
+        }
+    }
+    return true;
+}
+
+template<typename TYPE, original::queueMode MODE>
+original::u_integer original::concurrentQueue<TYPE, MODE>::pushBatch(const TYPE* data, const u_integer n)
+{
+    if (n == 0) {
+        return 0;
+    }
+    ul_integer first = 0;
+    const u_integer count = this->claim<MULTI_PRODUCER>(this->enqueue_pos_, n, 0, first);
+    for (u_integer i = 0; i < count; ++i) {
+        slot& s = this->slots_[(first + i) & this->mask_];
+        s.data = data[i];
+        s.sequence.store(first + i + 1, memOrder::RELEASE);
+    }
+    if (count > 0) {
+        this->wake(this->parked_consumers_, this->not_empty_);
+    }
+    return count;
+}
+
+template<typename TYPE, original::queueMode MODE>
+original::u_integer original::concurrentQueue<TYPE, MODE>::popBatch(TYPE* data, const u_integer n)
+{
+    if (n == 0) {
+        return 0;
+    }
+    ul_integer first = 0;
+    const u_integer count = this->claim<MULTI_CONSUMER>(this->dequeue_pos_, n, 1, first);
+    for (u_integer i = 0; i < count; ++i) {
+        slot& s = this->slots_[(first + i) & this->mask_];
+        data[i] = std::move(s.data);
+        s.sequence.store(first + i + this->mask_ + 1, memOrder::RELEASE);
+    }
+    if (count > 0) {
+        this->wake(this->parked_producers_, this->not_full_);
+    }
+    return count;
+}
+
+template<typename TYPE, original::queueMode MODE>
+original::u_integer original::concurrentQueue<TYPE, MODE>::size() const
+{
+    const ul_integer head = this->dequeue_pos_.load(memOrder::ACQUIRE);
+    const ul_integer tail = this->enqueue_pos_.load(memOrder::ACQUIRE);
+    if (static_cast<integer>(tail - head) <= 0) {
+        return 0;
+    }
+    return static_cast<u_integer>(tail - head > this->mask_ + 1 ? this->mask_ + 1 : tail - head);
+}
+
+template<typename TYPE, original::queueMode MODE>
+bool original::concurrentQueue<TYPE, MODE>::empty() const
+{
+    return this->size() == 0;
+}
+
+template<typename TYPE, original::queueMode MODE>
+original::u_integer original::concurrentQueue<TYPE, MODE>::capacity() const noexcept
+{
+    return static_cast<u_integer>(this->mask_ + 1);
+}
+
+template<typename TYPE, original::queueMode MODE>
+original::concurrentQueue<TYPE, MODE>::~concurrentQueue()
+{
+    delete[] this->slots_;
+}
+
+#endif //ORIGINAL_CONCURRENT_QUEUE_H
@@ -0,0 +1,766 @@
+/**
+ * @file concurrentSkipList.h
+ * @brief Lock-free concurrent skip list
+ * @details
+ * This header defines `concurrentSkipList`, the storage engine of `concurrentJMap`.
+ * It follows the lock-free skip list of Fraser and Herlihy-Shavit:
+ * - Searches never write shared memory and never block
+ * - Insertion links a node bottom-up with one CAS per level; the CAS on level 1
+ *   is the linearization point
+ * - Deletion marks the next pointers of a node top-down (logical deletion, the mark
+ *   lives in the low bit of the pointer), the mark on level 1 is the linearization
+ *   point; marked nodes are unlinked by any later traversal
+ * - Unlinked nodes and replaced values are reclaimed through an `epochDomain`
+ *
+ * Values are held in a separately allocated key-value pair that is swapped atomically
+ * on update, so readers always see a complete pair.
+ *
+ * The allocator must be safe to use from several threads at once.
+ */
+
+#ifndef ORIGINAL_CONCURRENT_SKIPLIST_H
+#define ORIGINAL_CONCURRENT_SKIPLIST_H
+
+#include <bit>
+#include <cstdint>
+#include <random>
+#include "allocator.h"
+#include "comparator.h"
+#include "couple.h"
+#include "epochs.h"
+
+namespace original {
+
+    /**
+     * @class concurrentSkipList
+     * @tparam K_TYPE Key type (must be comparable and copyable)
+     * @tparam V_TYPE Value type
+     * @tparam ALLOC Allocator type of the key-value pairs (must be thread-safe)
+     * @tparam Compare Comparison function type (default: increaseComparator<K_TYPE>)
+     * @brief Lock-free ordered skip list with epoch-based reclamation
+     * @details All public operations of derived containers may be called concurrently.
+     * Every operation pins the epoch domain of the list for its duration.
+     *
+     * Performance Characteristics:
+     * - Search: expected O(log n), lock-free and free of writes
+     * - Insert/Erase: expected O(log n), lock-free
+     * - Update: expected O(log n) plus one pair allocation
+     */
+    template<typename K_TYPE,
+             typename V_TYPE,
+             typename ALLOC = allocator<couple<const K_TYPE, V_TYPE>>,
+             typename Compare = increaseComparator<K_TYPE>>
+    class concurrentSkipList {
+    protected:
+        using entryType = couple<const K_TYPE, V_TYPE>;  ///< Key-value pair type
+
+        /**
+         * @class skipListNode
+         * @brief Node of the concurrent skip list
+         * @details Holds a copy of the key for searching, the current key-value pair
+         * and the number of levels; the atomic next pointers are stored in the same
+         * allocation right after the node. A set low bit of a next pointer marks the
+         * node as deleted on that level.
+         */
+        class skipListNode {
+            const K_TYPE key_;                  ///< Search key, equal to the key of every pair of the node
+            atomic<entryType*> data_;           ///< Current key-value pair
+            atomic<u_integer> owners_;          ///< Inserter and remover still working on the node
+            u_integer levels_;                  ///< Number of levels
+
+        public:
+            friend class concurrentSkipList;
+
+            /**
+             * @brief Constructs a node with null next pointers
+             * @param key Search key
+             * @param data Owned key-value pair
+             * @param levels Number of levels, next pointers must be reserved behind the node
+             */
+            skipListNode(const K_TYPE& key, entryType* data, u_integer levels);
+
+            skipListNode(const skipListNode&) = delete;
+            skipListNode& operator=(const skipListNode&) = delete;
+
+            /**
+             * @brief Gets the next pointer of a level
+             * @param level Level to access (0-based)
+             * @return Reference to the atomic next pointer
+             */
+            atomic<skipListNode*>& next(u_integer level);
+
+            /**
+             * @brief Gets the key
+             * @return Const reference to the key
+             */
+            const K_TYPE& getKey() const;
+
+            /**
+             * @brief Gets the current key-value pair
+             * @return Current pair, valid while the caller stays pinned
+             */
+            entryType* getEntry() const;
+
+            /**
+             * @brief Checks whether the node is logically deleted
+             * @return true if level 0 is marked
+             */
+            bool isDeleted();
+
+            /**
+             * @brief Destroys the next pointers
+             */
+            ~skipListNode();
+        };
+
+        /**
+         * @brief Allocation unit of a node together with its next pointers
+         */
+        struct alignas(skipListNode) nodeBlock {
+            byte storage[alignof(skipListNode)];
+        };
+
+        using rebind_alloc_node = ALLOC::template rebind_alloc<nodeBlock>;  ///< Rebound allocator for nodes
+
+        /**
+         * @brief Maximum number of levels of a node, also the number of levels of the head
+         */
+        static constexpr u_integer MAX_LEVELS = 32;
+
+        skipListNode* head_;                            ///< Head sentinel with MAX_LEVELS levels
+        Compare compare_;                               ///< Comparison function
+        atomic<integer> size_{makeAtomic<integer>(0)};  ///< Number of elements
+        mutable ALLOC data_alloc_{};                    ///< Key-value pair allocator
+        mutable rebind_alloc_node node_alloc_{};        ///< Node allocator
+        mutable epochDomain epochs_;                    ///< Reclamation domain, destroyed before the allocators
+
+        /**
+         * @brief Checks the deletion mark of a next pointer
+         * @param p Next pointer value
+         * @return true if marked
+         */
+        static bool isMarked(const skipListNode* p);
+
+        /**
+         * @brief Sets the deletion mark of a next pointer
+         * @param p Next pointer value
+         * @return Marked pointer
+         */
+        static skipListNode* marked(const skipListNode* p);
+
+        /**
+         * @brief Clears the deletion mark of a next pointer
+         * @param p Next pointer value
+         * @return Unmarked pointer
+         */
+        static skipListNode* unmarked(const skipListNode* p);
+
+        /**
+         * @brief Draws a random number of levels with p = 0.5
+         * @return Levels in [1, MAX_LEVELS]
+         * @details Uses a per-thread xorshift64 generator.
+         */
+        static u_integer getRandomLevels();
+
+        /**
+         * @brief Number of node blocks holding a node and its next pointers
+         * @param levels Number of levels
+         * @return Number of blocks to allocate
+         */
+        static u_integer blocksOf(u_integer levels);
+
+        /**
+         * @brief Allocates a key-value pair
+         * @param key Key
+         * @param value Value
+         * @return New pair
+         */
+        entryType* createEntry(const K_TYPE& key, const V_TYPE& value) const;
+
+        /**
+         * @brief Destroys a key-value pair
+         * @param entry Pair to destroy
+         */
+        void destroyEntry(entryType* entry) const;
+
+        /**
+         * @brief Allocates a node and its pair
+         * @param key Key
+         * @param value Value
+         * @param levels Number of levels
+         * @return New node
+         */
+        skipListNode* createNode(const K_TYPE& key, const V_TYPE& value, u_integer levels) const;
+
+        /**
+         * @brief Destroys a node and its current pair
+         * @param node Node to destroy
+         */
+        void destroyNode(skipListNode* node) const;
+
+        /**
+         * @brief Reclaim callback of a retired node
+         */
+        static void reclaimNode(void* node, void* list);
+
+        /**
+         * @brief Reclaim callback of a replaced key-value pair
+         */
+        static void reclaimEntry(void* entry, void* list);
+
+        /**
+         * @brief Checks whether two keys are equal
+         */
+        bool equal(const K_TYPE& k1, const K_TYPE& k2) const;
+
+        /**
+         * @brief Locates the predecessors and successors of a key on every level
+         * @param key Key to locate
+         * @param preds Output predecessors (MAX_LEVELS entries)
+         * @param succs Output successors (MAX_LEVELS entries)
+         * @return true if an unmarked node with the key is linked on level 0
+         * @details Unlinks marked nodes met on the way. Must be called while pinned.
+         */
+        bool locate(const K_TYPE& key, skipListNode** preds, skipListNode** succs) const;
+
+        /**
+         * @brief Unlinks every marked node with a key from all levels
+         * @param key Key of the nodes to unlink
+         * @details Unlike locate(), walks past all nodes with an equal key so that a
+         * marked node behind a live one with the same key is unlinked too.
+         * Must be called while pinned.
+         */
+        void unlinkMarked(const K_TYPE& key) const;
+
+        /**
+         * @brief Drops one owner of a node, retiring it once both owners are done
+         * @param node Node whose inserter or remover finished
+         * @param g Guard of the caller
+         */
+        void releaseOwner(skipListNode* node, epochDomain::guard& g) const;
+
+        /**
+         * @brief Constructs an empty list
+         * @param compare Comparison function
+         */
+        explicit concurrentSkipList(Compare compare = Compare{});
+
+        /**
+         * @brief Pins the epoch domain
+         * @return Guard of the critical section
+         */
+        epochDomain::guard pin() const;
+
+        /**
+         * @brief Gets the number of elements
+         * @return Number of elements, exact when no update is in flight
+         */
+        u_integer count() const;
+
+        /**
+         * @brief Finds the live node of a key without modifying the list
+         * @param key Key to find
+         * @return Node pointer, nullptr if absent
+         * @pre The caller is pinned
+         */
+        skipListNode* find(const K_TYPE& key) const;
+
+        /**
+         * @brief Inserts a key-value pair if the key is absent
+         * @param key Key to insert
+         * @param value Value to associate
+         * @return true if inserted
+         */
+        bool insert(const K_TYPE& key, const V_TYPE& value);
+
+        /**
+         * @brief Replaces the value of a key
+         * @param key Key to modify
+         * @param value New value
+         * @return true if the key was present
+         */
+        bool modify(const K_TYPE& key, const V_TYPE& value);
+
+        /**
+         * @brief Removes a key
+         * @param key Key to remove
+         * @return true if this call removed the key
+         */
+        bool erase(const K_TYPE& key);
+
+        /**
+         * @brief Gets the first live node
+         * @return First node, nullptr if empty
+         * @pre The caller is pinned
+         */
+        skipListNode* firstNode() const;
+
+        /**
+         * @brief Gets the live node following a node on level 0
+         * @param node Current node, may be deleted
+         * @return Next live node, nullptr at the end
+         * @pre The caller is pinned
+         */
+        skipListNode* nextNode(skipListNode* node) const;
+
+        /**
+         * @brief Gets the last live node
+         * @return Last node, nullptr if empty
+         * @pre The caller is pinned
+         */
+        skipListNode* lastNode() const;
+
+        /**
+         * @brief Destroys all nodes
+         * @pre No other thread accesses the list
+         */
+        ~concurrentSkipList();
+    };
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::skipListNode(
+    const K_TYPE& key, entryType* data, const u_integer levels)
+    : key_(key), data_(makeAtomic(data)), owners_(makeAtomic<u_integer>(2)), levels_(levels)
+{
+    auto nexts = reinterpret_cast<atomic<skipListNode*>*>(reinterpret_cast<byte*>(this) + sizeof(skipListNode));
+    for (u_integer i = 0; i < levels; ++i) {
+        new (&nexts[i]) atomic<skipListNode*>(makeAtomic<skipListNode*>(nullptr));
+    }
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::atomic<typename original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*>&
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::next(const u_integer level)
+{
+    return reinterpret_cast<atomic<skipListNode*>*>(reinterpret_cast<byte*>(this) + sizeof(skipListNode))[level];
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+const K_TYPE& original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::getKey() const
+{
+    return this->key_;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::entryType*
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::getEntry() const
+{
+    return this->data_.load(memOrder::ACQUIRE);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::isDeleted()
+{
+    return isMarked(this->next(0).load(memOrder::ACQUIRE));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode::~skipListNode()
+{
+    for (u_integer i = 0; i < this->levels_; ++i) {
+        this->next(i).~atomic<skipListNode*>();
+    }
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::isMarked(const skipListNode* p)
+{
+    return reinterpret_cast<std::uintptr_t>(p) & 1;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::marked(const skipListNode* p)
+{
+    return reinterpret_cast<skipListNode*>(reinterpret_cast<std::uintptr_t>(p) | 1);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::unmarked(const skipListNode* p)
+{
+    return reinterpret_cast<skipListNode*>(reinterpret_cast<std::uintptr_t>(p) & ~static_cast<std::uintptr_t>(1));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::u_integer original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::getRandomLevels()
+{
+    thread_local std::uint64_t state = std::random_device{}() | 1;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return static_cast<u_integer>(std::countr_zero(state | std::uint64_t{1} << (MAX_LEVELS - 1))) + 1;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::u_integer original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::blocksOf(const u_integer levels)
+{
+    return (sizeof(skipListNode) + levels * sizeof(atomic<skipListNode*>) + sizeof(nodeBlock) - 1) / sizeof(nodeBlock);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::entryType*
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::createEntry(const K_TYPE& key, const V_TYPE& value) const
+{
+    auto entry = this->data_alloc_.allocate(1);
+    try {
+        this->data_alloc_.construct(entry, key, value);
+    } catch (...) {
+        this->data_alloc_.deallocate(entry, 1);
+        throw;
+    }
+    return entry;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::destroyEntry(entryType* entry) const
+{
+    this->data_alloc_.destroy(entry);
+    this->data_alloc_.deallocate(entry, 1);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::createNode(
+    const K_TYPE& key, const V_TYPE& value, const u_integer levels) const
+{
+    auto entry = this->createEntry(key, value);
+    const u_integer blocks = blocksOf(levels);
+    auto node = reinterpret_cast<skipListNode*>(this->node_alloc_.allocate(blocks));
+    try {
+        this->node_alloc_.construct(node, key, entry, levels);
+    } catch (...) {
+        this->node_alloc_.deallocate(reinterpret_cast<nodeBlock*>(node), blocks);
+        this->destroyEntry(entry);
+        throw;
+    }
+    return node;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::destroyNode(skipListNode* node) const
+{
+    if (auto entry = node->data_.load(memOrder::RELAXED)) {
+        this->destroyEntry(entry);
+    }
+    const u_integer blocks = blocksOf(node->levels_);
+    this->node_alloc_.destroy(node);
+    this->node_alloc_.deallocate(reinterpret_cast<nodeBlock*>(node), blocks);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::reclaimNode(void* node, void* list)
+{
+    static_cast<const concurrentSkipList*>(list)->destroyNode(static_cast<skipListNode*>(node));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::reclaimEntry(void* entry, void* list)
+{
+    static_cast<const concurrentSkipList*>(list)->destroyEntry(static_cast<entryType*>(entry));
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::equal(const K_TYPE& k1, const K_TYPE& k2) const
+{
+    return !this->compare_(k1, k2) && !this->compare_(k2, k1);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::locate(
+    const K_TYPE& key, skipListNode** preds, skipListNode** succs) const
+{
+    bool restart = true;
+    skipListNode* cur = nullptr;
+    while (restart) {
+        restart = false;
+        skipListNode* pred = this->head_;
+        for (u_integer i = MAX_LEVELS; i > 0 && !restart; --i) {
+            const u_integer level = i - 1;
+            cur = unmarked(pred->next(level).load(memOrder::ACQUIRE));
+            while (cur) {
+                skipListNode* succ = cur->next(level).load(memOrder::ACQUIRE);
+                if (isMarked(succ)) {
+                    skipListNode* expected = cur;
+                    if (!pred->next(level).exchangeCmp(expected, unmarked(succ))) {
+                        restart = true;
+                        break;
+                    }
+                    cur = unmarked(succ);
+                    continue;
+                }
+                if (!this->compare_(cur->getKey(), key)) {
+                    break;
+                }
+                pred = cur;
+                cur = succ;
+            }
+            preds[level] = pred;
+            succs[level] = cur;
+        }
+    }
+    return cur && !this->compare_(key, cur->getKey());
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::unlinkMarked(const K_TYPE& key) const
+{
+    bool restart = true;
+    while (restart) {
+        restart = false;
+        // Last node before the key, where the walk of the next level starts
+        skipListNode* start = this->head_;
+        for (u_integer i = MAX_LEVELS; i > 0 && !restart; --i) {
+            const u_integer level = i - 1;
+            skipListNode* pred = start;
+            skipListNode* cur = unmarked(pred->next(level).load(memOrder::ACQUIRE));
+            while (cur) {
+                skipListNode* succ = cur->next(level).load(memOrder::ACQUIRE);
+                if (isMarked(succ)) {
+                    skipListNode* expected = cur;
+                    if (!pred->next(level).exchangeCmp(expected, unmarked(succ))) {
+                        restart = true;
+                        break;
+                    }
+                    cur = unmarked(succ);
+                    continue;
+                }
+                if (this->compare_(key, cur->getKey())) {
+                    break;
+                }
+                if (this->compare_(cur->getKey(), key)) {
+                    start = cur;
+                }
+                pred = cur;
+                cur = succ;
+            }
+        }
+    }
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+void original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::releaseOwner(
+    skipListNode* node, epochDomain::guard& g) const
+{
+    u_integer owners = node->owners_.load();
+    while (!node->owners_.exchangeCmp(owners, owners - 1)) {}
+    if (owners == 1) {
+        // Both the inserter and the remover are done, no new link to the node can appear
+        this->unlinkMarked(node->getKey());
+        g.retire(node, &concurrentSkipList::reclaimNode,
+                 const_cast<concurrentSkipList*>(this));
+    }
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::concurrentSkipList(Compare compare)
+    : head_(nullptr), compare_(std::move(compare))
+{
+    const u_integer blocks = blocksOf(MAX_LEVELS);
+    this->head_ = reinterpret_cast<skipListNode*>(this->node_alloc_.allocate(blocks));
+    try {
+        this->node_alloc_.construct(this->head_, K_TYPE{}, static_cast<entryType*>(nullptr), MAX_LEVELS);
+    } catch (...) {
+        this->node_alloc_.deallocate(reinterpret_cast<nodeBlock*>(this->head_), blocks);
+        throw;
+    }
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::epochDomain::guard original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::pin() const
+{
+    return this->epochs_.pin();
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::u_integer original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::count() const
+{
+    const integer size = this->size_.load(memOrder::RELAXED);
+    return size > 0 ? static_cast<u_integer>(size) : 0;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::find(const K_TYPE& key) const
+{
+    skipListNode* pred = this->head_;
+    skipListNode* cur = nullptr;
+    for (u_integer i = MAX_LEVELS; i > 0; --i) {
+        const u_integer level = i - 1;
+        cur = unmarked(pred->next(level).load(memOrder::ACQUIRE));
+        while (cur) {
+            skipListNode* succ = cur->next(level).load(memOrder::ACQUIRE);
+            if (isMarked(succ)) {
+                cur = unmarked(succ);
+                continue;
+            }
+            if (!this->compare_(cur->getKey(), key)) {
+                break;
+            }
+            pred = cur;
+            cur = succ;
+        }
+    }
+    if (cur && !this->compare_(key, cur->getKey())) {
+        return cur;
+    }
+    return nullptr;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::insert(const K_TYPE& key, const V_TYPE& value)
+{
+    skipListNode* preds[MAX_LEVELS];
+    skipListNode* succs[MAX_LEVELS];
+    auto g = this->pin();
+
+    skipListNode* node = nullptr;
+    u_integer levels = 0;
+    while (true) {
+        if (this->locate(key, preds, succs)) {
+            if (node) {
+                this->destroyNode(node);
+            }
+            return false;
+        }
+        if (!node) {
+            levels = getRandomLevels();
+            node = this->createNode(key, value, levels);
+        }
+        for (u_integer i = 0; i < levels; ++i) {
+            node->next(i).store(succs[i], memOrder::RELAXED);
+        }
+        skipListNode* expected = succs[0];
+        if (preds[0]->next(0).exchangeCmp(expected, node, memOrder::RELEASE)) {
+            break;
+        }
+    }
+    this->size_ += 1;
+
+    for (u_integer level = 1; level < levels; ++level) {
+        while (true) {
+            skipListNode* succ = node->next(level).load(memOrder::ACQUIRE);
+            if (isMarked(succ)) {
+                // Removed while linking, the remover owns the unlinking of the linked levels
+                this->releaseOwner(node, g);
+                return true;
+            }
+            if (succ != succs[level] && !node->next(level).exchangeCmp(succ, succs[level])) {
+                continue;
+            }
+            skipListNode* expected = succs[level];
+            if (preds[level]->next(level).exchangeCmp(expected, node, memOrder::RELEASE)) {
+                break;
+            }
+            this->locate(key, preds, succs);
+            if (succs[0] != node) {
+                // Deleted (and possibly unlinked) in the meantime
+                this->releaseOwner(node, g);
+                return true;
+            }
+        }
+    }
+    this->releaseOwner(node, g);
+    return true;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::modify(const K_TYPE& key, const V_TYPE& value)
+{
+    auto g = this->pin();
+    skipListNode* node = this->find(key);
+    if (!node) {
+        return false;
+    }
+
+    entryType* entry = this->createEntry(node->getKey(), value);
+    entryType* old = node->data_.exchange(entry, memOrder::ACQ_REL);
+    g.retire(old, &concurrentSkipList::reclaimEntry, const_cast<concurrentSkipList*>(this));
+    return true;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+bool original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::erase(const K_TYPE& key)
+{
+    skipListNode* preds[MAX_LEVELS];
+    skipListNode* succs[MAX_LEVELS];
+    auto g = this->pin();
+
+    if (!this->locate(key, preds, succs)) {
+        return false;
+    }
+
+    skipListNode* victim = succs[0];
+    for (u_integer level = victim->levels_ - 1; level > 0; --level) {
+        skipListNode* succ = victim->next(level).load(memOrder::ACQUIRE);
+        while (!isMarked(succ) && !victim->next(level).exchangeCmp(succ, marked(succ))) {}
+    }
+
+    skipListNode* succ = victim->next(0).load(memOrder::ACQUIRE);
+    while (!isMarked(succ)) {
+        if (victim->next(0).exchangeCmp(succ, marked(succ))) {
+            this->size_ -= 1;
+            this->locate(key, preds, succs);
+            this->releaseOwner(victim, g);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::firstNode() const
+{
+    return this->nextNode(this->head_);
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::nextNode(skipListNode* node) const
+{
+    skipListNode* cur = unmarked(node->next(0).load(memOrder::ACQUIRE));
+    while (cur && cur->isDeleted()) {
+        cur = unmarked(cur->next(0).load(memOrder::ACQUIRE));
+    }
+    return cur;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+typename original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::skipListNode*
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::lastNode() const
+{
+    skipListNode* pred = this->head_;
+    for (u_integer i = MAX_LEVELS; i > 1; --i) {
+        const u_integer level = i - 1;
+        skipListNode* cur = unmarked(pred->next(level).load(memOrder::ACQUIRE));
+        while (cur) {
+            skipListNode* succ = cur->next(level).load(memOrder::ACQUIRE);
+            if (!isMarked(succ)) {
+                pred = cur;
+            }
+            cur = unmarked(succ);
+        }
+    }
+
+    skipListNode* last = pred == this->head_ || pred->isDeleted() ? nullptr : pred;
+    for (skipListNode* cur = this->nextNode(pred); cur; cur = this->nextNode(cur)) {
+        last = cur;
+    }
+    return last;
+}
+
+template <typename K_TYPE, typename V_TYPE, typename ALLOC, typename Compare>
+original::concurrentSkipList<K_TYPE, V_TYPE, ALLOC, Compare>::~concurrentSkipList()
+{
+    skipListNode* cur = unmarked(this->head_->next(0).load(memOrder::RELAXED));
+    while (cur) {
+        skipListNode* next = unmarked(cur->next(0).load(memOrder::RELAXED));
+        this->destroyNode(cur);
+        cur = next;
+    }
+    this->destroyNode(this->head_);
+}
+
+#endif //ORIGINAL_CONCURRENT_SKIPLIST_H
@@ -3,6 +3,7 @@
 #include "optional.h"
 #include <coroutine>
 #include <exception>
+#include <type_traits>
 
 /**
  * @file coroutines.h
@@ -13,6 +14,13 @@
  * consume sequences of values with minimal memory overhead and efficient
  * suspension/resumption semantics.
  *
+ * It also provides `coroutine::task`, a lazily started coroutine whose result
+ * is obtained by co_await-ing it from another coroutine. A task that finishes
+ * without suspending lets its awaiter continue in place, so long sequences of
+ * awaits do not grow the stack. `async::spawn()` starts a task from ordinary
+ * code, futures are awaitable, and `taskDelegator::schedule()` moves a
+ * coroutine onto a pool worker.
+ *
  * Key Features:
  * - Lazy evaluation: Values are generated on-demand
  * - Exception safety: Proper exception propagation through coroutine boundaries
@@ -247,6 +255,220 @@ namespace original {
              */
             ~generator();
         };
+
+        template<typename TYPE>
+        class task;
+
+    private:
+        /**
+         * @class taskPromiseBase
+         * @brief Result-independent part of the promise of a task
+         * @details Tasks start suspended. The awaiting coroutine and the final awaiter
+         *          race on a handoff flag: if the body finishes before the awaiter has
+         *          suspended, the awaiting coroutine simply does not suspend; otherwise
+         *          the final awaiter resumes it. Tasks that complete synchronously
+         *          therefore never nest resumptions, whether or not the compiler turns
+         *          symmetric transfer into a tail call.
+         */
+        class taskPromiseBase {
+            /**
+             * @struct finalAwaiter
+             * @brief Resumes the awaiting coroutine when the task body finishes
+             */
+            struct finalAwaiter {
+                static bool await_ready() noexcept;
+
+                template<typename PROMISE>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<PROMISE> h) noexcept;
+
+                static void await_resume() noexcept;
+            };
+
+            std::coroutine_handle<> continuation_{};  ///< Coroutine awaiting this task
+            std::exception_ptr e_{};                  ///< Exception escaping the task body
+            bool handoff_{false};                     ///< Set by whichever of awaiter and body finishes first
+
+        public:
+            /**
+             * @brief Defines initial suspension behavior
+             * @return suspend_always, tasks only run once awaited
+             */
+            static std::suspend_always initial_suspend() noexcept;
+
+            /**
+             * @brief Defines final suspension behavior
+             * @return Awaiter resuming the awaiting coroutine by symmetric transfer
+             * @note The frame stays alive until the owning task is destroyed
+             */
+            static finalAwaiter final_suspend() noexcept;
+
+            /**
+             * @brief Captures exceptions thrown from the task body
+             */
+            void unhandled_exception() noexcept;
+
+            /**
+             * @brief Sets the coroutine resumed when the task finishes
+             * @param continuation Awaiting coroutine
+             */
+            void setContinuation(std::coroutine_handle<> continuation) noexcept;
+
+            /**
+             * @brief Marks one side of the handoff as finished
+             * @return True if the other side had already finished
+             */
+            bool handoff() noexcept;
+
+            /**
+             * @brief Re-throws any captured exception
+             */
+            void rethrowIfException() const;
+        };
+
+        /**
+         * @class taskPromise
+         * @brief Promise type of task, storing the returned value
+         * @tparam TYPE Result type of the task
+         */
+        template<typename TYPE>
+        class taskPromise : public taskPromiseBase {
+            alternative<TYPE> value_;  ///< Value passed to co_return
+
+        public:
+            /**
+             * @brief Creates the task object from this promise
+             */
+            task<TYPE> get_return_object() noexcept;
+
+            /**
+             * @brief Stores the value passed to co_return
+             * @param value Result of the task
+             */
+            void return_value(TYPE value);
+
+            /**
+             * @brief Moves the result out of the finished task
+             * @throws The exception escaping the task body, if any
+             */
+            TYPE result();
+        };
+
+    public:
+        /**
+         * @class task
+         * @tparam TYPE Result type of the coroutine
+         * @brief Lazily started coroutine producing one value
+         * @details A task does not run until it is co_awaited. It then runs on the
+         *          awaiting thread; if it suspends, the awaiting coroutine suspends too
+         *          and is resumed directly with the result when the task finishes.
+         *          Exceptions escaping the task body are rethrown at the co_await.
+         *
+         *          A task can be awaited only once. Use `async::spawn()` to start one from
+         *          ordinary code and obtain a future of its result.
+         *
+         * @code
+         * coroutine::task<int> answer() { co_return 42; }
+         * coroutine::task<int> twice() { co_return 2 * co_await answer(); }
+         * @endcode
+         *
+         * @note Tasks are move-only; destroying a task destroys its coroutine frame.
+         */
+        template<typename TYPE>
+        class task {
+        public:
+            using promise_type = taskPromise<TYPE>;  ///< Promise type for coroutine protocol
+
+        private:
+            using handle = std::coroutine_handle<promise_type>;  ///< Coroutine handle type
+
+            /**
+             * @class awaiter
+             * @brief Starts the task and resumes the awaiting coroutine with its result
+             */
+            class awaiter {
+                handle handle_;  ///< Task being awaited
+
+            public:
+                explicit awaiter(handle h) noexcept;
+
+                [[nodiscard]] bool await_ready() const noexcept;
+
+                /**
+                 * @brief Runs the task until it finishes or suspends
+                 * @param awaiting Coroutine awaiting the task
+                 * @return False if the task already finished, so the awaiting coroutine continues
+                 */
+                bool await_suspend(std::coroutine_handle<> awaiting) noexcept;
+
+                TYPE await_resume();
+            };
+
+            handle handle_{};  ///< Underlying coroutine handle
+
+        public:
+            task() = default;  ///< Default constructor creates an invalid task
+
+            /**
+             * @brief Constructs a task from its coroutine handle
+             * @param h Coroutine handle to manage
+             */
+            explicit task(handle h) noexcept;
+
+            task(const task&) = delete;
+            task& operator=(const task&) = delete;
+
+            /**
+             * @brief Move constructor transfers coroutine ownership
+             * @param other Task to move from
+             */
+            task(task&& other) noexcept;
+
+            /**
+             * @brief Move assignment operator transfers coroutine ownership
+             * @param other Task to move from
+             * @return Reference to this task
+             */
+            task& operator=(task&& other) noexcept;
+
+            /**
+             * @brief Checks if the task owns a coroutine
+             */
+            [[nodiscard]] bool valid() const noexcept;
+
+            /**
+             * @brief Checks if the task body has finished
+             */
+            [[nodiscard]] bool done() const noexcept;
+
+            /**
+             * @brief Awaits the task from another coroutine
+             * @return Awaiter yielding the task result
+             * @throws sysError if the task is invalid
+             */
+            awaiter operator co_await() &&;
+
+            /**
+             * @brief Destroys the coroutine frame
+             */
+            ~task();
+        };
+    };
+
+    /**
+     * @brief Specialization of taskPromise for tasks without a result
+     */
+    template<>
+    class coroutine::taskPromise<void> : public taskPromiseBase {
+    public:
+        /**
+         * @brief Creates the task object from this promise
+         */
+        task<void> get_return_object() noexcept;
+
+        /**
+         * @brief Handles coroutine completion without value
+         */
+        static void return_void() noexcept;
     };
 }
 
@@ -426,4 +648,163 @@ original::coroutine::generator<TYPE>::~generator()
         this->handle_.destroy();
 }
 
+inline bool original::coroutine::taskPromiseBase::finalAwaiter::await_ready() noexcept
+{
+    return false;
+}
+
+template <typename PROMISE>
+std::coroutine_handle<>
+original::coroutine::taskPromiseBase::finalAwaiter::await_suspend(std::coroutine_handle<PROMISE> h) noexcept
+{
+    if (auto& promise = h.promise(); promise.handoff()) {
+        return promise.continuation_;
+    }
+    return std::noop_coroutine();
+}
+
+inline void original::coroutine::taskPromiseBase::finalAwaiter::await_resume() noexcept {}
+
+inline std::suspend_always original::coroutine::taskPromiseBase::initial_suspend() noexcept
+{
+    return std::suspend_always{};
+}
+
+inline original::coroutine::taskPromiseBase::finalAwaiter
+original::coroutine::taskPromiseBase::final_suspend() noexcept
+{
+    return finalAwaiter{};
+}
+
+inline void original::coroutine::taskPromiseBase::unhandled_exception() noexcept
+{
+    this->e_ = std::current_exception();
+}
+
+inline void original::coroutine::taskPromiseBase::setContinuation(std::coroutine_handle<> continuation) noexcept
+{
+    this->continuation_ = continuation;
+}
+
+inline bool original::coroutine::taskPromiseBase::handoff() noexcept
+{
+    return __atomic_exchange_n(&this->handoff_, true, __ATOMIC_ACQ_REL);
+}
+
+inline void original::coroutine::taskPromiseBase::rethrowIfException() const
+{
+    if (this->e_)
+        std::rethrow_exception(this->e_);
+}
+
+template <typename TYPE>
+original::coroutine::task<TYPE> original::coroutine::taskPromise<TYPE>::get_return_object() noexcept
+{
+    return task<TYPE>{std::coroutine_handle<taskPromise>::from_promise(*this)};
+}
+
+template <typename TYPE>
+void original::coroutine::taskPromise<TYPE>::return_value(TYPE value)
+{
+    this->value_.emplace(std::move(value));
+}
+
+template <typename TYPE>
+TYPE original::coroutine::taskPromise<TYPE>::result()
+{
+    this->rethrowIfException();
+    return std::move(*this->value_);
+}
+
+inline original::coroutine::task<void> original::coroutine::taskPromise<void>::get_return_object() noexcept
+{
+    return task<void>{std::coroutine_handle<taskPromise>::from_promise(*this)};
+}
+
+inline void original::coroutine::taskPromise<void>::return_void() noexcept {}
+
+template <typename TYPE>
+original::coroutine::task<TYPE>::awaiter::awaiter(handle h) noexcept
+    : handle_(h) {}
+
+template <typename TYPE>
+bool original::coroutine::task<TYPE>::awaiter::await_ready() const noexcept
+{
+    return this->handle_.done();
+}
+
+template <typename TYPE>
+bool original::coroutine::task<TYPE>::awaiter::await_suspend(std::coroutine_handle<> awaiting) noexcept
+{
+    this->handle_.promise().setContinuation(awaiting);
+    this->handle_.resume();
+    return !this->handle_.promise().handoff();
+}
+
+template <typename TYPE>
+TYPE original::coroutine::task<TYPE>::awaiter::await_resume()
+{
+    if constexpr (std::is_void_v<TYPE>) {
+        this->handle_.promise().rethrowIfException();
+    } else {
+        return this->handle_.promise().result();
+    }
+}
+
+template <typename TYPE>
+original::coroutine::task<TYPE>::task(handle h) noexcept
+    : handle_(h) {}
+
+template <typename TYPE>
+original::coroutine::task<TYPE>::task(task&& other) noexcept
+    : handle_(other.handle_)
+{
+    other.handle_ = nullptr;
+}
+
+template <typename TYPE>
+original::coroutine::task<TYPE>&
+original::coroutine::task<TYPE>::operator=(task&& other) noexcept
+{
+    if (this == &other) {
+        return *this;
+    }
+
+    if (this->handle_) {
+        this->handle_.destroy();
+    }
+
+    this->handle_ = other.handle_;
+    other.handle_ = nullptr;
+    return *this;
+}
+
+template <typename TYPE>
+bool original::coroutine::task<TYPE>::valid() const noexcept
+{
+    return static_cast<bool>(this->handle_);
+}
+
+template <typename TYPE>
+bool original::coroutine::task<TYPE>::done() const noexcept
+{
+    return this->handle_ && this->handle_.done();
+}
+
+template <typename TYPE>
+typename original::coroutine::task<TYPE>::awaiter
+original::coroutine::task<TYPE>::operator co_await() &&
+{
+    if (!this->handle_)
+        throw sysError("Await an invalid coroutine task");
+    return awaiter{this->handle_};
+}
+
+template <typename TYPE>
+original::coroutine::task<TYPE>::~task()
+{
+    if (this->handle_)
+        this->handle_.destroy();
+}
+
 #endif //ORIGINAL_COROUTINES_H
@@ -0,0 +1,336 @@
+/**
+ * @file epochs.h
+ * @brief Epoch-based memory reclamation for lock-free data structures
+ * @details
+ * This header defines `epochDomain`, a reclamation scheme in the style of
+ * Fraser's epoch-based reclamation. Lock-free containers unlink a node with a
+ * CAS but cannot free it right away, because concurrent readers may still hold
+ * a pointer to it. Instead the node is *retired* into the domain and freed once
+ * every reader that could have seen it has left its critical section.
+ *
+ * Protocol:
+ * - A thread enters a critical section with `epochDomain::pin()`, which returns
+ *   an RAII `epochDomain::guard`; shared pointers must only be dereferenced while
+ *   a guard is alive
+ * - Unlinked objects are handed to `guard::retire()` together with a reclaim
+ *   callback
+ * - The global epoch advances once every pinned guard has observed it; an object
+ *   retired in epoch e is reclaimed when the global epoch reaches e + 2
+ *
+ * Guards are not bound to a thread: each guard owns a participant record for its
+ * lifetime, so nested guards and guards held by iterators are supported. Long-lived
+ * guards delay reclamation but never block other threads.
+ */
+
+#ifndef ORIGINAL_EPOCHS_H
+#define ORIGINAL_EPOCHS_H
+
+#include "atomic.h"
+#include "vector.h"
+
+namespace original {
+
+    /**
+     * @class epochDomain
+     * @brief Epoch-based reclamation domain
+     * @details Owns the global epoch, the participant records and their lists of
+     * retired objects. Every lock-free container owns one domain, so reclamation
+     * of one container never waits on readers of another.
+     *
+     * All objects still retired when the domain is destroyed are reclaimed by its
+     * destructor; no guard may be alive at that point.
+     *
+     * @note epochDomain is **non-copyable** and **non-movable**.
+     */
+    class epochDomain {
+        /**
+         * @struct retiredEntry
+         * @brief Object waiting for reclamation
+         */
+        struct retiredEntry {
+            void* ptr;                          ///< Retired object
+            void (*reclaim)(void*, void*);      ///< Reclaim callback, called as reclaim(ptr, context)
+            void* context;                      ///< Owner context passed to the callback
+        };
+
+        /// @brief Number of limbo lists per record (epochs e, e - 1 and e - 2 may be pending)
+        static constexpr u_integer LIMBO_LISTS = 3;
+
+        /// @brief Number of retirements on a record between two attempts to advance the epoch
+        static constexpr u_integer ADVANCE_PERIOD = 64;
+
+        /**
+         * @struct record
+         * @brief Participant record owned by at most one guard at a time
+         * @details The limbo lists stay with the record when its guard is released
+         * and are drained by the next guard acquiring it, or by the domain destructor.
+         */
+        struct record {
+            atomic<bool> in_use_{makeAtomic(false)};                 ///< Whether a guard owns the record
+            atomic<ul_integer> epoch_{makeAtomic<ul_integer>(0)};    ///< Epoch observed when pinned
+            record* next_ = nullptr;                                 ///< Next record in the domain
+            vector<retiredEntry> limbo_[LIMBO_LISTS];                ///< Retired objects by epoch % LIMBO_LISTS
+            ul_integer limbo_epochs_[LIMBO_LISTS]{};                 ///< Epoch each limbo list was filled in
+            u_integer retired_count_ = 0;                            ///< Retirements since the last advance attempt
+        };
+
+        atomic<ul_integer> global_epoch_{makeAtomic<ul_integer>(0)};  ///< Global epoch
+        atomic<record*> records_{makeAtomic<record*>(nullptr)};       ///< Lock-free list of records
+
+        /**
+         * @brief Takes ownership of a free record, creating one if none is free
+         * @return Record owned by the caller
+         */
+        record* acquire();
+
+        /**
+         * @brief Advances the global epoch if every pinned record observed it
+         * @return The global epoch after the attempt
+         */
+        ul_integer tryAdvance();
+
+        /**
+         * @brief Reclaims all objects of a limbo list
+         * @param list Limbo list to drain
+         */
+        static void reclaimList(vector<retiredEntry>& list);
+
+        /**
+         * @brief Reclaims the limbo lists of a record that are at least two epochs old
+         * @param r Record owned by the caller
+         * @param epoch Current global epoch
+         */
+        static void collect(record* r, ul_integer epoch);
+
+    public:
+        /**
+         * @class guard
+         * @brief RAII critical section of an epoch domain
+         * @details While a guard is alive, no object retired after the guard was
+         * pinned is reclaimed. Copying a guard pins the same domain again.
+         */
+        class guard {
+            epochDomain* domain_;   ///< Pinned domain, nullptr if moved from
+            record* record_;        ///< Owned participant record
+
+            /**
+             * @brief Pins a domain
+             * @param domain Domain to pin
+             */
+            explicit guard(epochDomain* domain);
+
+            /**
+             * @brief Releases the owned record
+             */
+            void release() noexcept;
+
+        public:
+            friend class epochDomain;
+
+            /**
+             * @brief Pins the domain of another guard again
+             * @param other Guard to copy
+             */
+            guard(const guard& other);
+
+            /**
+             * @brief Releases this guard and pins the domain of another guard
+             * @param other Guard to copy
+             * @return Reference to this guard
+             */
+            guard& operator=(const guard& other);
+
+            /**
+             * @brief Takes over the record of another guard
+             * @param other Guard to move from, left unpinned
+             */
+            guard(guard&& other) noexcept;
+
+            /**
+             * @brief Releases this guard and takes over the record of another guard
+             * @param other Guard to move from, left unpinned
+             * @return Reference to this guard
+             */
+            guard& operator=(guard&& other) noexcept;
+
+            /**
+             * @brief Retires an unlinked object
+             * @param ptr Object no longer reachable from the shared structure
+             * @param reclaim Callback freeing the object, called as reclaim(ptr, context)
+             * @param context Owner context passed to the callback
+             * @details The object is reclaimed once no guard pinned before the call
+             * can still reach it. The callback may run on any thread holding a guard
+             * of the same domain, or in the domain destructor.
+             */
+            void retire(void* ptr, void (*reclaim)(void*, void*), void* context);
+
+            /**
+             * @brief Unpins the domain
+             */
+            ~guard();
+        };
+
+        /**
+         * @brief Constructs a domain at epoch 0
+         */
+        epochDomain() = default;
+
+        epochDomain(const epochDomain&) = delete;
+        epochDomain& operator=(const epochDomain&) = delete;
+
+        /**
+         * @brief Enters a critical section
+         * @return Guard that keeps the critical section open until destroyed
+         */
+        guard pin();
+
+        /**
+         * @brief Reclaims every retired object and frees the records
+         * @pre No guard of this domain is alive
+         */
+        ~epochDomain();
+    };
+}
+
+inline original::epochDomain::record* original::epochDomain::acquire()
+{
+    for (record* r = this->records_.load(memOrder::ACQUIRE); r; r = r->next_) {
+        bool expected = false;
+        if (!r->in_use_.load(memOrder::RELAXED) && r->in_use_.exchangeCmp(expected, true)) {
+            return r;
+        }
+    }
+
+    auto r = new record;
+    r->in_use_.store(true, memOrder::RELAXED);
+    record* head = this->records_.load(memOrder::RELAXED);
+    do {
+        r->next_ = head;
+    } while (!this->records_.exchangeCmp(head, r, memOrder::RELEASE));
+    return r;
+}
+
+inline original::ul_integer original::epochDomain::tryAdvance()
+{
+    ul_integer epoch = this->global_epoch_.load();
+    for (record* r = this->records_.load(memOrder::ACQUIRE); r; r = r->next_) {
+        if (r->in_use_.load() && r->epoch_.load() != epoch) {
+            return epoch;
+        }
+    }
+    if (this->global_epoch_.exchangeCmp(epoch, epoch + 1)) {
+        return epoch + 1;
+    }
+    return epoch;
+}
+
+inline void original::epochDomain::reclaimList(vector<retiredEntry>& list)
+{
+    while (!list.empty()) {
+        const retiredEntry entry = list.popEnd();
+        entry.reclaim(entry.ptr, entry.context);
+    }
+}
+
+inline void original::epochDomain::collect(record* r, const ul_integer epoch)
+{
+    for (u_integer i = 0; i < LIMBO_LISTS; ++i) {
+        if (r->limbo_epochs_[i] + 2 <= epoch) {
+            reclaimList(r->limbo_[i]);
+        }
+    }
+}
+
+inline original::epochDomain::guard::guard(epochDomain* domain)
+    : domain_(domain), record_(domain->acquire())
+{
+    this->record_->epoch_.store(domain->global_epoch_.load());
+}
+
+inline void original::epochDomain::guard::release() noexcept
+{
+    if (this->domain_) {
+        this->record_->in_use_.store(false, memOrder::RELEASE);
+        this->domain_ = nullptr;
+        this->record_ = nullptr;
+    }
+}
+
+inline original::epochDomain::guard::guard(const guard& other)
+    : guard(other.domain_) {}
+
+inline original::epochDomain::guard&
+original::epochDomain::guard::operator=(const guard& other)
+{
+    if (this == &other) {
+        return *this;
+    }
+
+    guard pinned{other.domain_};
+    return this->operator=(std::move(pinned));
+}
+
+inline original::epochDomain::guard::guard(guard&& other) noexcept
+    : domain_(other.domain_), record_(other.record_)
+{
+    other.domain_ = nullptr;
+    other.record_ = nullptr;
+}
+
+inline original::epochDomain::guard&
+original::epochDomain::guard::operator=(guard&& other) noexcept
+{
+    if (this == &other) {
+        return *this;
+    }
+
+    this->release();
+    this->domain_ = other.domain_;
+    this->record_ = other.record_;
+    other.domain_ = nullptr;
+    other.record_ = nullptr;
+    return *this;
+}
+
+inline void original::epochDomain::guard::retire(void* ptr, void (*reclaim)(void*, void*), void* context)
+{
+    const ul_integer epoch = this->domain_->global_epoch_.load();
+    const u_integer index = epoch % LIMBO_LISTS;
+    if (this->record_->limbo_epochs_[index] != epoch) {
+        // The list was filled at least LIMBO_LISTS epochs ago
+        reclaimList(this->record_->limbo_[index]);
+        this->record_->limbo_epochs_[index] = epoch;
+    }
+    this->record_->limbo_[index].pushEnd(retiredEntry{ptr, reclaim, context});
+
+    this->record_->retired_count_ += 1;
+    if (this->record_->retired_count_ >= ADVANCE_PERIOD) {
+        this->record_->retired_count_ = 0;
+        collect(this->record_, this->domain_->tryAdvance());
+    }
+}
+
+inline original::epochDomain::guard::~guard()
+{
+    this->release();
+}
+
+inline original::epochDomain::guard original::epochDomain::pin()
+{
+    return guard{this};
+}
+
+inline original::epochDomain::~epochDomain()
+{
+    record* r = this->records_.load(memOrder::ACQUIRE);
+    while (r) {
+        for (u_integer i = 0; i < LIMBO_LISTS; ++i) {
+            reclaimList(r->limbo_[i]);
+        }
+        record* next = r->next_;
+        delete r;
+        r = next;
+    }
+}
+
+#endif //ORIGINAL_EPOCHS_H
@@ -0,0 +1,680 @@
+#ifndef ORIGINAL_PARALLEL_H
+#define ORIGINAL_PARALLEL_H
+
+#include "algorithms.h"
+#include "condition.h"
+#include "error.h"
+#include "mutex.h"
+#include "optional.h"
+#include "refCntPtr.h"
+#include "tasks.h"
+#include "types.h"
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+
+/**
+ * @file parallel.h
+ * @brief Bulk parallel algorithms over contiguous containers
+ * @details Provides data-parallel counterparts of the sequential routines in
+ * algorithms.h (forEach, transform, reduce, count, find, sort). A range is cut
+ * into chunks of a grain size and the chunks are executed by a taskDelegator.
+ *
+ * Execution model:
+ * - The calling thread always takes part and claims chunks itself, so a call
+ *   made from inside a worker of the same delegator cannot deadlock
+ * - Helper tasks claim chunks from a shared counter; a helper that starts late
+ *   simply finds no work left
+ * - The first exception thrown by a callback cancels the remaining chunks and
+ *   is rethrown to the caller once every running chunk has finished
+ * - Results never depend on scheduling: reduce combines partial results in
+ *   chunk order and sort merges runs stably
+ */
+
+namespace original
+{
+
+    /**
+     * @class parallel
+     * @brief Utility class containing data-parallel container algorithms
+     * @details All methods operate on a ContiguousContainer (`vector`, `array`)
+     * and take a taskDelegator plus an optional grain size, the number of
+     * elements processed by one chunk. A grain of 0 picks one automatically
+     * from the range size and the delegator's thread count.
+     * @note Callbacks run concurrently on different elements and must not touch
+     *       shared state without synchronization.
+     */
+    class parallel final
+    {
+        /// Smallest automatically chosen grain, below it tasks cost more than they save
+        static constexpr u_integer MIN_GRAIN = 2048;
+
+        /// Chunks per worker thread for the automatic grain, to absorb imbalance
+        static constexpr u_integer CHUNKS_PER_THREAD = 4;
+
+        /**
+         * @class loop
+         * @brief Shared state of one parallel loop over chunk indices
+         * @tparam Body Callable invoked with a chunk index
+         * @details Reference counted by the caller and every submitted helper.
+         *          Chunks are claimed with an atomic counter; the caller blocks
+         *          until every claimed chunk has completed.
+         */
+        template<typename Body>
+        class loop {
+            const Body& body_;
+            const u_integer chunks_;
+            u_integer next_;
+            u_integer done_;
+            u_integer refs_;
+            bool failed_;
+            std::exception_ptr e_;
+            pMutex mutex_;
+            pCondition condition_;
+
+        public:
+            loop(const Body& body, u_integer chunks, u_integer refs);
+
+            /**
+             * @brief Claims and runs chunks until none is left
+             */
+            void work() noexcept;
+
+            /**
+             * @brief Blocks until all chunks completed, rethrows the first failure
+             */
+            void wait();
+
+            /**
+             * @brief Drops one reference, destroying the loop with the last one
+             */
+            void release() noexcept;
+        };
+
+        /**
+         * @class helper
+         * @brief Move-only task submitted to the delegator for one loop
+         * @details Releases its reference even when the delegator drops the
+         *          task without running it.
+         */
+        template<typename Body>
+        class helper {
+            loop<Body>* loop_;
+
+        public:
+            explicit helper(loop<Body>* l) noexcept;
+
+            helper(helper&& other) noexcept;
+
+            helper(const helper&) = delete;
+
+            helper& operator=(const helper&) = delete;
+
+            helper& operator=(helper&&) = delete;
+
+            void operator()();
+
+            ~helper();
+        };
+
+        /**
+         * @brief Runs body(i) for every chunk index i in [0, chunks)
+         * @param delegator Delegator providing helper threads
+         * @param chunks Number of chunks
+         * @param body Callable invoked with a chunk index
+         * @throws The first exception thrown by body
+         */
+        template<typename Body>
+        static void run(taskDelegator& delegator, u_integer chunks, const Body& body);
+
+        /**
+         * @brief Resolves the grain size used for a range
+         * @param delegator Delegator whose thread count sizes the automatic grain
+         * @param size Number of elements in the range
+         * @param grain Requested grain, 0 for automatic
+         */
+        static u_integer grainOf(const taskDelegator& delegator, u_integer size, u_integer grain) noexcept;
+
+        /**
+         * @brief Number of chunks of at most grain elements covering size elements
+         */
+        static u_integer chunksOf(u_integer size, u_integer grain) noexcept;
+
+        /**
+         * @brief One past the last index of a chunk, clamped to size
+         * @details Computed as a distance from size so that it cannot wrap when
+         *          size is close to the limit of u_integer.
+         */
+        static u_integer chunkEnd(u_integer chunk, u_integer size, u_integer grain) noexcept;
+
+        /**
+         * @brief Finds how many elements of a come first among the first k of merge(a, b)
+         * @details Ties are taken from a, matching the stable merge.
+         */
+        template<typename TYPE, typename Callback>
+        static u_integer coRank(const TYPE* a, u_integer m, const TYPE* b, u_integer n,
+                                u_integer k, const Callback& compares);
+
+        /**
+         * @brief Stably merges a[0, m) and b[0, n) into dst by moving elements
+         */
+        template<typename TYPE, typename Callback>
+        static void merge(TYPE* a, u_integer m, TYPE* b, u_integer n, TYPE* dst, const Callback& compares);
+
+    public:
+        /// Element type stored by a contiguous container
+        template<ContiguousContainer CONTAINER>
+        using elemType = contiguousElemType<CONTAINER>;
+
+        /**
+         * @brief Applies an operation to every element in parallel
+         * @tparam CONTAINER Contiguous container type
+         * @tparam Callback Operation callback type
+         * @param delegator Delegator executing the chunks
+         * @param container Container to process
+         * @param operation Operation applied to each element
+         * @param grain Elements per chunk, 0 for automatic
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires Operation<Callback, elemType<CONTAINER>>
+        static void forEach(taskDelegator& delegator, CONTAINER& container,
+                            const Callback& operation, u_integer grain = 0);
+
+        /**
+         * @brief Writes operation(src[i]) to dst[i] for every element in parallel
+         * @tparam SRC Source contiguous container type
+         * @tparam DST Destination contiguous container type
+         * @tparam Callback Transformer callback type
+         * @param delegator Delegator executing the chunks
+         * @param src Source container
+         * @param dst Destination container, at least as long as src
+         * @param operation Transformation applied to each element
+         * @param grain Elements per chunk, 0 for automatic
+         * @throws outOfBoundError If dst is shorter than src
+         */
+        template<ContiguousContainer SRC, ContiguousContainer DST, typename Callback>
+        requires Transformer<Callback, elemType<DST>, const elemType<SRC>&>
+        static void transform(taskDelegator& delegator, const SRC& src, DST& dst,
+                              const Callback& operation, u_integer grain = 0);
+
+        /**
+         * @brief Folds all elements with an associative operation in parallel
+         * @tparam CONTAINER Contiguous container type
+         * @tparam Callback Binary operation type
+         * @param delegator Delegator executing the chunks
+         * @param container Container to reduce
+         * @param init Initial value, combined first
+         * @param operation Associative binary operation
+         * @param grain Elements per chunk, 0 for automatic
+         * @return init combined with every element
+         * @details Each chunk is folded left to right, then the partial results are
+         *          folded in chunk order, so the result is reproducible for a given
+         *          grain even when the operation is not commutative.
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires CallbackOf<Callback, elemType<CONTAINER>, const elemType<CONTAINER>&, const elemType<CONTAINER>&>
+        static elemType<CONTAINER> reduce(taskDelegator& delegator, const CONTAINER& container,
+                                          const elemType<CONTAINER>& init,
+                                          const Callback& operation, u_integer grain = 0);
+
+        /**
+         * @brief Counts elements equal to a target in parallel
+         * @param delegator Delegator executing the chunks
+         * @param container Container to search
+         * @param target Value to count
+         * @param grain Elements per chunk, 0 for automatic
+         * @return Number of matching elements
+         */
+        template<ContiguousContainer CONTAINER>
+        static u_integer count(taskDelegator& delegator, const CONTAINER& container,
+                               const elemType<CONTAINER>& target, u_integer grain = 0);
+
+        /**
+         * @brief Counts elements satisfying a condition in parallel
+         * @param delegator Delegator executing the chunks
+         * @param container Container to search
+         * @param condition Predicate checked for each element
+         * @param grain Elements per chunk, 0 for automatic
+         * @return Number of elements satisfying the condition
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires Condition<Callback, elemType<CONTAINER>>
+        static u_integer count(taskDelegator& delegator, const CONTAINER& container,
+                               const Callback& condition, u_integer grain = 0);
+
+        /**
+         * @brief Finds the first element equal to a target in parallel
+         * @param delegator Delegator executing the chunks
+         * @param container Container to search
+         * @param target Value to find
+         * @param grain Elements per chunk, 0 for automatic
+         * @return Index of the first match, or container.size() if none
+         */
+        template<ContiguousContainer CONTAINER>
+        static u_integer find(taskDelegator& delegator, const CONTAINER& container,
+                              const elemType<CONTAINER>& target, u_integer grain = 0);
+
+        /**
+         * @brief Finds the first element satisfying a condition in parallel
+         * @param delegator Delegator executing the chunks
+         * @param container Container to search
+         * @param condition Predicate checked for each element
+         * @param grain Elements per chunk, 0 for automatic
+         * @return Index of the first match, or container.size() if none
+         * @details Chunks lying entirely after an already found match are skipped.
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires Condition<Callback, elemType<CONTAINER>>
+        static u_integer find(taskDelegator& delegator, const CONTAINER& container,
+                              const Callback& condition, u_integer grain = 0);
+
+        /**
+         * @brief Sorts a container with a parallel merge sort
+         * @tparam CONTAINER Contiguous container type
+         * @tparam Callback Comparison callback type
+         * @param delegator Delegator executing the chunks
+         * @param container Container to sort
+         * @param compares Comparison callback defining the order
+         * @param is_stable Sort chunks with stableSort instead of introSort
+         * @param grain Elements per chunk, 0 for automatic
+         * @details Chunks are sorted independently with algorithms::introSort or
+         *          algorithms::stableSort, then merged pairwise in rounds. Every
+         *          merge is split into grain-sized pieces at co-ranked positions,
+         *          so all rounds run in parallel. Merges are stable, so with
+         *          is_stable the result equals the sequential stableSort.
+         * @note Uses a temporary copy of the container as merge buffer.
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires Compare<Callback, elemType<CONTAINER>>
+        static void sort(taskDelegator& delegator, CONTAINER& container, const Callback& compares,
+                         bool is_stable = false, u_integer grain = 0);
+
+        /**
+         * @brief Stably sorts a container with a parallel merge sort
+         * @details Equivalent to sort(delegator, container, compares, true, grain);
+         *          the result is deterministic and independent of the grain.
+         */
+        template<ContiguousContainer CONTAINER, typename Callback>
+        requires Compare<Callback, elemType<CONTAINER>>
+        static void stableSort(taskDelegator& delegator, CONTAINER& container,
+                               const Callback& compares, u_integer grain = 0);
+    };
+} // namespace original
+
+// ==================== Loop Implementation ====================
+
+template<typename Body>
+original::parallel::loop<Body>::loop(const Body& body, const u_integer chunks, const u_integer refs)
+    : body_(body), chunks_(chunks), next_(0), done_(0), refs_(refs), failed_(false) {}
+
+template<typename Body>
+void original::parallel::loop<Body>::work() noexcept
+{
+    for (;;) {
+        const u_integer i = __atomic_fetch_add(&this->next_, 1, __ATOMIC_RELAXED);
+        if (i >= this->chunks_)
+            return;
+
+        if (!__atomic_load_n(&this->failed_, __ATOMIC_ACQUIRE)) {
+            try {
+                this->body_(i);
+            } catch (...) {
+                uniqueLock lock(this->mutex_);
+                if (!this->failed_) {
+                    this->e_ = std::current_exception();
+                    __atomic_store_n(&this->failed_, true, __ATOMIC_RELEASE);
+                }
+            }
+        }
+
+        if (__atomic_add_fetch(&this->done_, 1, __ATOMIC_ACQ_REL) == this->chunks_) {
+            uniqueLock lock(this->mutex_);
+            this->condition_.notifyAll();
+        }
+    }
+}
+
+template<typename Body>
+void original::parallel::loop<Body>::wait()
+{
+    uniqueLock lock(this->mutex_);
+    this->condition_.wait(this->mutex_, [this] {
+        return __atomic_load_n(&this->done_, __ATOMIC_ACQUIRE) == this->chunks_;
+    });
+    if (this->e_)
+        std::rethrow_exception(this->e_);
+}
+
+template<typename Body>
+void original::parallel::loop<Body>::release() noexcept
+{
+    if (__atomic_sub_fetch(&this->refs_, 1, __ATOMIC_ACQ_REL) == 0)
+        delete this;
+}
+
+template<typename Body>
+original::parallel::helper<Body>::helper(loop<Body>* l) noexcept
+    : loop_(l) {}
+
+template<typename Body>
+original::parallel::helper<Body>::helper(helper&& other) noexcept
+    : loop_(std::exchange(other.loop_, nullptr)) {}
+
+template<typename Body>
+void original::parallel::helper<Body>::operator()()
+{
+    this->loop_->work();
+}
+
+template<typename Body>
+original::parallel::helper<Body>::~helper()
+{
+    if (this->loop_)
+        this->loop_->release();
+}
+
+// ==================== Parallel Implementation ====================
+
+template<typename Body>
+void original::parallel::run(taskDelegator& delegator, const u_integer chunks, const Body& body)
+{
+    if (chunks == 0)
+        return;
+    if (chunks == 1) {
+        body(0);
+        return;
+    }
+
+    const u_integer helpers = chunks - 1 < delegator.threadCnt() ? chunks - 1 : delegator.threadCnt();
+    auto l = new loop<Body>(body, chunks, helpers + 1);
+    for (u_integer i = 0; i < helpers; ++i) {
+        try {
+            delegator.submit(helper<Body>{l});
+        } catch (...) {
+            // The helper was released on destruction, the caller covers its chunks
+        }
+    }
+    l->work();
+    try {
+        l->wait();
+    } catch (...) {
+        l->release();
+        throw;
+    }
+    l->release();
+}
+
+inline original::u_integer
+original::parallel::grainOf(const taskDelegator& delegator, const u_integer size, const u_integer grain) noexcept
+{
+    if (grain != 0)
+        return grain;
+    const u_integer threads = delegator.threadCnt() == 0 ? 1 : delegator.threadCnt();
+    const u_integer even = chunksOf(size, threads * CHUNKS_PER_THREAD);
+    return even < MIN_GRAIN ? MIN_GRAIN : even;
+}
+
+inline original::u_integer original::parallel::chunksOf(const u_integer size, const u_integer grain) noexcept
+{
+    return size / grain + (size % grain != 0);
+}
+
+inline original::u_integer
+original::parallel::chunkEnd(const u_integer chunk, const u_integer size, const u_integer grain) noexcept
+{
+    const u_integer begin = chunk * grain;
+    return grain < size - begin ? begin + grain : size;
+}
+
+template<typename TYPE, typename Callback>
+original::u_integer original::parallel::coRank(const TYPE* a, const u_integer m, const TYPE* b, const u_integer n,
+                                               const u_integer k, const Callback& compares)
+{
+    u_integer low = k > n ? k - n : 0;
+    u_integer high = k < m ? k : m;
+    while (low < high) {
+        const u_integer i = low + (high - low) / 2;
+        const u_integer j = k - i;
+        // a[i] precedes b[j - 1] in the merge, so more elements of a are needed
+        if (j > 0 && !compares(b[j - 1], a[i])) {
+            low = i + 1;
+        } else {
+            high = i;
+        }
+    }
+    return low;
+}
+
+template<typename TYPE, typename Callback>
+void original::parallel::merge(TYPE* a, const u_integer m, TYPE* b, const u_integer n,
+                               TYPE* dst, const Callback& compares)
+{
+    u_integer i = 0, j = 0;
+    while (i < m && j < n) {
+        if (compares(b[j], a[i])) {
+            *dst++ = std::move(b[j++]);
+        } else {
+            *dst++ = std::move(a[i++]);
+        }
+    }
+    while (i < m)
+        *dst++ = std::move(a[i++]);
+    while (j < n)
+        *dst++ = std::move(b[j++]);
+}
+
+template<original::ContiguousContainer CONTAINER, typename Callback>
+requires original::Operation<Callback, original::parallel::elemType<CONTAINER>>
+void original::parallel::forEach(taskDelegator& delegator, CONTAINER& container,
+                                 const Callback& operation, u_integer grain)
+{
+    const u_integer size = container.size();
+    if (size == 0)
+        return;
+    grain = grainOf(delegator, size, grain);
+    auto* base = &container.data();
+    run(delegator, chunksOf(size, grain), [&](const u_integer chunk) {
+        const u_integer end = chunkEnd(chunk, size, grain);
+        for (u_integer i = chunk * grain; i < end; ++i) {
+            operation(base[i]);
+        }
+    });
+}
+
+template<original::ContiguousContainer SRC, original::ContiguousContainer DST, typename Callback>
+requires original::Transformer<Callback, original::parallel::elemType<DST>, const original::parallel::elemType<SRC>&>
+void original::parallel::transform(taskDelegator& delegator, const SRC& src, DST& dst,
+                                   const Callback& operation, u_integer grain)
+{
+    const u_integer size = src.size();
+    if (dst.size() < size)
+        throw outOfBoundError("Destination is shorter than source in parallel::transform");
+    if (size == 0)
+        return;
+    grain = grainOf(delegator, size, grain);
+    const auto* from = &src.data();
+    auto* to = &dst.data();
+    run(delegator, chunksOf(size, grain), [&](const u_integer chunk) {
+        const u_integer end = chunkEnd(chunk, size, grain);
+        for (u_integer i = chunk * grain; i < end; ++i) {
+            to[i] = operation(from[i]);
+        }
+    });
+}
+
+template<original::ContiguousContainer CONTAINER, typename Callback>
+requires original::CallbackOf<Callback, original::parallel::elemType<CONTAINER>,
+                              const original::parallel::elemType<CONTAINER>&,
+                              const original::parallel::elemType<CONTAINER>&>
+auto original::parallel::reduce(taskDelegator& delegator, const CONTAINER& container,
+                                const elemType<CONTAINER>& init,
+                                const Callback& operation, u_integer grain) -> elemType<CONTAINER>
+{
+    using TYPE = elemType<CONTAINER>;
+    const u_integer size = container.size();
+    if (size == 0)
+        return init;
+    grain = grainOf(delegator, size, grain);
+    const u_integer chunks = chunksOf(size, grain);
+    const TYPE* base = &container.data();
+
+    vector<alternative<TYPE>> partials;
+    for (u_integer i = 0; i < chunks; ++i) {
+        partials.pushEnd(alternative<TYPE>{});
+    }
+    auto* slots = &partials.data();
+    run(delegator, chunks, [&](const u_integer chunk) {
+        const u_integer begin = chunk * grain;
+        const u_integer end = chunkEnd(chunk, size, grain);
+        TYPE acc = base[begin];
+        for (u_integer i = begin + 1; i < end; ++i) {
+            acc = operation(acc, base[i]);
+        }
+        slots[chunk].emplace(std::move(acc));
+    });
+
+    TYPE result = init;
+    for (u_integer i = 0; i < chunks; ++i) {
+        result = operation(result, *slots[i]);
+    }
+    return result;
+}
+
+template<original::ContiguousContainer CONTAINER>
+original::u_integer original::parallel::count(taskDelegator& delegator, const CONTAINER& container,
+                                              const elemType<CONTAINER>& target, const u_integer grain)
+{
+    return count(delegator, container, [&target](const elemType<CONTAINER>& e) {
+        return e == target;
+    }, grain);
+}
+
+template<original::ContiguousContainer CONTAINER, typename Callback>
+requires original::Condition<Callback, original::parallel::elemType<CONTAINER>>
+original::u_integer original::parallel::count(taskDelegator& delegator, const CONTAINER& container,
+                                              const Callback& condition, u_integer grain)
+{
+    const u_integer size = container.size();
+    if (size == 0)
+        return 0;
+    grain = grainOf(delegator, size, grain);
+    const auto* base = &container.data();
+    u_integer total = 0;
+    run(delegator, chunksOf(size, grain), [&](const u_integer chunk) {
+        const u_integer end = chunkEnd(chunk, size, grain);
+        u_integer cnt = 0;
+        for (u_integer i = chunk * grain; i < end; ++i) {
+            if (condition(base[i])) {
+                cnt += 1;
+            }
+        }
+        __atomic_fetch_add(&total, cnt, __ATOMIC_RELAXED);
+    });
+    return total;
+}
+
+template<original::ContiguousContainer CONTAINER>
+original::u_integer original::parallel::find(taskDelegator& delegator, const CONTAINER& container,
+                                             const elemType<CONTAINER>& target, const u_integer grain)
+{
+    return find(delegator, container, [&target](const elemType<CONTAINER>& e) {
+        return e == target;
+    }, grain);
+}
+
+template<original::ContiguousContainer CONTAINER, typename Callback>
+requires original::Condition<Callback, original::parallel::elemType<CONTAINER>>
+original::u_integer original::parallel::find(taskDelegator& delegator, const CONTAINER& container,
+                                             const Callback& condition, u_integer grain)
+{
+    const u_integer size = container.size();
+    if (size == 0)
+        return 0;
+    grain = grainOf(delegator, size, grain);
+    const auto* base = &container.data();
+    u_integer found = size;
+    run(delegator, chunksOf(size, grain), [&](const u_integer chunk) {
+        const u_integer begin = chunk * grain;
+        const u_integer end = chunkEnd(chunk, size, grain);
+        for (u_integer i = begin; i < end; ++i) {
+            if (i % MIN_GRAIN == 0 && __atomic_load_n(&found, __ATOMIC_RELAXED) < begin)
+                return;
+            if (condition(base[i])) {
+                u_integer cur = __atomic_load_n(&found, __ATOMIC_RELAXED);
+                while (i < cur && !__atomic_compare_exchange_n(&found, &cur, i, true,
+                                                               __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+                return;
+            }
+        }
+    });
+    return found;
+}
+
+template<original::ContiguousContainer CONTAINER, typename Callback>
+requires original::Compare<Callback, original::parallel::elemType<CONTAINER>>
+void original::parallel::sort(taskDelegator& delegator, CONTAINER& container, const Callback& compares,
+                              const bool is_stable, u_integer grain)
+{
+    using TYPE = elemType<CONTAINER>;
+    const u_integer size = container.size();
+    if (size <= 1)
+        return;
+    grain = grainOf(delegator, size, grain);
+    const u_integer chunks = chunksOf(size, grain);
+    TYPE* base = &container.data();
+
+    run(delegator, chunks, [&](const u_integer chunk) {
+        const u_integer begin = chunk * grain;
+        const u_integer end = chunkEnd(chunk, size, grain);
+        if (is_stable) {
+            algorithms::stableSort(base + begin, base + end, compares);
+        } else {
+            algorithms::introSort(base + begin, base + end, compares);
+        }
+    });
+    if (chunks == 1)
+        return;
+
+    CONTAINER buffer{container};
+    TYPE* src = base;
+    TYPE* dst = &buffer.data();
+    for (u_integer width = grain, span; width < size; width = span) {
+        // span is the length of a merged pair, capped at size in the last round so
+        // that neither it nor the doubled width can wrap u_integer
+        span = width < size - width ? 2 * width : size;
+        // Output piece p covers [p * grain, (p + 1) * grain) and belongs to the pair
+        // starting at the preceding multiple of span, a multiple of grain
+        run(delegator, chunks, [&](const u_integer piece) {
+            const u_integer lo = piece * grain / span * span;
+            const u_integer m = width < size - lo ? width : size - lo;
+            const u_integer n = width < size - lo - m ? width : size - lo - m;
+            const u_integer k0 = piece * grain - lo;
+            const u_integer k1 = grain < m + n - k0 ? k0 + grain : m + n;
+            const u_integer i0 = coRank(src + lo, m, src + lo + m, n, k0, compares);
+            const u_integer i1 = coRank(src + lo, m, src + lo + m, n, k1, compares);
+            merge(src + lo + i0, i1 - i0, src + lo + m + k0 - i0, k1 - i1 - (k0 - i0),
+                  dst + lo + k0, compares);
+        });
+        std::swap(src, dst);
+    }
+
+    if (src != base) {
+        run(delegator, chunks, [&](const u_integer chunk) {
+            const u_integer end = chunkEnd(chunk, size, grain);
+            for (u_integer i = chunk * grain; i < end; ++i) {
+                base[i] = std::move(src[i]);
+            }
+        });
+    }
+}
+
+template<original::ContiguousContainer CONTAINER, typename Callback>
+requires original::Compare<Callback, original::parallel::elemType<CONTAINER>>
+void original::parallel::stableSort(taskDelegator& delegator, CONTAINER& container,
+                                    const Callback& compares, const u_integer grain)
+{
+    sort(delegator, container, compares, true, grain);
+}
+
+#endif // ORIGINAL_PARALLEL_H
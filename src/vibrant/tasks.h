@@ -7,7 +7,9 @@
  *
  * The file also defines:
  * - `taskDelegator::taskBase`: abstract base class for tasks
- * - `taskDelegator::task<TYPE>`: concrete task wrapper with future/promise support
+ * - `taskDelegator::task<TYPE, Callback>`: concrete task that stores its callable
+ *   inline and doubles as the shared state of its future
+ * - `taskDelegator::taskSlab`: per-delegator pool of fixed-size task blocks
  *
  * Features:
  * - Task prioritization (IMMEDIATE, HIGH, NORMAL, LOW, DEFERRED)
@@ -17,6 +19,14 @@
  * - Deferred task handling (activate, discard, or keep on shutdown)
  * - Query interfaces for task counts and thread states
  * - Timeout-based immediate task submission
+ * - Optional work-stealing dispatch (WORK_STEALING) with per-worker
+ *   Chase-Lev deques, local push for tasks submitted from inside a worker
+ *   and random-victim stealing
+ * - Allocation-free submission in steady state: a task, its callable and its
+ *   result share one block recycled through a per-delegator slab
+ * - Target for async continuations posted with `future::then(delegator, callback)`
+ * - Coroutine scheduling: `co_await delegator.schedule()` resumes a coroutine
+ *   on a pool worker
  * - Thread-safe execution and synchronization
  *
  * @note taskDelegator is **non-copyable** and **non-movable** to prevent accidental
@@ -26,13 +36,17 @@
 #ifndef ORIGINAL_TASKS_H
 #define ORIGINAL_TASKS_H
 
+#include "allocator.h"
 #include "async.h"
 #include "atomic.h"
+#include "condition.h"
+#include "mutex.h"
 #include "queue.h"
 #include "refCntPtr.h"
 #include "array.h"
-#include "prique.h"
 #include "vector.h"
+#include <coroutine>
+#include <cstddef>
 
 namespace original {
 
@@ -54,56 +68,134 @@ namespace original {
          * @brief Abstract base class for all tasks
          * @details
          * Provides the common interface for tasks to be executed in the thread pool.
-         * Must implement the run() method.
+         * The delegator owns one reference to every queued task, which is dropped
+         * either by run() or by discard().
          */
         class taskBase {
         public:
             /**
-             * @brief Executes the task
+             * @brief Executes the task and drops the delegator's reference
+             * @note The task must not be touched after this call
              */
             virtual void run() = 0;
 
+            /**
+             * @brief Drops the delegator's reference without executing the task
+             */
+            virtual void discard() noexcept = 0;
+
             /**
              * @brief Virtual destructor for proper polymorphic behavior
              */
             virtual ~taskBase() = default;
         };
 
+        // ==================== Task Slab ====================
+
+        /**
+         * @class taskSlab
+         * @brief Pool of fixed-size blocks holding a task together with its result
+         * @details
+         * Blocks are taken from an objPoolAllocator guarded by a mutex and go back to
+         * its free list when the last reference to the task (queue or future) is
+         * dropped, so submissions in steady state do not touch the global heap.
+         * Every live block keeps the slab alive, which lets futures outlive the
+         * delegator that produced them.
+         */
+        class taskSlab {
+        public:
+            static constexpr u_integer BLOCK_SIZE = 128;  ///< Bytes available to one task
+
+        private:
+            /**
+             * @struct block
+             * @brief Raw storage of one pooled task
+             */
+            struct alignas(std::max_align_t) block {
+                byte data[BLOCK_SIZE];
+            };
+
+            static constexpr u_integer INIT_BLOCKS = 64;
+
+            pMutex mutex_;                ///< Guards pool_, live_ and peak_
+            objPoolAllocator<block> pool_{1, INIT_BLOCKS};  ///< Block storage
+            u_integer refs_{1};           ///< Owning delegator plus one per live block
+            u_integer live_{0};           ///< Blocks currently holding a task
+            u_integer peak_{0};           ///< Largest number of blocks held at once
+
+            friend class taskDelegator;
+
+        public:
+            taskSlab() = default;
+
+            taskSlab(const taskSlab&) = delete;
+            taskSlab& operator=(const taskSlab&) = delete;
+
+            /**
+             * @brief Checks whether a task type fits into a block
+             * @tparam T Task type
+             */
+            template<typename T>
+            static constexpr bool fits = sizeof(T) <= BLOCK_SIZE && alignof(T) <= alignof(block);
+
+            /**
+             * @brief Takes a block from the pool
+             * @return Uninitialized storage of BLOCK_SIZE bytes
+             */
+            void* allocate();
+
+            /**
+             * @brief Returns a block to the pool
+             * @param p Block obtained from allocate()
+             */
+            void deallocate(void* p) noexcept;
+
+            /**
+             * @brief Drops a reference, deleting the slab when it was the last one
+             */
+            void release() noexcept;
+        };
+
         // ==================== Concrete Task Class ====================
 
         /**
          * @class task
-         * @brief Concrete task implementation with future/promise support
+         * @brief Concrete task that stores its callable inline
          * @tparam TYPE Return type of the task
+         * @tparam Callback Type of the bound callable
          * @details
-         * Wraps a callable and its arguments, and provides integration with futures.
+         * The task is also the async wrapper its future reads from, so the callable,
+         * the result and the ready flag share a single block. Blocks come from the
+         * delegator's taskSlab when the task fits, and from the heap otherwise.
          */
-        template<typename TYPE>
-        class task final : public taskBase {
-            async::promise<TYPE, std::function<TYPE()>> p;  ///< Promise for task result
+        template<typename TYPE, typename Callback>
+        class task final : public taskBase, public async::asyncWrapper<TYPE> {
+            Callback c_;       ///< Bound callable
+            taskSlab* slab_;   ///< Slab owning this block, nullptr if heap-allocated
 
-        public:
-            task(const task&) = delete;                 ///< Disable copy constructor
-            task& operator=(const task&) = delete;      ///< Disable copy assignment
-            task(task&&) = default;                     ///< Allow move constructor
-            task& operator=(task&&) = default;          ///< Allow move assignment
-            task() = default;
+            /**
+             * @brief Destroys the task and frees its block
+             */
+            void destroy() noexcept override;
 
+        public:
             /**
-             * @brief Constructs a task from a callable and its arguments
-             * @tparam Callback Callable type
-             * @tparam Args Argument types
+             * @brief Constructs a task holding the delegator's reference
+             * @param slab Slab owning the storage, or nullptr for heap storage
              * @param c Callable to execute
-             * @param args Arguments for the callable
              */
-            template<typename Callback, typename... Args>
-            explicit task(Callback&& c, Args&&... args);
+            task(taskSlab* slab, Callback&& c);
 
             /**
              * @brief Executes the task
              */
             void run() override;
 
+            /**
+             * @brief Drops the task without executing it
+             */
+            void discard() noexcept override;
+
             /**
              * @brief Gets the future associated with this task
              * @return Future object for the task result
@@ -136,6 +228,28 @@ namespace original {
             RUN_DEFERRED,      ///< Execute all deferred tasks before stopping
         };
 
+        /**
+         * @enum dispatchMode
+         * @brief How workers obtain tasks from the delegator
+         */
+        enum class dispatchMode {
+            SHARED_QUEUE,   ///< All tasks go through the shared, mutex-protected queues
+            WORK_STEALING,  ///< Workers keep local deques and steal from each other
+        };
+
+        /**
+         * @struct poolStatistics
+         * @brief Snapshot of where submitted tasks were stored
+         * @details The pool only takes memory from the heap when the number of live
+         *          blocks exceeds every earlier peak, so an unchanged peak_blocks and
+         *          heap_tasks over a series of submissions means none of them allocated.
+         */
+        struct poolStatistics {
+            u_integer live_blocks = 0;   ///< Pooled blocks currently holding a task
+            u_integer peak_blocks = 0;   ///< Largest number of pooled blocks held at once
+            ul_integer heap_tasks = 0;   ///< Tasks too large for a block, allocated on the heap
+        };
+
         // Convenience constants
         static constexpr auto IMMEDIATE = priority::IMMEDIATE;
         static constexpr auto HIGH = priority::HIGH;
@@ -147,46 +261,292 @@ namespace original {
         static constexpr auto KEEP_DEFERRED = stopMode::KEEP_DEFERRED;
         static constexpr auto RUN_DEFERRED = stopMode::RUN_DEFERRED;
 
+        static constexpr auto SHARED_QUEUE = dispatchMode::SHARED_QUEUE;
+        static constexpr auto WORK_STEALING = dispatchMode::WORK_STEALING;
+
+        // ==================== Coroutine Scheduling ====================
+
+        /**
+         * @class scheduleAwaiter
+         * @brief Awaiter that resumes a coroutine on a worker of the delegator
+         * @details Returned by schedule(). Suspending submits a task whose only job
+         *          is to resume the coroutine, so the coroutine continues on a pool
+         *          worker without any thread waiting for it.
+         *
+         *          If the delegator discards that task (a DEFERRED task dropped on stop,
+         *          or tasks left when the delegator is destroyed), the coroutine is
+         *          resumed on the discarding thread and co_await throws sysError, so
+         *          the frame is unwound and awaiting parents see the error.
+         */
+        class scheduleAwaiter {
+            /**
+             * @class resumer
+             * @brief Move-only callable owning the suspended coroutine
+             * @details Resumes the coroutine when run, and cancels the await when it is
+             *          destroyed without having run.
+             */
+            class resumer {
+                std::coroutine_handle<> h_;    ///< Suspended coroutine, null once handed over
+                scheduleAwaiter* awaiter_;     ///< Awaiter inside the coroutine frame
+
+            public:
+                resumer(std::coroutine_handle<> h, scheduleAwaiter* awaiter) noexcept;
+
+                resumer(resumer&& other) noexcept;
+
+                resumer(const resumer&) = delete;
+                resumer& operator=(const resumer&) = delete;
+                resumer& operator=(resumer&&) = delete;
+
+                /**
+                 * @brief Resumes the coroutine
+                 */
+                void operator()();
+
+                /**
+                 * @brief Resumes the coroutine with an error if it was never run
+                 */
+                ~resumer();
+            };
+
+            taskDelegator* delegator_;  ///< Delegator to resume on
+            priority priority_;         ///< Priority of the resuming task
+            bool cancelled_ = false;    ///< Whether the resuming task was discarded
+            atomic<bool> arrived_{makeAtomic(false)};  ///< Set by whichever of await_suspend and the task finishes first
+
+            /**
+             * @brief Hands the coroutine over once both await_suspend and the task are done
+             * @return True if the caller arrived second and has to resume the coroutine
+             */
+            bool arrive() noexcept;
+
+        public:
+            /**
+             * @brief Constructs an awaiter for a delegator
+             * @param delegator Delegator to resume on
+             * @param priority Priority of the resuming task
+             */
+            scheduleAwaiter(taskDelegator* delegator, priority priority) noexcept;
+
+            static bool await_ready() noexcept;
+
+            /**
+             * @brief Submits a task that resumes the coroutine
+             * @param h Coroutine to resume
+             * @return False if the task already finished, resuming the coroutine right away
+             * @throw sysError if the delegator rejects the task; the coroutine then
+             *        continues on the calling thread with the error
+             */
+            bool await_suspend(std::coroutine_handle<> h);
+
+            /**
+             * @throw sysError if the delegator discarded the resuming task
+             */
+            void await_resume() const;
+        };
+
     private:
-        // Internal type definitions
-        using priorityTask = couple<strongPtr<taskBase>, priority>;  ///< Task with priority
+        using taskQueue = queue<taskBase*, vector>;  ///< FIFO of owned tasks
+
+        static constexpr u_integer WAITING_LEVELS = 4;  ///< HIGH, NORMAL, LOW and activated DEFERRED
+
+        // ==================== Work-Stealing Deque ====================
 
         /**
-         * @struct taskComparator
-         * @brief Comparator for ordering tasks by priority
+         * @class workStealingDeque
+         * @brief Chase-Lev lock-free deque of owned task pointers
+         * @details
+         * The owning worker pushes and takes at the bottom (LIFO) without locking,
+         * other workers steal from the top (FIFO) with a single CAS. The ring buffer
+         * grows on demand; retired buffers are kept until the deque is destroyed so
+         * that a concurrent thief never reads freed memory.
+         *
+         * Tasks stored here are owned by the deque until taken or stolen.
          */
-        template<typename COUPLE>
-        struct taskComparator {
+        class workStealingDeque {
             /**
-             * @brief Compares two tasks based on priority
-             * @param lhs Left-hand side task
-             * @param rhs Right-hand side task
-             * @return True if lhs has higher priority than rhs
+             * @struct ringBuffer
+             * @brief Power-of-two circular slot array
              */
-            bool operator()(const COUPLE& lhs, const COUPLE& rhs) const;
+            struct ringBuffer {
+                integer capacity_;      ///< Number of slots (power of two)
+                taskBase** slots_;      ///< Slot storage
+                ringBuffer* retired_;   ///< Previous (smaller) buffer kept alive for thieves
+
+                explicit ringBuffer(integer capacity, ringBuffer* retired = nullptr);
+
+                taskBase* get(integer i) const noexcept;
+
+                void put(integer i, taskBase* t) noexcept;
+
+                /**
+                 * @brief Creates a buffer twice as large holding slots [top, bottom)
+                 */
+                ringBuffer* grow(integer top, integer bottom);
+
+                ~ringBuffer();
+            };
+
+            static constexpr integer INIT_CAPACITY = 64;
+
+            atomic<integer> top_{makeAtomic<integer>(0)};        ///< Steal end
+            atomic<integer> bottom_{makeAtomic<integer>(0)};     ///< Owner end
+            atomic<ringBuffer*> buffer_{makeAtomic<ringBuffer*>(nullptr)};  ///< Current slot array
+
+        public:
+            workStealingDeque();
+
+            workStealingDeque(const workStealingDeque&) = delete;
+            workStealingDeque& operator=(const workStealingDeque&) = delete;
+
+            /**
+             * @brief Pushes a task at the bottom (owner only)
+             * @param t Owned task pointer
+             */
+            void push(taskBase* t);
+
+            /**
+             * @brief Takes the most recently pushed task (owner only)
+             * @return Owned task pointer, or nullptr if empty
+             */
+            taskBase* take();
+
+            /**
+             * @brief Steals the oldest task (any thread)
+             * @return Owned task pointer, or nullptr if empty or lost a race
+             */
+            taskBase* steal();
+
+            /**
+             * @brief Approximate number of queued tasks
+             */
+            [[nodiscard]] u_integer size() const noexcept;
+
+            /**
+             * @brief Deletes any tasks left in the deque and all buffers
+             */
+            ~workStealingDeque();
         };
 
-        using priorityTaskQueue = prique<priorityTask, taskComparator, vector>;  ///< Priority queue
+        /**
+         * @struct workerSlot
+         * @brief Thread-local identity of a worker thread
+         */
+        struct workerSlot {
+            const taskDelegator* owner;  ///< Delegator the current thread works for
+            u_integer index;             ///< Index of the worker in that delegator
+            u_integer seed;              ///< Xorshift state used to pick steal victims
+        };
 
+        dispatchMode mode_;                  ///< Dispatch mode chosen at construction
+        taskSlab* slab_;                     ///< Storage of pooled tasks, shared with live futures
+        atomic<ul_integer> heap_tasks_{makeAtomic<ul_integer>(0)};  ///< Tasks allocated outside the slab
         array<thread> threads_;              ///< Worker threads
-        priorityTaskQueue tasks_waiting_;    ///< Waiting tasks
-        queue<strongPtr<taskBase>> task_immediate_;  ///< Immediate tasks
-        queue<strongPtr<taskBase>> tasks_deferred_;  ///< Deferred tasks
+        array<strongPtr<workStealingDeque>> local_tasks_;  ///< Per-worker deques (WORK_STEALING only)
+        taskQueue tasks_waiting_[WAITING_LEVELS];  ///< Waiting tasks, one FIFO per priority level
+        taskQueue task_immediate_;           ///< Immediate tasks
+        taskQueue tasks_deferred_;           ///< Deferred tasks
         mutable pCondition condition_;       ///< Synchronization
         mutable pMutex mutex_;               ///< Mutex for thread safety
-        bool stopped_;                       ///< Stop flag
-        u_integer active_threads_;           ///< Count of active threads
-        u_integer idle_threads_;             ///< Count of idle threads
+        atomic<bool> stopped_{makeAtomic(false)};                   ///< Stop flag
+        atomic<u_integer> active_threads_{makeAtomic<u_integer>(0)};  ///< Count of active threads
+        atomic<u_integer> idle_threads_{makeAtomic<u_integer>(0)};    ///< Count of idle threads
+        atomic<u_integer> immediate_pending_{makeAtomic<u_integer>(0)};  ///< Mirror of task_immediate_ size
+        atomic<u_integer> waiting_pending_{makeAtomic<u_integer>(0)};    ///< Mirror of tasks_waiting_ size
+
+        /**
+         * @brief Returns the calling thread's worker identity
+         */
+        static workerSlot& currentWorker() noexcept;
+
+        /**
+         * @brief Worker loop used in SHARED_QUEUE mode
+         */
+        void sharedLoop();
+
+        /**
+         * @brief Worker loop used in WORK_STEALING mode
+         * @param index Index of the worker
+         */
+        void stealingLoop(u_integer index);
+
+        /**
+         * @brief Tries to find and run one task for a work-stealing worker
+         * @param index Index of the worker
+         * @return True if a task was run
+         * @details Order: immediate tasks, own deque, shared waiting tasks, stealing.
+         */
+        bool runNext(u_integer index);
+
+        /**
+         * @brief Creates a task for a bound callable
+         * @tparam TYPE Task result type
+         * @tparam Callback Bound callable type
+         * @param c Callable taking no arguments
+         * @return Owned task, placed in the slab when it fits
+         */
+        template<typename TYPE, typename Callback>
+        task<TYPE, std::decay_t<Callback>>* makeTask(Callback&& c);
+
+        /**
+         * @brief Pops the oldest task of the highest non-empty waiting level
+         * @return Owned task pointer
+         * @note Caller must hold mutex_ and ensure waiting_pending_ is not zero
+         */
+        taskBase* popWaiting();
+
+        /**
+         * @brief Checks whether any waiting level holds a task
+         * @note Caller must hold mutex_
+         */
+        [[nodiscard]] bool waitingEmpty() const;
+
+        /**
+         * @brief Drops every task in a queue without running it
+         * @note Caller must hold mutex_ or be the only user of the queue
+         */
+        static void discardAll(taskQueue& tasks) noexcept;
+
+        /**
+         * @brief Pops a task from the shared queues without blocking
+         * @param immediate_only Only consider immediate tasks
+         * @return Owned task pointer, or nullptr
+         */
+        taskBase* popShared(bool immediate_only);
+
+        /**
+         * @brief Steals one task from another worker, starting at a random victim
+         * @param index Index of the thief
+         * @return Owned task pointer, or nullptr
+         */
+        taskBase* stealFor(u_integer index);
+
+        /**
+         * @brief Checks whether any queue holds a runnable task
+         * @note Caller must hold mutex_ so that it pairs with notifyLocalPush()
+         */
+        [[nodiscard]] bool hasRunnable() const;
+
+        /**
+         * @brief Runs a task while counting the worker as active
+         */
+        void execute(taskBase& t);
+
+        /**
+         * @brief Wakes an idle worker after a lock-free local push
+         */
+        void notifyLocalPush();
 
         /**
          * @brief Submits a pre-created task with specified priority
          * @tparam TYPE Task result type
+         * @tparam Callback Bound callable type
          * @param priority Task priority level
-         * @param t Shared pointer to the task
+         * @param t Owned task, discarded if submission fails
          * @return Future for the task result
          */
-        template<typename TYPE>
-        async::future<TYPE> submit(priority priority, strongPtr<task<TYPE>>& t);
+        template<typename TYPE, typename Callback>
+        async::future<TYPE> enqueue(priority priority, task<TYPE, Callback>* t);
 
     public:
         taskDelegator(const taskDelegator&) = delete;               ///< Disable copy constructor
@@ -197,8 +557,17 @@ namespace original {
         /**
          * @brief Constructs a task delegator with a given number of threads
          * @param thread_cnt Number of threads (default: 8)
+         * @param mode Dispatch mode (default: SHARED_QUEUE)
+         * @details
+         * In WORK_STEALING mode each worker owns a lock-free deque. NORMAL tasks
+         * submitted from inside one of this delegator's workers are pushed to that
+         * worker's deque without locking; idle workers steal from random victims.
+         * Tasks submitted from other threads, and all IMMEDIATE, HIGH, LOW and
+         * DEFERRED tasks, keep using the shared queues, so priorities and stop
+         * modes behave as in SHARED_QUEUE mode. Workers prefer immediate tasks,
+         * then their own deque, then the shared priority queue, then stealing.
          */
-        explicit taskDelegator(u_integer thread_cnt = 8);
+        explicit taskDelegator(u_integer thread_cnt = 8, dispatchMode mode = dispatchMode::SHARED_QUEUE);
 
         /**
          * @brief Submits a task with normal priority
@@ -244,8 +613,21 @@ namespace original {
         template<typename Callback, typename... Args>
         auto submit(time::duration timeout, Callback&& c, Args&&... args);
 
+        /**
+         * @brief Moves the awaiting coroutine onto a worker thread
+         * @param priority Priority of the task that resumes the coroutine (default: NORMAL)
+         * @return Awaiter for `co_await delegator.schedule()`
+         * @details Thousands of coroutines can be in flight on a small pool: a
+         *          coroutine only occupies a worker between suspension points.
+         * @note If the resuming task is discarded (for example a DEFERRED task dropped
+         *       on stop), co_await throws sysError on the discarding thread.
+         */
+        scheduleAwaiter schedule(priority priority = priority::NORMAL);
+
         /**
          * @brief Returns the number of waiting (non-immediate, non-deferred) tasks
+         * @note In WORK_STEALING mode this includes an approximate count of
+         *       tasks queued in worker-local deques.
          */
         u_integer waitingCnt() const noexcept;
 
@@ -280,6 +662,12 @@ namespace original {
          */
         u_integer deferredCnt() const noexcept;
 
+        /**
+         * @brief Returns a snapshot of the task storage counters
+         * @return Current statistics
+         */
+        [[nodiscard]] poolStatistics poolStats() const;
+
         /**
          * @brief Stops the task delegator
          * @param mode Stop mode (default: KEEP_DEFERRED)
@@ -290,6 +678,12 @@ namespace original {
          */
         void stop(stopMode mode = stopMode::KEEP_DEFERRED);
 
+        /**
+         * @brief Gets the number of worker threads
+         * @return Count of threads owned by this delegator
+         */
+        u_integer threadCnt() const noexcept;
+
         /**
          * @brief Gets the number of active threads
          * @return Count of currently active threads
@@ -302,9 +696,15 @@ namespace original {
          */
         u_integer idleThreads() const noexcept;
 
+        /**
+         * @brief Gets the dispatch mode of this delegator
+         */
+        dispatchMode mode() const noexcept;
+
         /**
          * @brief Destructor
-         * @details Calls stop(RUN_DEFERRED) and joins all threads
+         * @details Calls stop(RUN_DEFERRED) and joins all threads. Tasks still
+         *          queued after the workers exit are discarded.
          */
         ~taskDelegator();
     };
@@ -312,78 +712,403 @@ namespace original {
 
 // ==================== Task Implementation ====================
 
-template <typename TYPE>
-template <typename Callback, typename... Args>
-original::taskDelegator::task<TYPE>::task(Callback&& c, Args&&... args)
-    : p([c = std::forward<Callback>(c), ...args = std::forward<Args>(args)]() mutable {
-        return c(args...);
-    }) {}
+inline void* original::taskDelegator::taskSlab::allocate()
+{
+    uniqueLock lock(this->mutex_);
+    void* p = this->pool_.allocate(1);
+    this->live_ += 1;
+    if (this->live_ > this->peak_) {
+        this->peak_ = this->live_;
+    }
+    __atomic_add_fetch(&this->refs_, 1, __ATOMIC_RELAXED);
+    return p;
+}
+
+inline void original::taskDelegator::taskSlab::deallocate(void* p) noexcept
+{
+    {
+        uniqueLock lock(this->mutex_);
+        this->pool_.deallocate(static_cast<block*>(p), 1);
+        this->live_ -= 1;
+    }
+    this->release();
+}
+
+inline void original::taskDelegator::taskSlab::release() noexcept
+{
+    if (__atomic_sub_fetch(&this->refs_, 1, __ATOMIC_ACQ_REL) == 0) {
+        delete this;
+    }
+}
+
+template <typename TYPE, typename Callback>
+original::taskDelegator::task<TYPE, Callback>::task(taskSlab* slab, Callback&& c)
+    : c_(std::move(c)), slab_(slab)
+{
+    this->retain();
+}
+
+template <typename TYPE, typename Callback>
+void original::taskDelegator::task<TYPE, Callback>::destroy() noexcept
+{
+    taskSlab* slab = this->slab_;
+    if (!slab) {
+        delete this;
+        return;
+    }
+    this->~task();
+    slab->deallocate(this);
+}
+
+template <typename TYPE, typename Callback>
+void original::taskDelegator::task<TYPE, Callback>::run()
+{
+    try {
+        if constexpr (std::is_void_v<TYPE>) {
+            this->c_();
+            this->setValue();
+        } else {
+            this->setValue(this->c_());
+        }
+    } catch (...) {
+        this->setException(std::current_exception());
+    }
+    this->release();
+}
 
-template <typename TYPE>
-void original::taskDelegator::task<TYPE>::run()
+template <typename TYPE, typename Callback>
+void original::taskDelegator::task<TYPE, Callback>::discard() noexcept
 {
-    this->p.run();
+    this->release();
 }
 
-template <typename TYPE>
-original::async::future<TYPE> original::taskDelegator::task<TYPE>::getFuture()
+template <typename TYPE, typename Callback>
+original::async::future<TYPE> original::taskDelegator::task<TYPE, Callback>::getFuture()
 {
-    return this->p.getFuture();
+    return async::makeFuture<TYPE>(this);
 }
 
 // ==================== Task Delegator Implementation ====================
 
-template <typename COUPLE>
-bool original::taskDelegator::taskComparator<COUPLE>::operator()(const COUPLE& lhs, const COUPLE& rhs) const
-{
-    return static_cast<u_integer>(lhs.second()) < static_cast<u_integer>(rhs.second());
-}
-
-inline original::taskDelegator::taskDelegator(const u_integer thread_cnt)
-    : threads_(thread_cnt),
-      stopped_(false),
-      active_threads_(0),
-      idle_threads_(0) {
-    for (auto& thread_ : this->threads_) {
-        thread_ = thread {
-            [this]{
-                while (true) {
-                    strongPtr<taskBase> task;
-                    {
-                        uniqueLock lock(this->mutex_);
-                        this->idle_threads_ += 1;
-                        this->condition_.wait(this->mutex_, [this] {
-                            return this->stopped_ || !this->tasks_waiting_.empty() || !this->task_immediate_.empty();
-                        });
-
-                        if (this->stopped_ &&
-                            this->tasks_waiting_.empty() &&
-                            this->task_immediate_.empty()) {
-                                this->idle_threads_ -= 1;
-                                return;
-                        }
-
-                        if (!this->task_immediate_.empty()) {
-                            task = std::move(this->task_immediate_.pop());
-                        } else {
-                            task = std::move(this->tasks_waiting_.pop().first());
-                        }
-                        this->idle_threads_ -= 1;
-                    }
-
-                    {
-                        uniqueLock lock(this->mutex_);
-                        this->active_threads_ += 1;
-                    }
-                    task->run();
-                    {
-                        uniqueLock lock(this->mutex_);
-                        this->active_threads_ -= 1;
-                    }
-                }
+inline original::taskDelegator::workStealingDeque::ringBuffer::ringBuffer(const integer capacity, ringBuffer* retired)
+    : capacity_(capacity), slots_(new taskBase*[capacity]{}), retired_(retired) {}
+
+inline original::taskDelegator::taskBase*
+original::taskDelegator::workStealingDeque::ringBuffer::get(const integer i) const noexcept
+{
+    return __atomic_load_n(&this->slots_[i & (this->capacity_ - 1)], __ATOMIC_RELAXED);
+}
+
+inline void original::taskDelegator::workStealingDeque::ringBuffer::put(const integer i, taskBase* t) noexcept
+{
+    __atomic_store_n(&this->slots_[i & (this->capacity_ - 1)], t, __ATOMIC_RELAXED);
+}
+
+inline original::taskDelegator::workStealingDeque::ringBuffer*
+original::taskDelegator::workStealingDeque::ringBuffer::grow(const integer top, const integer bottom)
+{
+    auto grown = new ringBuffer(this->capacity_ * 2, this);
+    for (integer i = top; i < bottom; ++i) {
+        grown->put(i, this->get(i));
+    }
+    return grown;
+}
+
+inline original::taskDelegator::workStealingDeque::ringBuffer::~ringBuffer()
+{
+    delete[] this->slots_;
+    delete this->retired_;
+}
+
+inline original::taskDelegator::workStealingDeque::workStealingDeque()
+{
+    this->buffer_.store(new ringBuffer(INIT_CAPACITY));
+}
+
+inline void original::taskDelegator::workStealingDeque::push(taskBase* t)
+{
+    const integer bottom = this->bottom_.load(memOrder::RELAXED);
+    const integer top = this->top_.load(memOrder::ACQUIRE);
+    ringBuffer* buffer = this->buffer_.load(memOrder::RELAXED);
+    if (bottom - top > buffer->capacity_ - 1) {
+        buffer = buffer->grow(top, bottom);
+        this->buffer_.store(buffer, memOrder::RELEASE);
+    }
+    buffer->put(bottom, t);
+    this->bottom_.store(bottom + 1, memOrder::RELEASE);
+}
+
+inline original::taskDelegator::taskBase* original::taskDelegator::workStealingDeque::take()
+{
+    const integer bottom = this->bottom_.load(memOrder::RELAXED) - 1;
+    const ringBuffer* buffer = this->buffer_.load(memOrder::RELAXED);
+    this->bottom_.store(bottom, memOrder::RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    integer top = this->top_.load(memOrder::RELAXED);
+
+    if (top > bottom) {
+        this->bottom_.store(bottom + 1, memOrder::RELAXED);
+        return nullptr;
+    }
+
+    taskBase* t = buffer->get(bottom);
+    if (top == bottom) {
+        // Last element: race against thieves for it
+        if (!this->top_.exchangeCmp(top, top + 1, memOrder::SEQ_CST)) {
+            t = nullptr;
+        }
+        this->bottom_.store(bottom + 1, memOrder::RELAXED);
+    }
+    return t;
+}
+
+inline original::taskDelegator::taskBase* original::taskDelegator::workStealingDeque::steal()
+{
+    integer top = this->top_.load(memOrder::ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    const integer bottom = this->bottom_.load(memOrder::ACQUIRE);
+    if (top >= bottom) {
+        return nullptr;
+    }
+
+    const ringBuffer* buffer = this->buffer_.load(memOrder::ACQUIRE);
+    taskBase* t = buffer->get(top);
+    if (!this->top_.exchangeCmp(top, top + 1, memOrder::SEQ_CST)) {
+        return nullptr;
+    }
+    return t;
+}
+
+inline original::u_integer original::taskDelegator::workStealingDeque::size() const noexcept
+{
+    const integer bottom = this->bottom_.load();
+    const integer top = this->top_.load();
+    return bottom > top ? static_cast<u_integer>(bottom - top) : 0;
+}
+
+inline original::taskDelegator::workStealingDeque::~workStealingDeque()
+{
+    const ringBuffer* buffer = this->buffer_.load();
+    for (integer i = this->top_.load(); i < this->bottom_.load(); ++i) {
+        buffer->get(i)->discard();
+    }
+    delete buffer;
+}
+
+inline original::taskDelegator::taskDelegator(const u_integer thread_cnt, const dispatchMode mode)
+    : mode_(mode),
+      slab_(new taskSlab),
+      threads_(thread_cnt),
+      local_tasks_(mode == dispatchMode::WORK_STEALING ? thread_cnt : 0) {
+    for (u_integer i = 0; i < this->threads_.size(); ++i) {
+        if (this->mode_ == dispatchMode::WORK_STEALING) {
+            this->local_tasks_[i] = makeStrongPtr<workStealingDeque>();
+        }
+    }
+    for (u_integer i = 0; i < this->threads_.size(); ++i) {
+        if (this->mode_ == dispatchMode::WORK_STEALING) {
+            this->threads_[i] = thread{[this, i]{ this->stealingLoop(i); }};
+        } else {
+            this->threads_[i] = thread{[this]{ this->sharedLoop(); }};
+        }
+    }
+}
+
+inline original::taskDelegator::workerSlot& original::taskDelegator::currentWorker() noexcept
+{
+    thread_local workerSlot slot{nullptr, 0, 0};
+    return slot;
+}
+
+template <typename TYPE, typename Callback>
+original::taskDelegator::task<TYPE, std::decay_t<Callback>>*
+original::taskDelegator::makeTask(Callback&& c)
+{
+    using taskType = task<TYPE, std::decay_t<Callback>>;
+    if constexpr (taskSlab::fits<taskType>) {
+        void* storage = this->slab_->allocate();
+        try {
+            return new (storage) taskType(this->slab_, std::forward<Callback>(c));
+        } catch (...) {
+            this->slab_->deallocate(storage);
+            throw;
+        }
+    } else {
+        this->heap_tasks_ += 1;
+        return new taskType(nullptr, std::forward<Callback>(c));
+    }
+}
+
+inline original::taskDelegator::taskBase* original::taskDelegator::popWaiting()
+{
+    for (u_integer i = 0; i < WAITING_LEVELS; ++i) {
+        if (!this->tasks_waiting_[i].empty()) {
+            this->waiting_pending_ -= 1;
+            return this->tasks_waiting_[i].pop();
+        }
+    }
+    return nullptr;
+}
+
+inline bool original::taskDelegator::waitingEmpty() const
+{
+    for (u_integer i = 0; i < WAITING_LEVELS; ++i) {
+        if (!this->tasks_waiting_[i].empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline void original::taskDelegator::discardAll(taskQueue& tasks) noexcept
+{
+    while (!tasks.empty()) {
+        tasks.pop()->discard();
+    }
+}
+
+inline void original::taskDelegator::sharedLoop()
+{
+    while (true) {
+        taskBase* task;
+        {
+            uniqueLock lock(this->mutex_);
+            this->idle_threads_ += 1;
+            this->condition_.wait(this->mutex_, [this] {
+                return this->stopped_.load() || !this->waitingEmpty() || !this->task_immediate_.empty();
+            });
+            this->idle_threads_ -= 1;
+
+            if (this->stopped_.load() &&
+                this->waitingEmpty() &&
+                this->task_immediate_.empty()) {
+                    return;
             }
-        };
+
+            if (!this->task_immediate_.empty()) {
+                task = this->task_immediate_.pop();
+                this->immediate_pending_ -= 1;
+            } else {
+                task = this->popWaiting();
+            }
+        }
+        this->execute(*task);
+    }
+}
+
+inline void original::taskDelegator::stealingLoop(const u_integer index)
+{
+    currentWorker() = workerSlot{this, index, index * 2654435761u + 1};
+    while (true) {
+        if (this->runNext(index)) {
+            continue;
+        }
+
+        uniqueLock lock(this->mutex_);
+        this->idle_threads_ += 1;
+        this->condition_.wait(this->mutex_, [this] {
+            return this->stopped_.load() || this->hasRunnable();
+        });
+        this->idle_threads_ -= 1;
+        if (this->stopped_.load() && !this->hasRunnable()) {
+            return;
+        }
+    }
+}
+
+inline bool original::taskDelegator::runNext(const u_integer index)
+{
+    taskBase* t = this->popShared(true);
+    if (!t) {
+        t = this->local_tasks_[index]->take();
+    }
+    if (!t) {
+        t = this->popShared(false);
+    }
+    if (!t) {
+        t = this->stealFor(index);
+    }
+    if (!t) {
+        return false;
     }
+    this->execute(*t);
+    return true;
+}
+
+inline original::taskDelegator::taskBase* original::taskDelegator::popShared(const bool immediate_only)
+{
+    const bool has_immediate = this->immediate_pending_.load() > 0;
+    if (!has_immediate && (immediate_only || this->waiting_pending_.load() == 0)) {
+        return nullptr;
+    }
+
+    uniqueLock lock(this->mutex_);
+    if (!this->task_immediate_.empty()) {
+        this->immediate_pending_ -= 1;
+        return this->task_immediate_.pop();
+    }
+    if (!immediate_only) {
+        return this->popWaiting();
+    }
+    return nullptr;
+}
+
+inline original::taskDelegator::taskBase* original::taskDelegator::stealFor(const u_integer index)
+{
+    const u_integer cnt = this->local_tasks_.size();
+    if (cnt <= 1) {
+        return nullptr;
+    }
+
+    auto& seed = currentWorker().seed;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    const u_integer start = seed % cnt;
+    for (u_integer i = 0; i < cnt; ++i) {
+        const u_integer victim = (start + i) % cnt;
+        if (victim == index) {
+            continue;
+        }
+        if (taskBase* t = this->local_tasks_[victim]->steal()) {
+            return t;
+        }
+    }
+    return nullptr;
+}
+
+inline bool original::taskDelegator::hasRunnable() const
+{
+    if (!this->task_immediate_.empty() || !this->waitingEmpty()) {
+        return true;
+    }
+    for (u_integer i = 0; i < this->local_tasks_.size(); ++i) {
+        if (this->local_tasks_[i]->size() > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void original::taskDelegator::execute(taskBase& t)
+{
+    this->active_threads_ += 1;
+    t.run();
+    this->active_threads_ -= 1;
+}
+
+inline void original::taskDelegator::notifyLocalPush()
+{
+    // Pairs with the idle_threads_ increment in stealingLoop: either the sleeper
+    // sees the pushed task, or this thread sees the sleeper and wakes it up.
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (this->idle_threads_.load() == 0) {
+        return;
+    }
+    {
+        uniqueLock lock(this->mutex_);
+    }
+    this->condition_.notify();
 }
 
 template <typename Callback, typename ... Args>
@@ -396,34 +1121,47 @@ template <typename Callback, typename ... Args>
 auto original::taskDelegator::submit(const priority priority, Callback&& c, Args&&... args)
 {
     using ReturnType = decltype(c(args...));
-    strongPtr<task<ReturnType>> new_task = makeStrongPtr<task<ReturnType>>(
-        std::forward<Callback>(c),
-        std::forward<Args>(args)...
-    );
-    return this->submit<ReturnType>(priority, new_task);
+    auto bound = [c = std::forward<Callback>(c), ...args = std::forward<Args>(args)]() mutable -> ReturnType {
+        return c(args...);
+    };
+    if (priority == priority::NORMAL && currentWorker().owner == this) {
+        if (this->stopped_.load()) {
+            throw sysError("taskDelegator already stopped");
+        }
+        auto new_task = this->makeTask<ReturnType>(std::move(bound));
+        auto f = new_task->getFuture();
+        this->local_tasks_[currentWorker().index]->push(new_task);
+        this->notifyLocalPush();
+        return f;
+    }
+    return this->enqueue(priority, this->makeTask<ReturnType>(std::move(bound)));
 }
 
 template <typename Callback, typename ... Args>
 auto original::taskDelegator::submit(time::duration timeout, Callback&& c, Args&&... args)
 {
     using ReturnType = decltype(c(args...));
-    strongPtr<task<ReturnType>> new_task = makeStrongPtr<task<ReturnType>>(
-        std::forward<Callback>(c),
-        std::forward<Args>(args)...
+    auto new_task = this->makeTask<ReturnType>(
+        [c = std::forward<Callback>(c), ...args = std::forward<Args>(args)]() mutable -> ReturnType {
+            return c(args...);
+        }
     );
     auto f = new_task->getFuture();
     {
         uniqueLock lock(this->mutex_);
-        if (this->stopped_) {
+        if (this->stopped_.load()) {
+            new_task->discard();
             throw sysError("taskDelegator already stopped");
         }
         const bool success = this->condition_.waitFor(this->mutex_, timeout, [this]{
-            return this->idle_threads_ > 0;
+            return this->idle_threads_.load() > 0;
         });
         if (!success) {
+            new_task->discard();
             throw sysError("No idle threads available within timeout");
         }
-        this->task_immediate_.push(std::move(new_task.template dynamicCastTo<taskBase>()));
+        this->task_immediate_.push(new_task);
+        this->immediate_pending_ += 1;
     }
     this->condition_.notify();
     return f;
@@ -431,8 +1169,16 @@ auto original::taskDelegator::submit(time::duration timeout, Callback&& c, Args&
 
 inline original::u_integer original::taskDelegator::waitingCnt() const noexcept
 {
+    u_integer local_cnt = 0;
+    for (u_integer i = 0; i < this->local_tasks_.size(); ++i) {
+        local_cnt += this->local_tasks_[i]->size();
+    }
     uniqueLock lock(this->mutex_);
-    return this->tasks_waiting_.size();
+    u_integer waiting_cnt = 0;
+    for (u_integer i = 0; i < WAITING_LEVELS; ++i) {
+        waiting_cnt += this->tasks_waiting_[i].size();
+    }
+    return waiting_cnt + local_cnt;
 }
 
 inline original::u_integer original::taskDelegator::immediateCnt() const noexcept
@@ -441,32 +1187,37 @@ inline original::u_integer original::taskDelegator::immediateCnt() const noexcep
     return this->task_immediate_.size();
 }
 
-template <typename TYPE>
+template <typename TYPE, typename Callback>
 original::async::future<TYPE>
-original::taskDelegator::submit(const priority priority, strongPtr<task<TYPE>>& t)
+original::taskDelegator::enqueue(const priority priority, task<TYPE, Callback>* t)
 {
     auto f = t->getFuture();
     {
         uniqueLock lock(this->mutex_);
-        if (this->stopped_) {
+        if (this->stopped_.load()) {
+            t->discard();
             throw sysError("taskDelegator already stopped");
         }
         switch (priority) {
         case priority::IMMEDIATE:
-            if (this->idle_threads_ == 0) {
+            if (this->idle_threads_.load() == 0) {
+                t->discard();
                 throw sysError("No idle threads now");
             }
-            this->task_immediate_.push(std::move(t.template dynamicCastTo<taskBase>()));
+            this->task_immediate_.push(t);
+            this->immediate_pending_ += 1;
             break;
         case priority::HIGH:
         case priority::NORMAL:
         case priority::LOW:
-            this->tasks_waiting_.push(priorityTask{t.template dynamicCastTo<taskBase>(), priority});
+            this->tasks_waiting_[static_cast<u_integer>(priority) - 1].push(t);
+            this->waiting_pending_ += 1;
             break;
         case priority::DEFERRED:
-            this->tasks_deferred_.push(t.template dynamicCastTo<taskBase>());
+            this->tasks_deferred_.push(t);
             return f;
         default:
+            t->discard();
             throw sysError("Unknown priority");
         }
     }
@@ -479,7 +1230,8 @@ inline void original::taskDelegator::runDeferred()
     {
         uniqueLock lock(this->mutex_);
         if (!this->tasks_deferred_.empty()) {
-            this->tasks_waiting_.push(priorityTask{this->tasks_deferred_.pop(), priority::DEFERRED});
+            this->tasks_waiting_[static_cast<u_integer>(DEFERRED) - 1].push(this->tasks_deferred_.pop());
+            this->waiting_pending_ += 1;
         } else {
             return;
         }
@@ -495,7 +1247,8 @@ inline void original::taskDelegator::runAllDeferred()
             return;
         }
         while (!this->tasks_deferred_.empty()) {
-            this->tasks_waiting_.push(priorityTask{this->tasks_deferred_.pop(), priority::DEFERRED});
+            this->tasks_waiting_[static_cast<u_integer>(DEFERRED) - 1].push(this->tasks_deferred_.pop());
+            this->waiting_pending_ += 1;
         }
     }
     this->condition_.notifyAll();
@@ -505,7 +1258,7 @@ inline original::u_integer original::taskDelegator::discardDeferred()
 {
     uniqueLock lock(this->mutex_);
     if (!this->tasks_deferred_.empty()) {
-        this->tasks_deferred_.pop();
+        this->tasks_deferred_.pop()->discard();
     }
     return this->tasks_deferred_.size();
 }
@@ -513,9 +1266,7 @@ inline original::u_integer original::taskDelegator::discardDeferred()
 inline void original::taskDelegator::discardAllDeferred()
 {
     uniqueLock lock(this->mutex_);
-    if (!this->tasks_deferred_.empty()) {
-        this->tasks_deferred_.clear();
-    }
+    discardAll(this->tasks_deferred_);
 }
 
 inline original::u_integer original::taskDelegator::deferredCnt() const noexcept
@@ -524,6 +1275,18 @@ inline original::u_integer original::taskDelegator::deferredCnt() const noexcept
     return this->tasks_deferred_.size();
 }
 
+inline original::taskDelegator::poolStatistics original::taskDelegator::poolStats() const
+{
+    poolStatistics s;
+    {
+        uniqueLock lock(this->slab_->mutex_);
+        s.live_blocks = this->slab_->live_;
+        s.peak_blocks = this->slab_->peak_;
+    }
+    s.heap_tasks = this->heap_tasks_.load(memOrder::RELAXED);
+    return s;
+}
+
 inline void original::taskDelegator::stop(const stopMode mode)
 {
     {
@@ -531,32 +1294,105 @@ inline void original::taskDelegator::stop(const stopMode mode)
         switch (mode) {
         case RUN_DEFERRED:
             while (!this->tasks_deferred_.empty()) {
-                this->tasks_waiting_.push(priorityTask{this->tasks_deferred_.pop(), DEFERRED});
+                this->tasks_waiting_[static_cast<u_integer>(DEFERRED) - 1].push(this->tasks_deferred_.pop());
+                this->waiting_pending_ += 1;
             }
             break;
         case DISCARD_DEFERRED:
-            this->tasks_deferred_.clear();
+            discardAll(this->tasks_deferred_);
             break;
         case KEEP_DEFERRED:
             break;
         default:
             throw sysError("Unknown stop mode");
         }
-        this->stopped_ = true;
+        this->stopped_.store(true);
     }
     this->condition_.notifyAll();
 }
 
+inline original::u_integer original::taskDelegator::threadCnt() const noexcept
+{
+    return this->threads_.size();
+}
+
 inline original::u_integer original::taskDelegator::activeThreads() const noexcept
 {
-    uniqueLock lock(this->mutex_);
-    return this->active_threads_;
+    return this->active_threads_.load();
 }
 
 inline original::u_integer original::taskDelegator::idleThreads() const noexcept
 {
-    uniqueLock lock(this->mutex_);
-    return this->idle_threads_;
+    return this->idle_threads_.load();
+}
+
+inline original::taskDelegator::dispatchMode original::taskDelegator::mode() const noexcept
+{
+    return this->mode_;
+}
+
+inline original::taskDelegator::scheduleAwaiter
+original::taskDelegator::schedule(const priority priority)
+{
+    return scheduleAwaiter{this, priority};
+}
+
+inline original::taskDelegator::scheduleAwaiter::scheduleAwaiter(taskDelegator* delegator,
+                                                                 const priority priority) noexcept
+    : delegator_(delegator), priority_(priority) {}
+
+inline bool original::taskDelegator::scheduleAwaiter::await_ready() noexcept
+{
+    return false;
+}
+
+inline bool original::taskDelegator::scheduleAwaiter::arrive() noexcept
+{
+    return this->arrived_.exchange(true);
+}
+
+inline bool original::taskDelegator::scheduleAwaiter::await_suspend(std::coroutine_handle<> h)
+{
+    // A rejected submit destroys the resumer before arrive(), so it does not resume
+    this->delegator_->submit(this->priority_, resumer{h, this});
+    return !this->arrive();
+}
+
+inline void original::taskDelegator::scheduleAwaiter::await_resume() const
+{
+    if (this->cancelled_) {
+        throw sysError("taskDelegator discarded the task resuming this coroutine");
+    }
+}
+
+inline original::taskDelegator::scheduleAwaiter::resumer::resumer(std::coroutine_handle<> h,
+                                                                  scheduleAwaiter* awaiter) noexcept
+    : h_(h), awaiter_(awaiter) {}
+
+inline original::taskDelegator::scheduleAwaiter::resumer::resumer(resumer&& other) noexcept
+    : h_(other.h_), awaiter_(other.awaiter_)
+{
+    other.h_ = nullptr;
+}
+
+inline void original::taskDelegator::scheduleAwaiter::resumer::operator()()
+{
+    const std::coroutine_handle<> h = this->h_;
+    this->h_ = nullptr;
+    if (this->awaiter_->arrive()) {
+        h.resume();
+    }
+}
+
+inline original::taskDelegator::scheduleAwaiter::resumer::~resumer()
+{
+    if (!this->h_) {
+        return;
+    }
+    this->awaiter_->cancelled_ = true;
+    if (this->awaiter_->arrive()) {
+        this->h_.resume();
+    }
 }
 
 inline original::taskDelegator::~taskDelegator()
@@ -566,6 +1402,23 @@ inline original::taskDelegator::~taskDelegator()
         if (thread.joinable())
             thread.join();
     }
+    discardAll(this->task_immediate_);
+    for (u_integer i = 0; i < WAITING_LEVELS; ++i) {
+        discardAll(this->tasks_waiting_[i]);
+    }
+    discardAll(this->tasks_deferred_);
+    this->slab_->release();
+}
+
+// ==================== Async Continuation Posting ====================
+
+inline void original::async::post(taskDelegator& delegator, continuation* node) noexcept
+{
+    try {
+        delegator.submit(postedContinuation{node});
+    } catch (...) {
+        // The rejected callable has already cancelled the continuation
+    }
 }
 
 #endif //ORIGINAL_TASKS_H
@@ -3,10 +3,16 @@
 
 #include "async.h"
 #include "atomic.h"
+#include "concurrentMaps.h"
+#include "concurrentPool.h"
+#include "concurrentQueue.h"
+#include "concurrentSkipList.h"
 #include "condition.h"
 #include "coroutines.h"
+#include "epochs.h"
 #include "generators.h"
 #include "mutex.h"
+#include "parallel.h"
 #include "semaphores.h"
 #include "syncPoint.h"
 #include "tasks.h"
@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <map>
+#include <random>
 
 using namespace original;
 
@@ -317,4 +319,40 @@ it2->next();
 // Check distance
 integer distance = *it2 - *it1;
 EXPECT_EQ(distance, 3);
-}
\ No newline at end of file
+}
+// Inline level array tests: random operations with non-trivial values and a pooled allocator
+TEST(JMapInlineLevelsTest, RandomOperationsMatchStd) {
+    JMap<int, std::string, increaseComparator<int>, objPoolAllocator<couple<const int, std::string>>> map;
+    std::map<int, std::string> expected;
+    std::mt19937 gen(11);
+    std::uniform_int_distribution key_dist(0, 5000);
+
+    for (int i = 0; i < 40000; ++i) {
+        const int key = key_dist(gen);
+        if (i % 3 != 2) {
+            const std::string value = "value_" + std::to_string(i);
+            ASSERT_EQ(map.add(key, value), expected.emplace(key, value).second);
+        } else {
+            ASSERT_EQ(map.remove(key), expected.erase(key) == 1);
+        }
+    }
+
+    const auto copy = map;
+    for (const auto* m : std::initializer_list<const decltype(map)*>{&map, &copy}) {
+        ASSERT_EQ(m->size(), expected.size());
+        auto it = expected.begin();
+        for (const auto& e : *m) {
+            ASSERT_EQ(e.first(), it->first);
+            ASSERT_EQ(e.second(), it->second);
+            ++it;
+        }
+    }
+
+    for (const auto& [k, v] : expected) {
+        ASSERT_TRUE(map.remove(k));
+    }
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_TRUE(map.add(1, "one"));
+    EXPECT_EQ(map.get(1), "one");
+    EXPECT_EQ(copy.size(), expected.size());
+}
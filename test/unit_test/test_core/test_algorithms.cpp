@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <algorithm> // std algorithm
+#include <random>
+#include <vector>
 #include "array.h"
 #include "vector.h"
 #include "algorithms.h" // original algorithm
@@ -193,6 +195,86 @@ namespace original {
         }
     }
 
+    // 测试 stableSort 在归并时保持相等元素的原有顺序
+    TEST(AlgorithmsTest, StableSortKeepsEqualOrder){
+        vector<std::pair<int, int>> v;
+        std::vector<std::pair<int, int>> expected;
+        for (int i = 0; i < 100; i++){
+            v.pushEnd({i % 7, i});
+            expected.emplace_back(i % 7, i);
+        }
+        auto byKey = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+            return a.first < b.first;
+        };
+        algorithms::stableSort(v.first(), v.last(), byKey);
+        std::ranges::stable_sort(expected, byKey);
+        for (u_integer i = 0; i < v.size(); i++){
+            EXPECT_EQ(v[i], expected[i]);
+        }
+    }
+
+    // 测试连续容器重载与原始指针快速路径，覆盖有序、逆序、全相等等退化输入
+    TEST(AlgorithmsTest, ContiguousSortTest){
+        std::mt19937 gen(7);
+        std::vector<std::vector<int>> inputs;
+        inputs.emplace_back();
+        for (int i = 0; i < 5000; i++) inputs.back().push_back(static_cast<int>(gen() % 100));
+        inputs.emplace_back(3000, 4);
+        inputs.emplace_back();
+        for (int i = 0; i < 3000; i++) inputs.back().push_back(i);
+        inputs.emplace_back(inputs.back().rbegin(), inputs.back().rend());
+
+        for (const auto& input : inputs) {
+            auto expected = input;
+            std::ranges::sort(expected);
+            for (int kind = 0; kind < 4; kind++) {
+                vector<int> v;
+                for (const int e : input) v.pushEnd(e);
+                switch (kind) {
+                    case 0: algorithms::sort(v, increaseComparator<int>()); break;
+                    case 1: algorithms::stableSort(v, increaseComparator<int>()); break;
+                    case 2: algorithms::heapSort(v, increaseComparator<int>()); break;
+                    default: algorithms::introSort(v.first(), v.last(), increaseComparator<int>()); break;
+                }
+                for (u_integer i = 0; i < v.size(); i++) {
+                    ASSERT_EQ(v[i], expected[i]) << "kind " << kind << " index " << i;
+                }
+            }
+        }
+
+        // 迭代器子区间只排序 [begin, end]，区间外元素保持不变
+        array<int> arr = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+        algorithms::insertionSort(*algorithms::frontOf(arr.first(), 2), *algorithms::backOf(arr.last(), 2),
+                                  increaseComparator<int>());
+        const std::array<int, 10> partial = {9, 8, 2, 3, 4, 5, 6, 7, 1, 0};
+        for (u_integer i = 0; i < arr.size(); i++) {
+            EXPECT_EQ(arr[i], partial[i]);
+        }
+
+        // 原始指针区间重载只排序 [first, last)
+        for (const bool is_stable : {false, true}) {
+            array<int> raw = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+            int* first = &raw.data();
+            if (is_stable) {
+                algorithms::stableSort(first + 2, first + 8, increaseComparator<int>());
+            } else {
+                algorithms::introSort(first + 2, first + 8, increaseComparator<int>());
+            }
+            for (u_integer i = 0; i < raw.size(); i++) {
+                EXPECT_EQ(raw[i], partial[i]);
+            }
+        }
+
+        vector<std::pair<int, int>> pairs;
+        for (int i = 0; i < 1000; i++) pairs.pushEnd({i % 13, i});
+        algorithms::stableSort(pairs, [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+            return a.first < b.first;
+        });
+        for (u_integer i = 1; i < pairs.size(); i++) {
+            EXPECT_TRUE(pairs[i - 1] < pairs[i]);
+        }
+    }
+
     TEST(AlgorithmsTest, SortTest){
         #define lst4 {5, 8, 7, 2, 8, 10, -8, 4, 3, 1, 21, 17, 19, 35, 4, 25, 6, 2, 0, -2, 31, 9, 11, 14, 15, 12, 13, 19, 18, 16, 17, 20}
         array originalArr1 = lst4;
@@ -132,6 +132,15 @@ TEST(AllocatorsTest, MallocFree) {
     original::allocators::free(nullArray);
 }
 
+TEST(AllocatorsTest, SizeTypeWidth) {
+    EXPECT_EQ(sizeof(original::u_integer), ORIGINAL_LARGE_SIZE ? 8u : 4u);
+    if constexpr (sizeof(original::u_integer) == 8) {
+        // The byte count of this request does not fit in size_t
+        EXPECT_THROW(original::allocators::malloc<original::ul_integer>(std::numeric_limits<original::u_integer>::max()),
+                     original::allocateError);
+    }
+}
+
 TEST(AllocatorTest, BasicOperations) {
     original::allocator<int> alloc;
     constexpr int size = 15;
@@ -0,0 +1,416 @@
+#include <gtest/gtest.h>
+#include "maps.h"
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <map>
+#include <random>
+
+using namespace original;
+
+class BTreeMapTest : public testing::Test {
+protected:
+    void SetUp() override {
+        // Common setup for all tests
+        intMap = new bTreeMap<int, int>();
+        stringMap = new bTreeMap<std::string, int>();
+    }
+
+    void TearDown() override {
+        delete intMap;
+        delete stringMap;
+    }
+
+    bTreeMap<int, int>* intMap{};
+    bTreeMap<std::string, int>* stringMap{};
+};
+
+// Basic Functionality Tests
+TEST_F(BTreeMapTest, InitialState) {
+    EXPECT_EQ(intMap->size(), 0);
+    EXPECT_TRUE(intMap->className() == "bTreeMap");
+}
+
+TEST_F(BTreeMapTest, AddAndContains) {
+    EXPECT_TRUE(intMap->add(42, 100));
+    EXPECT_EQ(intMap->size(), 1);
+    EXPECT_TRUE(intMap->containsKey(42));
+    EXPECT_FALSE(intMap->containsKey(43));
+    EXPECT_EQ(intMap->get(42), 100);
+
+    EXPECT_TRUE(stringMap->add("test", 200));
+    EXPECT_TRUE(stringMap->containsKey("test"));
+    EXPECT_EQ(stringMap->get("test"), 200);
+}
+
+TEST_F(BTreeMapTest, AddDuplicate) {
+    EXPECT_TRUE(intMap->add(10, 1));
+    EXPECT_FALSE(intMap->add(10, 2)); // Adding duplicate key should fail
+    EXPECT_EQ(intMap->size(), 1);
+    EXPECT_EQ(intMap->get(10), 1); // Value should remain unchanged
+}
+
+TEST_F(BTreeMapTest, Remove) {
+    intMap->add(1, 10);
+    intMap->add(2, 20);
+    EXPECT_TRUE(intMap->remove(1));
+    EXPECT_EQ(intMap->size(), 1);
+    EXPECT_FALSE(intMap->containsKey(1));
+    EXPECT_TRUE(intMap->containsKey(2));
+    EXPECT_EQ(intMap->get(2), 20);
+
+    EXPECT_FALSE(intMap->remove(99)); // Remove non-existent key
+}
+
+TEST_F(BTreeMapTest, Update) {
+    intMap->add(1, 10);
+    EXPECT_TRUE(intMap->update(1, 100));
+    EXPECT_EQ(intMap->get(1), 100);
+    EXPECT_FALSE(intMap->update(2, 200)); // Update non-existent key
+}
+
+TEST_F(BTreeMapTest, OperatorAccess) {
+    (*intMap)[1] = 10;
+    (*intMap)[2] = 20;
+
+    // Const access
+    const auto& constMap = *intMap;
+    EXPECT_EQ(constMap[1], 10);
+    EXPECT_EQ(constMap[2], 20);
+
+    // Non-const access creates default if not exists
+    EXPECT_EQ((*intMap)[3], int{});
+    EXPECT_EQ(intMap->size(), 3);
+}
+
+// Iterator Tests - bTreeMap should maintain order
+TEST_F(BTreeMapTest, IteratorOrder) {
+    // Insert elements out of order
+    intMap->add(3, 30);
+    intMap->add(1, 10);
+    intMap->add(2, 20);
+    intMap->add(5, 50);
+    intMap->add(4, 40);
+
+    const auto it = intMap->begins();
+    EXPECT_TRUE(it->isValid());
+
+    std::vector<int> keys;
+    std::vector<int> values;
+    while (it->isValid()) {
+        auto pair = it->get();
+        keys.push_back(pair.first());
+        values.push_back(pair.second());
+        it->next();
+    }
+    delete it;
+
+    // Verify elements are in order
+    EXPECT_EQ(keys.size(), 5);
+    EXPECT_EQ(values.size(), 5);
+    for (size_t i = 0; i < keys.size() - 1; ++i) {
+        EXPECT_LT(keys[i], keys[i + 1]) << "Elements not in order at position " << i;
+    }
+}
+
+TEST_F(BTreeMapTest, IteratorReverseOrder) {
+    intMap->add(1, 10);
+    intMap->add(2, 20);
+    intMap->add(3, 30);
+
+    const auto it = intMap->ends();
+    EXPECT_TRUE(it->isValid());
+
+    std::vector<int> keys;
+    std::vector<int> values;
+    while (it->isValid()) {
+        auto pair = it->get();
+        keys.push_back(pair.first());
+        values.push_back(pair.second());
+        it->prev();
+    }
+    delete it;
+
+    // Verify elements are in reverse order
+    EXPECT_EQ(keys.size(), 3);
+    EXPECT_EQ(values.size(), 3);
+    for (size_t i = 0; i < keys.size() - 1; ++i) {
+        EXPECT_GT(keys[i], keys[i + 1]) << "Elements not in reverse order at position " << i;
+    }
+}
+
+TEST_F(BTreeMapTest, IteratorEnd) {
+    intMap->add(1, 10);
+    const auto begin = intMap->begin();
+    const auto end = intMap->end();
+
+    EXPECT_TRUE(begin.isValid());
+    EXPECT_FALSE(end.isValid());
+}
+
+// Boundary Tests
+TEST_F(BTreeMapTest, LargeNumberOfElements) {
+    constexpr int count = 100000;
+    for (int i = 0; i < count; ++i) {
+        EXPECT_TRUE(intMap->add(i, i * 10));
+    }
+    EXPECT_EQ(intMap->size(), count);
+
+    for (int i = 0; i < count; ++i) {
+        EXPECT_TRUE(intMap->containsKey(i));
+        EXPECT_EQ(intMap->get(i), i * 10);
+    }
+
+    for (int i = 0; i < count; ++i) {
+        EXPECT_TRUE(intMap->remove(i));
+        EXPECT_FALSE(intMap->containsKey(i));
+    }
+}
+
+TEST_F(BTreeMapTest, StringKeyElements) {
+    const std::vector<std::string> testStrings = {"apple", "banana", "cherry"};
+
+    for (size_t i = 0; i < testStrings.size(); ++i) {
+        stringMap->add(testStrings[i], static_cast<int>(i));
+    }
+
+    EXPECT_EQ(stringMap->size(), 3);
+    for (size_t i = 0; i < testStrings.size(); ++i) {
+        EXPECT_TRUE(stringMap->containsKey(testStrings[i]));
+        EXPECT_EQ(stringMap->get(testStrings[i]), static_cast<int>(i));
+    }
+}
+
+// Copy and Move Tests
+TEST_F(BTreeMapTest, CopyConstructor) {
+    intMap->add(1, 10);
+    intMap->add(2, 20);
+
+    const bTreeMap copy(*intMap);
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_TRUE(copy.containsKey(1));
+    EXPECT_TRUE(copy.containsKey(2));
+    EXPECT_EQ(copy.get(1), 10);
+    EXPECT_EQ(copy.get(2), 20);
+}
+
+TEST_F(BTreeMapTest, MoveConstructor) {
+    intMap->add(1, 10);
+    intMap->add(2, 20);
+
+    const bTreeMap moved(std::move(*intMap));
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_TRUE(moved.containsKey(1));
+    EXPECT_TRUE(moved.containsKey(2));
+    EXPECT_EQ(moved.get(1), 10);
+    EXPECT_EQ(moved.get(2), 20);
+    EXPECT_EQ(intMap->size(), 0); // NOLINT(bugprone-use-after-move)
+}
+
+TEST_F(BTreeMapTest, CopyAssignment) {
+    intMap->add(1, 10);
+    intMap->add(2, 20);
+
+    const bTreeMap<int, int> copy = *intMap;
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_TRUE(copy.containsKey(1));
+    EXPECT_TRUE(copy.containsKey(2));
+    EXPECT_EQ(copy.get(1), 10);
+    EXPECT_EQ(copy.get(2), 20);
+}
+
+TEST_F(BTreeMapTest, MoveAssignment) {
+    intMap->add(1, 10);
+    intMap->add(2, 20);
+
+    const bTreeMap<int, int> moved = std::move(*intMap);
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_TRUE(moved.containsKey(1));
+    EXPECT_TRUE(moved.containsKey(2));
+    EXPECT_EQ(moved.get(1), 10);
+    EXPECT_EQ(moved.get(2), 20);
+    EXPECT_EQ(intMap->size(), 0); // NOLINT(bugprone-use-after-move)
+}
+
+// Custom Comparator Test
+TEST(BTreeMapCustomCompareTest, CustomCompareFunction) {
+    struct CustomCompare {
+        bool operator()(const int a, const int b) const {
+            return a > b; // Reverse order
+        }
+    };
+
+    bTreeMap<int, int, CustomCompare> customMap;
+    customMap.add(1, 10);
+    customMap.add(2, 20);
+    customMap.add(3, 30);
+
+    const auto it = customMap.begins();
+    EXPECT_TRUE(it->isValid());
+    std::vector<int> keys;
+    while (it->isValid()) {
+        keys.push_back(it->get().first());
+        it->next();
+    }
+    delete it;
+
+    // Verify elements are in reverse order
+    EXPECT_EQ(keys.size(), 3);
+    for (size_t i = 0; i < keys.size() - 1; ++i) {
+        EXPECT_GT(keys[i], keys[i + 1]) << "Elements not in reverse order at position " << i;
+    }
+}
+
+// toString Test
+TEST_F(BTreeMapTest, ToString) {
+    intMap->add(1, 10);
+    intMap->add(2, 20);
+    const std::string str = intMap->toString(false);
+
+    // Basic checks - exact format might vary
+    EXPECT_TRUE(str.find("bTreeMap") != std::string::npos);
+    EXPECT_TRUE(str.find('1') != std::string::npos);
+    EXPECT_TRUE(str.find("10") != std::string::npos);
+    EXPECT_TRUE(str.find('2') != std::string::npos);
+    EXPECT_TRUE(str.find("20") != std::string::npos);
+}
+
+// Contains with value test
+TEST_F(BTreeMapTest, ContainsKeyValuePair) {
+    intMap->add(1, 10);
+    intMap->add(2, 20);
+
+    EXPECT_TRUE(intMap->contains(couple<const int, int>(1, 10)));
+    EXPECT_FALSE(intMap->contains(couple<const int, int>(1, 20))); // Wrong value
+    EXPECT_FALSE(intMap->contains(couple<const int, int>(3, 30))); // Key doesn't exist
+}
+
+// Test predecessor and successor functionality through iterator
+TEST_F(BTreeMapTest, IteratorPredecessorSuccessor) {
+    intMap->add(1, 10);
+    intMap->add(3, 30);
+    intMap->add(5, 50);
+
+    auto it = ownerPtr(intMap->begins());
+    EXPECT_EQ(it->get().first(), 1);
+
+    it->next();
+    EXPECT_EQ(it->get().first(), 3);
+
+    it->next();
+    EXPECT_EQ(it->get().first(), 5);
+
+    it->prev();
+    EXPECT_EQ(it->get().first(), 3);
+
+    it->prev();
+    EXPECT_EQ(it->get().first(), 1);
+}
+
+// Test tree balancing by inserting elements in reverse order
+TEST_F(BTreeMapTest, ReverseOrderInsertion) {
+    constexpr int count = 1000;
+    for (int i = count; i > 0; --i) {
+        EXPECT_TRUE(intMap->add(i, i * 10));
+    }
+
+    EXPECT_EQ(intMap->size(), count);
+
+    // Verify all elements are present and in order
+    auto it = ownerPtr(intMap->begins());
+    int expected = 1;
+    while (it->isValid()) {
+        EXPECT_EQ(it->get().first(), expected);
+        EXPECT_EQ(it->get().second(), expected * 10);
+        it->next();
+        expected++;
+    }
+}
+// Randomized comparison against std::map, exercising node splits, borrows and merges
+TEST(BTreeMapRandomTest, MatchesStdMap) {
+    bTreeMap<int, int> m;
+    std::map<int, int> expected;
+    std::mt19937 gen(42);
+    for (int i = 0; i < 50000; ++i) {
+        const int k = static_cast<int>(gen() % 4000);
+        switch (gen() % 3) {
+            case 0:
+            case 1:
+                EXPECT_EQ(m.add(k, i), expected.emplace(k, i).second);
+                break;
+            default:
+                EXPECT_EQ(m.remove(k), expected.erase(k) == 1);
+                break;
+        }
+    }
+    ASSERT_EQ(m.size(), expected.size());
+
+    auto it = expected.begin();
+    for (auto& e : m) {
+        ASSERT_NE(it, expected.end());
+        EXPECT_EQ(e.first(), it->first);
+        EXPECT_EQ(e.second(), it->second);
+        ++it;
+    }
+    EXPECT_EQ(it, expected.end());
+
+    auto rit = expected.rbegin();
+    for (auto b = ownerPtr(m.ends()); b->isValid(); b->prev()) {
+        ASSERT_NE(rit, expected.rend());
+        EXPECT_EQ(b->get().first(), rit->first);
+        ++rit;
+    }
+    EXPECT_EQ(rit, expected.rend());
+
+    // Drain completely to exercise root collapse
+    for (const auto& [k, v] : expected) {
+        EXPECT_EQ(m.get(k), v);
+        EXPECT_TRUE(m.remove(k));
+    }
+    EXPECT_EQ(m.size(), 0);
+    EXPECT_EQ(m.toString(false), "bTreeMap()");
+}
+
+TEST(BTreeMapRandomTest, StepAcrossLeaves) {
+    bTreeMap<int, int> m;
+    for (int i = 0; i < 1000; ++i) {
+        m.add(i, i);
+    }
+
+    auto it = m.begin();
+    it += 517;
+    EXPECT_EQ(it.get().first(), 517);
+    it -= 300;
+    EXPECT_EQ(it.get().first(), 217);
+    it += 782;
+    EXPECT_EQ(it.get().first(), 999);
+    EXPECT_FALSE(it.hasNext());
+    it += 1;
+    EXPECT_FALSE(it.isValid());
+}
+
+TEST(BTreeMapRandomTest, StringKeysCopySwap) {
+    bTreeMap<std::string, int> a;
+    for (int i = 0; i < 2000; ++i) {
+        a.add(std::to_string(i), i);
+    }
+    bTreeMap<std::string, int> b(a);
+    for (int i = 0; i < 2000; i += 2) {
+        EXPECT_TRUE(a.remove(std::to_string(i)));
+    }
+    EXPECT_EQ(a.size(), 1000);
+    EXPECT_EQ(b.size(), 2000);
+    EXPECT_EQ(b.get("0"), 0);
+
+    std::swap(a, b);
+    EXPECT_EQ(a.size(), 2000);
+    EXPECT_EQ(b.size(), 1000);
+    EXPECT_FALSE(b.containsKey("0"));
+    EXPECT_TRUE(b.containsKey("1"));
+
+    std::string prev;
+    for (auto& e : a) {
+        EXPECT_LT(prev, e.first());
+        prev = e.first();
+    }
+}
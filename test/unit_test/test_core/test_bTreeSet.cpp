@@ -0,0 +1,301 @@
+#include <gtest/gtest.h>
+#include "sets.h"
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <set>
+
+using namespace original;
+
+class BTreeSetTest : public testing::Test {
+protected:
+    void SetUp() override {
+        // Common setup for all tests
+        intSet = new bTreeSet<int>();
+        stringSet = new bTreeSet<std::string>();
+    }
+
+    void TearDown() override {
+        delete intSet;
+        delete stringSet;
+    }
+
+    bTreeSet<int>* intSet{};
+    bTreeSet<std::string>* stringSet{};
+};
+
+// Basic Functionality Tests
+TEST_F(BTreeSetTest, InitialState) {
+    EXPECT_EQ(intSet->size(), 0);
+    EXPECT_TRUE(intSet->className() == "bTreeSet");
+}
+
+TEST_F(BTreeSetTest, AddAndContains) {
+    EXPECT_TRUE(intSet->add(42));
+    EXPECT_EQ(intSet->size(), 1);
+    EXPECT_TRUE(intSet->contains(42));
+    EXPECT_FALSE(intSet->contains(43));
+
+    EXPECT_TRUE(stringSet->add("test"));
+    EXPECT_TRUE(stringSet->contains("test"));
+}
+
+TEST_F(BTreeSetTest, AddDuplicate) {
+    EXPECT_TRUE(intSet->add(10));
+    EXPECT_FALSE(intSet->add(10)); // Adding duplicate should fail
+    EXPECT_EQ(intSet->size(), 1);
+}
+
+TEST_F(BTreeSetTest, Remove) {
+    intSet->add(1);
+    intSet->add(2);
+    EXPECT_TRUE(intSet->remove(1));
+    EXPECT_EQ(intSet->size(), 1);
+    EXPECT_FALSE(intSet->contains(1));
+    EXPECT_TRUE(intSet->contains(2));
+
+    EXPECT_FALSE(intSet->remove(99)); // Remove non-existent
+}
+
+// Iterator Tests - bTreeSet should maintain order
+TEST_F(BTreeSetTest, IteratorOrder) {
+    // Insert elements out of order
+    intSet->add(3);
+    intSet->add(1);
+    intSet->add(2);
+    intSet->add(5);
+    intSet->add(4);
+
+    const auto it = intSet->begins();
+    EXPECT_TRUE(it->isValid());
+
+    std::vector<int> values;
+    while (it->isValid()) {
+        values.push_back(it->get());
+        it->next();
+    }
+    delete it;
+
+    // Verify elements are in order
+    EXPECT_EQ(values.size(), 5);
+    for (size_t i = 0; i < values.size() - 1; ++i) {
+        EXPECT_LT(values[i], values[i + 1]) << "Elements not in order at position " << i;
+    }
+}
+
+TEST_F(BTreeSetTest, IteratorReverseOrder) {
+    intSet->add(1);
+    intSet->add(2);
+    intSet->add(3);
+
+    const auto it = intSet->ends();
+    EXPECT_TRUE(it->isValid());
+
+    std::vector<int> values;
+    while (it->isValid()) {
+        values.push_back(it->get());
+        it->prev();
+    }
+    delete it;
+
+    // Verify elements are in reverse order
+    EXPECT_EQ(values.size(), 3);
+    for (size_t i = 0; i < values.size() - 1; ++i) {
+        EXPECT_GT(values[i], values[i + 1]) << "Elements not in reverse order at position " << i;
+    }
+}
+
+TEST_F(BTreeSetTest, IteratorEnd) {
+    intSet->add(1);
+    const auto begin = intSet->begin();
+    const auto end = intSet->end();
+
+    EXPECT_TRUE(begin.isValid());
+    EXPECT_FALSE(end.isValid());
+}
+
+// Boundary Tests
+TEST_F(BTreeSetTest, LargeNumberOfElements) {
+    constexpr int count = 100000;
+    for (int i = 0; i < count; ++i) {
+        EXPECT_TRUE(intSet->add(i));
+    }
+    EXPECT_EQ(intSet->size(), count);
+
+    for (int i = 0; i < count; ++i) {
+        EXPECT_TRUE(intSet->contains(i));
+    }
+
+    for (int i = 0; i < count; ++i) {
+        EXPECT_TRUE(intSet->remove(i));
+        EXPECT_FALSE(intSet->contains(i));
+    }
+}
+
+TEST_F(BTreeSetTest, StringElements) {
+    const std::vector<std::string> testStrings = {"apple", "banana", "cherry"};
+
+    for (const auto& s : testStrings) {
+        stringSet->add(s);
+    }
+
+    EXPECT_EQ(stringSet->size(), 3);
+    for (const auto& s : testStrings) {
+        EXPECT_TRUE(stringSet->contains(s));
+    }
+}
+
+// Copy and Move Tests
+TEST_F(BTreeSetTest, CopyConstructor) {
+    intSet->add(1);
+    intSet->add(2);
+
+    const bTreeSet copy(*intSet);
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_TRUE(copy.contains(1));
+    EXPECT_TRUE(copy.contains(2));
+}
+
+TEST_F(BTreeSetTest, MoveConstructor) {
+    intSet->add(1);
+    intSet->add(2);
+
+    const bTreeSet moved(std::move(*intSet));
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_TRUE(moved.contains(1));
+    EXPECT_TRUE(moved.contains(2));
+    EXPECT_EQ(intSet->size(), 0); // NOLINT(bugprone-use-after-move)
+}
+
+TEST_F(BTreeSetTest, CopyAssignment) {
+    intSet->add(1);
+    intSet->add(2);
+
+    const bTreeSet<int> copy = *intSet;
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_TRUE(copy.contains(1));
+    EXPECT_TRUE(copy.contains(2));
+}
+
+TEST_F(BTreeSetTest, MoveAssignment) {
+    intSet->add(1);
+    intSet->add(2);
+
+    const bTreeSet<int> moved = std::move(*intSet);
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_TRUE(moved.contains(1));
+    EXPECT_TRUE(moved.contains(2));
+    EXPECT_EQ(intSet->size(), 0); // NOLINT(bugprone-use-after-move)
+}
+
+// Custom Comparator Test
+TEST(BTreeSetCustomCompareTest, CustomCompareFunction) {
+    struct CustomCompare {
+        bool operator()(const int a, const int b) const {
+            return a > b; // Reverse order
+        }
+    };
+
+    bTreeSet<int, CustomCompare> customSet;
+    customSet.add(1);
+    customSet.add(2);
+    customSet.add(3);
+
+    const auto it = customSet.begins();
+    EXPECT_TRUE(it->isValid());
+
+    std::vector<int> values;
+    while (it->isValid()) {
+        values.push_back(it->get());
+        it->next();
+    }
+    delete it;
+
+    // Verify elements are in reverse order
+    EXPECT_EQ(values.size(), 3);
+    for (size_t i = 0; i < values.size() - 1; ++i) {
+        EXPECT_GT(values[i], values[i + 1]) << "Elements not in reverse order at position " << i;
+    }
+}
+
+// toString Test
+TEST_F(BTreeSetTest, ToString) {
+    intSet->add(1);
+    intSet->add(2);
+    const std::string str = intSet->toString(false);
+
+    // Basic checks - exact format might vary
+    EXPECT_TRUE(str.find("bTreeSet") != std::string::npos);
+    EXPECT_TRUE(str.find('1') != std::string::npos);
+    EXPECT_TRUE(str.find('2') != std::string::npos);
+}
+
+// Test predecessor and successor functionality through iterator
+TEST_F(BTreeSetTest, IteratorPredecessorSuccessor) {
+    intSet->add(1);
+    intSet->add(3);
+    intSet->add(5);
+
+    auto it = ownerPtr(intSet->begins());
+    EXPECT_EQ(it->get(), 1);
+
+    it->next();
+    EXPECT_EQ(it->get(), 3);
+
+    it->next();
+    EXPECT_EQ(it->get(), 5);
+
+    it->prev();
+    EXPECT_EQ(it->get(), 3);
+
+    it->prev();
+    EXPECT_EQ(it->get(), 1);
+}
+
+// Test tree balancing by inserting elements in reverse order
+TEST_F(BTreeSetTest, ReverseOrderInsertion) {
+    constexpr int count = 1000;
+    for (int i = count; i > 0; --i) {
+        EXPECT_TRUE(intSet->add(i));
+    }
+
+    EXPECT_EQ(intSet->size(), count);
+
+    // Verify all elements are present and in order
+    auto it = ownerPtr(intSet->begins());
+    int expected = 1;
+    while (it->isValid()) {
+        EXPECT_EQ(it->get(), expected);
+        it->next();
+        expected++;
+    }
+}
+
+// Randomized comparison against std::set, exercising node splits, borrows and merges
+TEST(BTreeSetRandomTest, MatchesStdSet) {
+    bTreeSet<long> s;
+    std::set<long> expected;
+    std::mt19937 gen(7);
+    for (int i = 0; i < 50000; ++i) {
+        const long e = static_cast<long>(gen() % 3000);
+        if (gen() % 2) {
+            EXPECT_EQ(s.add(e), expected.insert(e).second);
+        } else {
+            EXPECT_EQ(s.remove(e), expected.erase(e) == 1);
+        }
+    }
+    ASSERT_EQ(s.size(), expected.size());
+
+    auto it = expected.begin();
+    for (const auto& e : s) {
+        ASSERT_NE(it, expected.end());
+        EXPECT_EQ(e, *it);
+        ++it;
+    }
+    EXPECT_EQ(it, expected.end());
+
+    for (long e = 0; e < 3000; ++e) {
+        EXPECT_EQ(s.contains(e), expected.count(e) == 1);
+    }
+}
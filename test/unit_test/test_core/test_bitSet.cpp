@@ -216,3 +216,171 @@ TEST(BitSetTest, Iterator) {
     delete it3;
     delete it2;
 }
+
+TEST(BitSetTest, IteratorAcrossBlocks) {
+    original::bitSet bs1(200);
+    bs1.set(40, true);
+    bs1.set(64, true);
+    bs1.set(199, true);
+
+    // 迭代器跨过块边界后仍读取正确的块
+    std::vector<original::integer> set_bits;
+    original::integer i = 0;
+    for (const auto it = bs1.begin(); it.isValid(); it.next()) {
+        if (it.getElem()) {
+            set_bits.push_back(i);
+        }
+        i += 1;
+    }
+    EXPECT_EQ(set_bits, (std::vector<original::integer>{40, 64, 199}));
+
+    const auto it = bs1.begin();
+    const auto it2 = it + 64;
+    ASSERT_EQ(it2->getElem(), true);
+    it2->set(false);
+    ASSERT_EQ(bs1.get(64), false);
+    it2->operator-=(24);
+    ASSERT_EQ(it2->getElem(), true);  // 40位
+    delete it2;
+}
+
+TEST(BitSetTest, FindFirstAndNext) {
+    constexpr original::integer SIZE = 64 * 37 + 5;
+    std::mt19937 gen(17);
+    original::bitSet bs1(SIZE);
+    std::bitset<SIZE> bs2;
+
+    // 空集合返回 size()
+    EXPECT_EQ(bs1.findFirst(), SIZE);
+    EXPECT_EQ(bs1.findNext(0), SIZE);
+    EXPECT_EQ(bs1.indexOf(true), SIZE);
+    EXPECT_EQ(bs1.indexOf(false), 0u);
+
+    // 稀疏位，包含块首尾与最后一位
+    for (const original::integer index : std::vector<original::integer>{0, 63, 64, 127, 1000, 1001, SIZE - 1}) {
+        bs1.set(index, true);
+        bs2.set(index, true);
+    }
+    for (int i = 0; i < 40; ++i) {
+        const auto index = gen() % SIZE;
+        bs1.set(index, true);
+        bs2.set(index, true);
+    }
+
+    std::vector<original::u_integer> expected;
+    for (original::u_integer i = 0; i < SIZE; ++i) {
+        if (bs2[i]) expected.push_back(i);
+    }
+    std::vector<original::u_integer> found;
+    for (auto i = bs1.findFirst(); i < bs1.size(); i = bs1.findNext(i)) {
+        found.push_back(i);
+    }
+    EXPECT_EQ(found, expected);
+    EXPECT_EQ(bs1.indexOf(true), 0u);
+    EXPECT_EQ(bs1.findNext(SIZE - 1), SIZE);
+    EXPECT_EQ(bs1.findNext(SIZE + 10), SIZE);
+}
+
+TEST(BitSetTest, IndexOfFalse) {
+    original::bitSet bs1 = ~original::bitSet(130);
+    EXPECT_EQ(bs1.indexOf(false), 130u);
+    bs1.set(100, false);
+    EXPECT_EQ(bs1.indexOf(false), 100u);
+    bs1.set(3, false);
+    EXPECT_EQ(bs1.indexOf(false), 3u);
+
+    // 最后一块的冗余位不计入
+    original::bitSet bs2 = ~original::bitSet(64);
+    EXPECT_EQ(bs2.indexOf(false), 64u);
+}
+
+TEST(BitSetTest, WideBitwiseOperators) {
+    // 块数不是4的倍数，覆盖向量化主循环和尾部
+    constexpr original::integer SIZE = 64 * 37 + 5;
+    std::mt19937 gen(23);
+    original::bitSet bs1(SIZE);
+    original::bitSet bs2(SIZE);
+    std::bitset<SIZE> bs3;
+    std::bitset<SIZE> bs4;
+    for (int i = 0; i < SIZE / 3; ++i) {
+        const auto a = gen() % SIZE;
+        const auto b = gen() % SIZE;
+        bs1.set(a, true);
+        bs3.set(a, true);
+        bs2.set(b, true);
+        bs4.set(b, true);
+    }
+
+    EXPECT_TRUE(compareBitSets(bs1 & bs2, bs3 & bs4));
+    EXPECT_TRUE(compareBitSets(bs1 | bs2, bs3 | bs4));
+    EXPECT_TRUE(compareBitSets(bs1 ^ bs2, bs3 ^ bs4));
+    EXPECT_TRUE(compareBitSets(~bs1, ~bs3));
+    EXPECT_EQ((bs1 & bs2).count(), (bs3 & bs4).count());
+    EXPECT_EQ((bs1 ^ bs2).count(), (bs3 ^ bs4).count());
+    EXPECT_EQ((~bs1).count(), (~bs3).count());
+}
+
+TEST(BitSetTest, BitwiseOperatorsWithDifferentSizes) {
+    // 结果保持左侧大小：右侧超出部分被忽略，缺失部分视为 false
+    original::bitSet small(70);
+    original::bitSet large(300);
+    for (const original::integer index : {0, 65, 69}) small.set(index, true);
+    for (const original::integer index : {0, 1, 69, 70, 128, 299}) large.set(index, true);
+
+    original::bitSet bs_and = small;
+    bs_and &= large;
+    EXPECT_EQ(bs_and.size(), 70u);
+    EXPECT_EQ(bs_and.count(), 2u);
+
+    original::bitSet bs_or = small;
+    bs_or |= large;
+    EXPECT_EQ(bs_or.size(), 70u);
+    EXPECT_EQ(bs_or.count(), 4u);
+
+    original::bitSet bs_xor = small;
+    bs_xor ^= large;
+    EXPECT_EQ(bs_xor.count(), 2u);
+    EXPECT_TRUE(bs_xor.get(1));
+    EXPECT_TRUE(bs_xor.get(65));
+
+    original::bitSet wide_and = large;
+    wide_and &= small;
+    EXPECT_EQ(wide_and.size(), 300u);
+    EXPECT_EQ(wide_and.count(), 2u);
+    EXPECT_FALSE(wide_and.get(299));
+
+    original::bitSet wide_or = large;
+    wide_or |= small;
+    EXPECT_EQ(wide_or.count(), 7u);
+
+    original::bitSet empty(0);
+    EXPECT_EQ((~empty).size(), 0u);
+    wide_or &= empty;
+    EXPECT_EQ(wide_or.count(), 0u);
+}
+
+TEST(BitSetTest, EmptySet) {
+    // 空位集没有任何块，批量操作不能访问块数组
+    original::bitSet empty(0);
+    original::bitSet other(0);
+    EXPECT_EQ(empty.count(), 0u);
+    EXPECT_EQ(empty.findFirst(), 0u);
+    EXPECT_EQ(empty.indexOf(false), 0u);
+    EXPECT_EQ(empty.indexOf(true), 0u);
+
+    empty &= other;
+    empty |= other;
+    empty ^= other;
+    EXPECT_EQ(empty.size(), 0u);
+    EXPECT_EQ((empty & other).count(), 0u);
+    EXPECT_EQ((empty | other).count(), 0u);
+    EXPECT_EQ((empty ^ other).count(), 0u);
+    EXPECT_EQ((~empty).count(), 0u);
+
+    original::bitSet wide(100);
+    wide.set(7, true);
+    empty |= wide;
+    EXPECT_EQ(empty.size(), 0u);
+    wide ^= empty;
+    EXPECT_EQ(wide.count(), 1u);
+}
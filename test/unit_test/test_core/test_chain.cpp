@@ -1,5 +1,7 @@
 #include <list>
 #include <random>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 #include "chain.h"
 
@@ -391,4 +393,151 @@ namespace original {
         // 检查 c1 是否为空
         EXPECT_EQ(c1.size(), 0);
     }
+
+    // 测试按下标顺序访问
+    TEST(ChainTest, SequentialIndexAccess) {
+        chain<int> c;
+        for (int i = 0; i < 20000; ++i) {
+            c.pushEnd(i);
+        }
+        long long sum = 0;
+        for (u_integer i = 0; i < c.size(); ++i) {
+            sum += c.get(static_cast<integer>(i));
+        }
+        EXPECT_EQ(sum, 19999LL * 20000 / 2);
+        for (integer i = static_cast<integer>(c.size()) - 1; i >= 0; i -= 3) {
+            c[i] = -c[i];
+        }
+        EXPECT_EQ(c.get(19999), -19999);
+        EXPECT_EQ(c.get(19998), 19998);
+        EXPECT_EQ(c.get(-4), -19996);
+    }
+
+    // 测试随机混合操作下的下标访问
+    TEST(ChainTest, MixedIndexOperations) {
+        std::mt19937 gen(23);
+        chain<int> c;
+        std::vector<int> ref;
+        for (int step = 0; step < 20000; ++step) {
+            const auto size = static_cast<integer>(ref.size());
+            const int value = static_cast<int>(gen() % 1000);
+            switch (gen() % 9) {
+                case 0:
+                    c.pushBegin(value);
+                    ref.insert(ref.begin(), value);
+                    break;
+                case 1:
+                    c.pushEnd(value);
+                    ref.push_back(value);
+                    break;
+                case 2: {
+                    const integer index = static_cast<integer>(gen() % (ref.size() + 1));
+                    c.push(index, value);
+                    ref.insert(ref.begin() + index, value);
+                    break;
+                }
+                case 3:
+                    if (size > 0) {
+                        ASSERT_EQ(c.popBegin(), ref.front());
+                        ref.erase(ref.begin());
+                    }
+                    break;
+                case 4:
+                    if (size > 0) {
+                        ASSERT_EQ(c.popEnd(), ref.back());
+                        ref.pop_back();
+                    }
+                    break;
+                case 5:
+                    if (size > 0) {
+                        const integer index = static_cast<integer>(gen() % ref.size());
+                        ASSERT_EQ(c.pop(index), ref[index]);
+                        ref.erase(ref.begin() + index);
+                    }
+                    break;
+                case 6:
+                    if (size > 0) {
+                        const integer index = static_cast<integer>(gen() % ref.size());
+                        c.set(index, value);
+                        ref[index] = value;
+                    }
+                    break;
+                default:
+                    if (size > 0) {
+                        // 在上一次访问附近读取
+                        const integer index = static_cast<integer>(gen() % ref.size());
+                        ASSERT_EQ(c.get(index), ref[index]);
+                        ASSERT_EQ(c[index], ref[index]);
+                        if (index + 1 < size) {
+                            ASSERT_EQ(c.get(index + 1), ref[index + 1]);
+                        }
+                        if (index > 0) {
+                            ASSERT_EQ(c.get(index - 1), ref[index - 1]);
+                        }
+                    }
+                    break;
+            }
+            ASSERT_EQ(c.size(), ref.size());
+        }
+        EXPECT_TRUE(compareChainsAndLists(c, std::list(ref.begin(), ref.end())));
+    }
+
+    // 测试复制、移动、交换与拼接后的下标访问
+    TEST(ChainTest, IndexAccessAfterTransfer) {
+        chain<int> a = {0, 1, 2, 3, 4, 5, 6, 7};
+        chain<int> b = {10, 11, 12};
+        EXPECT_EQ(a[6], 6);
+        EXPECT_EQ(b[1], 11);
+
+        a.swap(b);
+        EXPECT_EQ(a.get(2), 12);
+        EXPECT_EQ(b.get(5), 5);
+
+        b += a;
+        EXPECT_EQ(b.get(9), 11);
+        EXPECT_EQ(a.size(), 0);
+        a.pushEnd(42);
+        EXPECT_EQ(a.get(0), 42);
+
+        chain<int> moved = std::move(b);
+        EXPECT_EQ(moved.get(8), 10);
+        EXPECT_EQ(moved.get(3), 3);
+        b = moved;
+        EXPECT_EQ(b.get(10), 12);
+        EXPECT_EQ(b.get(4), 4);
+
+        while (moved.size() > 2) {
+            moved.pop(static_cast<integer>(moved.size() / 2));
+            ASSERT_EQ(moved.get(-1), 12);
+        }
+        EXPECT_EQ(moved.get(0), 0);
+        moved.popEnd();
+        moved.pushBegin(7);
+        EXPECT_EQ(moved.get(0), 7);
+        EXPECT_EQ(moved.get(1), 0);
+    }
+
+    TEST(ChainTest, ConcurrentConstReads) {
+        // const get() 只读取 finger，多个线程可以同时读取同一个 chain
+        chain<int> c;
+        for (int i = 0; i < 2000; ++i) {
+            c.pushEnd(i);
+        }
+        EXPECT_EQ(c[1000], 1000);
+
+        const chain<int>& shared = c;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&shared, t] {
+                for (int i = 0; i < 2000; ++i) {
+                    const int index = (i * 7 + t * 500) % 2000;
+                    ASSERT_EQ(shared.get(index), index);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(c[1001], 1001);
+    }
 }
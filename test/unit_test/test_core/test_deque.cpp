@@ -3,6 +3,7 @@
 #include "blocksList.h"
 #include "deque.h"
 #include "forwardChain.h"
+#include "ringBuffer.h"
 #include "vector.h"
 
 // Helper function to compare two deques (original::deque and std::deque)
@@ -159,6 +160,38 @@ TEST(DequeTest, BlocksListDeque) {
     EXPECT_TRUE(d2.empty());
 }
 
+// Test deque with `ringBuffer` as the underlying container
+TEST(DequeTest, RingBufferDeque) {
+    original::deque<int, original::ringBuffer> d1;
+    std::deque<int> d2;
+
+    EXPECT_EQ(d1.size(), 0);
+    EXPECT_TRUE(d1.empty());
+
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 2 == 0) {
+            d1.pushBegin(i);
+            d2.push_front(i);
+        } else {
+            d1.pushEnd(i);
+            d2.push_back(i);
+        }
+        if (i % 5 == 4) {
+            EXPECT_EQ(d1.popEnd(), d2.back());
+            d2.pop_back();
+        }
+        EXPECT_EQ(d1.head(), d2.front());
+        EXPECT_EQ(d1.tail(), d2.back());
+    }
+    EXPECT_TRUE(compareDeques(d1, d2));
+
+    while (!d2.empty()) {
+        EXPECT_EQ(d1.popBegin(), d2.front());
+        d2.pop_front();
+    }
+    EXPECT_TRUE(d1.empty());
+}
+
 // Test copy constructor
 TEST(DequeTest, CopyConstructor) {
     original::deque<int> d1;
@@ -99,4 +99,32 @@ namespace original {
         EXPECT_FALSE(f(arr));
     }
 
+    // 测试按块匹配，每个元素对应一位
+    TEST(FilterTest, BlockMatchTest) {
+        constexpr u_integer n = 150;
+        int data[n];
+        for (u_integer i = 0; i < n; ++i) {
+            data[i] = static_cast<int>(i * 7 % 31);
+        }
+
+        const equalFilter<int> equal(3);
+        const notEqualFilter<int> not_equal(3);
+        const lessFilter<int> less(10);
+        const greaterFilter<int> greater(10);
+        const notLessFilter<int> not_less(10);
+        const notGreaterFilter<int> not_greater(10);
+        const rangeFilter<int> range(5, 20);
+        const filter<int> any;
+        const filter<int>* filters[] = {&equal, &not_equal, &less, &greater, &not_less, &not_greater, &range, &any};
+
+        for (const auto f : filters) {
+            ul_integer words[3] = {~ul_integer{0}, ~ul_integer{0}, ~ul_integer{0}};
+            (*f)(data, n, words);
+            for (u_integer i = 0; i < n; ++i) {
+                ASSERT_EQ((words[i / 64] >> i % 64 & 1) != 0, (*f)(data[i]));
+            }
+            EXPECT_EQ(words[2] >> (n % 64), 0);  // 超出 n 的位被清零
+        }
+    }
+
 }
@@ -1,9 +1,28 @@
 #include <gtest/gtest.h>
+#include <random>
 #include "filterStream.h"
 #include "vector.h"
 
 namespace original {
 
+    // 记录调用次数的过滤器，使用基类的逐元素按块匹配
+    class countingFilter final : public filter<int> {
+        u_integer* calls;
+
+    protected:
+        bool match(const int& t) const override {
+            *this->calls += 1;
+            return t % 2 == 0;
+        }
+
+    public:
+        explicit countingFilter(u_integer* calls) : calls(calls) {}
+
+        countingFilter* clone() const override {
+            return new countingFilter(*this);
+        }
+    };
+
     TEST(FilterStreamTest, AndOptTest) {
         const vector vec = {1, 2, 3, 4, 5};
         const vector vec1 = {1, 4, 5};
@@ -178,4 +197,92 @@ namespace original {
         });
     }
 
+    // 求值后继续扩展 filterStream
+    TEST(FilterStreamTest, ExtendAfterEvaluationTest) {
+        const lessFilter less(5);
+        const greaterFilter greater(1);
+        const equalFilter equal(8);
+
+        const filterStream fs = less && greater;
+        EXPECT_TRUE(fs(3));
+        EXPECT_FALSE(fs(8));
+
+        const filterStream fs2 = fs || equal;
+        const filterStream fs3 = equal || fs;
+        filterStream fs4 = fs;
+        fs4 && !equal;
+        for (int x = 0; x < 10; ++x) {
+            ASSERT_EQ(fs(x), x < 5 && x > 1);
+            ASSERT_EQ(fs2(x), (x < 5 && x > 1) || x == 8);
+            ASSERT_EQ(fs3(x), x == 8 || (x < 5 && x > 1));
+            ASSERT_EQ(fs4(x), x < 5 && x > 1 && x != 8);
+        }
+    }
+
+    // 按块求值与逐元素求值结果一致
+    TEST(FilterStreamTest, BatchEvaluateTest) {
+        std::mt19937 gen(11);
+        vector<int> data(5000, allocator<int>{}, 0);
+        for (u_integer i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<int>(gen() % 1000);
+        }
+
+        const lessFilter less(500);
+        const greaterFilter greater(100);
+        const equalFilter equal(300);
+        const rangeFilter range(250, 750);
+        const notEqualFilter n_equal(42);
+
+        const filterStream<int> streams[] = {
+            less && group(greater || !equal),
+            !group(less || range) || equal,
+            group(less && greater) || group(range && n_equal) || !n_equal,
+            !group(!group(less && !range) && greater),
+            group(range),
+        };
+        for (const auto& fs : streams) {
+            for (const u_integer n : {0u, 1u, 63u, 64u, 1000u, 1024u, 1025u, 5000u}) {
+                bitSet<> out(7);
+                fs.evaluate(&data.data(), n, out);
+                ASSERT_EQ(out.size(), n);
+                u_integer expected = 0;
+                for (u_integer i = 0; i < n; ++i) {
+                    ASSERT_EQ(out.get(i), fs(data[i]));
+                    expected += fs(data[i]);
+                }
+                ASSERT_EQ(out.count(), expected);
+            }
+        }
+    }
+
+    // 左操作数已经决定结果时跳过右操作数
+    TEST(FilterStreamTest, ShortCircuitTest) {
+        u_integer calls = 0;
+        const countingFilter counting(&calls);
+        const lessFilter less(0);
+        const notLessFilter not_less(0);
+        const filterStream and_fs = less && counting;
+        const filterStream or_fs = not_less || counting;
+
+        vector<int> data(3000, allocator<int>{}, 0);
+        for (u_integer i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<int>(i);
+        }
+        bitSet<> out(0);
+        and_fs.evaluate(&data.data(), data.size(), out);
+        EXPECT_EQ(out.count(), 0);
+        or_fs.evaluate(&data.data(), data.size(), out);
+        EXPECT_EQ(out.count(), data.size());
+        for (u_integer i = 0; i < 10; ++i) {
+            EXPECT_FALSE(and_fs(data[i]));
+            EXPECT_TRUE(or_fs(data[i]));
+        }
+        EXPECT_EQ(calls, 0);
+
+        // 负数使左操作数不能决定整个块
+        data[2000] = -1;
+        and_fs.evaluate(&data.data(), data.size(), out);
+        EXPECT_EQ(out.count(), 0);
+        EXPECT_EQ(calls, 1024);
+    }
 }
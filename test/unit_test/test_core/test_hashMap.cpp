@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "maps.h"
+#include <random>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace original;
@@ -261,3 +263,246 @@ TEST_F(HashMapTest, ContainsKeyValuePair) {
     EXPECT_FALSE(intMap->contains(couple<const int, int>(1, 20))); // Wrong value
     EXPECT_FALSE(intMap->contains(couple<const int, int>(3, 30))); // Key doesn't exist
 }
+
+// Open Addressing Engine Tests
+TEST(HashMapOpenTableTest, RandomOperationsMatchStd) {
+    hashMap<int, int, hash<int>, allocator<couple<const int, int>>, openHashTable> map;
+    std::unordered_map<int, int> expected;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution key(0, 5000);
+
+    for (int i = 0; i < 200000; ++i) {
+        const int k = key(gen);
+        switch (gen() % 4) {
+            case 0:
+                EXPECT_EQ(map.add(k, i), expected.emplace(k, i).second);
+                break;
+            case 1:
+                EXPECT_EQ(map.remove(k), expected.erase(k) == 1);
+                break;
+            case 2:
+                EXPECT_EQ(map.update(k, -i), expected.contains(k));
+                if (expected.contains(k)) expected[k] = -i;
+                break;
+            default:
+                ASSERT_EQ(map.containsKey(k), expected.contains(k));
+                if (expected.contains(k)) {
+                    ASSERT_EQ(map.get(k), expected[k]);
+                }
+        }
+        ASSERT_EQ(map.size(), expected.size());
+    }
+
+    u_integer visited = 0;
+    for (auto it = map.begin(); it != map.end(); it.next()) {
+        EXPECT_EQ(expected.at(it.get().first()), it.get().second());
+        visited += 1;
+    }
+    EXPECT_EQ(visited, expected.size());
+}
+
+TEST(HashMapOpenTableTest, CollisionsAndOwnership) {
+    struct CollideHash {
+        u_integer operator()(const int key) const {
+            return key % 3;
+        }
+    };
+
+    hashMap<int, int, CollideHash, allocator<couple<const int, int>>, openHashTable> collide;
+    for (int i = 0; i < 300; ++i) {
+        EXPECT_TRUE(collide.add(i, i * 2));
+    }
+    for (int i = 0; i < 300; i += 2) {
+        EXPECT_TRUE(collide.remove(i));
+    }
+    for (int i = 0; i < 300; ++i) {
+        EXPECT_EQ(collide.containsKey(i), i % 2 == 1);
+    }
+
+    using strMap = hashMap<std::string, int, hash<std::string>,
+                           allocator<couple<const std::string, int>>, openHashTable>;
+    strMap words;
+    for (int i = 0; i < 1000; ++i) {
+        words[std::to_string(i)] = i;
+    }
+
+    strMap copy(words);
+    strMap moved(std::move(words));
+    EXPECT_EQ(words.size(), 0); // NOLINT(bugprone-use-after-move)
+    EXPECT_TRUE(words.add("again", 1));
+    EXPECT_EQ(copy.size(), 1000);
+    EXPECT_EQ(moved.size(), 1000);
+    EXPECT_EQ(moved.get("999"), 999);
+
+    copy.remove("0");
+    copy.swap(words);
+    EXPECT_EQ(copy.size(), 1);
+    EXPECT_EQ(words.size(), 999);
+    EXPECT_FALSE(words.containsKey("0"));
+    EXPECT_EQ(words["500"], 500);
+
+    words = moved;
+    EXPECT_EQ(words.size(), 1000);
+    EXPECT_TRUE(words.containsKey("0"));
+}
+
+TEST(HashMapOpenTableTest, RelocationMovesKeys) {
+    struct CountedKey {
+        std::string s;
+        int* copies;
+        CountedKey(const int i, int* counter) : s(std::to_string(i)), copies(counter) {}
+        CountedKey(const CountedKey& other) : s(other.s), copies(other.copies) { *copies += 1; }
+        CountedKey(CountedKey&& other) noexcept = default;
+        bool operator==(const CountedKey& other) const { return s == other.s; }
+    };
+    struct CountedHash {
+        u_integer operator()(const CountedKey& key) const {
+            return static_cast<u_integer>(std::hash<std::string>{}(key.s));
+        }
+    };
+
+    // 每个键只在插入时复制一次，Robin Hood 位移与扩容只移动键
+    int copies = 0;
+    hashMap<CountedKey, int, CountedHash, allocator<couple<const CountedKey, int>>, openHashTable> map;
+    for (int i = 0; i < 5000; ++i) {
+        EXPECT_TRUE(map.add(CountedKey(i, &copies), i));
+    }
+    EXPECT_EQ(copies, 5000);
+    for (int i = 0; i < 5000; i += 2) {
+        EXPECT_TRUE(map.remove(CountedKey(i, &copies)));
+    }
+    EXPECT_EQ(copies, 5000);
+    for (int i = 0; i < 5000; ++i) {
+        EXPECT_EQ(map.containsKey(CountedKey(i, &copies)), i % 2 == 1);
+    }
+}
+
+// Power-of-two Bucket Sizing Tests
+TEST(HashMapPowerOfTwoTest, SequentialAndStridedKeys) {
+    hashMap<int, int, hash<int>, allocator<couple<const int, int>>, powerOfTwoHashTable> map;
+    // Strides of a power of two would all share the low bits without mixing
+    for (int i = 0; i < 50000; ++i) {
+        EXPECT_TRUE(map.add(i * 1024, i));
+        EXPECT_TRUE(map.add(i * 1024 + 1, -i));
+    }
+    EXPECT_EQ(map.size(), 100000);
+    for (int i = 0; i < 50000; ++i) {
+        ASSERT_EQ(map.get(i * 1024), i);
+        ASSERT_EQ(map.get(i * 1024 + 1), -i);
+    }
+    for (int i = 0; i < 50000; ++i) {
+        EXPECT_TRUE(map.remove(i * 1024));
+    }
+    EXPECT_EQ(map.size(), 50000);
+    EXPECT_FALSE(map.containsKey(0));
+    EXPECT_TRUE(map.containsKey(1));
+
+    auto copy = map;
+    map.swap(copy);
+    EXPECT_EQ(map.size(), 50000);
+    EXPECT_EQ(map[49999 * 1024 + 1], -49999);
+
+    EXPECT_NE(powerOfTwoBucketSizing::mix(1), powerOfTwoBucketSizing::mix(2));
+    EXPECT_EQ(powerOfTwoBucketSizing::nextSize(16), 32);
+    EXPECT_EQ(powerOfTwoBucketSizing::prevSize(16), 16);
+}
+
+// Incremental Rehash Tests
+namespace {
+    // Migrates a single bucket per operation, so the table spends most of its time mid-migration
+    template<typename K_TYPE, typename V_TYPE, typename ALLOC, typename HASH>
+    using singleStepHashTable = hashTable<K_TYPE, V_TYPE, ALLOC, HASH, primeBucketSizing, incrementalRehash<1>>;
+}
+
+TEST(HashMapIncrementalTest, RandomOperationsMatchStd) {
+    hashMap<int, int, hash<int>, allocator<couple<const int, int>>, singleStepHashTable> map;
+    std::unordered_map<int, int> expected;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution key_dist(0, 20000);
+
+    const auto check = [&](const auto& m) {
+        ASSERT_EQ(m.size(), expected.size());
+        // Iteration must visit both bucket arrays while a migration is in progress
+        std::unordered_map<int, int> seen;
+        for (const auto& e : m) {
+            ASSERT_TRUE(seen.emplace(e.first(), e.second()).second);
+        }
+        ASSERT_EQ(seen, expected);
+    };
+
+    // Grow well past several resizes, then shrink back through them
+    for (int round = 0; round < 2; ++round) {
+        const bool growing = round == 0;
+        for (int i = 0; i < 60000; ++i) {
+            const int key = key_dist(gen);
+            if (growing ? i % 4 != 3 : i % 4 == 3) {
+                ASSERT_EQ(map.add(key, i), expected.emplace(key, i).second);
+            } else {
+                ASSERT_EQ(map.remove(key), expected.erase(key) == 1);
+            }
+            const int probe = key_dist(gen);
+            ASSERT_EQ(map.containsKey(probe), expected.contains(probe));
+            if (i % 997 == 0) {
+                check(map);
+                auto copy = map;
+                check(copy);
+            }
+        }
+        check(map);
+    }
+
+    for (auto& [k, v] : expected) {
+        map[k] = v + 1;
+        v += 1;
+    }
+    check(map);
+
+    auto moved = std::move(map);
+    check(moved);
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_TRUE(map.add(1, 1));
+    EXPECT_EQ(map.get(1), 1);
+}
+
+TEST(HashMapIncrementalTest, RemovalKeepsIterators) {
+    // 迁移进行中删除其他元素不应使迭代器失效：每个键恰好访问一次
+    for (int n = 1000; n < 4000; n += 250) {
+        hashMap<int, int, hash<int>, allocator<couple<const int, int>>, singleStepHashTable> map;
+        for (int i = 0; i < n; ++i) {
+            ASSERT_TRUE(map.add(i, i));
+        }
+        std::vector<bool> seen(n, false);
+        int previous = -1;
+        for (auto it = map.begin(); it.isValid(); it.next()) {
+            const int key = it.get().first();
+            ASSERT_FALSE(seen[key]) << "n " << n << " key " << key;
+            seen[key] = true;
+            if (previous >= 0) {
+                ASSERT_TRUE(map.remove(previous));
+            }
+            previous = key;
+        }
+        EXPECT_EQ(map.size(), 1) << "n " << n;
+        for (int i = 0; i < n; ++i) {
+            ASSERT_TRUE(seen[i]) << "n " << n << " key " << i;
+        }
+    }
+}
+
+TEST(HashMapIncrementalTest, BulkInsertAndErase) {
+    hashMap<int, int, hash<int>, allocator<couple<const int, int>>, incrementalHashTable> map;
+    for (int i = 0; i < 100000; ++i) {
+        ASSERT_TRUE(map.add(i, i * 2));
+        ASSERT_FALSE(map.add(i / 2, 0));
+    }
+    for (int i = 0; i < 100000; ++i) {
+        ASSERT_EQ(map.get(i), i * 2);
+    }
+    for (int i = 0; i < 100000; i += 2) {
+        ASSERT_TRUE(map.remove(i));
+    }
+    EXPECT_EQ(map.size(), 50000);
+    for (int i = 0; i < 100000; ++i) {
+        ASSERT_EQ(map.containsKey(i), i % 2 == 1);
+    }
+}
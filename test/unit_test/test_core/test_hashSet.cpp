@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "sets.h"
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -203,3 +204,33 @@ TEST(HashSetCustomHashTest, CustomHashFunction) {
 
     EXPECT_EQ(customSet.size(), 20); // All should be added despite hash collisions
 }
+
+// Open Addressing Engine Tests
+TEST(HashSetOpenTableTest, AddRemoveAndIterate) {
+    hashSet<int, hash<int>, allocator<couple<const int, const bool>>, openHashTable> set;
+    for (int i = 0; i < 10000; ++i) {
+        EXPECT_TRUE(set.add(i * 7));
+    }
+    EXPECT_FALSE(set.add(7));
+    for (int i = 0; i < 10000; i += 3) {
+        EXPECT_TRUE(set.remove(i * 7));
+    }
+    EXPECT_EQ(set.size(), 6666);
+
+    std::vector<int> elements;
+    for (auto it = set.begin(); it != set.end(); it.next()) {
+        elements.push_back(it.get());
+    }
+    std::ranges::sort(elements);
+    ASSERT_EQ(elements.size(), 6666);
+    for (const int e : elements) {
+        EXPECT_EQ(e % 7, 0);
+        EXPECT_NE(e / 7 % 3, 0);
+        EXPECT_TRUE(set.contains(e));
+    }
+
+    auto copy = set;
+    set.remove(7);
+    EXPECT_TRUE(copy.contains(7));
+    EXPECT_FALSE(set.contains(7));
+}
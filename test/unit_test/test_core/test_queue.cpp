@@ -4,6 +4,7 @@
 #include "forwardChain.h"
 #include "vector.h"
 #include "blocksList.h"
+#include "ringBuffer.h"
 
 // Helper function to compare two queues (original::queue and std::queue)
 template <typename T, template <typename, typename> typename SERIAL>
@@ -159,6 +160,34 @@ TEST(QueueTest, BlocksListQueue) {
     EXPECT_TRUE(q2.empty());
 }
 
+// Test queue with `ringBuffer` as the underlying container
+TEST(QueueTest, RingBufferQueue) {
+    original::queue<int, original::ringBuffer> q1;
+    std::queue<int> q2;
+
+    EXPECT_EQ(q1.size(), 0);
+    EXPECT_TRUE(q1.empty());
+
+    // Interleaved push and pop make the elements wrap around the buffer
+    for (int i = 0; i < 1000; ++i) {
+        q1.push(i);
+        q2.push(i);
+        if (i % 3 == 2) {
+            EXPECT_EQ(q1.pop(), q2.front());
+            q2.pop();
+        }
+        EXPECT_EQ(q1.head(), q2.front());
+        EXPECT_EQ(q1.tail(), q2.back());
+    }
+    EXPECT_TRUE(compareQueues(q1, q2));
+
+    while (!q2.empty()) {
+        EXPECT_EQ(q1.pop(), q2.front());
+        q2.pop();
+    }
+    EXPECT_TRUE(q1.empty());
+}
+
 // Test copy constructor
 TEST(QueueTest, CopyConstructor) {
     original::queue<int> q1;
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+#include "maps.h"
+#include "sets.h"
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace original;
+
+// Ordered navigation and range views are shared by the tree and skip list containers,
+// so every test runs against all of them
+template <typename T>
+class OrderedMapNavigationTest : public testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 10; i <= 100; i += 10) {
+            m.add(i, i * 2);
+        }
+    }
+
+    T m;
+};
+
+template <typename T>
+class OrderedSetNavigationTest : public testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 10; i <= 100; i += 10) {
+            s.add(i);
+        }
+    }
+
+    T s;
+};
+
+using OrderedMapTypes = testing::Types<treeMap<int, int>, bTreeMap<int, int>, JMap<int, int>>;
+using OrderedSetTypes = testing::Types<treeSet<int>, bTreeSet<int>, JSet<int>>;
+TYPED_TEST_SUITE(OrderedMapNavigationTest, OrderedMapTypes);
+TYPED_TEST_SUITE(OrderedSetNavigationTest, OrderedSetTypes);
+
+template <typename MAP>
+std::vector<int> keysOf(const MAP& view) {
+    std::vector<int> keys;
+    for (const auto& e : view) {
+        keys.push_back(e.first());
+    }
+    return keys;
+}
+
+template <typename SET>
+std::vector<int> elementsOf(const SET& view) {
+    std::vector<int> elements;
+    for (const auto& e : view) {
+        elements.push_back(e);
+    }
+    return elements;
+}
+
+// ========== Map tests ==========
+TYPED_TEST(OrderedMapNavigationTest, BoundsOnExistingKeys) {
+    EXPECT_EQ(this->m.lowerBound(20).get().first(), 20);
+    EXPECT_EQ(this->m.upperBound(20).get().first(), 30);
+    EXPECT_EQ(this->m.floor(20).get().first(), 20);
+    EXPECT_EQ(this->m.ceiling(20).get().first(), 20);
+    EXPECT_EQ(this->m.lowerBound(20).get().second(), 40);
+}
+
+TYPED_TEST(OrderedMapNavigationTest, BoundsBetweenKeys) {
+    EXPECT_EQ(this->m.lowerBound(25).get().first(), 30);
+    EXPECT_EQ(this->m.upperBound(25).get().first(), 30);
+    EXPECT_EQ(this->m.floor(25).get().first(), 20);
+    EXPECT_EQ(this->m.ceiling(25).get().first(), 30);
+}
+
+TYPED_TEST(OrderedMapNavigationTest, BoundsOutsideKeys) {
+    EXPECT_FALSE(this->m.floor(5).isValid());
+    EXPECT_EQ(this->m.ceiling(5).get().first(), 10);
+    EXPECT_FALSE(this->m.ceiling(105).isValid());
+    EXPECT_FALSE(this->m.lowerBound(105).isValid());
+    EXPECT_FALSE(this->m.upperBound(100).isValid());
+    EXPECT_EQ(this->m.floor(105).get().first(), 100);
+    EXPECT_THROW(this->m.floor(5).get(), outOfBoundError);
+}
+
+TYPED_TEST(OrderedMapNavigationTest, BoundIteratorContinuesInOrder) {
+    auto it = this->m.lowerBound(45);
+    std::vector<int> keys;
+    while (it.isValid()) {
+        keys.push_back(it.get().first());
+        it.next();
+    }
+    EXPECT_EQ(keys, (std::vector<int>{50, 60, 70, 80, 90, 100}));
+}
+
+TYPED_TEST(OrderedMapNavigationTest, RangeIteratesHalfOpenInterval) {
+    EXPECT_EQ(keysOf(this->m.range(25, 75)), (std::vector<int>{30, 40, 50, 60, 70}));
+    EXPECT_EQ(keysOf(this->m.range(30, 70)), (std::vector<int>{30, 40, 50, 60}));
+    EXPECT_EQ(keysOf(this->m.range(0, 1000)).size(), 10u);
+    EXPECT_EQ(keysOf(this->m.range(100, 101)), (std::vector<int>{100}));
+}
+
+TYPED_TEST(OrderedMapNavigationTest, EmptyRanges) {
+    EXPECT_TRUE(this->m.range(30, 30).empty());
+    EXPECT_TRUE(this->m.range(70, 30).empty());
+    EXPECT_TRUE(this->m.range(31, 39).empty());
+    EXPECT_TRUE(this->m.range(101, 200).empty());
+    EXPECT_TRUE(keysOf(this->m.range(70, 30)).empty());
+    EXPECT_FALSE(this->m.range(30, 31).empty());
+
+    TypeParam empty;
+    EXPECT_TRUE(empty.range(0, 100).empty());
+    EXPECT_FALSE(empty.lowerBound(0).isValid());
+    EXPECT_FALSE(empty.floor(0).isValid());
+}
+
+TYPED_TEST(OrderedMapNavigationTest, RangeIsLazy) {
+    auto view = this->m.range(20, 50);
+    this->m.update(30, -1);
+    std::vector<int> values;
+    for (const auto& e : view) {
+        values.push_back(e.second());
+    }
+    EXPECT_EQ(values, (std::vector<int>{40, -1, 80}));
+}
+
+TYPED_TEST(OrderedMapNavigationTest, RangeToString) {
+    EXPECT_EQ(this->m.range(20, 40).toString(false), "rangeView(couple(20, 40), couple(30, 60))");
+    EXPECT_EQ(this->m.range(40, 20).toString(false), "rangeView()");
+}
+
+TYPED_TEST(OrderedMapNavigationTest, EraseRange) {
+    EXPECT_EQ(this->m.eraseRange(25, 75), 5u);
+    EXPECT_EQ(this->m.size(), 5u);
+    EXPECT_EQ(keysOf(this->m), (std::vector<int>{10, 20, 80, 90, 100}));
+    EXPECT_EQ(this->m.eraseRange(75, 25), 0u);
+    EXPECT_EQ(this->m.eraseRange(30, 70), 0u);
+    EXPECT_EQ(this->m.eraseRange(0, 1000), 5u);
+    EXPECT_EQ(this->m.size(), 0u);
+    EXPECT_TRUE(this->m.range(0, 1000).empty());
+
+    // The container stays usable after being emptied
+    this->m.add(1, 1);
+    EXPECT_EQ(keysOf(this->m), (std::vector<int>{1}));
+}
+
+TYPED_TEST(OrderedMapNavigationTest, RandomizedAgainstStdMap) {
+    TypeParam m;
+    std::map<int, int> expected;
+    std::mt19937 gen(14);
+    for (int i = 0; i < 3000; ++i) {
+        const int k = static_cast<int>(gen() % 10000);
+        m.add(k, k);
+        expected.emplace(k, k);
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        const int k = static_cast<int>(gen() % 10200) - 100;
+
+        auto lb = expected.lower_bound(k);
+        auto it = m.lowerBound(k);
+        ASSERT_EQ(it.isValid(), lb != expected.end());
+        if (it.isValid()) {
+            ASSERT_EQ(it.get().first(), lb->first);
+        }
+
+        auto ub = expected.upper_bound(k);
+        it = m.upperBound(k);
+        ASSERT_EQ(it.isValid(), ub != expected.end());
+        if (it.isValid()) {
+            ASSERT_EQ(it.get().first(), ub->first);
+        }
+
+        it = m.floor(k);
+        ASSERT_EQ(it.isValid(), ub != expected.begin());
+        if (it.isValid()) {
+            ASSERT_EQ(it.get().first(), std::prev(ub)->first);
+        }
+
+        const int hi = k + static_cast<int>(gen() % 300);
+        std::vector<int> in_range;
+        for (auto e = lb; e != expected.end() && e->first < hi; ++e) {
+            in_range.push_back(e->first);
+        }
+        ASSERT_EQ(keysOf(m.range(k, hi)), in_range);
+    }
+
+    for (int i = 0; i < 50; ++i) {
+        const int lo = static_cast<int>(gen() % 10000);
+        const int hi = lo + static_cast<int>(gen() % 500);
+        const auto first = expected.lower_bound(lo);
+        const auto last = expected.lower_bound(hi);
+        const auto cnt = static_cast<u_integer>(std::distance(first, last));
+        expected.erase(first, last);
+        ASSERT_EQ(m.eraseRange(lo, hi), cnt);
+        ASSERT_EQ(m.size(), expected.size());
+    }
+
+    std::vector<int> remaining;
+    for (const auto& [k, v] : expected) {
+        remaining.push_back(k);
+    }
+    EXPECT_EQ(keysOf(m), remaining);
+}
+
+// ========== Set tests ==========
+TYPED_TEST(OrderedSetNavigationTest, Bounds) {
+    EXPECT_EQ(this->s.lowerBound(20).get(), 20);
+    EXPECT_EQ(this->s.upperBound(20).get(), 30);
+    EXPECT_EQ(this->s.floor(25).get(), 20);
+    EXPECT_EQ(this->s.ceiling(25).get(), 30);
+    EXPECT_FALSE(this->s.floor(5).isValid());
+    EXPECT_FALSE(this->s.upperBound(100).isValid());
+}
+
+TYPED_TEST(OrderedSetNavigationTest, RangeAndEraseRange) {
+    EXPECT_EQ(elementsOf(this->s.range(25, 75)), (std::vector<int>{30, 40, 50, 60, 70}));
+    EXPECT_TRUE(this->s.range(75, 25).empty());
+    EXPECT_EQ(this->s.range(10, 30).toString(false), "rangeView(10, 20)");
+
+    EXPECT_EQ(this->s.eraseRange(25, 75), 5u);
+    EXPECT_EQ(elementsOf(this->s), (std::vector<int>{10, 20, 80, 90, 100}));
+    EXPECT_FALSE(this->s.contains(50));
+}
+
+TYPED_TEST(OrderedSetNavigationTest, RandomizedAgainstStdSet) {
+    TypeParam s;
+    std::set<int> expected;
+    std::mt19937 gen(41);
+    for (int i = 0; i < 3000; ++i) {
+        const int e = static_cast<int>(gen() % 10000);
+        s.add(e);
+        expected.insert(e);
+    }
+
+    for (int i = 0; i < 300; ++i) {
+        const int lo = static_cast<int>(gen() % 10000);
+        const int hi = lo + static_cast<int>(gen() % 300);
+        const std::vector<int> in_range(expected.lower_bound(lo), expected.lower_bound(hi));
+        ASSERT_EQ(elementsOf(s.range(lo, hi)), in_range);
+
+        auto ub = expected.upper_bound(lo);
+        auto it = s.upperBound(lo);
+        ASSERT_EQ(it.isValid(), ub != expected.end());
+        if (it.isValid()) {
+            ASSERT_EQ(it.get(), *ub);
+        }
+    }
+
+    for (int i = 0; i < 50; ++i) {
+        const int lo = static_cast<int>(gen() % 10000);
+        const int hi = lo + static_cast<int>(gen() % 500);
+        const auto cnt = static_cast<u_integer>(
+            std::distance(expected.lower_bound(lo), expected.lower_bound(hi)));
+        expected.erase(expected.lower_bound(lo), expected.lower_bound(hi));
+        ASSERT_EQ(s.eraseRange(lo, hi), cnt);
+    }
+    EXPECT_EQ(elementsOf(s), std::vector<int>(expected.begin(), expected.end()));
+}
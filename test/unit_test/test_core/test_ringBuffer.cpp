@@ -0,0 +1,164 @@
+#include <deque>
+#include <random>
+#include <string>
+#include <gtest/gtest.h>
+#include "refCntPtr.h"
+#include "ringBuffer.h"
+
+namespace {
+    // 对比函数，用于比较 original::ringBuffer 和 std::deque
+    template <typename T>
+    void compareRingBuffer(const original::ringBuffer<T>& rb, const std::deque<T>& dq) {
+        ASSERT_EQ(rb.size(), dq.size());
+        for (size_t i = 0; i < dq.size(); ++i) {
+            ASSERT_EQ(rb.get(static_cast<original::integer>(i)), dq[i]);
+        }
+    }
+}
+
+// 测试两端的 push 和 pop 操作
+TEST(RingBufferTest, PushPopBothEnds) {
+    original::ringBuffer<int> rb;
+    std::deque<int> dq;
+    EXPECT_TRUE(rb.empty());
+    EXPECT_EQ(rb.capacity(), 16);
+
+    for (int i = 0; i < 10; ++i) {
+        rb.pushEnd(i);
+        dq.push_back(i);
+        rb.pushBegin(-i);
+        dq.push_front(-i);
+    }
+    compareRingBuffer(rb, dq);
+    EXPECT_EQ(rb.capacity(), 32);
+
+    EXPECT_EQ(rb.popBegin(), -9);
+    EXPECT_EQ(rb.popEnd(), 9);
+    dq.pop_front();
+    dq.pop_back();
+    compareRingBuffer(rb, dq);
+
+    while (!rb.empty()) {
+        EXPECT_EQ(rb.popBegin(), dq.front());
+        dq.pop_front();
+    }
+    EXPECT_THROW(rb.popBegin(), original::noElementError);
+    EXPECT_THROW(rb.popEnd(), original::noElementError);
+}
+
+// 测试环绕后的下标访问与容量不变
+TEST(RingBufferTest, WrapAroundWithoutGrowth) {
+    original::ringBuffer<int> rb;
+    for (int i = 0; i < 12; ++i) {
+        rb.pushEnd(i);
+    }
+    // 头部不断前移，元素跨越缓冲区末尾
+    for (int i = 12; i < 1000; ++i) {
+        EXPECT_EQ(rb.popBegin(), i - 12);
+        rb.pushEnd(i);
+        ASSERT_EQ(rb.get(0), i - 11);
+        ASSERT_EQ(rb.get(-1), i);
+        ASSERT_EQ(rb[5], i - 6);
+    }
+    EXPECT_EQ(rb.capacity(), 16);
+
+    rb.set(3, 42);
+    EXPECT_EQ(rb.get(3), 42);
+    EXPECT_EQ(rb.indexOf(42), 3);
+    EXPECT_EQ(rb.indexOf(-1), rb.size());
+    EXPECT_THROW(rb.get(12), original::outOfBoundError);
+    EXPECT_THROW(rb.set(-13, 0), original::outOfBoundError);
+}
+
+// 测试中间位置插入与删除
+TEST(RingBufferTest, MiddlePushPop) {
+    std::mt19937 gen(24);
+    original::ringBuffer<int> rb;
+    std::deque<int> dq;
+    for (int step = 0; step < 5000; ++step) {
+        const int value = static_cast<int>(gen() % 1000);
+        if (dq.empty() || gen() % 2 == 0) {
+            const auto index = static_cast<original::integer>(gen() % (dq.size() + 1));
+            rb.push(index, value);
+            dq.insert(dq.begin() + index, value);
+        } else {
+            const auto index = static_cast<original::integer>(gen() % dq.size());
+            ASSERT_EQ(rb.pop(index), dq[index]);
+            dq.erase(dq.begin() + index);
+        }
+        if (step % 7 == 0) {
+            rb.pushBegin(value);
+            dq.push_front(value);
+        }
+    }
+    compareRingBuffer(rb, dq);
+    EXPECT_EQ(rb.capacity() & (rb.capacity() - 1), 0);
+}
+
+// 测试迭代器
+TEST(RingBufferTest, Iterator) {
+    original::ringBuffer<int> rb;
+    for (int i = 0; i < 10; ++i) {
+        rb.pushBegin(i);
+    }
+    int expected = 9;
+    for (const auto& e : rb) {
+        EXPECT_EQ(e, expected);
+        expected -= 1;
+    }
+    EXPECT_EQ(expected, -1);
+
+    auto it = rb.begin();
+    it += 4;
+    EXPECT_EQ(*it, 5);
+    it.set(50);
+    EXPECT_EQ(rb.get(4), 50);
+    EXPECT_TRUE(it.hasPrev());
+    EXPECT_EQ(rb.end() - rb.begin(), 10);
+    EXPECT_EQ(rb.last().get(), 0);
+    EXPECT_EQ(rb.className(), "ringBuffer");
+}
+
+// 测试构造、复制、移动与交换
+TEST(RingBufferTest, CopyMoveSwap) {
+    original::ringBuffer<int> rb = {1, 2, 3};
+    rb.pushBegin(0);
+    original::ringBuffer<int> copy{rb};
+    copy.pushEnd(4);
+    EXPECT_EQ(rb.size(), 4);
+    EXPECT_EQ(copy.size(), 5);
+    EXPECT_EQ(copy.get(0), 0);
+    EXPECT_EQ(copy.get(4), 4);
+
+    original::ringBuffer<int> moved{std::move(copy)};
+    EXPECT_EQ(moved.size(), 5);
+    EXPECT_EQ(copy.size(), 0);
+    copy.pushEnd(7);
+    EXPECT_EQ(copy.get(0), 7);
+
+    std::swap(moved, rb);
+    EXPECT_EQ(rb.size(), 5);
+    EXPECT_EQ(moved.size(), 4);
+    EXPECT_EQ(moved.get(-1), 3);
+
+    const original::array<int> arr{5, 6};
+    const original::ringBuffer<int> from_array(arr);
+    EXPECT_EQ(from_array.get(1), 6);
+
+    original::ringBuffer<int> reserved;
+    reserved.reserve(100);
+    EXPECT_EQ(reserved.capacity(), 128);
+}
+
+// 测试弹出元素时资源被移出
+TEST(RingBufferTest, PopReleasesElements) {
+    original::ringBuffer<original::strongPtr<std::string>> rb;
+    auto p = original::makeStrongPtr<std::string>("message");
+    rb.pushEnd(p);
+    rb.pushEnd(p);
+    EXPECT_EQ(p.strongRefs(), 3);
+    auto out = rb.popBegin();
+    EXPECT_EQ(*out, "message");
+    rb.popEnd();
+    EXPECT_EQ(p.strongRefs(), 2);
+}
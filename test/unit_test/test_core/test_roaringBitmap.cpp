@@ -0,0 +1,272 @@
+#include <random>
+#include <set>
+#include <vector>
+
+#include "bitSet.h"
+#include "roaringBitmap.h"
+#include "gtest/gtest.h"
+
+namespace {
+    using bitmap = original::roaringBitmap<>;
+
+    std::vector<original::u_integer> collect(const bitmap& rb)
+    {
+        std::vector<original::u_integer> values;
+        for (const auto it = rb.begin(); it.isValid(); ++it) {
+            values.push_back(it.get());
+        }
+        return values;
+    }
+
+    bool sameValues(const bitmap& rb, const std::set<original::u_integer>& expected)
+    {
+        return rb.size() == expected.size()
+            && collect(rb) == std::vector<original::u_integer>(expected.begin(), expected.end());
+    }
+
+    // Values spread over sparse, dense and run-like chunks
+    std::set<original::u_integer> mixedValues(const original::u_integer seed)
+    {
+        std::mt19937 gen(seed);
+        std::set<original::u_integer> values;
+        std::uniform_int_distribution<original::u_integer> any;
+        for (int i = 0; i < 2000; ++i) {
+            values.insert(any(gen));
+        }
+        std::uniform_int_distribution<original::u_integer> low(0, 0xFFFF);
+        for (int i = 0; i < 20000; ++i) {
+            values.insert(3u << 16 | low(gen));
+        }
+        for (original::u_integer v = 0; v < 30000; v += 1 + gen() % 2) {
+            values.insert(7u << 16 | v);
+        }
+        return values;
+    }
+}
+
+TEST(RoaringBitmapTest, AddRemoveContains) {
+    bitmap rb;
+    EXPECT_TRUE(rb.empty());
+    EXPECT_TRUE(rb.add(5));
+    EXPECT_TRUE(rb.add(70000));
+    EXPECT_TRUE(rb.add(4294967295u));
+    EXPECT_FALSE(rb.add(5));
+    EXPECT_EQ(rb.size(), 3);
+    EXPECT_TRUE(rb.contains(70000));
+    EXPECT_FALSE(rb.contains(6));
+    EXPECT_TRUE(rb.remove(70000));
+    EXPECT_FALSE(rb.remove(70000));
+    EXPECT_FALSE(rb.contains(70000));
+    EXPECT_TRUE(sameValues(rb, {5, 4294967295u}));
+}
+
+TEST(RoaringBitmapTest, ArrayAndBitmapChunks) {
+    bitmap rb;
+    std::set<original::u_integer> expected;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<original::u_integer> low(0, 0xFFFF);
+    for (int i = 0; i < 30000; ++i) {
+        const original::u_integer v = 1u << 16 | low(gen);
+        EXPECT_EQ(rb.add(v), expected.insert(v).second);
+    }
+    EXPECT_TRUE(sameValues(rb, expected));
+    EXPECT_EQ(rb.storageSize(), 8192);
+
+    // Removing back below 4096 values turns the bitmap chunk into an array
+    while (expected.size() > 100) {
+        EXPECT_TRUE(rb.remove(*expected.begin()));
+        expected.erase(expected.begin());
+    }
+    EXPECT_TRUE(sameValues(rb, expected));
+    EXPECT_EQ(rb.storageSize(), 200);
+}
+
+TEST(RoaringBitmapTest, AddRangeAndRunOptimize) {
+    bitmap rb;
+    rb.addRange(10, 200000);
+    EXPECT_EQ(rb.size(), 199991);
+    EXPECT_TRUE(rb.contains(10));
+    EXPECT_TRUE(rb.contains(65536));
+    EXPECT_TRUE(rb.contains(200000));
+    EXPECT_FALSE(rb.contains(9));
+    EXPECT_FALSE(rb.contains(200001));
+    EXPECT_EQ(rb.storageSize(), 16);
+
+    rb.addRange(300000, 299999);
+    EXPECT_EQ(rb.size(), 199991);
+
+    bitmap full;
+    full.addRange(0xFFFF0000u, 0xFFFFFFFFu);
+    EXPECT_EQ(full.size(), 65536);
+    EXPECT_EQ(full.select(65535), 0xFFFFFFFFu);
+
+    // Adding into a run chunk unpacks it, runOptimize packs it again
+    rb.add(300);
+    rb.remove(400);
+    EXPECT_EQ(rb.size(), 199990);
+    EXPECT_FALSE(rb.contains(400));
+    EXPECT_TRUE(rb.runOptimize());
+    EXPECT_EQ(rb.storageSize(), 20);
+    EXPECT_FALSE(rb.contains(400));
+    EXPECT_EQ(rb.size(), 199990);
+
+    bitmap sparse{1, 3, 5, 7};
+    EXPECT_FALSE(sparse.runOptimize());
+    EXPECT_EQ(sparse.storageSize(), 8);
+}
+
+TEST(RoaringBitmapTest, RankAndSelect) {
+    const auto expected = mixedValues(1);
+    bitmap rb;
+    for (const auto v : expected) {
+        rb.add(v);
+    }
+    rb.runOptimize();
+
+    original::u_integer index = 0;
+    for (const auto v : expected) {
+        ASSERT_EQ(rb.rank(v), index);
+        ASSERT_EQ(rb.select(index), v);
+        index += 1;
+    }
+    EXPECT_EQ(rb.rank(0), 0);
+    EXPECT_THROW((void) rb.select(rb.size()), original::outOfBoundError);
+}
+
+TEST(RoaringBitmapTest, BooleanOperators) {
+    for (original::u_integer seed = 1; seed <= 4; ++seed) {
+        const auto left = mixedValues(seed);
+        const auto right = mixedValues(seed + 10);
+        bitmap lrb;
+        bitmap rrb;
+        for (const auto v : left) lrb.add(v);
+        for (const auto v : right) rrb.add(v);
+        if (seed % 2 == 0) {
+            lrb.runOptimize();
+        } else {
+            rrb.runOptimize();
+        }
+
+        std::set<original::u_integer> both, either, one, only_left;
+        for (const auto v : left) {
+            (right.contains(v) ? both : only_left).insert(v);
+        }
+        either = left;
+        either.insert(right.begin(), right.end());
+        one = only_left;
+        for (const auto v : right) {
+            if (!left.contains(v)) one.insert(v);
+        }
+
+        EXPECT_TRUE(sameValues(lrb & rrb, both));
+        EXPECT_TRUE(sameValues(lrb | rrb, either));
+        EXPECT_TRUE(sameValues(lrb ^ rrb, one));
+        bitmap diff{lrb};
+        diff.andNot(rrb);
+        EXPECT_TRUE(sameValues(diff, only_left));
+    }
+}
+
+TEST(RoaringBitmapTest, RunChunkOperands) {
+    bitmap runs;
+    runs.addRange(100, 70000);
+    bitmap sparse{50, 150, 65536, 70001, 80000};
+    bitmap dense;
+    for (original::u_integer v = 0; v < 65536; v += 3) dense.add(v);
+
+    EXPECT_TRUE(sameValues(runs & sparse, {150, 65536}));
+    original::u_integer multiples = 0;
+    for (original::u_integer v = 100; v < 65536; ++v) {
+        multiples += v % 3 == 0;
+    }
+    EXPECT_EQ((runs & dense).size(), multiples);
+    EXPECT_EQ((runs | sparse).size(), 69901 + 3);
+    EXPECT_EQ((runs ^ sparse).size(), 69901 + 3 - 2);
+    bitmap diff{runs};
+    diff.andNot(dense);
+    EXPECT_EQ(diff.size(), 69901 - multiples);
+
+    bitmap self{runs};
+    self ^= self;
+    EXPECT_TRUE(self.empty());
+    self = runs;
+    self &= self;
+    EXPECT_EQ(self.size(), runs.size());
+}
+
+TEST(RoaringBitmapTest, BitSetConversion) {
+    original::bitSet bits(200000);
+    std::set<original::u_integer> expected;
+    std::mt19937 gen(3);
+    for (int i = 0; i < 50000; ++i) {
+        const original::u_integer v = gen() % 200000;
+        bits.set(v, true);
+        expected.insert(v);
+    }
+
+    const bitmap rb(bits);
+    EXPECT_TRUE(sameValues(rb, expected));
+
+    const auto back = rb.toBitSet(200000);
+    EXPECT_EQ(back.size(), 200000);
+    EXPECT_EQ(back.count(), expected.size());
+    for (const auto v : expected) {
+        ASSERT_TRUE(back.get(v));
+    }
+
+    const auto cut = rb.toBitSet(1000);
+    EXPECT_EQ(cut.count(), rb.rank(1000));
+}
+
+TEST(RoaringBitmapTest, Iterator) {
+    const bitmap empty;
+    EXPECT_FALSE(empty.begin().isValid());
+    int visited = 0;
+    for (const auto& v : empty) {
+        (void) v;
+        visited += 1;
+    }
+    EXPECT_EQ(visited, 0);
+
+    bitmap rb{1, 70000, 70001, 200000};
+    std::vector<original::u_integer> values;
+    for (const auto& v : rb) {
+        values.push_back(v);
+    }
+    EXPECT_EQ(values, (std::vector<original::u_integer>{1, 70000, 70001, 200000}));
+
+    auto it = rb.begin();
+    it += 2;
+    EXPECT_EQ(*it, 70001);
+    EXPECT_TRUE(it.hasNext());
+    EXPECT_TRUE(it.hasPrev());
+    it.prev();
+    it.prev();
+    EXPECT_EQ(*it, 1);
+    EXPECT_FALSE(it.hasPrev());
+    EXPECT_EQ(rb.end() - rb.begin(), 4);
+    EXPECT_EQ(rb.last().get(), 200000);
+    EXPECT_THROW(rb.begin().set(3), original::unSupportedMethodError);
+}
+
+TEST(RoaringBitmapTest, CopyMoveAndPrint) {
+    bitmap rb{3, 1, 100000};
+    EXPECT_EQ(rb.toString(false), "roaringBitmap(1, 3, 100000)");
+
+    bitmap copy{rb};
+    copy.add(5);
+    EXPECT_EQ(rb.size(), 3);
+    EXPECT_EQ(copy.size(), 4);
+
+    bitmap moved{std::move(copy)};
+    EXPECT_EQ(moved.size(), 4);
+    EXPECT_TRUE(moved.contains(5));
+
+    std::swap(moved, rb);
+    EXPECT_EQ(rb.size(), 4);
+    EXPECT_EQ(moved.size(), 3);
+
+    rb.clear();
+    EXPECT_TRUE(rb.empty());
+    EXPECT_EQ(rb.toString(false), "roaringBitmap()");
+}
@@ -0,0 +1,286 @@
+#include <gtest/gtest.h>
+#include "maps.h"
+#include "sets.h"
+#include "vector.h"
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace original;
+
+// Bulk construction and merging are shared by the tree and skip list containers,
+// so every ordered test runs against both of them
+template <typename T>
+class SortedMapBuildTest : public testing::Test {};
+
+template <typename T>
+class SortedSetBuildTest : public testing::Test {};
+
+using SortedMapTypes = testing::Types<treeMap<int, int>, JMap<int, int>>;
+using SortedSetTypes = testing::Types<treeSet<int>, JSet<int>>;
+TYPED_TEST_SUITE(SortedMapBuildTest, SortedMapTypes);
+TYPED_TEST_SUITE(SortedSetBuildTest, SortedSetTypes);
+
+using pairs = std::vector<std::pair<int, int>>;
+
+template <typename MAP>
+pairs pairsOf(const MAP& m) {
+    pairs result;
+    for (const auto& e : m) {
+        result.emplace_back(e.first(), e.second());
+    }
+    return result;
+}
+
+pairs pairsOf(const std::map<int, int>& m) {
+    return {m.begin(), m.end()};
+}
+
+template <typename SET>
+std::vector<int> elementsOf(const SET& s) {
+    std::vector<int> elements;
+    for (const auto& e : s) {
+        elements.push_back(e);
+    }
+    return elements;
+}
+
+std::set<int> randomSet(std::mt19937& gen, const int count, const int bound) {
+    std::set<int> result;
+    for (int i = 0; i < count; ++i) {
+        result.insert(static_cast<int>(gen() % bound));
+    }
+    return result;
+}
+
+// ========== Map tests ==========
+TYPED_TEST(SortedMapBuildTest, FromSortedMatchesInsertion) {
+    for (const int n : {1, 2, 3, 7, 8, 100, 1023, 1024, 1025}) {
+        TypeParam source;
+        std::map<int, int> expected;
+        for (int i = 0; i < n; ++i) {
+            source.add(i * 3, i);
+            expected.emplace(i * 3, i);
+        }
+
+        auto built = TypeParam::fromSorted(source.first().getIt(), source.last().getIt());
+        ASSERT_EQ(built.size(), static_cast<u_integer>(n));
+        ASSERT_EQ(pairsOf(built), pairsOf(expected));
+
+        // The built container must keep working as a regular one
+        std::mt19937 gen(n);
+        for (int i = 0; i < 2 * n; ++i) {
+            const int k = static_cast<int>(gen() % (3 * n + 10));
+            if (gen() % 2) {
+                ASSERT_EQ(built.add(k, -k), expected.emplace(k, -k).second);
+            } else {
+                ASSERT_EQ(built.remove(k), expected.erase(k) == 1);
+            }
+        }
+        ASSERT_EQ(pairsOf(built), pairsOf(expected));
+    }
+}
+
+TYPED_TEST(SortedMapBuildTest, FromSortedSubRange) {
+    TypeParam source;
+    for (int i = 1; i <= 10; ++i) {
+        source.add(i, i * i);
+    }
+    auto begin = source.ceiling(3);
+    auto end = source.floor(6);
+    auto built = TypeParam::fromSorted(begin, end);
+    EXPECT_EQ(pairsOf(built), (pairs{{3, 9}, {4, 16}, {5, 25}, {6, 36}}));
+}
+
+TYPED_TEST(SortedMapBuildTest, FromSortedEmptyRange) {
+    TypeParam source;
+    auto built = TypeParam::fromSorted(source.first().getIt(), source.last().getIt());
+    EXPECT_EQ(built.size(), 0u);
+    built.add(1, 1);
+    EXPECT_TRUE(built.containsKey(1));
+}
+
+TYPED_TEST(SortedMapBuildTest, FromSortedRejectsUnsortedInput) {
+    treeMap<int, int, decreaseComparator<int>> descending;
+    for (int i = 0; i < 10; ++i) {
+        descending.add(i, i);
+    }
+    EXPECT_THROW(TypeParam::fromSorted(descending.first().getIt(), descending.last().getIt()), valueError);
+
+    treeMap<int, int, decreaseComparator<int>> single;
+    single.add(1, 1);
+    EXPECT_EQ(TypeParam::fromSorted(single.first().getIt(), single.last().getIt()).size(), 1u);
+}
+
+TYPED_TEST(SortedMapBuildTest, MergeKeepsExistingValues) {
+    TypeParam m;
+    TypeParam other;
+    for (int i = 0; i < 20; i += 2) {
+        m.add(i, i);
+    }
+    for (int i = 0; i < 30; i += 3) {
+        other.add(i, -i);
+    }
+    m.merge(other);
+
+    std::map<int, int> expected;
+    for (int i = 0; i < 20; i += 2) expected.emplace(i, i);
+    for (int i = 0; i < 30; i += 3) expected.emplace(i, -i);
+    EXPECT_EQ(pairsOf(m), pairsOf(expected));
+    EXPECT_EQ(other.size(), 10u);
+
+    m.merge(m);
+    EXPECT_EQ(m.size(), expected.size());
+}
+
+TYPED_TEST(SortedMapBuildTest, MergeRandomizedAgainstStdMap) {
+    std::mt19937 gen(16);
+    // The sizes cover both the linear rebuild and the element-wise path for a small other
+    for (const auto& [n, m] : {std::pair{0, 100}, {100, 0}, {1000, 1000}, {5000, 10}, {10, 5000}}) {
+        TypeParam left;
+        TypeParam right;
+        std::map<int, int> expected;
+        for (const int k : randomSet(gen, n, 20000)) {
+            left.add(k, 1);
+            expected.emplace(k, 1);
+        }
+        for (const int k : randomSet(gen, m, 20000)) {
+            right.add(k, 2);
+            expected.emplace(k, 2);
+        }
+        left.merge(right);
+        ASSERT_EQ(left.size(), expected.size());
+        ASSERT_EQ(pairsOf(left), pairsOf(expected));
+
+        // The merged container must keep working as a regular one
+        for (int i = 0; i < 2000; ++i) {
+            const int k = static_cast<int>(gen() % 20000);
+            if (gen() % 2) {
+                ASSERT_EQ(left.add(k, 3), expected.emplace(k, 3).second);
+            } else {
+                ASSERT_EQ(left.remove(k), expected.erase(k) == 1);
+            }
+        }
+        ASSERT_EQ(pairsOf(left), pairsOf(expected));
+    }
+}
+
+TEST(SortedOrderStatisticTest, SubtreeSizesAfterBuildAndMerge) {
+    using rankedTreeSet = treeSet<int, increaseComparator<int>, allocator<couple<const int, const bool>>, orderStatistic>;
+    vector<int> odd;
+    for (int i = 1; i < 2000; i += 2) {
+        odd.pushEnd(i);
+    }
+    auto s = rankedTreeSet::fromSorted(odd.first().getIt(), odd.last().getIt());
+    for (u_integer i = 0; i < 1000; ++i) {
+        ASSERT_EQ(s.select(i).get(), static_cast<int>(2 * i + 1));
+    }
+
+    rankedTreeSet even;
+    for (int i = 0; i < 2000; i += 2) {
+        even.add(i);
+    }
+    s.merge(even);
+    for (u_integer i = 0; i < 2000; ++i) {
+        ASSERT_EQ(s.select(i).get(), static_cast<int>(i));
+        ASSERT_EQ(s.rank(static_cast<int>(i)), i);
+    }
+    s.remove(0);
+    EXPECT_EQ(s.select(0).get(), 1);
+}
+
+// ========== Set tests ==========
+TYPED_TEST(SortedSetBuildTest, FromSortedMatchesInsertion) {
+    TypeParam source;
+    for (int i = 0; i < 777; ++i) {
+        source.add(i * 2);
+    }
+    auto built = TypeParam::fromSorted(source.first().getIt(), source.last().getIt());
+    EXPECT_EQ(elementsOf(built), elementsOf(source));
+    EXPECT_TRUE(built.contains(1552));
+    EXPECT_FALSE(built.contains(1553));
+    EXPECT_TRUE(built.add(1553));
+    EXPECT_TRUE(built.remove(0));
+    EXPECT_EQ(built.size(), 777u);
+}
+
+TYPED_TEST(SortedSetBuildTest, FromSortedFromVector) {
+    const vector<int> sorted{1, 4, 9, 16};
+    auto built = TypeParam::fromSorted(sorted.first().getIt(), sorted.last().getIt());
+    EXPECT_EQ(elementsOf(built), (std::vector<int>{1, 4, 9, 16}));
+
+    const vector<int> unsorted{1, 9, 4, 16};
+    EXPECT_THROW(TypeParam::fromSorted(unsorted.first().getIt(), unsorted.last().getIt()), valueError);
+    const vector<int> duplicated{1, 4, 4, 16};
+    EXPECT_THROW(TypeParam::fromSorted(duplicated.first().getIt(), duplicated.last().getIt()), valueError);
+}
+
+TYPED_TEST(SortedSetBuildTest, SetAlgebraAgainstStdSet) {
+    std::mt19937 gen(61);
+    for (const auto& [n, m] : {std::pair{0, 0}, {0, 50}, {50, 0}, {300, 300}, {2000, 40}, {40, 2000}}) {
+        const auto a = randomSet(gen, n, 3000);
+        const auto b = randomSet(gen, m, 3000);
+        TypeParam left;
+        TypeParam right;
+        for (const int e : a) left.add(e);
+        for (const int e : b) right.add(e);
+
+        std::vector<int> expected;
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ASSERT_EQ(elementsOf(left.unite(right)), expected);
+
+        expected.clear();
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ASSERT_EQ(elementsOf(left.intersect(right)), expected);
+
+        expected.clear();
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        auto diff = left.difference(right);
+        ASSERT_EQ(elementsOf(diff), expected);
+        ASSERT_EQ(diff.size(), expected.size());
+
+        left.merge(right);
+        expected.clear();
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ASSERT_EQ(elementsOf(left), expected);
+        ASSERT_EQ(elementsOf(right), std::vector<int>(b.begin(), b.end()));
+    }
+}
+
+TEST(HashSetAlgebraTest, AgainstStdSet) {
+    std::mt19937 gen(62);
+    for (const auto& [n, m] : {std::pair{0, 0}, {0, 50}, {50, 0}, {300, 300}, {2000, 40}}) {
+        const auto a = randomSet(gen, n, 3000);
+        const auto b = randomSet(gen, m, 3000);
+        hashSet<int> left;
+        hashSet<int> right;
+        for (const int e : a) left.add(e);
+        for (const int e : b) right.add(e);
+
+        auto sortedOf = [](const hashSet<int>& s) {
+            std::vector<int> elements;
+            for (const ownerPtr<iterator<const int>> it(s.begins()); it->isValid(); it->next()) {
+                elements.push_back(it->get());
+            }
+            std::sort(elements.begin(), elements.end());
+            return elements;
+        };
+
+        std::vector<int> expected;
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ASSERT_EQ(sortedOf(left.unite(right)), expected);
+
+        expected.clear();
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ASSERT_EQ(sortedOf(left.intersect(right)), expected);
+        ASSERT_EQ(sortedOf(right.intersect(left)), expected);
+
+        expected.clear();
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ASSERT_EQ(sortedOf(left.difference(right)), expected);
+        ASSERT_EQ(left.size(), a.size());
+    }
+}
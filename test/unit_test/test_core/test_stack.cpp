@@ -4,6 +4,7 @@
 #include "forwardChain.h"
 #include "vector.h"
 #include "blocksList.h"
+#include "ringBuffer.h"
 
 // Helper function to check stack equality (compare original::stack with std::stack)
 template <typename T, template <typename, typename> typename SERIAL>
@@ -146,6 +147,32 @@ TEST(StackTest, BlocksListStack) {
     EXPECT_TRUE(s2.empty());
 }
 
+// Test stack with `ringBuffer` as the underlying container
+TEST(StackTest, RingBufferStack) {
+    original::stack<int, original::ringBuffer> s1;
+    std::stack<int> s2;
+
+    EXPECT_EQ(s1.size(), 0);
+    EXPECT_TRUE(s1.empty());
+
+    for (int i = 0; i < 1000; ++i) {
+        s1.push(i);
+        s2.push(i);
+        if (i % 4 == 3) {
+            EXPECT_EQ(s1.pop(), s2.top());
+            s2.pop();
+        }
+        EXPECT_EQ(s1.top(), s2.top());
+    }
+    EXPECT_TRUE(compareStacks(s1, s2));
+
+    while (!s2.empty()) {
+        EXPECT_EQ(s1.pop(), s2.top());
+        s2.pop();
+    }
+    EXPECT_TRUE(s1.empty());
+}
+
 // Test copy constructor
 TEST(StackTest, CopyConstructor) {
     original::stack<int> s1;
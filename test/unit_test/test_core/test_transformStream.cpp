@@ -22,4 +22,83 @@ namespace original {
             }
         );
     }
+
+    // 测试编译期流水线与运行时流的结果一致
+    TEST(TransformStreamTest, PipelineMatchesStreamTest) {
+        const addOptTransform add(5);
+        const multiOptTransform mult(-3);
+        const absTransform<int> abs;
+
+        auto fused = pipeline(add, mult, abs) + addOptTransform(-1);
+        auto stream = fused.toStream();
+        for (int i = -20; i <= 20; ++i) {
+            int a = i;
+            int b = i;
+            fused(a);
+            stream(b);
+            EXPECT_EQ(a, original::abs((i + 5) * -3) - 1);
+            EXPECT_EQ(a, b);
+        }
+
+        auto joined = transformPipeline<int>() + assignOptTransform(2) + fused;
+        int v = 100;
+        joined(v);
+        EXPECT_EQ(v, 20);
+    }
+
+    // 测试批量应用到 vector 和 array
+    TEST(TransformStreamTest, PipelineBulkApplyTest) {
+        auto p = pipeline(multiOptTransform(2), addOptTransform(-7), absTransform<int>());
+
+        vector<int> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.pushEnd(i);
+        }
+        v.popBegin();
+        p(v);
+        for (u_integer i = 0; i < v.size(); ++i) {
+            ASSERT_EQ(v[i], original::abs(static_cast<int>(i + 1) * 2 - 7));
+        }
+
+        array<int> arr(37);
+        arr.forEach([](int& e) { e = -1; });
+        p(arr);
+        arr.forEach([](const int& e) { ASSERT_EQ(e, 9); });
+
+        array<double> reals{1.5, -2.5};
+        pipeline(multiOptTransform(2.0), absTransform<double>())(reals);
+        EXPECT_EQ(reals[0], 3.0);
+        EXPECT_EQ(reals[1], 5.0);
+
+        vector<int> empty;
+        p(empty);
+        EXPECT_TRUE(empty.empty());
+    }
+
+    // 测试流水线中的副作用变换与自定义变换
+    TEST(TransformStreamTest, PipelineSideEffectTest) {
+        struct counter final : transform<int> {
+            int calls = 0;
+            void operator()(int& t) override {
+                calls += 1;
+                t += calls;
+            }
+        };
+
+        vector<int> copied;
+        auto p = pipeline(addOptTransform(1), copyTransform(copied), counter());
+        array<int> arr{10, 20, 30};
+        p(arr);
+        EXPECT_EQ(copied.size(), 3);
+        EXPECT_EQ(copied[0], 11);
+        EXPECT_EQ(copied[2], 31);
+        EXPECT_EQ(arr[0], 12);
+        EXPECT_EQ(arr[2], 34);
+
+        // 批量应用后的状态会保留
+        int x = 0;
+        p(x);
+        EXPECT_EQ(x, 5);
+        EXPECT_EQ(copied.size(), 4);
+    }
 }
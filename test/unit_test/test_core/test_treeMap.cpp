@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <map>
+#include <random>
 
 using namespace original;
 
@@ -323,4 +325,92 @@ TEST_F(TreeMapTest, ReverseOrderInsertion) {
         it->next();
         expected++;
     }
-}
\ No newline at end of file
+}
+// Order statistic tests
+using rankedTreeMap = treeMap<int, int, increaseComparator<int>, allocator<couple<const int, int>>, orderStatistic>;
+
+TEST(TreeMapOrderStatisticTest, SelectAndRank) {
+    rankedTreeMap map;
+    for (int i = 10; i > 0; --i) {
+        map.add(i * 10, i);
+    }
+
+    for (u_integer i = 0; i < 10; ++i) {
+        EXPECT_EQ(map.select(i).get().first(), static_cast<int>(i + 1) * 10);
+    }
+    EXPECT_FALSE(map.select(10).isValid());
+
+    EXPECT_EQ(map.rank(10), 0u);
+    EXPECT_EQ(map.rank(55), 5u);
+    EXPECT_EQ(map.rank(60), 5u);
+    EXPECT_EQ(map.rank(1000), 10u);
+    EXPECT_EQ(map.rank(-1), 0u);
+}
+
+TEST(TreeMapOrderStatisticTest, IteratorJumpsAndDistance) {
+    rankedTreeMap map;
+    for (int i = 0; i < 100; ++i) {
+        map.add(i, i);
+    }
+
+    auto it = map.begin();
+    it += 42;
+    EXPECT_EQ((*it).first(), 42);
+    it -= 40;
+    EXPECT_EQ((*it).first(), 2);
+    it += -2;
+    EXPECT_EQ((*it).first(), 0);
+    it -= 1;
+    EXPECT_FALSE(it.isValid());
+
+    auto first = ownerPtr(map.begins());
+    auto last = ownerPtr(map.ends());
+    EXPECT_EQ(*last - *first, 99);
+    EXPECT_EQ(*first - *last, -99);
+    EXPECT_EQ(map.end() - map.begin(), 100);
+
+    auto past = ownerPtr(map.ends());
+    *past += 5;
+    EXPECT_FALSE(past->isValid());
+}
+
+TEST(TreeMapOrderStatisticTest, PlainTreeKeepsStepwiseIterators) {
+    treeMap<int, int> map;
+    for (int i = 0; i < 10; ++i) {
+        map.add(i, i);
+    }
+    auto it = ownerPtr(map.begins());
+    *it += 3;
+    EXPECT_EQ(it->get().first(), 3);
+    EXPECT_THROW(*it - *it, unSupportedMethodError);
+}
+
+TEST(TreeMapOrderStatisticTest, RandomizedAgainstStdMap) {
+    rankedTreeMap map;
+    std::map<int, int> expected;
+    std::mt19937 gen(15);
+    for (int round = 0; round < 20000; ++round) {
+        const int k = static_cast<int>(gen() % 2000);
+        if (gen() % 3 == 0) {
+            ASSERT_EQ(map.remove(k), expected.erase(k) == 1);
+        } else {
+            ASSERT_EQ(map.add(k, k), expected.emplace(k, k).second);
+        }
+
+        if (round % 500 == 0) {
+            u_integer index = 0;
+            for (const auto& [key, value] : expected) {
+                ASSERT_EQ(map.select(index).get().first(), key);
+                ASSERT_EQ(map.rank(key), index);
+                index += 1;
+            }
+            ASSERT_FALSE(map.select(index).isValid());
+        }
+    }
+
+    // Copies carry the subtree sizes over
+    const rankedTreeMap copied(map);
+    const auto middle = std::next(expected.begin(), static_cast<long>(expected.size() / 2));
+    EXPECT_EQ(copied.select(static_cast<u_integer>(expected.size() / 2)).get().first(), middle->first);
+    EXPECT_EQ(copied.rank(middle->first), expected.size() / 2);
+}
@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <random>
+#include <set>
 
 using namespace original;
 
@@ -269,3 +271,30 @@ TEST_F(TreeSetTest, ReverseOrderInsertion) {
         expected++;
     }
 }
+
+// Order statistic tests
+TEST(TreeSetOrderStatisticTest, RandomizedAgainstStdSet) {
+    treeSet<int, increaseComparator<int>, allocator<couple<const int, const bool>>, orderStatistic> set;
+    std::set<int> expected;
+    std::mt19937 gen(51);
+    for (int round = 0; round < 10000; ++round) {
+        const int e = static_cast<int>(gen() % 1000);
+        if (gen() % 3 == 0) {
+            ASSERT_EQ(set.remove(e), expected.erase(e) == 1);
+        } else {
+            ASSERT_EQ(set.add(e), expected.insert(e).second);
+        }
+    }
+
+    u_integer index = 0;
+    for (const int e : expected) {
+        ASSERT_EQ(set.select(index).get(), e);
+        ASSERT_EQ(set.rank(e), index);
+        index += 1;
+    }
+
+    auto it = ownerPtr(set.begins());
+    *it += static_cast<integer>(expected.size() - 1);
+    EXPECT_EQ(it->get(), *expected.rbegin());
+    EXPECT_EQ(*it - *ownerPtr(set.begins()), static_cast<integer>(expected.size() - 1));
+}
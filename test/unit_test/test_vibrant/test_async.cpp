@@ -1,8 +1,10 @@
 #include <algorithm>
+#include <atomic>
 #include <numeric>
 #include <unordered_set>
 #include <gtest/gtest.h>
 #include <utility>
+#include <vector>
 #include "async.h"
 #include "zeit.h"
 
@@ -2376,4 +2378,234 @@ TEST(AsyncTest, LazyPipeLazyEvaluationVerification) {
     EXPECT_TRUE(first_stage_executed.load());
     EXPECT_TRUE(second_stage_executed.load());
     EXPECT_GE(total_time.value(), 190);  // 总执行时间至少200ms
-}
\ No newline at end of file
+}
+// 测试多个线程同时阻塞在同一个sharedFuture上时全部被唤醒
+TEST(AsyncTest, SharedFutureWakesAllBlockedWaiters) {
+    auto p = async::makePromise([] {
+        thread::sleep(milliseconds(100));
+        return 7;
+    });
+    auto sf = p.getFuture().share();
+
+    std::atomic sum{0};
+    std::vector<thread> waiters;
+    for (int i = 0; i < 8; ++i) {
+        waiters.emplace_back([sf, &sum] {
+            sum += sf.result();
+        }, thread::AUTO_JOIN);
+    }
+    runPromiseInThread(std::move(p));
+    waiters.clear();
+
+    EXPECT_EQ(sum.load(), 56);
+}
+
+// 测试超时等待失败后仍可继续等待到结果
+TEST(AsyncTest, WaitForTimeoutThenComplete) {
+    auto f = async::get([] {
+        thread::sleep(milliseconds(200));
+        return std::string("done");
+    });
+
+    EXPECT_FALSE(f.waitFor(milliseconds(20)));
+    EXPECT_FALSE(f.ready());
+    EXPECT_TRUE(f.waitFor(seconds(5)));
+    EXPECT_TRUE(f.ready());
+    EXPECT_EQ(f.exception(), nullptr);
+    EXPECT_EQ(f.result(), "done");
+}
+
+// 测试then回调由完成结果的线程执行，不阻塞调用线程
+TEST(AsyncTest, ThenRunsOnCompletingThread) {
+    auto p = async::makePromise([] { return 21; });
+    std::atomic<bool> executed{false};
+    auto f = p.getFuture().then([&executed](const int x) {
+        executed = true;
+        return x * 2;
+    });
+
+    EXPECT_FALSE(executed.load());
+    EXPECT_FALSE(f.ready());
+    p.run();
+    EXPECT_TRUE(executed.load());
+    EXPECT_TRUE(f.ready());
+    EXPECT_EQ(f.result(), 42);
+}
+
+// 测试对已完成的future调用then会立即执行回调
+TEST(AsyncTest, ThenOnReadyFutureRunsImmediately) {
+    auto p = async::makePromise([] { return std::string("ready"); });
+    auto source = p.getFuture();
+    p.run();
+
+    auto f = source.then([](std::string s) { return s.size(); });
+    EXPECT_FALSE(source.valid());
+    EXPECT_TRUE(f.ready());
+    EXPECT_EQ(f.result(), 5u);
+}
+
+// 测试then跳过回调并传递上游异常
+TEST(AsyncTest, ThenForwardsException) {
+    auto p = async::makePromise([]() -> int { throw runTimeTestError("upstream"); });
+    bool executed = false;
+    auto f = p.getFuture().then([&executed](int) {
+        executed = true;
+    });
+    p.run();
+
+    EXPECT_FALSE(executed);
+    EXPECT_THROW(f.result(), runTimeTestError);
+}
+
+// 测试promise未运行即销毁时，then得到的future收到异常而不是永久挂起
+TEST(AsyncTest, ThenOnDroppedPromiseReportsError) {
+    async::future<int> f;
+    {
+        auto p = async::makePromise([] { return 1; });
+        f = p.getFuture().then([](const int x) { return x + 1; });
+    }
+    EXPECT_TRUE(f.ready());
+    EXPECT_THROW(f.result(), sysError);
+}
+
+// 测试长链then不占用任何等待线程
+TEST(AsyncTest, ThenLongChain) {
+    auto p = async::makePromise([] { return 0; });
+    auto f = p.getFuture().then([](const int x) { return x + 1; });
+    for (int i = 1; i < 1000; ++i) {
+        f = f.then([](const int x) { return x + 1; });
+    }
+    EXPECT_FALSE(f.ready());
+    p.run();
+    EXPECT_EQ(f.result(), 1000);
+}
+
+// 测试sharedFuture上注册多个then，源仍然有效
+TEST(AsyncTest, SharedFutureMultipleThen) {
+    auto p = async::makePromise([] { return 10; });
+    const auto sf = p.getFuture().share();
+    auto f1 = sf.then([](const int& x) { return x + 1; });
+    auto f2 = sf.then([](const int x) { return x * 3; });
+    auto f3 = sf.then([](int) {});
+    runPromiseInThread(std::move(p));
+
+    EXPECT_EQ(f1.result(), 11);
+    EXPECT_EQ(f2.result(), 30);
+    EXPECT_NO_THROW(f3.result());
+    EXPECT_EQ(sf.result(), 10);
+}
+
+// 测试void future的then
+TEST(AsyncTest, VoidFutureThen) {
+    std::atomic<int> counter{0};
+    auto f = async::get([&counter] {
+        thread::sleep(milliseconds(50));
+        ++counter;
+    }).then([&counter] {
+        return counter.load() + 1;
+    });
+    EXPECT_EQ(f.result(), 2);
+}
+
+// 测试whenAll按输入顺序收集结果
+TEST(AsyncTest, WhenAllCollectsResultsInOrder) {
+    vector<async::sharedFuture<int>> futures;
+    for (int i = 0; i < 5; ++i) {
+        futures.pushEnd(async::get([i] {
+            thread::sleep(milliseconds(10 * (5 - i)));
+            return i * i;
+        }).share());
+    }
+
+    auto all = async::whenAll(futures);
+    const auto results = all.result();
+    ASSERT_EQ(results.size(), 5u);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(results.get(i), i * i);
+    }
+}
+
+// 测试whenAll传递第一个失败输入的异常
+TEST(AsyncTest, WhenAllPropagatesException) {
+    vector<async::sharedFuture<int>> futures;
+    futures.pushEnd(async::get([] { return 1; }).share());
+    futures.pushEnd(async::get([]() -> int { throw runTimeTestError("failed"); }).share());
+    futures.pushEnd(async::get([] { return 3; }).share());
+
+    auto all = async::whenAll(futures);
+    EXPECT_THROW(all.result(), runTimeTestError);
+}
+
+// 测试void输入和空输入的whenAll
+TEST(AsyncTest, WhenAllVoidAndEmpty) {
+    std::atomic<int> counter{0};
+    vector<async::sharedFuture<void>> futures;
+    for (int i = 0; i < 4; ++i) {
+        futures.pushEnd(async::get([&counter] {
+            thread::sleep(milliseconds(20));
+            ++counter;
+        }).share());
+    }
+    async::whenAll(futures).result();
+    EXPECT_EQ(counter.load(), 4);
+
+    auto empty = async::whenAll(vector<async::sharedFuture<int>>{});
+    EXPECT_TRUE(empty.ready());
+    EXPECT_EQ(empty.result().size(), 0u);
+}
+
+// 测试whenAny返回最先完成的输入下标
+TEST(AsyncTest, WhenAnyReturnsFirstReadyIndex) {
+    auto slow = async::makePromise([] { return 1; });
+    auto fast = async::makePromise([] { return 2; });
+    vector<async::sharedFuture<int>> futures;
+    futures.pushEnd(slow.getFuture().share());
+    futures.pushEnd(fast.getFuture().share());
+
+    auto any = async::whenAny(futures);
+    EXPECT_FALSE(any.ready());
+    fast.run();
+    EXPECT_EQ(any.result(), 1u);
+    slow.run();
+    EXPECT_EQ(futures.get(0).result(), 1);
+
+    EXPECT_THROW(async::whenAny(vector<async::sharedFuture<int>>{}), sysError);
+}
+
+// 测试协程co_await future时挂起，结果就绪后由完成线程恢复
+TEST(AsyncTest, CoAwaitFutureResumesOnCompletion) {
+    auto p = async::makePromise([] { return 6; });
+    auto source = p.getFuture();
+    auto f = async::spawn([](async::future<int>& in) -> coroutine::task<int> {
+        const int x = co_await in;
+        co_return x * 7;
+    }(source));
+
+    EXPECT_FALSE(f.ready());
+    p.run();
+    EXPECT_TRUE(f.ready());
+    EXPECT_EQ(f.result(), 42);
+}
+
+// 测试co_await sharedFuture与void future，以及异常传递
+TEST(AsyncTest, CoAwaitSharedAndVoidFutures) {
+    const auto shared = async::get([] {
+        thread::sleep(milliseconds(20));
+        return std::string("shared");
+    }).share();
+    auto failed = async::get([]() -> int { throw runTimeTestError("await failure"); });
+
+    auto f = async::spawn([](async::sharedFuture<std::string> sf, async::future<int> bad) -> coroutine::task<std::string> {
+        co_await async::get([] { thread::sleep(milliseconds(10)); });
+        std::string text = co_await sf;
+        try {
+            co_await bad;
+        } catch (const runTimeTestError&) {
+            text += "+caught";
+        }
+        co_return text;
+    }(shared, std::move(failed)));
+
+    EXPECT_EQ(f.result(), "shared+caught");
+    EXPECT_EQ(shared.result(), "shared");
+}
@@ -0,0 +1,267 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "concurrentMaps.h"
+
+using namespace original;
+
+// ========== 单线程行为测试 ==========
+TEST(ConcurrentJMapTest, BasicOperations) {
+    concurrentJMap<int, std::string> m;
+    EXPECT_EQ(m.size(), 0);
+    EXPECT_FALSE(m.containsKey(1));
+
+    EXPECT_TRUE(m.add(2, "two"));
+    EXPECT_TRUE(m.add(1, "one"));
+    EXPECT_TRUE(m.add(3, "three"));
+    EXPECT_FALSE(m.add(2, "again"));
+    EXPECT_EQ(m.size(), 3);
+
+    EXPECT_EQ(m.get(2), "two");
+    EXPECT_TRUE(m.contains(couple<const int, std::string>(1, "one")));
+    EXPECT_FALSE(m.contains(couple<const int, std::string>(1, "uno")));
+
+    EXPECT_TRUE(m.update(2, "deux"));
+    EXPECT_FALSE(m.update(4, "four"));
+    EXPECT_EQ(m[2], "deux");
+
+    EXPECT_THROW(m[4], noElementError);
+    EXPECT_TRUE(m.add(4, "four"));
+    EXPECT_EQ(m[4], "four");
+    EXPECT_EQ(m.size(), 4);
+
+    EXPECT_TRUE(m.remove(1));
+    EXPECT_FALSE(m.remove(1));
+    EXPECT_FALSE(m.containsKey(1));
+    EXPECT_THROW(m.get(1), noElementError);
+    EXPECT_EQ(m.size(), 3);
+}
+
+TEST(ConcurrentJMapTest, OrderedIteration) {
+    concurrentJMap<int, int> m;
+    std::mt19937 gen(7);
+    std::map<int, int> expected;
+    for (int i = 0; i < 2000; ++i) {
+        const int k = static_cast<int>(gen() % 5000);
+        m.add(k, k * 2);
+        expected.emplace(k, k * 2);
+    }
+
+    auto it = expected.begin();
+    for (auto& e : m) {
+        ASSERT_NE(it, expected.end());
+        EXPECT_EQ(e.first(), it->first);
+        EXPECT_EQ(e.second(), it->second);
+        ++it;
+    }
+    EXPECT_EQ(it, expected.end());
+    EXPECT_EQ(m.first().get().first(), expected.begin()->first);
+    EXPECT_EQ(m.last().get().first(), expected.rbegin()->first);
+}
+
+TEST(ConcurrentJMapTest, EmptyIterationAndToString) {
+    concurrentJMap<int, int> m;
+    int visited = 0;
+    for (auto& e : m) {
+        (void) e;
+        visited += 1;
+    }
+    EXPECT_EQ(visited, 0);
+    EXPECT_EQ(m.toString(false), "concurrentJMap()");
+
+    m.add(2, 20);
+    m.add(1, 10);
+    EXPECT_EQ(m.toString(false), "concurrentJMap({1: 10}, {2: 20})");
+}
+
+TEST(ConcurrentJMapTest, CopyTakesSnapshot) {
+    concurrentJMap<int, int> m;
+    for (int i = 0; i < 100; ++i) {
+        m.add(i, i);
+    }
+    concurrentJMap<int, int> copied(m);
+    m.remove(0);
+    m.update(1, -1);
+    EXPECT_EQ(copied.size(), 100);
+    EXPECT_EQ(copied.get(0), 0);
+    EXPECT_EQ(copied.get(1), 1);
+
+    concurrentJMap<int, int> assigned;
+    assigned.add(1000, 1000);
+    assigned = m;
+    EXPECT_EQ(assigned.size(), 99);
+    EXPECT_FALSE(assigned.containsKey(1000));
+    EXPECT_EQ(assigned.get(1), -1);
+}
+
+TEST(ConcurrentJMapTest, IteratorSurvivesRemoval) {
+    concurrentJMap<int, int> m;
+    for (int i = 0; i < 10; ++i) {
+        m.add(i, i);
+    }
+
+    // 迭代器指向的节点被删除后仍可读取，并能继续前进
+    auto it = m.begin();
+    it += 3;
+    EXPECT_EQ(it.get().first(), 3);
+    m.remove(3);
+    m.remove(4);
+    EXPECT_EQ(it.get().first(), 3);
+    it.next();
+    EXPECT_EQ(it.get().first(), 5);
+}
+
+// ========== 多线程测试 ==========
+TEST(ConcurrentJMapTest, ConcurrentDisjointInserts) {
+    constexpr int threads_cnt = 4;
+    constexpr int per_thread = 5000;
+    concurrentJMap<int, int> m;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_cnt; ++t) {
+        threads.emplace_back([&m, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                const int k = i * threads_cnt + t;
+                EXPECT_TRUE(m.add(k, -k));
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    EXPECT_EQ(m.size(), static_cast<u_integer>(threads_cnt * per_thread));
+    int expected = 0;
+    for (auto& e : m) {
+        EXPECT_EQ(e.first(), expected);
+        EXPECT_EQ(e.second(), -expected);
+        expected += 1;
+    }
+    EXPECT_EQ(expected, threads_cnt * per_thread);
+}
+
+TEST(ConcurrentJMapTest, ConcurrentMixedOperations) {
+    constexpr int threads_cnt = 4;
+    constexpr int ops = 20000;
+    constexpr int key_range = 512;
+    concurrentJMap<int, int> m;
+
+    // 每个线程统计自己成功的插入与删除次数
+    std::vector<long> added(threads_cnt), removed(threads_cnt);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_cnt; ++t) {
+        threads.emplace_back([&, t] {
+            std::mt19937 gen(t + 1);
+            for (int i = 0; i < ops; ++i) {
+                const int k = static_cast<int>(gen() % key_range);
+                switch (gen() % 4) {
+                    case 0:
+                    case 1:
+                        added[t] += m.add(k, k);
+                        break;
+                    case 2:
+                        removed[t] += m.remove(k);
+                        break;
+                    default:
+                        if (m.containsKey(k)) {
+                            m.update(k, k);
+                        }
+                        break;
+                }
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    long net = 0;
+    for (int t = 0; t < threads_cnt; ++t) {
+        net += added[t] - removed[t];
+    }
+    EXPECT_EQ(static_cast<long>(m.size()), net);
+
+    long visited = 0;
+    int prev = -1;
+    for (auto& e : m) {
+        EXPECT_LT(prev, e.first());
+        EXPECT_EQ(e.second(), e.first());
+        prev = e.first();
+        visited += 1;
+    }
+    EXPECT_EQ(visited, net);
+}
+
+TEST(ConcurrentJMapTest, ReadersSeeStableKeysDuringWrites) {
+    constexpr int stable = 256;
+    concurrentJMap<int, int> m;
+    for (int i = 0; i < stable; ++i) {
+        m.add(i * 2, i);
+    }
+
+    // 写线程只操作奇数键，读线程检查偶数键始终可见且遍历有序
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        std::mt19937 gen(99);
+        for (int i = 0; i < 50000; ++i) {
+            const int k = static_cast<int>(gen() % stable) * 2 + 1;
+            if (gen() % 2) {
+                m.add(k, k);
+            } else {
+                m.remove(k);
+            }
+        }
+        stop = true;
+    });
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!stop) {
+                for (int i = 0; i < stable; ++i) {
+                    ASSERT_TRUE(m.containsKey(i * 2));
+                    ASSERT_EQ(m.get(i * 2), i);
+                }
+                int evens = 0;
+                int prev = -1;
+                for (auto& e : m) {
+                    ASSERT_LT(prev, e.first());
+                    prev = e.first();
+                    evens += e.first() % 2 == 0;
+                }
+                ASSERT_EQ(evens, stable);
+            }
+        });
+    }
+
+    writer.join();
+    for (auto& th : readers) {
+        th.join();
+    }
+}
+
+TEST(ConcurrentJMapTest, ConcurrentUpdatesKeepValuesWhole) {
+    concurrentJMap<int, std::string> m;
+    m.add(0, std::string(64, 'a'));
+
+    // 更新整体替换值，读者不会看到混合的字符串
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        for (int i = 0; i < 20000; ++i) {
+            m.update(0, std::string(64, static_cast<char>('a' + i % 26)));
+        }
+        stop = true;
+    });
+    std::thread reader([&] {
+        while (!stop) {
+            const std::string v = m.get(0);
+            ASSERT_EQ(v.size(), 64u);
+            ASSERT_EQ(v, std::string(64, v[0]));
+        }
+    });
+    writer.join();
+    reader.join();
+}
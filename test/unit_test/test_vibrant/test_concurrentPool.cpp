@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "chain.h"
+#include "concurrentPool.h"
+#include "maps.h"
+#include "sets.h"
+
+using namespace original;
+
+namespace {
+    bool alignedTo(const void* ptr, const u_integer alignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+    }
+
+    // 一个 size class 中每个 slab 可切出的块数
+    u_integer blocksPerSlab(const u_integer block_size)
+    {
+        const u_integer first = (3 * sizeof(void*) + block_size - 1) / block_size * block_size;
+        return (concurrentPool::SLAB_SIZE - first) / block_size;
+    }
+}
+
+// ========== 单线程行为测试 ==========
+TEST(ConcurrentPoolTest, AllocateAndReuse) {
+    concurrentPool pool;
+    EXPECT_EQ(pool.allocate(0), nullptr);
+
+    void* p = pool.allocate(24);
+    ASSERT_NE(p, nullptr);
+    EXPECT_TRUE(alignedTo(p, 32));
+    pool.deallocate(p, 24);
+    EXPECT_EQ(pool.allocate(20), p);
+    pool.deallocate(p, 20);
+
+    const auto s = pool.stats();
+    EXPECT_EQ(s.allocations, 2);
+    EXPECT_EQ(s.deallocations, 2);
+    EXPECT_EQ(s.cache_hits, 1);
+    EXPECT_EQ(s.refills, 1);
+    EXPECT_EQ(s.slabs, 1);
+    EXPECT_EQ(s.thread_caches, 1);
+}
+
+TEST(ConcurrentPoolTest, SizeClassesAndLargeRequests) {
+    concurrentPool pool;
+    std::vector<std::pair<void*, u_integer>> blocks;
+    for (u_integer bytes = 1; bytes <= concurrentPool::MAX_BLOCK_SIZE; bytes = bytes * 2 + 1) {
+        void* p = pool.allocate(bytes);
+        u_integer block = concurrentPool::MIN_BLOCK_SIZE;
+        while (block < bytes) block *= 2;
+        EXPECT_TRUE(alignedTo(p, block));
+        std::memset(p, 0xAB, bytes);
+        blocks.emplace_back(p, bytes);
+    }
+    void* large = pool.allocate(concurrentPool::MAX_BLOCK_SIZE + 1);
+    std::memset(large, 0xCD, concurrentPool::MAX_BLOCK_SIZE + 1);
+    pool.deallocate(large, concurrentPool::MAX_BLOCK_SIZE + 1);
+    for (const auto& [p, bytes] : blocks) {
+        pool.deallocate(p, bytes);
+    }
+
+    const auto s = pool.stats();
+    EXPECT_EQ(s.large_allocations, 1);
+    EXPECT_EQ(s.allocations, blocks.size());
+    EXPECT_EQ(s.deallocations, blocks.size());
+}
+
+TEST(ConcurrentPoolTest, BatchTransfers) {
+    concurrentPool pool;
+    constexpr u_integer count = 1000;
+    std::vector<void*> blocks;
+    for (u_integer i = 0; i < count; ++i) {
+        blocks.push_back(pool.allocate(64));
+    }
+    auto s = pool.stats();
+    EXPECT_EQ(s.refills, (count + concurrentPool::BATCH_SIZE - 1) / concurrentPool::BATCH_SIZE);
+    EXPECT_EQ(s.cache_hits, count - s.refills);
+
+    for (void* p : blocks) {
+        pool.deallocate(p, 64);
+    }
+    s = pool.stats();
+    // 缓存超过两个批次时退回一个批次
+    EXPECT_EQ(s.flushes, (count - concurrentPool::BATCH_SIZE - 1) / concurrentPool::BATCH_SIZE);
+
+    pool.flushThreadCache();
+    s = pool.stats();
+    EXPECT_EQ(s.central_blocks, s.slabs * blocksPerSlab(64));
+}
+
+TEST(ConcurrentPoolTest, ForeignFreeReturnsToOwner) {
+    concurrentPool owner;
+    concurrentPool other;
+    void* p = owner.allocate(48);
+    other.deallocate(p, 48);
+
+    EXPECT_EQ(owner.stats().foreign_frees, 1);
+    EXPECT_EQ(owner.stats().deallocations, 1);
+    EXPECT_EQ(other.stats().deallocations, 0);
+    EXPECT_EQ(owner.allocate(48), p);
+    owner.deallocate(p, 48);
+}
+
+TEST(ConcurrentPoolTest, AllocatorHandles) {
+    concurrentPool pool;
+    concurrentPoolAllocator<int> alloc{pool};
+    const concurrentPoolAllocator<double> rebound{alloc};
+    EXPECT_EQ(&rebound.pool(), &pool);
+    EXPECT_EQ(&concurrentPoolAllocator<int>{}.pool(), &concurrentPool::shared());
+
+    int* values = alloc.allocate(100);
+    for (int i = 0; i < 100; ++i) values[i] = i;
+    EXPECT_EQ(values[99], 99);
+    alloc.deallocate(values, 100);
+    EXPECT_EQ(alloc.allocate(0), nullptr);
+    EXPECT_EQ(pool.stats().allocations, 1);
+}
+
+// ========== 多线程测试 ==========
+TEST(ConcurrentPoolTest, CrossThreadFree) {
+    concurrentPool pool;
+    constexpr int producers = 4;
+    constexpr int per_thread = 20000;
+    std::vector<std::vector<void*>> produced(producers);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&pool, &produced, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                auto p = static_cast<int*>(pool.allocate(sizeof(int) * (1 + i % 16)));
+                *p = t;
+                produced[t].push_back(p);
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    threads.clear();
+
+    // 由另一组线程释放
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&pool, &produced, t] {
+            const int source = (t + 1) % producers;
+            for (u_integer i = 0; i < produced[source].size(); ++i) {
+                EXPECT_EQ(*static_cast<int*>(produced[source][i]), source);
+                pool.deallocate(produced[source][i], sizeof(int) * (1 + i % 16));
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    // 线程退出时缓存已退回中心链表
+    const auto s = pool.stats();
+    EXPECT_EQ(s.allocations, producers * per_thread);
+    EXPECT_EQ(s.deallocations, producers * per_thread);
+    EXPECT_GT(s.flushes, 0);
+    u_integer carved = 0;
+    for (const u_integer block : {16u, 32u, 64u}) {
+        carved += blocksPerSlab(block);
+    }
+    EXPECT_GE(s.central_blocks, carved);
+    EXPECT_LE(s.thread_caches, 2 * producers);
+}
+
+TEST(ConcurrentPoolTest, ContainersAcrossThreads) {
+    constexpr int threads_cnt = 4;
+    constexpr int per_thread = 3000;
+    std::vector<chain<int, concurrentPoolAllocator<int>>*> chains(threads_cnt);
+    const auto before = concurrentPool::shared().stats();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_cnt; ++t) {
+        threads.emplace_back([&chains, t] {
+            hashMap<int, int, hash<int>, concurrentPoolAllocator<couple<const int, int>>> m;
+            treeSet<int, increaseComparator<int>, concurrentPoolAllocator<couple<const int, const bool>>> s;
+            auto c = new chain<int, concurrentPoolAllocator<int>>;
+            for (int i = 0; i < per_thread; ++i) {
+                m.add(i, i * t);
+                s.add(per_thread - i);
+                c->pushEnd(i + t);
+            }
+            EXPECT_EQ(m.size(), static_cast<u_integer>(per_thread));
+            EXPECT_EQ(m.get(per_thread - 1), (per_thread - 1) * t);
+            EXPECT_EQ(s.size(), static_cast<u_integer>(per_thread));
+            EXPECT_EQ(s.first().get(), 1);
+            for (int i = 0; i < per_thread; i += 2) {
+                m.remove(i);
+                s.remove(i + 1);
+            }
+            EXPECT_EQ(m.size(), static_cast<u_integer>(per_thread / 2));
+            chains[t] = c;
+        });
+    }
+    for (auto& th : threads) th.join();
+    threads.clear();
+
+    // 链表节点在另一个线程中释放
+    for (int t = 0; t < threads_cnt; ++t) {
+        threads.emplace_back([&chains, t] {
+            auto c = chains[(t + 1) % threads_cnt];
+            EXPECT_EQ(c->size(), static_cast<u_integer>(per_thread));
+            delete c;
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    const auto after = concurrentPool::shared().stats();
+    EXPECT_EQ(after.allocations - before.allocations, after.deallocations - before.deallocations);
+}
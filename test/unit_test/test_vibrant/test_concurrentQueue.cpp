@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+#include "concurrentQueue.h"
+
+using namespace original;
+
+// ========== 单线程行为测试 ==========
+TEST(ConcurrentQueueTest, TryPushPop) {
+    concurrentQueue<int> q{5};
+    EXPECT_EQ(q.capacity(), 8);
+    EXPECT_TRUE(q.empty());
+
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(q.tryPush(i));
+    }
+    EXPECT_FALSE(q.tryPush(8));
+    EXPECT_EQ(q.size(), 8);
+
+    int value = -1;
+    for (int round = 0; round < 100; ++round) {
+        // 位置不断前移，槽位在多轮之间复用
+        ASSERT_TRUE(q.tryPop(value));
+        ASSERT_EQ(value, round);
+        ASSERT_TRUE(q.tryPush(round + 8));
+    }
+    while (q.tryPop(value)) {}
+    EXPECT_EQ(value, 107);
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.tryPop(value));
+
+    EXPECT_THROW(concurrentQueue<int>{0}, valueError);
+    EXPECT_EQ(concurrentQueue<int>{1}.capacity(), 2);
+}
+
+TEST(ConcurrentQueueTest, Batches) {
+    concurrentQueue<std::string> q{16};
+    std::vector<std::string> in(20);
+    for (int i = 0; i < 20; ++i) {
+        in[i] = std::to_string(i);
+    }
+    EXPECT_EQ(q.pushBatch(in.data(), 10), 10);
+    EXPECT_EQ(q.pushBatch(in.data() + 10, 10), 6);
+    EXPECT_EQ(q.pushBatch(in.data(), 0), 0);
+
+    std::vector<std::string> out(20);
+    EXPECT_EQ(q.popBatch(out.data(), 4), 4);
+    EXPECT_EQ(out[3], "3");
+    EXPECT_EQ(q.popBatch(out.data() + 4, 20), 12);
+    EXPECT_EQ(out[15], "15");
+    EXPECT_EQ(q.popBatch(out.data(), 20), 0);
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(ConcurrentQueueTest, TimedOperations) {
+    concurrentQueue<int, queueMode::SPSC> q{2};
+    int value = 0;
+    const auto start = time::point::now();
+    EXPECT_FALSE(q.popFor(value, time::duration(50)));
+    EXPECT_GE((time::point::now() - start).value(), 40);
+
+    EXPECT_TRUE(q.pushFor(1, time::duration(50)));
+    EXPECT_TRUE(q.pushFor(2, time::duration(50)));
+    EXPECT_FALSE(q.pushFor(3, time::duration(20)));
+    EXPECT_TRUE(q.popFor(value, time::duration(50)));
+    EXPECT_EQ(value, 1);
+}
+
+// ========== 多线程测试 ==========
+TEST(ConcurrentQueueTest, MPMCStress) {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int per_thread = 50000;
+    concurrentQueue<long long> q{64};
+    std::vector<std::vector<long long>> received(consumers);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&q, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                q.push(static_cast<long long>(t) * per_thread + i);
+            }
+        });
+    }
+    for (int t = 0; t < consumers; ++t) {
+        threads.emplace_back([&q, &received, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                received[t].push_back(q.pop());
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    EXPECT_TRUE(q.empty());
+
+    long long sum = 0;
+    for (const auto& values : received) {
+        // 每个消费者看到的同一生产者元素保持顺序
+        std::vector<long long> last(producers, -1);
+        for (const long long v : values) {
+            const auto producer = v / per_thread;
+            ASSERT_GT(v, last[producer]);
+            last[producer] = v;
+            sum += v;
+        }
+    }
+    constexpr long long total = static_cast<long long>(producers) * per_thread;
+    EXPECT_EQ(sum, total * (total - 1) / 2);
+}
+
+TEST(ConcurrentQueueTest, MPMCBatches) {
+    constexpr int producers = 3;
+    constexpr int per_thread = 30000;
+    concurrentQueue<int> q{32};
+    std::vector<int> counts(producers * per_thread, 0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&q, t] {
+            std::vector<int> batch(7);
+            int next = 0;
+            while (next < per_thread) {
+                const int n = std::min(7, per_thread - next);
+                for (int i = 0; i < n; ++i) batch[i] = t * per_thread + next + i;
+                const u_integer pushed = q.pushBatch(batch.data(), n);
+                if (pushed == 0) std::this_thread::yield();
+                next += static_cast<int>(pushed);
+            }
+        });
+    }
+    threads.emplace_back([&q, &counts] {
+        std::vector<int> batch(5);
+        int received = 0;
+        while (received < producers * per_thread) {
+            const u_integer popped = q.popBatch(batch.data(), 5);
+            if (popped == 0) std::this_thread::yield();
+            for (u_integer i = 0; i < popped; ++i) counts[batch[i]] += 1;
+            received += static_cast<int>(popped);
+        }
+    });
+    for (auto& th : threads) th.join();
+
+    for (const int c : counts) {
+        ASSERT_EQ(c, 1);
+    }
+}
+
+TEST(ConcurrentQueueTest, SPSCOrder) {
+    constexpr int count = 200000;
+    concurrentQueue<int, queueMode::SPSC> q{16};
+    std::thread producer([&q] {
+        for (int i = 0; i < count; ++i) q.push(i);
+    });
+    bool ordered = true;
+    for (int i = 0; i < count; ++i) {
+        if (q.pop() != i) ordered = false;
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(ConcurrentQueueTest, MPSCOrder) {
+    constexpr int producers = 4;
+    constexpr int per_thread = 40000;
+    concurrentQueue<int, queueMode::MPSC> q{8};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&q, t] {
+            for (int i = 0; i < per_thread; ++i) q.push(t * per_thread + i);
+        });
+    }
+    std::vector<int> last(producers, -1);
+    bool ordered = true;
+    for (int i = 0; i < producers * per_thread; ++i) {
+        const int v = q.pop();
+        if (v <= last[v / per_thread]) ordered = false;
+        last[v / per_thread] = v;
+    }
+    for (auto& th : threads) th.join();
+    EXPECT_TRUE(ordered);
+    for (int t = 0; t < producers; ++t) {
+        EXPECT_EQ(last[t], (t + 1) * per_thread - 1);
+    }
+}
+
+TEST(ConcurrentQueueTest, BlockedConsumersWake) {
+    concurrentQueue<int> q{4};
+    std::vector<int> got(3, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([&q, &got, t] {
+            got[t] = q.pop();
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    for (int i = 1; i <= 3; ++i) q.push(i);
+    for (auto& th : threads) th.join();
+    EXPECT_EQ(std::accumulate(got.begin(), got.end(), 0), 6);
+}
@@ -1,3 +1,4 @@
+#include "async.h"
 #include "coroutines.h"
 #include <gtest/gtest.h>
 #include <vector>
@@ -271,4 +272,65 @@ TEST(GeneratorTest, MemoryManagement) {
         }
     }
     // 如果测试通过，说明没有内存泄漏
-}
\ No newline at end of file
+}
+namespace {
+    coroutine::task<int> square(const int x) {
+        co_return x * x;
+    }
+
+    coroutine::task<void> failing() {
+        throw std::runtime_error("task failed");
+        co_return;
+    }
+}
+
+// 测试任务惰性启动以及嵌套co_await
+TEST(TaskTest, LazyStartAndNestedAwait) {
+    bool started = false;
+    // 闭包对象必须比协程活得更久
+    auto body = [&started]() -> coroutine::task<int> {
+        started = true;
+        const int a = co_await square(3);
+        const int b = co_await square(4);
+        co_return a + b;
+    };
+    auto outer = body();
+
+    EXPECT_TRUE(outer.valid());
+    EXPECT_FALSE(started);
+
+    auto f = async::spawn(std::move(outer));
+    EXPECT_TRUE(started);
+    EXPECT_FALSE(outer.valid());
+    EXPECT_TRUE(f.ready());
+    EXPECT_EQ(f.result(), 25);
+}
+
+// 测试任务中的异常在co_await处重新抛出
+TEST(TaskTest, ExceptionPropagatesThroughAwait) {
+    auto caught = []() -> coroutine::task<std::string> {
+        try {
+            co_await failing();
+        } catch (const std::runtime_error& e) {
+            co_return std::string(e.what());
+        }
+        co_return std::string("not thrown");
+    };
+    EXPECT_EQ(async::spawn(caught()).result(), "task failed");
+
+    auto f = async::spawn(failing());
+    EXPECT_THROW(f.result(), std::runtime_error);
+    EXPECT_THROW(async::spawn(coroutine::task<int>{}), sysError);
+}
+
+// 测试大量顺序co_await不会增长调用栈
+TEST(TaskTest, ManySequentialAwaits) {
+    auto sum = []() -> coroutine::task<long long> {
+        long long total = 0;
+        for (int i = 0; i < 100000; ++i) {
+            total += co_await square(i % 10);
+        }
+        co_return total;
+    };
+    EXPECT_EQ(async::spawn(sum()).result(), 10000LL * 285);
+}
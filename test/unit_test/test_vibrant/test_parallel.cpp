@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "array.h"
+#include "comparator.h"
+#include "parallel.h"
+#include "vector.h"
+
+using namespace original;
+
+namespace {
+    // 生成固定种子的随机数据，保证测试可重复
+    original::vector<int> randomInts(const u_integer n, const int bound) {
+        std::mt19937 gen(42);
+        std::uniform_int_distribution dist(0, bound);
+        original::vector<int> v;
+        for (u_integer i = 0; i < n; ++i) {
+            v.pushEnd(dist(gen));
+        }
+        return v;
+    }
+
+    std::vector<int> toStd(const original::vector<int>& v) {
+        std::vector<int> out;
+        for (u_integer i = 0; i < v.size(); ++i) {
+            out.push_back(v.get(i));
+        }
+        return out;
+    }
+}
+
+// 测试 forEach / transform 覆盖所有元素
+TEST(ParallelTest, ForEachAndTransform) {
+    taskDelegator pool(4);
+    original::vector<int> v;
+    for (int i = 0; i < 100000; ++i) {
+        v.pushEnd(i);
+    }
+
+    parallel::forEach(pool, v, [](int& e) { e *= 2; }, 1000);
+    for (u_integer i = 0; i < v.size(); ++i) {
+        ASSERT_EQ(v.get(i), 2 * static_cast<int>(i));
+    }
+
+    original::array<long long> out(v.size());
+    parallel::transform(pool, v, out, [](const int& e) { return static_cast<long long>(e) + 1; });
+    for (u_integer i = 0; i < out.size(); ++i) {
+        ASSERT_EQ(out.get(i), 2LL * i + 1);
+    }
+
+    original::array<long long> small(10);
+    EXPECT_THROW(parallel::transform(pool, v, small, [](const int& e) { return static_cast<long long>(e); }),
+                 outOfBoundError);
+}
+
+// 测试 reduce 按块顺序合并，非交换运算结果也确定
+TEST(ParallelTest, ReduceIsDeterministic) {
+    taskDelegator pool(4);
+    const auto v = randomInts(50000, 1000);
+    const auto expected = toStd(v);
+    EXPECT_EQ(parallel::reduce(pool, v, 7, std::plus<int>{}, 333),
+              std::accumulate(expected.begin(), expected.end(), 7));
+
+    // 字符串拼接满足结合律但不满足交换律
+    original::vector<std::string> words;
+    std::string joined = ">";
+    for (int i = 0; i < 2000; ++i) {
+        words.pushEnd(std::to_string(i));
+        joined += std::to_string(i);
+    }
+    EXPECT_EQ(parallel::reduce(pool, words, std::string{">"}, std::plus<std::string>{}, 17), joined);
+
+    const original::vector<int> empty;
+    EXPECT_EQ(parallel::reduce(pool, empty, 5, std::plus<int>{}), 5);
+}
+
+// 测试 count / find，find 返回第一个匹配位置
+TEST(ParallelTest, CountAndFind) {
+    taskDelegator pool(4);
+    original::vector<int> v;
+    for (int i = 0; i < 200000; ++i) {
+        v.pushEnd(i % 100);
+    }
+
+    EXPECT_EQ(parallel::count(pool, v, 42, 1024), 2000u);
+    EXPECT_EQ(parallel::count(pool, v, [](const int& e) { return e < 10; }), 20000u);
+
+    EXPECT_EQ(parallel::find(pool, v, 99, 512), 99u);
+    EXPECT_EQ(parallel::find(pool, v, [](const int& e) { return e == 50; }, 7), 50u);
+    EXPECT_EQ(parallel::find(pool, v, 1000), v.size());
+
+    // 匹配只出现在末尾附近时也要找到最早的那个
+    v[150001] = -1;
+    v[199999] = -1;
+    EXPECT_EQ(parallel::find(pool, v, -1, 100), 150001u);
+}
+
+// 测试并行排序与 std::sort 结果一致
+TEST(ParallelTest, SortMatchesSequential) {
+    taskDelegator pool(4);
+    for (const u_integer grain : {1u, 3u, 1000u, 4096u, 0u}) {
+        auto v = randomInts(30001, 1 << 20);
+        auto expected = toStd(v);
+        std::sort(expected.begin(), expected.end());
+        parallel::sort(pool, v, increaseComparator<int>{}, false, grain);
+        EXPECT_EQ(toStd(v), expected) << "grain " << grain;
+    }
+
+    auto desc = randomInts(10000, 100);
+    auto expected = toStd(desc);
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+    parallel::sort(pool, desc, decreaseComparator<int>{}, false, 999);
+    EXPECT_EQ(toStd(desc), expected);
+}
+
+// 测试 stableSort 保持相等元素原有顺序，且与粒度无关
+TEST(ParallelTest, StableSortIsDeterministic) {
+    taskDelegator pool(4);
+    const auto keys = randomInts(20000, 50);
+    std::vector<std::pair<int, int>> expected;
+    for (u_integer i = 0; i < keys.size(); ++i) {
+        expected.emplace_back(keys.get(i), static_cast<int>(i));
+    }
+    // 第二分量为原始下标，按 (键, 下标) 排序即为稳定排序的结果
+    std::ranges::sort(expected);
+
+    for (const u_integer grain : {1u, 64u, 777u, 0u}) {
+        original::vector<std::pair<int, int>> v;
+        for (u_integer i = 0; i < keys.size(); ++i) {
+            v.pushEnd({keys.get(i), static_cast<int>(i)});
+        }
+        parallel::stableSort(pool, v, [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+            return a.first < b.first;
+        }, grain);
+        for (u_integer i = 0; i < v.size(); ++i) {
+            ASSERT_EQ(v.get(i), expected[i]) << "grain " << grain << " index " << i;
+        }
+    }
+}
+
+// 测试回调异常会传回调用者，且线程池仍可继续使用
+TEST(ParallelTest, ExceptionPropagates) {
+    taskDelegator pool(4);
+    original::vector<int> v;
+    for (int i = 0; i < 10000; ++i) {
+        v.pushEnd(i);
+    }
+    EXPECT_THROW(parallel::forEach(pool, v, [](int& e) {
+        if (e == 5000) throw std::runtime_error("boom");
+    }, 100), std::runtime_error);
+    EXPECT_EQ(parallel::count(pool, v, [](const int& e) { return e % 2 == 0; }, 100), 5000u);
+}
+
+// 测试在工作线程内部嵌套调用，以及线程池停止后仍由调用者完成
+TEST(ParallelTest, NestedCallAndStoppedPool) {
+    taskDelegator pool(1);
+    auto v = randomInts(5000, 1000);
+    auto expected = toStd(v);
+    std::sort(expected.begin(), expected.end());
+
+    // 唯一的工作线程在等待嵌套调用，调用者自身必须能完成所有块
+    pool.submit([&] {
+        parallel::sort(pool, v, increaseComparator<int>{}, false, 100);
+    }).result();
+    EXPECT_EQ(toStd(v), expected);
+
+    pool.stop();
+    original::vector<int> w;
+    for (int i = 0; i < 1000; ++i) {
+        w.pushEnd(1);
+    }
+    EXPECT_EQ(parallel::reduce(pool, w, 0, std::plus<int>{}, 10), 1000);
+}
@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <array>
+#include <numeric>
+#include <thread>
 #include "tasks.h"
 #include "thread.h"
 
@@ -763,3 +766,266 @@ TEST(TaskDelegatorTest, StressTestMixedTasks) {
     EXPECT_EQ(deferred_sum.load(), expected_deferred_sum);
     EXPECT_EQ(immediate_sum.load(), immediate_task_submitted ? expected_immediate_sum : 0);
 }
+
+// 测试工作窃取模式下的基本提交
+TEST(TaskDelegatorTest, WorkStealingSubmitTasks) {
+    taskDelegator delegator(4, taskDelegator::WORK_STEALING);
+    EXPECT_EQ(delegator.mode(), taskDelegator::WORK_STEALING);
+
+    std::vector<async::future<int>> futures;
+    for (int i = 0; i < 100; ++i) {
+        futures.emplace_back(delegator.submit([i]{ return i * 2; }));
+    }
+
+    int sum = 0;
+    for (auto& f : futures) {
+        sum += f.result();
+    }
+    EXPECT_EQ(sum, 99 * 100);
+}
+
+// 测试工作线程内部提交的任务进入本地队列并全部执行
+TEST(TaskDelegatorTest, WorkStealingNestedSubmit) {
+    taskDelegator delegator(4, taskDelegator::WORK_STEALING);
+
+    constexpr int parents = 8;
+    constexpr int children = 100;
+    std::vector<async::future<std::vector<async::future<int>>>> parent_futures;
+
+    for (int p = 0; p < parents; ++p) {
+        parent_futures.emplace_back(delegator.submit([&delegator] {
+            std::vector<async::future<int>> child_futures;
+            for (int c = 0; c < children; ++c) {
+                child_futures.emplace_back(delegator.submit([c]{ return c; }));
+            }
+            return child_futures;
+        }));
+    }
+
+    int sum = 0;
+    for (auto& pf : parent_futures) {
+        for (auto& cf : pf.result()) {
+            sum += cf.result();
+        }
+    }
+    EXPECT_EQ(sum, parents * (children - 1) * children / 2);
+}
+
+// 测试阻塞的工作线程本地队列中的任务会被其他线程窃取
+TEST(TaskDelegatorTest, WorkStealingStealsFromBlockedWorker) {
+    taskDelegator delegator(4, taskDelegator::WORK_STEALING);
+
+    std::atomic executed{0};
+    auto parent = delegator.submit([&delegator, &executed] {
+        std::vector<async::future<void>> child_futures;
+        for (int c = 0; c < 32; ++c) {
+            child_futures.emplace_back(delegator.submit([&executed]{ ++executed; }));
+        }
+        // 父任务阻塞当前工作线程，子任务只能被其他线程窃取执行
+        for (auto& cf : child_futures) {
+            cf.result();
+        }
+        return executed.load();
+    });
+
+    EXPECT_EQ(parent.result(), 32);
+    // 结果就绪后工作线程才离开任务，稍等活跃计数归零
+    for (int i = 0; i < 100 && delegator.activeThreads() != 0; ++i) {
+        thread::sleep(milliseconds(10));
+    }
+    EXPECT_EQ(delegator.activeThreads(), 0);
+}
+
+// 测试工作窃取模式下的优先级与停止模式
+TEST(TaskDelegatorTest, WorkStealingPrioritiesAndStopModes) {
+    taskDelegator delegator(2, taskDelegator::WORK_STEALING);
+
+    std::atomic executed{0};
+    std::vector<async::future<int>> futures;
+    futures.emplace_back(delegator.submit(taskDelegator::HIGH, [&executed]{ return ++executed; }));
+    futures.emplace_back(delegator.submit(taskDelegator::LOW, [&executed]{ return ++executed; }));
+    for (int i = 0; i < 3; ++i) {
+        futures.emplace_back(delegator.submit(taskDelegator::DEFERRED, [&executed]{ return ++executed; }));
+    }
+    EXPECT_EQ(delegator.deferredCnt(), 3);
+
+    delegator.stop(taskDelegator::RUN_DEFERRED);
+    for (auto& f : futures) {
+        f.result();
+    }
+    EXPECT_EQ(executed.load(), 5);
+    EXPECT_EQ(delegator.deferredCnt(), 0);
+
+    EXPECT_THROW({
+        delegator.submit([]{ return 0; });
+    }, sysError);
+}
+
+// 测试工作窃取模式下的异常传播
+TEST(TaskDelegatorTest, WorkStealingExceptionPropagation) {
+    taskDelegator delegator(2, taskDelegator::WORK_STEALING);
+
+    auto f = delegator.submit([&delegator] {
+        auto inner = delegator.submit([]{
+            throw std::runtime_error("Inner exception");
+        });
+        inner.result();
+    });
+
+    EXPECT_THROW(f.result(), std::runtime_error);
+}
+
+// 测试稳定状态下提交返回int的任务不产生堆分配
+TEST(TaskDelegatorTest, SubmitWithoutHeapAllocationInSteadyState) {
+    taskDelegator delegator(2);
+    for (int i = 0; i < 256; ++i) {
+        delegator.submit([i]{ return i; }).result();
+    }
+
+    const auto before = delegator.poolStats();
+    int sum = 0;
+    for (int i = 0; i < 1000; ++i) {
+        sum += delegator.submit([i]{ return i; }).result();
+    }
+    const auto after = delegator.poolStats();
+
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+    // 峰值不变说明池没有向堆申请新的块
+    EXPECT_EQ(after.peak_blocks, before.peak_blocks);
+    EXPECT_EQ(after.heap_tasks, 0u);
+}
+
+// 测试超出任务槽大小的可调用对象回退到堆分配
+TEST(TaskDelegatorTest, SubmitOversizedCallable) {
+    taskDelegator delegator(2);
+    std::array<int, 256> big{};
+    big.fill(1);
+
+    auto f = delegator.submit([big]{ return std::accumulate(big.begin(), big.end(), 0); });
+    EXPECT_EQ(f.result(), 256);
+    EXPECT_EQ(delegator.poolStats().heap_tasks, 1u);
+}
+
+// 测试future可以比任务委派器存活更久
+TEST(TaskDelegatorTest, FutureOutlivesDelegator) {
+    async::future<int> f;
+    async::sharedFuture<void> sf;
+    {
+        taskDelegator delegator(1);
+        f = delegator.submit([]{ return 42; });
+        sf = delegator.submit([]{}).share();
+    }
+    EXPECT_EQ(f.result(), 42);
+    EXPECT_NO_THROW(sf.result());
+}
+
+// 测试then将后续回调投递到任务委派器的工作线程执行
+TEST(TaskDelegatorTest, ThenPostsContinuationToDelegator) {
+    taskDelegator delegator(2);
+    auto p = async::makePromise([] { return 20; });
+    auto f = p.getFuture().then(delegator, [](const int x) {
+        return std::make_pair(x + 1, std::this_thread::get_id());
+    });
+    p.run();
+
+    const auto [value, id] = f.result();
+    EXPECT_EQ(value, 21);
+    EXPECT_NE(id, std::this_thread::get_id());
+}
+
+// 测试单个工作线程上的任务链不会因等待前序任务而死锁
+TEST(TaskDelegatorTest, ThenChainsOnSingleWorker) {
+    taskDelegator delegator(1);
+    auto f = delegator.submit([] { return 1; })
+        .then(delegator, [](const int x) { return x * 10; })
+        .then(delegator, [](const int x) { return x + 5; })
+        .then(delegator, [](const int x) { return std::to_string(x); });
+    EXPECT_EQ(f.result(), "15");
+}
+
+// 测试委派器已停止时then得到的future收到异常
+TEST(TaskDelegatorTest, ThenOnStoppedDelegatorReportsError) {
+    taskDelegator delegator(1);
+    delegator.stop();
+    auto p = async::makePromise([] { return 1; });
+    auto f = p.getFuture().share().then(delegator, [](const int x) { return x; });
+    p.run();
+    EXPECT_THROW(f.result(), sysError);
+}
+
+// 测试schedule()将协程转移到工作线程上继续执行
+TEST(TaskDelegatorTest, ScheduleResumesOnWorker) {
+    taskDelegator delegator(2);
+    auto f = async::spawn([](taskDelegator& d) -> coroutine::task<std::thread::id> {
+        co_await d.schedule();
+        co_return std::this_thread::get_id();
+    }(delegator));
+    EXPECT_NE(f.result(), std::this_thread::get_id());
+}
+
+// 测试少量工作线程上同时运行大量协程
+TEST(TaskDelegatorTest, ManyCoroutinesOnSmallPool) {
+    taskDelegator delegator(2);
+    constexpr int count = 2000;
+    vector<async::sharedFuture<int>> futures;
+    for (int i = 0; i < count; ++i) {
+        futures.pushEnd(async::spawn([](taskDelegator& d, const int id) -> coroutine::task<int> {
+            co_await d.schedule();
+            const int doubled = co_await d.submit([id] { return id * 2; });
+            co_await d.schedule(taskDelegator::HIGH);
+            co_return doubled + 1;
+        }(delegator, i)).share());
+    }
+
+    const auto results = async::whenAll(futures).result();
+    long long sum = 0;
+    for (u_integer i = 0; i < results.size(); ++i) {
+        sum += results.get(i);
+    }
+    EXPECT_EQ(sum, static_cast<long long>(count) * (count - 1) + count);
+}
+
+// 测试在已停止的委派器上schedule()时协程收到异常
+TEST(TaskDelegatorTest, ScheduleOnStoppedDelegatorThrows) {
+    taskDelegator delegator(1);
+    delegator.stop();
+    auto f = async::spawn([](taskDelegator& d) -> coroutine::task<void> {
+        co_await d.schedule();
+    }(delegator));
+    EXPECT_THROW(f.result(), sysError);
+}
+
+// 测试恢复协程的延迟任务在停止时被丢弃，协程收到异常而不是泄漏
+TEST(TaskDelegatorTest, ScheduleDiscardedOnStopThrows) {
+    taskDelegator delegator(1);
+    bool unwound = false;
+    auto f = async::spawn([](taskDelegator& d, bool& flag) -> coroutine::task<int> {
+        struct guard {
+            bool& flag;
+            ~guard() { flag = true; }
+        } g{flag};
+        co_await d.schedule(taskDelegator::DEFERRED);
+        co_return 1;
+    }(delegator, unwound));
+    delegator.stop(taskDelegator::DISCARD_DEFERRED);
+    EXPECT_THROW(f.result(), sysError);
+    EXPECT_TRUE(unwound);
+}
+
+// 测试被丢弃的恢复任务让等待子协程的父协程收到异常
+TEST(TaskDelegatorTest, ScheduleDiscardedReachesParent) {
+    taskDelegator delegator(1);
+    auto child = [](taskDelegator& d) -> coroutine::task<int> {
+        co_await d.schedule(taskDelegator::DEFERRED);
+        co_return 1;
+    };
+    auto f = async::spawn([](taskDelegator& d, auto make_child) -> coroutine::task<int> {
+        try {
+            co_return co_await make_child(d);
+        } catch (const sysError&) {
+            co_return -1;
+        }
+    }(delegator, child));
+    delegator.stop(taskDelegator::DISCARD_DEFERRED);
+    EXPECT_EQ(f.result(), -1);
+}